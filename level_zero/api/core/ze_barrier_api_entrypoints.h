@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/device/device.h"
 #include <level_zero/ze_api.h>
@@ -17,7 +19,8 @@ ze_result_t zeCommandListAppendBarrier(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendMemoryRangesBarrier(
@@ -28,18 +31,21 @@ ze_result_t zeCommandListAppendMemoryRangesBarrier(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &numRanges, &pRangeSizes, &pRanges, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents));
 }
 
 ze_result_t zeDeviceSystemBarrier(
     ze_device_handle_t hDevice) {
-    return L0::Device::fromHandle(hDevice)->systemBarrier();
+    API_FLIGHT_RECORDER_ENTER(&hDevice);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->systemBarrier());
 }
 
 ze_result_t ZE_APICALL zeCommandListHostSynchronize(
     ze_command_list_handle_t hCommandList,
     uint64_t timeout) {
-    return L0::CommandList::fromHandle(hCommandList)->hostSynchronize(timeout);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &timeout);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->hostSynchronize(timeout));
 }
 
 } // namespace L0
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/context/context.h"
 #include <level_zero/ze_api.h>
@@ -19,7 +21,8 @@ ze_result_t zeCommandListCreate(
     ze_device_handle_t hDevice,
     const ze_command_list_desc_t *desc,
     ze_command_list_handle_t *phCommandList) {
-    return L0::Context::fromHandle(hContext)->createCommandList(hDevice, desc, phCommandList);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &desc, &phCommandList);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createCommandList(hDevice, desc, phCommandList));
 }
 
 ze_result_t zeCommandListCreateImmediate(
@@ -27,22 +30,26 @@ ze_result_t zeCommandListCreateImmediate(
     ze_device_handle_t hDevice,
     const ze_command_queue_desc_t *altdesc,
     ze_command_list_handle_t *phCommandList) {
-    return L0::Context::fromHandle(hContext)->createCommandListImmediate(hDevice, altdesc, phCommandList);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &altdesc, &phCommandList);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createCommandListImmediate(hDevice, altdesc, phCommandList));
 }
 
 ze_result_t zeCommandListDestroy(
     ze_command_list_handle_t hCommandList) {
-    return L0::CommandList::fromHandle(hCommandList)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hCommandList);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->destroy());
 }
 
 ze_result_t zeCommandListClose(
     ze_command_list_handle_t hCommandList) {
-    return L0::CommandList::fromHandle(hCommandList)->close();
+    API_FLIGHT_RECORDER_ENTER(&hCommandList);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->close());
 }
 
 ze_result_t zeCommandListReset(
     ze_command_list_handle_t hCommandList) {
-    return L0::CommandList::fromHandle(hCommandList)->reset();
+    API_FLIGHT_RECORDER_ENTER(&hCommandList);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->reset());
 }
 
 ze_result_t zeCommandListAppendWriteGlobalTimestamp(
@@ -51,7 +58,8 @@ ze_result_t zeCommandListAppendWriteGlobalTimestamp(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &dstptr, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents));
 }
 
 ze_result_t zeCommandListAppendQueryKernelTimestamps(
@@ -63,37 +71,43 @@ ze_result_t zeCommandListAppendQueryKernelTimestamps(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &numEvents, &phEvents, &dstptr, &pOffsets, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents));
 }
 
 ze_result_t zeCommandListGetDeviceHandle(
     ze_command_list_handle_t hCommandList,
     ze_device_handle_t *phDevice) {
-    return L0::CommandList::fromHandle(hCommandList)->getDeviceHandle(phDevice);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &phDevice);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->getDeviceHandle(phDevice));
 }
 
 ze_result_t zeCommandListGetContextHandle(
     ze_command_list_handle_t hCommandList,
     ze_context_handle_t *phContext) {
-    return L0::CommandList::fromHandle(hCommandList)->getContextHandle(phContext);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &phContext);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->getContextHandle(phContext));
 }
 
 ze_result_t zeCommandListGetOrdinal(
     ze_command_list_handle_t hCommandList,
     uint32_t *pOrdinal) {
-    return L0::CommandList::fromHandle(hCommandList)->getOrdinal(pOrdinal);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &pOrdinal);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->getOrdinal(pOrdinal));
 }
 
 ze_result_t zeCommandListImmediateGetIndex(
     ze_command_list_handle_t hCommandListImmediate,
     uint32_t *pIndex) {
-    return L0::CommandList::fromHandle(hCommandListImmediate)->getImmediateIndex(pIndex);
+    API_FLIGHT_RECORDER_ENTER(&hCommandListImmediate, &pIndex);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandListImmediate)->getImmediateIndex(pIndex));
 }
 
 ze_result_t zeCommandListIsImmediate(
     ze_command_list_handle_t hCommandList,
     ze_bool_t *pIsImmediate) {
-    return L0::CommandList::fromHandle(hCommandList)->isImmediate(pIsImmediate);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &pIsImmediate);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->isImmediate(pIsImmediate));
 }
 
 ze_result_t zeCommandListImmediateAppendCommandListsExp(
@@ -103,7 +117,8 @@ ze_result_t zeCommandListImmediateAppendCommandListsExp(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandListImmediate)->appendCommandLists(numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents);
+    API_FLIGHT_RECORDER_ENTER(&hCommandListImmediate, &numCommandLists, &phCommandLists, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandListImmediate)->appendCommandLists(numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents));
 }
 
 } // namespace L0
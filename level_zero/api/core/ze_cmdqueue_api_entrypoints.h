@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 #include "level_zero/core/source/context/context.h"
 #include <level_zero/ze_api.h>
@@ -17,12 +19,14 @@ ze_result_t zeCommandQueueCreate(
     ze_device_handle_t hDevice,
     const ze_command_queue_desc_t *desc,
     ze_command_queue_handle_t *phCommandQueue) {
-    return L0::Context::fromHandle(hContext)->createCommandQueue(hDevice, desc, phCommandQueue);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &desc, &phCommandQueue);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createCommandQueue(hDevice, desc, phCommandQueue));
 }
 
 ze_result_t zeCommandQueueDestroy(
     ze_command_queue_handle_t hCommandQueue) {
-    return L0::CommandQueue::fromHandle(hCommandQueue)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hCommandQueue);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandQueue::fromHandle(hCommandQueue)->destroy());
 }
 
 ze_result_t zeCommandQueueExecuteCommandLists(
@@ -30,25 +34,29 @@ ze_result_t zeCommandQueueExecuteCommandLists(
     uint32_t numCommandLists,
     ze_command_list_handle_t *phCommandLists,
     ze_fence_handle_t hFence) {
-    return L0::CommandQueue::fromHandle(hCommandQueue)->executeCommandLists(numCommandLists, phCommandLists, hFence, true, nullptr, 0, nullptr);
+    API_FLIGHT_RECORDER_ENTER(&hCommandQueue, &numCommandLists, &phCommandLists, &hFence);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandQueue::fromHandle(hCommandQueue)->executeCommandLists(numCommandLists, phCommandLists, hFence, true, nullptr, 0, nullptr));
 }
 
 ze_result_t zeCommandQueueSynchronize(
     ze_command_queue_handle_t hCommandQueue,
     uint64_t timeout) {
-    return L0::CommandQueue::fromHandle(hCommandQueue)->synchronize(timeout);
+    API_FLIGHT_RECORDER_ENTER(&hCommandQueue, &timeout);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandQueue::fromHandle(hCommandQueue)->synchronize(timeout));
 }
 
 ze_result_t zeCommandQueueGetOrdinal(
     ze_command_queue_handle_t hCommandQueue,
     uint32_t *pOrdinal) {
-    return L0::CommandQueue::fromHandle(hCommandQueue)->getOrdinal(pOrdinal);
+    API_FLIGHT_RECORDER_ENTER(&hCommandQueue, &pOrdinal);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandQueue::fromHandle(hCommandQueue)->getOrdinal(pOrdinal));
 }
 
 ze_result_t zeCommandQueueGetIndex(
     ze_command_queue_handle_t hCommandQueue,
     uint32_t *pIndex) {
-    return L0::CommandQueue::fromHandle(hCommandQueue)->getIndex(pIndex);
+    API_FLIGHT_RECORDER_ENTER(&hCommandQueue, &pIndex);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandQueue::fromHandle(hCommandQueue)->getIndex(pIndex));
 }
 
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include <level_zero/ze_api.h>
@@ -16,7 +18,8 @@ ze_result_t zeContextCreate(
     ze_driver_handle_t hDriver,
     const ze_context_desc_t *desc,
     ze_context_handle_t *phContext) {
-    return L0::DriverHandle::fromHandle(hDriver)->createContext(desc, 0u, nullptr, phContext);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &desc, &phContext);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->createContext(desc, 0u, nullptr, phContext));
 }
 
 ze_result_t zeContextCreateEx(
@@ -25,15 +28,18 @@ ze_result_t zeContextCreateEx(
     uint32_t numDevices,
     ze_device_handle_t *phDevices,
     ze_context_handle_t *phContext) {
-    return L0::DriverHandle::fromHandle(hDriver)->createContext(desc, numDevices, phDevices, phContext);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &desc, &numDevices, &phDevices, &phContext);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->createContext(desc, numDevices, phDevices, phContext));
 }
 
 ze_result_t zeContextDestroy(ze_context_handle_t hContext) {
-    return L0::Context::fromHandle(hContext)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hContext);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->destroy());
 }
 
 ze_result_t zeContextGetStatus(ze_context_handle_t hContext) {
-    return L0::Context::fromHandle(hContext)->getStatus();
+    API_FLIGHT_RECORDER_ENTER(&hContext);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->getStatus());
 }
 
 ze_result_t zeVirtualMemReserve(
@@ -41,14 +47,16 @@ ze_result_t zeVirtualMemReserve(
     const void *pStart,
     size_t size,
     void **pptr) {
-    return L0::Context::fromHandle(hContext)->reserveVirtualMem(pStart, size, pptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &pStart, &size, &pptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->reserveVirtualMem(pStart, size, pptr));
 }
 
 ze_result_t zeVirtualMemFree(
     ze_context_handle_t hContext,
     const void *ptr,
     size_t size) {
-    return L0::Context::fromHandle(hContext)->freeVirtualMem(ptr, size);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &size);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->freeVirtualMem(ptr, size));
 }
 
 ze_result_t zeVirtualMemQueryPageSize(
@@ -56,7 +64,8 @@ ze_result_t zeVirtualMemQueryPageSize(
     ze_device_handle_t hDevice,
     size_t size,
     size_t *pagesize) {
-    return L0::Context::fromHandle(hContext)->queryVirtualMemPageSize(hDevice, size, pagesize);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &size, &pagesize);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->queryVirtualMemPageSize(hDevice, size, pagesize));
 }
 
 ze_result_t zePhysicalMemCreate(
@@ -64,13 +73,15 @@ ze_result_t zePhysicalMemCreate(
     ze_device_handle_t hDevice,
     ze_physical_mem_desc_t *desc,
     ze_physical_mem_handle_t *phPhysicalMemory) {
-    return L0::Context::fromHandle(hContext)->createPhysicalMem(hDevice, desc, phPhysicalMemory);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &desc, &phPhysicalMemory);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createPhysicalMem(hDevice, desc, phPhysicalMemory));
 }
 
 ze_result_t zePhysicalMemDestroy(
     ze_context_handle_t hContext,
     ze_physical_mem_handle_t hPhysicalMemory) {
-    return L0::Context::fromHandle(hContext)->destroyPhysicalMem(hPhysicalMemory);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hPhysicalMemory);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->destroyPhysicalMem(hPhysicalMemory));
 }
 
 ze_result_t zeVirtualMemMap(
@@ -80,14 +91,16 @@ ze_result_t zeVirtualMemMap(
     ze_physical_mem_handle_t hPhysicalMemory,
     size_t offset,
     ze_memory_access_attribute_t access) {
-    return L0::Context::fromHandle(hContext)->mapVirtualMem(ptr, size, hPhysicalMemory, offset, access);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &size, &hPhysicalMemory, &offset, &access);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->mapVirtualMem(ptr, size, hPhysicalMemory, offset, access));
 }
 
 ze_result_t zeVirtualMemUnmap(
     ze_context_handle_t hContext,
     const void *ptr,
     size_t size) {
-    return L0::Context::fromHandle(hContext)->unMapVirtualMem(ptr, size);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &size);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->unMapVirtualMem(ptr, size));
 }
 
 ze_result_t zeVirtualMemSetAccessAttribute(
@@ -95,7 +108,8 @@ ze_result_t zeVirtualMemSetAccessAttribute(
     const void *ptr,
     size_t size,
     ze_memory_access_attribute_t access) {
-    return L0::Context::fromHandle(hContext)->setVirtualMemAccessAttribute(ptr, size, access);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &size, &access);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->setVirtualMemAccessAttribute(ptr, size, access));
 }
 
 ze_result_t zeVirtualMemGetAccessAttribute(
@@ -104,13 +118,15 @@ ze_result_t zeVirtualMemGetAccessAttribute(
     size_t size,
     ze_memory_access_attribute_t *access,
     size_t *outSize) {
-    return L0::Context::fromHandle(hContext)->getVirtualMemAccessAttribute(ptr, size, access, outSize);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &size, &access, &outSize);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->getVirtualMemAccessAttribute(ptr, size, access, outSize));
 }
 
 ze_result_t zeContextSystemBarrier(
     ze_context_handle_t hContext,
     ze_device_handle_t hDevice) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice);
+    return API_FLIGHT_RECORDER_EXIT(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 }
 
 ze_result_t zeContextMakeMemoryResident(
@@ -118,7 +134,8 @@ ze_result_t zeContextMakeMemoryResident(
     ze_device_handle_t hDevice,
     void *ptr,
     size_t size) {
-    return L0::Context::fromHandle(hContext)->makeMemoryResident(hDevice, ptr, size);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &ptr, &size);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->makeMemoryResident(hDevice, ptr, size));
 }
 
 ze_result_t zeContextEvictMemory(
@@ -126,21 +143,24 @@ ze_result_t zeContextEvictMemory(
     ze_device_handle_t hDevice,
     void *ptr,
     size_t size) {
-    return L0::Context::fromHandle(hContext)->evictMemory(hDevice, ptr, size);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &ptr, &size);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->evictMemory(hDevice, ptr, size));
 }
 
 ze_result_t zeContextMakeImageResident(
     ze_context_handle_t hContext,
     ze_device_handle_t hDevice,
     ze_image_handle_t hImage) {
-    return L0::Context::fromHandle(hContext)->makeImageResident(hDevice, hImage);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &hImage);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->makeImageResident(hDevice, hImage));
 }
 
 ze_result_t zeContextEvictImage(
     ze_context_handle_t hContext,
     ze_device_handle_t hDevice,
     ze_image_handle_t hImage) {
-    return L0::Context::fromHandle(hContext)->evictImage(hDevice, hImage);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &hImage);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->evictImage(hDevice, hImage));
 }
 
 } // namespace L0
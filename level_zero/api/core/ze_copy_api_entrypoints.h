@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include <level_zero/ze_api.h>
 
@@ -19,7 +21,8 @@ ze_result_t zeCommandListAppendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &dstptr, &srcptr, &size, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false, false));
 }
 
 ze_result_t zeCommandListAppendMemoryFill(
@@ -31,7 +34,8 @@ ze_result_t zeCommandListAppendMemoryFill(
     ze_event_handle_t hEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendMemoryFill(ptr, pattern, patternSize, size, hEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &ptr, &pattern, &patternSize, &size, &hEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendMemoryFill(ptr, pattern, patternSize, size, hEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendMemoryCopyRegion(
@@ -47,7 +51,8 @@ ze_result_t zeCommandListAppendMemoryCopyRegion(
     ze_event_handle_t hEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendMemoryCopyRegion(dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hEvent, numWaitEvents, phWaitEvents, false, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &dstptr, &dstRegion, &dstPitch, &dstSlicePitch, &srcptr, &srcRegion, &srcPitch, &srcSlicePitch, &hEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendMemoryCopyRegion(dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hEvent, numWaitEvents, phWaitEvents, false, false));
 }
 
 ze_result_t zeCommandListAppendImageCopy(
@@ -57,7 +62,8 @@ ze_result_t zeCommandListAppendImageCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendImageCopy(hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hDstImage, &hSrcImage, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendImageCopy(hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendImageCopyRegion(
@@ -69,7 +75,8 @@ ze_result_t zeCommandListAppendImageCopyRegion(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hDstImage, &hSrcImage, &pDstRegion, &pSrcRegion, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendImageCopyToMemory(
@@ -80,7 +87,8 @@ ze_result_t zeCommandListAppendImageCopyToMemory(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendImageCopyToMemory(dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &dstptr, &hSrcImage, &pSrcRegion, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendImageCopyToMemory(dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendImageCopyFromMemory(
@@ -91,7 +99,8 @@ ze_result_t zeCommandListAppendImageCopyFromMemory(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendImageCopyFromMemory(hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hDstImage, &srcptr, &pDstRegion, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendImageCopyFromMemory(hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendImageCopyToMemoryExt(
@@ -104,7 +113,8 @@ ze_result_t zeCommandListAppendImageCopyToMemoryExt(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendImageCopyToMemoryExt(dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &dstptr, &hSrcImage, &pSrcRegion, &destRowPitch, &destSlicePitch, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendImageCopyToMemoryExt(dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendImageCopyFromMemoryExt(
@@ -117,14 +127,16 @@ ze_result_t zeCommandListAppendImageCopyFromMemoryExt(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendImageCopyFromMemoryExt(hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hDstImage, &srcptr, &pDstRegion, &srcRowPitch, &srcSlicePitch, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendImageCopyFromMemoryExt(hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendMemoryPrefetch(
     ze_command_list_handle_t hCommandList,
     const void *ptr,
     size_t size) {
-    return L0::CommandList::fromHandle(hCommandList)->appendMemoryPrefetch(ptr, size);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &ptr, &size);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendMemoryPrefetch(ptr, size));
 }
 
 ze_result_t zeCommandListAppendMemAdvise(
@@ -133,7 +145,8 @@ ze_result_t zeCommandListAppendMemAdvise(
     const void *ptr,
     size_t size,
     ze_memory_advice_t advice) {
-    return L0::CommandList::fromHandle(hCommandList)->appendMemAdvise(hDevice, ptr, size, advice);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hDevice, &ptr, &size, &advice);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendMemAdvise(hDevice, ptr, size, advice));
 }
 
 ze_result_t zeCommandListAppendMemoryCopyFromContext(
@@ -145,7 +158,8 @@ ze_result_t zeCommandListAppendMemoryCopyFromContext(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendMemoryCopyFromContext(dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &dstptr, &hContextSrc, &srcptr, &size, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendMemoryCopyFromContext(dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver.h"
 #include "level_zero/core/source/driver/driver_handle.h"
@@ -18,104 +20,120 @@ ze_result_t zeDeviceGet(
     ze_driver_handle_t hDriver,
     uint32_t *pCount,
     ze_device_handle_t *phDevices) {
-    return L0::DriverHandle::fromHandle(hDriver)->getDevice(pCount, phDevices);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &pCount, &phDevices);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->getDevice(pCount, phDevices));
 }
 
 ze_result_t zeDeviceGetSubDevices(
     ze_device_handle_t hDevice,
     uint32_t *pCount,
     ze_device_handle_t *phSubdevices) {
-    return L0::Device::fromHandle(hDevice)->getSubDevices(pCount, phSubdevices);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pCount, &phSubdevices);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getSubDevices(pCount, phSubdevices));
 }
 
 ze_result_t zeDeviceGetProperties(
     ze_device_handle_t hDevice,
     ze_device_properties_t *pDeviceProperties) {
-    return L0::Device::fromHandle(hDevice)->getProperties(pDeviceProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pDeviceProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getProperties(pDeviceProperties));
 }
 
 ze_result_t zeDeviceGetComputeProperties(
     ze_device_handle_t hDevice,
     ze_device_compute_properties_t *pComputeProperties) {
-    return L0::Device::fromHandle(hDevice)->getComputeProperties(pComputeProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pComputeProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getComputeProperties(pComputeProperties));
 }
 
 ze_result_t zeDeviceGetModuleProperties(
     ze_device_handle_t hDevice,
     ze_device_module_properties_t *pKernelProperties) {
-    return L0::Device::fromHandle(hDevice)->getKernelProperties(pKernelProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pKernelProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getKernelProperties(pKernelProperties));
 }
 
 ze_result_t zeDeviceGetMemoryProperties(
     ze_device_handle_t hDevice,
     uint32_t *pCount,
     ze_device_memory_properties_t *pMemProperties) {
-    return L0::Device::fromHandle(hDevice)->getMemoryProperties(pCount, pMemProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pCount, &pMemProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getMemoryProperties(pCount, pMemProperties));
 }
 
 ze_result_t zeDeviceGetMemoryAccessProperties(
     ze_device_handle_t hDevice,
     ze_device_memory_access_properties_t *pMemAccessProperties) {
-    return L0::Device::fromHandle(hDevice)->getMemoryAccessProperties(pMemAccessProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pMemAccessProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getMemoryAccessProperties(pMemAccessProperties));
 }
 
 ze_result_t zeDeviceGetCacheProperties(
     ze_device_handle_t hDevice,
     uint32_t *pCount,
     ze_device_cache_properties_t *pCacheProperties) {
-    return L0::Device::fromHandle(hDevice)->getCacheProperties(pCount, pCacheProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pCount, &pCacheProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getCacheProperties(pCount, pCacheProperties));
 }
 
 ze_result_t zeDeviceGetImageProperties(
     ze_device_handle_t hDevice,
     ze_device_image_properties_t *pImageProperties) {
-    return L0::Device::fromHandle(hDevice)->getDeviceImageProperties(pImageProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pImageProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getDeviceImageProperties(pImageProperties));
 }
 
 ze_result_t zeDeviceGetP2PProperties(
     ze_device_handle_t hDevice,
     ze_device_handle_t hPeerDevice,
     ze_device_p2p_properties_t *pP2PProperties) {
-    return L0::Device::fromHandle(hDevice)->getP2PProperties(hPeerDevice, pP2PProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &hPeerDevice, &pP2PProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getP2PProperties(hPeerDevice, pP2PProperties));
 }
 
 ze_result_t zeDeviceCanAccessPeer(
     ze_device_handle_t hDevice,
     ze_device_handle_t hPeerDevice,
     ze_bool_t *value) {
-    return L0::Device::fromHandle(hDevice)->canAccessPeer(hPeerDevice, value);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &hPeerDevice, &value);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->canAccessPeer(hPeerDevice, value));
 }
 
 ze_result_t zeDeviceGetCommandQueueGroupProperties(
     ze_device_handle_t hDevice,
     uint32_t *pCount,
     ze_command_queue_group_properties_t *pCommandQueueGroupProperties) {
-    return L0::Device::fromHandle(hDevice)->getCommandQueueGroupProperties(pCount, pCommandQueueGroupProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pCount, &pCommandQueueGroupProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getCommandQueueGroupProperties(pCount, pCommandQueueGroupProperties));
 }
 
 ze_result_t zeDeviceGetExternalMemoryProperties(
     ze_device_handle_t hDevice,
     ze_device_external_memory_properties_t *pExternalMemoryProperties) {
-    return L0::Device::fromHandle(hDevice)->getExternalMemoryProperties(pExternalMemoryProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pExternalMemoryProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getExternalMemoryProperties(pExternalMemoryProperties));
 }
 
 ze_result_t zeDeviceGetStatus(
     ze_device_handle_t hDevice) {
-    return L0::Device::fromHandle(hDevice)->getStatus();
+    API_FLIGHT_RECORDER_ENTER(&hDevice);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getStatus());
 }
 
 ze_result_t zeDeviceGetGlobalTimestamps(
     ze_device_handle_t hDevice,
     uint64_t *hostTimestamp,
     uint64_t *deviceTimestamp) {
-    return L0::Device::fromHandle(hDevice)->getGlobalTimestamps(hostTimestamp, deviceTimestamp);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &hostTimestamp, &deviceTimestamp);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getGlobalTimestamps(hostTimestamp, deviceTimestamp));
 }
 
 ze_result_t zeDeviceReserveCacheExt(
     ze_device_handle_t hDevice,
     size_t cacheLevel,
     size_t cacheReservationSize) {
-    return L0::Device::fromHandle(hDevice)->reserveCache(cacheLevel, cacheReservationSize);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &cacheLevel, &cacheReservationSize);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->reserveCache(cacheLevel, cacheReservationSize));
 }
 
 ze_result_t zeDeviceSetCacheAdviceExt(
@@ -123,19 +141,22 @@ ze_result_t zeDeviceSetCacheAdviceExt(
     void *ptr,
     size_t regionSize,
     ze_cache_ext_region_t cacheRegion) {
-    return L0::Device::fromHandle(hDevice)->setCacheAdvice(ptr, regionSize, cacheRegion);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &ptr, &regionSize, &cacheRegion);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->setCacheAdvice(ptr, regionSize, cacheRegion));
 }
 
 ze_result_t zeDevicePciGetPropertiesExt(
     ze_device_handle_t hDevice,
     ze_pci_ext_properties_t *pPciProperties) {
-    return L0::Device::fromHandle(hDevice)->getPciProperties(pPciProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &pPciProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getPciProperties(pPciProperties));
 }
 
 ze_result_t zeDeviceGetRootDevice(
     ze_device_handle_t hDevice,
     ze_device_handle_t *phRootDevice) {
-    return L0::Device::fromHandle(hDevice)->getRootDevice(phRootDevice);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &phRootDevice);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->getRootDevice(phRootDevice));
 }
 
 } // namespace L0
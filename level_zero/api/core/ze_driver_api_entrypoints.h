@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/driver/driver.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include <level_zero/ze_api.h>
@@ -14,51 +16,59 @@
 namespace L0 {
 ze_result_t zeInit(
     ze_init_flags_t flags) {
-    return L0::init(flags);
+    API_FLIGHT_RECORDER_ENTER(&flags);
+    return API_FLIGHT_RECORDER_EXIT(L0::init(flags));
 }
 
 ze_result_t zeDriverGet(
     uint32_t *pCount,
     ze_driver_handle_t *phDrivers) {
-    return L0::driverHandleGet(pCount, phDrivers);
+    API_FLIGHT_RECORDER_ENTER(&pCount, &phDrivers);
+    return API_FLIGHT_RECORDER_EXIT(L0::driverHandleGet(pCount, phDrivers));
 }
 
 ze_result_t zeDriverGetProperties(
     ze_driver_handle_t hDriver,
     ze_driver_properties_t *pProperties) {
-    return L0::DriverHandle::fromHandle(hDriver)->getProperties(pProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &pProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->getProperties(pProperties));
 }
 
 ze_result_t zeDriverGetApiVersion(
     ze_driver_handle_t hDriver,
     ze_api_version_t *version) {
-    return L0::DriverHandle::fromHandle(hDriver)->getApiVersion(version);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &version);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->getApiVersion(version));
 }
 
 ze_result_t zeDriverGetIpcProperties(
     ze_driver_handle_t hDriver,
     ze_driver_ipc_properties_t *pIPCProperties) {
-    return L0::DriverHandle::fromHandle(hDriver)->getIPCProperties(pIPCProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &pIPCProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->getIPCProperties(pIPCProperties));
 }
 
 ze_result_t zeDriverGetLastErrorDescription(
     ze_driver_handle_t hDriver,
     const char **ppString) {
-    return L0::DriverHandle::fromHandle(hDriver)->getErrorDescription(ppString);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &ppString);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->getErrorDescription(ppString));
 }
 
 ze_result_t zeDriverGetExtensionProperties(
     ze_driver_handle_t hDriver,
     uint32_t *pCount,
     ze_driver_extension_properties_t *pExtensionProperties) {
-    return L0::DriverHandle::fromHandle(hDriver)->getExtensionProperties(pCount, pExtensionProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &pCount, &pExtensionProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::DriverHandle::fromHandle(hDriver)->getExtensionProperties(pCount, pExtensionProperties));
 }
 
 ze_result_t zeDriverGetExtensionFunctionAddress(
     ze_driver_handle_t hDriver,
     const char *name,
     void **ppFunctionAddress) {
-    return L0::BaseDriver::fromHandle(hDriver)->getExtensionFunctionAddress(name, ppFunctionAddress);
+    API_FLIGHT_RECORDER_ENTER(&hDriver, &name, &ppFunctionAddress);
+    return API_FLIGHT_RECORDER_EXIT(L0::BaseDriver::fromHandle(hDriver)->getExtensionFunctionAddress(name, ppFunctionAddress));
 }
 
 } // namespace L0
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/event/event.h"
 #include <level_zero/ze_api.h>
 
@@ -17,88 +19,103 @@ ze_result_t zeEventPoolCreate(
     uint32_t numDevices,
     ze_device_handle_t *phDevices,
     ze_event_pool_handle_t *phEventPool) {
-    return L0::Context::fromHandle(hContext)->createEventPool(desc, numDevices, phDevices, phEventPool);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &desc, &numDevices, &phDevices, &phEventPool);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createEventPool(desc, numDevices, phDevices, phEventPool));
 }
 
 ze_result_t zeEventPoolDestroy(
     ze_event_pool_handle_t hEventPool) {
-    return L0::EventPool::fromHandle(hEventPool)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hEventPool);
+    return API_FLIGHT_RECORDER_EXIT(L0::EventPool::fromHandle(hEventPool)->destroy());
 }
 
 ze_result_t zeEventCreate(
     ze_event_pool_handle_t hEventPool,
     const ze_event_desc_t *desc,
     ze_event_handle_t *phEvent) {
-    return L0::EventPool::fromHandle(hEventPool)->createEvent(desc, phEvent);
+    API_FLIGHT_RECORDER_ENTER(&hEventPool, &desc, &phEvent);
+    return API_FLIGHT_RECORDER_EXIT(L0::EventPool::fromHandle(hEventPool)->createEvent(desc, phEvent));
 }
 
 ze_result_t zeEventDestroy(
     ze_event_handle_t hEvent) {
-    return L0::Event::fromHandle(hEvent)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hEvent);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->destroy());
 }
 
 ze_result_t zeEventPoolGetIpcHandle(
     ze_event_pool_handle_t hEventPool,
     ze_ipc_event_pool_handle_t *phIpc) {
-    return L0::EventPool::fromHandle(hEventPool)->getIpcHandle(phIpc);
+    API_FLIGHT_RECORDER_ENTER(&hEventPool, &phIpc);
+    return API_FLIGHT_RECORDER_EXIT(L0::EventPool::fromHandle(hEventPool)->getIpcHandle(phIpc));
 }
 
 ze_result_t zeEventPoolOpenIpcHandle(
     ze_context_handle_t hContext,
     ze_ipc_event_pool_handle_t hIpc,
     ze_event_pool_handle_t *phEventPool) {
-    return L0::Context::fromHandle(hContext)->openEventPoolIpcHandle(hIpc, phEventPool);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hIpc, &phEventPool);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->openEventPoolIpcHandle(hIpc, phEventPool));
 }
 
 ze_result_t zeEventPoolCloseIpcHandle(
     ze_event_pool_handle_t hEventPool) {
-    return L0::EventPool::fromHandle(hEventPool)->closeIpcHandle();
+    API_FLIGHT_RECORDER_ENTER(&hEventPool);
+    return API_FLIGHT_RECORDER_EXIT(L0::EventPool::fromHandle(hEventPool)->closeIpcHandle());
 }
 
 ze_result_t zeCommandListAppendSignalEvent(
     ze_command_list_handle_t hCommandList,
     ze_event_handle_t hEvent) {
-    return L0::CommandList::fromHandle(hCommandList)->appendSignalEvent(hEvent);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hEvent);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendSignalEvent(hEvent));
 }
 
 ze_result_t zeCommandListAppendWaitOnEvents(
     ze_command_list_handle_t hCommandList,
     uint32_t numEvents,
     ze_event_handle_t *phEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendWaitOnEvents(numEvents, phEvents, nullptr, false, true, true, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &numEvents, &phEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendWaitOnEvents(numEvents, phEvents, nullptr, false, true, true, false));
 }
 
 ze_result_t zeEventHostSignal(
     ze_event_handle_t hEvent) {
-    return L0::Event::fromHandle(hEvent)->hostSignal();
+    API_FLIGHT_RECORDER_ENTER(&hEvent);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->hostSignal());
 }
 
 ze_result_t zeEventHostSynchronize(
     ze_event_handle_t hEvent,
     uint64_t timeout) {
-    return L0::Event::fromHandle(hEvent)->hostSynchronize(timeout);
+    API_FLIGHT_RECORDER_ENTER(&hEvent, &timeout);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->hostSynchronize(timeout));
 }
 
 ze_result_t zeEventQueryStatus(
     ze_event_handle_t hEvent) {
-    return L0::Event::fromHandle(hEvent)->queryStatus();
+    API_FLIGHT_RECORDER_ENTER(&hEvent);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->queryStatus());
 }
 
 ze_result_t zeCommandListAppendEventReset(
     ze_command_list_handle_t hCommandList,
     ze_event_handle_t hEvent) {
-    return L0::CommandList::fromHandle(hCommandList)->appendEventReset(hEvent);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &hEvent);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendEventReset(hEvent));
 }
 
 ze_result_t zeEventHostReset(
     ze_event_handle_t hEvent) {
-    return L0::Event::fromHandle(hEvent)->reset();
+    API_FLIGHT_RECORDER_ENTER(&hEvent);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->reset());
 }
 
 ze_result_t zeEventQueryKernelTimestamp(
     ze_event_handle_t hEvent,
     ze_kernel_timestamp_result_t *timestampType) {
-    return L0::Event::fromHandle(hEvent)->queryKernelTimestamp(timestampType);
+    API_FLIGHT_RECORDER_ENTER(&hEvent, &timestampType);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->queryKernelTimestamp(timestampType));
 }
 
 ze_result_t zeEventQueryKernelTimestampsExt(
@@ -106,37 +123,43 @@ ze_result_t zeEventQueryKernelTimestampsExt(
     ze_device_handle_t hDevice,
     uint32_t *pCount,
     ze_event_query_kernel_timestamps_results_ext_properties_t *pResults) {
-    return L0::Event::fromHandle(hEvent)->queryKernelTimestampsExt(L0::Device::fromHandle(hDevice), pCount, pResults);
+    API_FLIGHT_RECORDER_ENTER(&hEvent, &hDevice, &pCount, &pResults);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->queryKernelTimestampsExt(L0::Device::fromHandle(hDevice), pCount, pResults));
 }
 
 ze_result_t zeEventPoolGetContextHandle(
     ze_event_pool_handle_t hEventPool,
     ze_context_handle_t *phContext) {
-    return L0::EventPool::fromHandle(hEventPool)->getContextHandle(phContext);
+    API_FLIGHT_RECORDER_ENTER(&hEventPool, &phContext);
+    return API_FLIGHT_RECORDER_EXIT(L0::EventPool::fromHandle(hEventPool)->getContextHandle(phContext));
 }
 
 ze_result_t zeEventPoolGetFlags(
     ze_event_pool_handle_t hEventPool,
     ze_event_pool_flags_t *pFlags) {
-    return L0::EventPool::fromHandle(hEventPool)->getFlags(pFlags);
+    API_FLIGHT_RECORDER_ENTER(&hEventPool, &pFlags);
+    return API_FLIGHT_RECORDER_EXIT(L0::EventPool::fromHandle(hEventPool)->getFlags(pFlags));
 }
 
 ze_result_t zeEventGetEventPool(
     ze_event_handle_t hEvent,
     ze_event_pool_handle_t *phEventPool) {
-    return L0::Event::fromHandle(hEvent)->getEventPool(phEventPool);
+    API_FLIGHT_RECORDER_ENTER(&hEvent, &phEventPool);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->getEventPool(phEventPool));
 }
 
 ze_result_t zeEventGetSignalScope(
     ze_event_handle_t hEvent,
     ze_event_scope_flags_t *pSignalScope) {
-    return L0::Event::fromHandle(hEvent)->getSignalScope(pSignalScope);
+    API_FLIGHT_RECORDER_ENTER(&hEvent, &pSignalScope);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->getSignalScope(pSignalScope));
 }
 
 ze_result_t zeEventGetWaitScope(
     ze_event_handle_t hEvent,
     ze_event_scope_flags_t *pWaitScope) {
-    return L0::Event::fromHandle(hEvent)->getWaitScope(pWaitScope);
+    API_FLIGHT_RECORDER_ENTER(&hEvent, &pWaitScope);
+    return API_FLIGHT_RECORDER_EXIT(L0::Event::fromHandle(hEvent)->getWaitScope(pWaitScope));
 }
 } // namespace L0
 
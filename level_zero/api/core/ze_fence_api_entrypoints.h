@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/fence/fence.h"
 #include <level_zero/ze_api.h>
 
@@ -15,28 +17,33 @@ ze_result_t zeFenceCreate(
     ze_command_queue_handle_t hCommandQueue,
     const ze_fence_desc_t *desc,
     ze_fence_handle_t *phFence) {
-    return L0::CommandQueue::fromHandle(hCommandQueue)->createFence(desc, phFence);
+    API_FLIGHT_RECORDER_ENTER(&hCommandQueue, &desc, &phFence);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandQueue::fromHandle(hCommandQueue)->createFence(desc, phFence));
 }
 
 ze_result_t zeFenceDestroy(
     ze_fence_handle_t hFence) {
-    return L0::Fence::fromHandle(hFence)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hFence);
+    return API_FLIGHT_RECORDER_EXIT(L0::Fence::fromHandle(hFence)->destroy());
 }
 
 ze_result_t zeFenceHostSynchronize(
     ze_fence_handle_t hFence,
     uint64_t timeout) {
-    return L0::Fence::fromHandle(hFence)->hostSynchronize(timeout);
+    API_FLIGHT_RECORDER_ENTER(&hFence, &timeout);
+    return API_FLIGHT_RECORDER_EXIT(L0::Fence::fromHandle(hFence)->hostSynchronize(timeout));
 }
 
 ze_result_t zeFenceQueryStatus(
     ze_fence_handle_t hFence) {
-    return L0::Fence::fromHandle(hFence)->queryStatus();
+    API_FLIGHT_RECORDER_ENTER(&hFence);
+    return API_FLIGHT_RECORDER_EXIT(L0::Fence::fromHandle(hFence)->queryStatus());
 }
 
 ze_result_t zeFenceReset(
     ze_fence_handle_t hFence) {
-    return L0::Fence::fromHandle(hFence)->reset(false);
+    API_FLIGHT_RECORDER_ENTER(&hFence);
+    return API_FLIGHT_RECORDER_EXIT(L0::Fence::fromHandle(hFence)->reset(false));
 }
 
 } // namespace L0
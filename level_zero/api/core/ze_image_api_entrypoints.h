@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/image/image.h"
 #include <level_zero/ze_api.h>
 
@@ -15,7 +17,8 @@ ze_result_t zeImageGetProperties(
     ze_device_handle_t hDevice,
     const ze_image_desc_t *desc,
     ze_image_properties_t *pImageProperties) {
-    return L0::Device::fromHandle(hDevice)->imageGetProperties(desc, pImageProperties);
+    API_FLIGHT_RECORDER_ENTER(&hDevice, &desc, &pImageProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Device::fromHandle(hDevice)->imageGetProperties(desc, pImageProperties));
 }
 
 ze_result_t zeImageCreate(
@@ -23,12 +26,14 @@ ze_result_t zeImageCreate(
     ze_device_handle_t hDevice,
     const ze_image_desc_t *desc,
     ze_image_handle_t *phImage) {
-    return L0::Context::fromHandle(hContext)->createImage(hDevice, desc, phImage);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &desc, &phImage);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createImage(hDevice, desc, phImage));
 }
 
 ze_result_t zeImageDestroy(
     ze_image_handle_t hImage) {
-    return L0::Image::fromHandle(hImage)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hImage);
+    return API_FLIGHT_RECORDER_EXIT(L0::Image::fromHandle(hImage)->destroy());
 }
 
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/driver/driver_handle.h"
 #include <level_zero/ze_api.h>
 
@@ -19,7 +21,8 @@ ze_result_t zeMemAllocShared(
     size_t alignment,
     ze_device_handle_t hDevice,
     void **pptr) {
-    return L0::Context::fromHandle(hContext)->allocSharedMem(hDevice, deviceDesc, hostDesc, size, alignment, pptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &deviceDesc, &hostDesc, &size, &alignment, &hDevice, &pptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->allocSharedMem(hDevice, deviceDesc, hostDesc, size, alignment, pptr));
 }
 
 ze_result_t zeMemAllocDevice(
@@ -29,7 +32,8 @@ ze_result_t zeMemAllocDevice(
     size_t alignment,
     ze_device_handle_t hDevice,
     void **pptr) {
-    return L0::Context::fromHandle(hContext)->allocDeviceMem(hDevice, deviceDesc, size, alignment, pptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &deviceDesc, &size, &alignment, &hDevice, &pptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->allocDeviceMem(hDevice, deviceDesc, size, alignment, pptr));
 }
 
 ze_result_t zeMemAllocHost(
@@ -38,20 +42,23 @@ ze_result_t zeMemAllocHost(
     size_t size,
     size_t alignment,
     void **pptr) {
-    return L0::Context::fromHandle(hContext)->allocHostMem(hostDesc, size, alignment, pptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hostDesc, &size, &alignment, &pptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->allocHostMem(hostDesc, size, alignment, pptr));
 }
 
 ze_result_t zeMemFree(
     ze_context_handle_t hContext,
     void *ptr) {
-    return L0::Context::fromHandle(hContext)->freeMem(ptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->freeMem(ptr));
 }
 
 ze_result_t zeMemFreeExt(
     ze_context_handle_t hContext,
     const ze_memory_free_ext_desc_t *pMemFreeDesc,
     void *ptr) {
-    return L0::Context::fromHandle(hContext)->freeMemExt(pMemFreeDesc, ptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &pMemFreeDesc, &ptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->freeMemExt(pMemFreeDesc, ptr));
 }
 
 ze_result_t zeMemGetAllocProperties(
@@ -59,7 +66,8 @@ ze_result_t zeMemGetAllocProperties(
     const void *ptr,
     ze_memory_allocation_properties_t *pMemAllocProperties,
     ze_device_handle_t *phDevice) {
-    return L0::Context::fromHandle(hContext)->getMemAllocProperties(ptr, pMemAllocProperties, phDevice);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &pMemAllocProperties, &phDevice);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->getMemAllocProperties(ptr, pMemAllocProperties, phDevice));
 }
 
 ze_result_t zeMemGetAddressRange(
@@ -67,20 +75,23 @@ ze_result_t zeMemGetAddressRange(
     const void *ptr,
     void **pBase,
     size_t *pSize) {
-    return L0::Context::fromHandle(hContext)->getMemAddressRange(ptr, pBase, pSize);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &pBase, &pSize);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->getMemAddressRange(ptr, pBase, pSize));
 }
 
 ze_result_t zeMemGetIpcHandle(
     ze_context_handle_t hContext,
     const void *ptr,
     ze_ipc_mem_handle_t *pIpcHandle) {
-    return L0::Context::fromHandle(hContext)->getIpcMemHandle(ptr, pIpcHandle);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr, &pIpcHandle);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->getIpcMemHandle(ptr, pIpcHandle));
 }
 
 ze_result_t zeMemPutIpcHandle(
     ze_context_handle_t hContext,
     ze_ipc_mem_handle_t ipcHandle) {
-    return L0::Context::fromHandle(hContext)->putIpcMemHandle(ipcHandle);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ipcHandle);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->putIpcMemHandle(ipcHandle));
 }
 
 ze_result_t zeMemOpenIpcHandle(
@@ -89,21 +100,25 @@ ze_result_t zeMemOpenIpcHandle(
     ze_ipc_mem_handle_t handle,
     ze_ipc_memory_flags_t flags,
     void **pptr) {
-    return L0::Context::fromHandle(hContext)->openIpcMemHandle(hDevice, handle, flags, pptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &handle, &flags, &pptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->openIpcMemHandle(hDevice, handle, flags, pptr));
 }
 
 ze_result_t zeMemCloseIpcHandle(
     ze_context_handle_t hContext,
     const void *ptr) {
-    return L0::Context::fromHandle(hContext)->closeIpcMemHandle(ptr);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->closeIpcMemHandle(ptr));
 }
 
 ze_result_t zeMemGetIpcHandleFromFileDescriptorExp(ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t *pIpcHandle) {
-    return L0::Context::fromHandle(hContext)->getIpcHandleFromFd(handle, pIpcHandle);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &handle, &pIpcHandle);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->getIpcHandleFromFd(handle, pIpcHandle));
 }
 
 ze_result_t zeMemGetFileDescriptorFromIpcHandleExp(ze_context_handle_t hContext, ze_ipc_mem_handle_t ipcHandle, uint64_t *pHandle) {
-    return L0::Context::fromHandle(hContext)->getFdFromIpcHandle(ipcHandle, pHandle);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &ipcHandle, &pHandle);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->getFdFromIpcHandle(ipcHandle, pHandle));
 }
 
 } // namespace L0
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module.h"
@@ -20,31 +22,36 @@ ze_result_t zeModuleCreate(
     const ze_module_desc_t *desc,
     ze_module_handle_t *phModule,
     ze_module_build_log_handle_t *phBuildLog) {
-    return L0::Context::fromHandle(hContext)->createModule(hDevice, desc, phModule, phBuildLog);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &desc, &phModule, &phBuildLog);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createModule(hDevice, desc, phModule, phBuildLog));
 }
 
 ze_result_t zeModuleDestroy(
     ze_module_handle_t hModule) {
-    return L0::Module::fromHandle(hModule)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hModule);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(hModule)->destroy());
 }
 
 ze_result_t zeModuleBuildLogDestroy(
     ze_module_build_log_handle_t hModuleBuildLog) {
-    return L0::ModuleBuildLog::fromHandle(hModuleBuildLog)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hModuleBuildLog);
+    return API_FLIGHT_RECORDER_EXIT(L0::ModuleBuildLog::fromHandle(hModuleBuildLog)->destroy());
 }
 
 ze_result_t zeModuleBuildLogGetString(
     ze_module_build_log_handle_t hModuleBuildLog,
     size_t *pSize,
     char *pBuildLog) {
-    return L0::ModuleBuildLog::fromHandle(hModuleBuildLog)->getString(pSize, pBuildLog);
+    API_FLIGHT_RECORDER_ENTER(&hModuleBuildLog, &pSize, &pBuildLog);
+    return API_FLIGHT_RECORDER_EXIT(L0::ModuleBuildLog::fromHandle(hModuleBuildLog)->getString(pSize, pBuildLog));
 }
 
 ze_result_t zeModuleGetNativeBinary(
     ze_module_handle_t hModule,
     size_t *pSize,
     uint8_t *pModuleNativeBinary) {
-    return L0::Module::fromHandle(hModule)->getNativeBinary(pSize, pModuleNativeBinary);
+    API_FLIGHT_RECORDER_ENTER(&hModule, &pSize, &pModuleNativeBinary);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(hModule)->getNativeBinary(pSize, pModuleNativeBinary));
 }
 
 ze_result_t zeModuleGetGlobalPointer(
@@ -52,33 +59,38 @@ ze_result_t zeModuleGetGlobalPointer(
     const char *pGlobalName,
     size_t *pSize,
     void **pptr) {
-    return L0::Module::fromHandle(hModule)->getGlobalPointer(pGlobalName, pSize, pptr);
+    API_FLIGHT_RECORDER_ENTER(&hModule, &pGlobalName, &pSize, &pptr);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(hModule)->getGlobalPointer(pGlobalName, pSize, pptr));
 }
 
 ze_result_t zeModuleGetKernelNames(
     ze_module_handle_t hModule,
     uint32_t *pCount,
     const char **pNames) {
-    return L0::Module::fromHandle(hModule)->getKernelNames(pCount, pNames);
+    API_FLIGHT_RECORDER_ENTER(&hModule, &pCount, &pNames);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(hModule)->getKernelNames(pCount, pNames));
 }
 
 ze_result_t zeKernelCreate(
     ze_module_handle_t hModule,
     const ze_kernel_desc_t *desc,
     ze_kernel_handle_t *kernelHandle) {
-    return L0::Module::fromHandle(hModule)->createKernel(desc, kernelHandle);
+    API_FLIGHT_RECORDER_ENTER(&hModule, &desc, &kernelHandle);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(hModule)->createKernel(desc, kernelHandle));
 }
 
 ze_result_t zeKernelDestroy(
     ze_kernel_handle_t hKernel) {
-    return L0::Kernel::fromHandle(hKernel)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hKernel);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->destroy());
 }
 
 ze_result_t zeModuleGetFunctionPointer(
     ze_module_handle_t hModule,
     const char *pKernelName,
     void **pfnFunction) {
-    return L0::Module::fromHandle(hModule)->getFunctionPointer(pKernelName, pfnFunction);
+    API_FLIGHT_RECORDER_ENTER(&hModule, &pKernelName, &pfnFunction);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(hModule)->getFunctionPointer(pKernelName, pfnFunction));
 }
 
 ze_result_t zeKernelSetGroupSize(
@@ -86,7 +98,8 @@ ze_result_t zeKernelSetGroupSize(
     uint32_t groupSizeX,
     uint32_t groupSizeY,
     uint32_t groupSizeZ) {
-    return L0::Kernel::fromHandle(hKernel)->setGroupSize(groupSizeX, groupSizeY, groupSizeZ);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &groupSizeX, &groupSizeY, &groupSizeZ);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->setGroupSize(groupSizeX, groupSizeY, groupSizeZ));
 }
 
 ze_result_t zeKernelSuggestGroupSize(
@@ -97,13 +110,15 @@ ze_result_t zeKernelSuggestGroupSize(
     uint32_t *groupSizeX,
     uint32_t *groupSizeY,
     uint32_t *groupSizeZ) {
-    return L0::Kernel::fromHandle(hKernel)->suggestGroupSize(globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &globalSizeX, &globalSizeY, &globalSizeZ, &groupSizeX, &groupSizeY, &groupSizeZ);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->suggestGroupSize(globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ));
 }
 
 ze_result_t zeKernelSuggestMaxCooperativeGroupCount(
     ze_kernel_handle_t hKernel,
     uint32_t *totalGroupCount) {
-    return L0::Kernel::fromHandle(hKernel)->suggestMaxCooperativeGroupCount(totalGroupCount, NEO::EngineGroupType::compute, false);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &totalGroupCount);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->suggestMaxCooperativeGroupCount(totalGroupCount, NEO::EngineGroupType::compute, false));
 }
 
 ze_result_t zeKernelSetArgumentValue(
@@ -111,32 +126,37 @@ ze_result_t zeKernelSetArgumentValue(
     uint32_t argIndex,
     size_t argSize,
     const void *pArgValue) {
-    return L0::Kernel::fromHandle(hKernel)->setArgumentValue(argIndex, argSize, pArgValue);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &argIndex, &argSize, &pArgValue);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->setArgumentValue(argIndex, argSize, pArgValue));
 }
 
 ze_result_t zeKernelSetIndirectAccess(
     ze_kernel_handle_t hKernel,
     ze_kernel_indirect_access_flags_t flags) {
-    return L0::Kernel::fromHandle(hKernel)->setIndirectAccess(flags);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &flags);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->setIndirectAccess(flags));
 }
 
 ze_result_t zeKernelGetIndirectAccess(
     ze_kernel_handle_t hKernel,
     ze_kernel_indirect_access_flags_t *pFlags) {
-    return L0::Kernel::fromHandle(hKernel)->getIndirectAccess(pFlags);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &pFlags);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->getIndirectAccess(pFlags));
 }
 
 ze_result_t zeKernelGetSourceAttributes(
     ze_kernel_handle_t hKernel,
     uint32_t *pSize,
     char **pString) {
-    return L0::Kernel::fromHandle(hKernel)->getSourceAttributes(pSize, pString);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &pSize, &pString);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->getSourceAttributes(pSize, pString));
 }
 
 ze_result_t zeKernelGetProperties(
     ze_kernel_handle_t hKernel,
     ze_kernel_properties_t *pKernelProperties) {
-    return L0::Kernel::fromHandle(hKernel)->getProperties(pKernelProperties);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &pKernelProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->getProperties(pKernelProperties));
 }
 
 ze_result_t zeCommandListAppendLaunchKernel(
@@ -147,12 +167,14 @@ ze_result_t zeCommandListAppendLaunchKernel(
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
 
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &kernelHandle, &launchKernelArgs, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+
     auto cmdList = L0::CommandList::fromHandle(hCommandList);
 
     L0::CmdListKernelLaunchParams launchParams = {};
     launchParams.skipInOrderNonWalkerSignaling = cmdList->skipInOrderNonWalkerSignalingAllowed(hSignalEvent);
 
-    return cmdList->appendLaunchKernel(kernelHandle, *launchKernelArgs, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false);
+    return API_FLIGHT_RECORDER_EXIT(cmdList->appendLaunchKernel(kernelHandle, *launchKernelArgs, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false));
 }
 
 ze_result_t zeCommandListAppendLaunchCooperativeKernel(
@@ -162,7 +184,8 @@ ze_result_t zeCommandListAppendLaunchCooperativeKernel(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendLaunchCooperativeKernel(kernelHandle, *launchKernelArgs, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &kernelHandle, &launchKernelArgs, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendLaunchCooperativeKernel(kernelHandle, *launchKernelArgs, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendLaunchKernelIndirect(
@@ -172,7 +195,8 @@ ze_result_t zeCommandListAppendLaunchKernelIndirect(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendLaunchKernelIndirect(kernelHandle, *pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &kernelHandle, &pLaunchArgumentsBuffer, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendLaunchKernelIndirect(kernelHandle, *pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirect(
@@ -184,27 +208,31 @@ ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirect(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return L0::CommandList::fromHandle(hCommandList)->appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    API_FLIGHT_RECORDER_ENTER(&hCommandList, &numKernels, &kernelHandles, &pCountBuffer, &pLaunchArgumentsBuffer, &hSignalEvent, &numWaitEvents, &phWaitEvents);
+    return API_FLIGHT_RECORDER_EXIT(L0::CommandList::fromHandle(hCommandList)->appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, false));
 }
 
 ze_result_t zeKernelGetName(
     ze_kernel_handle_t hKernel,
     size_t *pSize,
     char *pName) {
-    return L0::Kernel::fromHandle(hKernel)->getKernelName(pSize, pName);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &pSize, &pName);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->getKernelName(pSize, pName));
 }
 
 ze_result_t zeModuleDynamicLink(
     uint32_t numModules,
     ze_module_handle_t *phModules,
     ze_module_build_log_handle_t *phLinkLog) {
-    return L0::Module::fromHandle(phModules[0])->performDynamicLink(numModules, phModules, phLinkLog);
+    API_FLIGHT_RECORDER_ENTER(&numModules, &phModules, &phLinkLog);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(phModules[0])->performDynamicLink(numModules, phModules, phLinkLog));
 }
 
 ze_result_t zeModuleGetProperties(
     ze_module_handle_t hModule,
     ze_module_properties_t *pModuleProperties) {
-    return L0::Module::fromHandle(hModule)->getProperties(pModuleProperties);
+    API_FLIGHT_RECORDER_ENTER(&hModule, &pModuleProperties);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(hModule)->getProperties(pModuleProperties));
 }
 
 ze_result_t zeModuleInspectLinkageExt(
@@ -212,19 +240,22 @@ ze_result_t zeModuleInspectLinkageExt(
     uint32_t numModules,
     ze_module_handle_t *phModules,
     ze_module_build_log_handle_t *phLog) {
-    return L0::Module::fromHandle(phModules[0])->inspectLinkage(pInspectDesc, numModules, phModules, phLog);
+    API_FLIGHT_RECORDER_ENTER(&pInspectDesc, &numModules, &phModules, &phLog);
+    return API_FLIGHT_RECORDER_EXIT(L0::Module::fromHandle(phModules[0])->inspectLinkage(pInspectDesc, numModules, phModules, phLog));
 }
 
 ze_result_t zeKernelSetCacheConfig(
     ze_kernel_handle_t hKernel,
     ze_cache_config_flags_t flags) {
-    return L0::Kernel::fromHandle(hKernel)->setCacheConfig(flags);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &flags);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->setCacheConfig(flags));
 }
 
 ze_result_t zeKernelSchedulingHintExp(
     ze_kernel_handle_t hKernel,
     ze_scheduling_hint_exp_desc_t *pHint) {
-    return L0::Kernel::fromHandle(hKernel)->setSchedulingHintExp(pHint);
+    API_FLIGHT_RECORDER_ENTER(&hKernel, &pHint);
+    return API_FLIGHT_RECORDER_EXIT(L0::Kernel::fromHandle(hKernel)->setSchedulingHintExp(pHint));
 }
 
 } // namespace L0
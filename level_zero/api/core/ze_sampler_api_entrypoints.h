@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
+
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/sampler/sampler.h"
 #include <level_zero/ze_api.h>
@@ -17,12 +19,14 @@ ze_result_t zeSamplerCreate(
     ze_device_handle_t hDevice,
     const ze_sampler_desc_t *desc,
     ze_sampler_handle_t *phSampler) {
-    return L0::Context::fromHandle(hContext)->createSampler(hDevice, desc, phSampler);
+    API_FLIGHT_RECORDER_ENTER(&hContext, &hDevice, &desc, &phSampler);
+    return API_FLIGHT_RECORDER_EXIT(L0::Context::fromHandle(hContext)->createSampler(hDevice, desc, phSampler));
 }
 
 ze_result_t zeSamplerDestroy(
     ze_sampler_handle_t hSampler) {
-    return L0::Sampler::fromHandle(hSampler)->destroy();
+    API_FLIGHT_RECORDER_ENTER(&hSampler);
+    return API_FLIGHT_RECORDER_EXIT(L0::Sampler::fromHandle(hSampler)->destroy());
 }
 
 } // namespace L0
@@ -16,6 +16,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/prefetch_manager.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -83,6 +84,33 @@ void CommandList::removeMemoryPrefetchAllocations() {
     }
 }
 
+void CommandList::learnKernelSharedAllocationsAccesses(Kernel *kernel) {
+    if (!this->prefetchContext.accessPatternLearningEnabled) {
+        return;
+    }
+    auto memoryManager = this->device->getDriverHandle()->getMemoryManager();
+    auto prefetchManager = memoryManager->getPrefetchManager();
+    if (!prefetchManager || !memoryManager->isKmdMigrationAvailable(this->device->getRootDeviceIndex())) {
+        return;
+    }
+
+    auto svmAllocsManager = this->device->getDriverHandle()->getSvmAllocsManager();
+    std::vector<const void *> sharedAllocations;
+    for (auto allocation : kernel->getResidencyContainer()) {
+        if (allocation == nullptr) {
+            continue;
+        }
+        auto ptr = reinterpret_cast<const void *>(allocation->getGpuAddress());
+        auto allocData = svmAllocsManager->getSVMAlloc(ptr);
+        if (allocData && allocData->memoryType == InternalMemoryType::sharedUnifiedMemory) {
+            sharedAllocations.push_back(ptr);
+        }
+    }
+
+    prefetchManager->learnKernelAccesses(this->prefetchContext, kernel->getImmutableData(), sharedAllocations);
+    this->performMemoryPrefetch |= !this->prefetchContext.allocations.empty();
+}
+
 NEO::GraphicsAllocation *CommandList::getAllocationFromHostPtrMap(const void *buffer, uint64_t bufferSize) {
     auto allocation = hostPtrMap.lower_bound(buffer);
     if (allocation != hostPtrMap.end()) {
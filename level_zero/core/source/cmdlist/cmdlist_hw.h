@@ -141,7 +141,9 @@ struct CommandListCoreFamily : public CommandListImp {
                                  ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) override;
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
+                                    size_t dstOffset,
                                     NEO::GraphicsAllocation *srcAllocation,
+                                    size_t srcOffset,
                                     size_t size,
                                     bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
@@ -377,6 +379,7 @@ struct CommandListCoreFamily : public CommandListImp {
     bool isDeviceToHostBcsCopy(NEO::GraphicsAllocation *srcAllocation, NEO::GraphicsAllocation *dstAllocation) const;
 
     NEO::InOrderPatchCommandsContainer<GfxFamily> inOrderPatchCmds;
+    NEO::InOrderPatchCommandHelpers::BatchedPatchCmds<GfxFamily> inOrderBatchedPatchCmds;
 
     uint64_t latestHostWaitedInOrderSyncValue = 0;
     bool latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
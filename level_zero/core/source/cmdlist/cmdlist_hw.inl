@@ -153,6 +153,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     taskCountUpdateFenceRequired = false;
 
     this->inOrderPatchCmds.clear();
+    this->inOrderBatchedPatchCmds.clear();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -401,6 +402,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
 
     auto res = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandle), threadGroupDimensions,
                                             event, launchParams);
+    if (res == ZE_RESULT_SUCCESS) {
+        learnKernelSharedAllocationsAccesses(Kernel::fromHandle(kernelHandle));
+    }
 
     if (!launchParams.skipInOrderNonWalkerSignaling) {
         handleInOrderDependencyCounter(event, isInOrderNonWalkerSignalingRequired(event));
@@ -1399,7 +1403,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
+                                                                      size_t dstOffset,
                                                                       NEO::GraphicsAllocation *srcAllocation,
+                                                                      size_t srcOffset,
                                                                       size_t size, bool flushHost) {
 
     size_t middleElSize = sizeof(uint32_t) * 4;
@@ -1414,17 +1420,17 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
     uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
     ze_result_t ret = ZE_RESULT_ERROR_UNKNOWN;
     if (isCopyOnly()) {
-        return appendMemoryCopyBlit(dstAddress, dstAllocation, 0u,
-                                    srcAddress, srcAllocation, 0u,
+        return appendMemoryCopyBlit(dstAddress, dstAllocation, dstOffset,
+                                    srcAddress, srcAllocation, srcOffset,
                                     size);
     } else {
         CmdListKernelLaunchParams launchParams = {};
         launchParams.isKernelSplitOperation = rightSize > 0;
         launchParams.numKernelsInSplitLaunch = 2;
         ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                           dstAllocation, 0,
+                                           dstAllocation, dstOffset,
                                            reinterpret_cast<void *>(&srcAddress),
-                                           srcAllocation, 0,
+                                           srcAllocation, srcOffset,
                                            size - rightSize,
                                            middleElSize,
                                            Builtin::copyBufferToBufferMiddle,
@@ -1434,9 +1440,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         launchParams.numKernelsExecutedInSplitLaunch++;
         if (ret == ZE_RESULT_SUCCESS && rightSize) {
             ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                               dstAllocation, size - rightSize,
+                                               dstAllocation, dstOffset + size - rightSize,
                                                reinterpret_cast<void *>(&srcAddress),
-                                               srcAllocation, size - rightSize,
+                                               srcAllocation, srcOffset + size - rightSize,
                                                rightSize, 1UL,
                                                Builtin::copyBufferToBufferSide,
                                                nullptr,
@@ -3873,6 +3879,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 size_t CommandListCoreFamily<gfxCoreFamily>::addCmdForPatching(std::shared_ptr<NEO::InOrderExecInfo> *externalInOrderExecInfo, void *cmd1, void *cmd2, uint64_t counterValue, NEO::InOrderPatchCommandHelpers::PatchCmdType patchCmdType) {
     if ((NEO::debugManager.flags.EnableInOrderRegularCmdListPatching.get() != 0) && !isImmediateType()) {
         this->inOrderPatchCmds.emplace_back(externalInOrderExecInfo, cmd1, cmd2, counterValue, patchCmdType, this->inOrderAtomicSignalingEnabled, this->duplicatedInOrderCounterStorageEnabled);
+        this->inOrderBatchedPatchCmds.invalidate();
         return this->inOrderPatchCmds.size() - 1;
     }
     return 0;
@@ -3892,6 +3899,14 @@ void CommandListCoreFamily<gfxCoreFamily>::patchInOrderCmds() {
         hasRgularCmdListSubmissionCounter = (inOrderExecInfo->getRegularCmdListSubmissionCounter() > 1);
     }
 
+    if (NEO::debugManager.flags.EnableInOrderBatchedPatching.get() == 1) {
+        if (!inOrderBatchedPatchCmds.isValid()) {
+            inOrderBatchedPatchCmds.build(inOrderPatchCmds);
+        }
+        inOrderBatchedPatchCmds.patch(inOrderPatchCmds, implicitAppendCounter, hasRgularCmdListSubmissionCounter);
+        return;
+    }
+
     for (auto &cmd : inOrderPatchCmds) {
         if (cmd.isExternalDependency() || hasRgularCmdListSubmissionCounter) {
             cmd.patch(implicitAppendCounter);
@@ -3963,18 +3978,21 @@ void CommandListCoreFamily<gfxCoreFamily>::updateInOrderExecInfo(size_t inOrderP
     auto &patchCmd = inOrderPatchCmds[inOrderPatchIndex];
     patchCmd.updateInOrderExecInfo(inOrderExecInfo);
     patchCmd.setSkipPatching(disablePatchingFlag);
+    inOrderBatchedPatchCmds.invalidate();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 inline void CommandListCoreFamily<gfxCoreFamily>::disablePatching(size_t inOrderPatchIndex) {
     auto &patchCmd = inOrderPatchCmds[inOrderPatchIndex];
     patchCmd.setSkipPatching(true);
+    inOrderBatchedPatchCmds.invalidate();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 inline void CommandListCoreFamily<gfxCoreFamily>::enablePatching(size_t inOrderPatchIndex) {
     auto &patchCmd = inOrderPatchCmds[inOrderPatchIndex];
     patchCmd.setSkipPatching(false);
+    inOrderBatchedPatchCmds.invalidate();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -99,7 +99,9 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     ze_result_t appendEventReset(ze_event_handle_t hEvent) override;
 
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
+                                    size_t dstOffset,
                                     NEO::GraphicsAllocation *srcAllocation,
+                                    size_t srcOffset,
                                     size_t size, bool flushHost) override;
 
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, CommandToPatchContainer *outWaitCmds,
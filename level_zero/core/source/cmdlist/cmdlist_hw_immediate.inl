@@ -719,7 +719,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
+                                                                               size_t dstOffset,
                                                                                NEO::GraphicsAllocation *srcAllocation,
+                                                                               size_t srcOffset,
                                                                                size_t size, bool flushHost) {
 
     checkAvailableSpace(0, false, commonImmediateCommandSize);
@@ -733,8 +735,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 
     if (isSplitNeeded) {
         relaxedOrdering = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
-        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
-        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
+        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress() + dstOffset);
+        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress() + srcOffset);
         ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, 0u, nullptr, false, relaxedOrdering, direction, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             this->appendMemoryCopyBlit(dstAddressParam, dstAllocation, 0u,
                                        srcAddressParam, srcAllocation, 0u,
@@ -742,7 +744,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
             return CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEventParam);
         });
     } else {
-        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, size, flushHost);
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, dstOffset, srcAllocation, srcOffset, size, flushHost);
     }
     return flushImmediate(ret, false, false, relaxedOrdering, true, nullptr);
 }
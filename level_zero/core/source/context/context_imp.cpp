@@ -132,6 +132,15 @@ ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
         unifiedMemoryProperties.allocationFlags.hostptr = reinterpret_cast<uintptr_t>(*ptr);
     }
 
+    if (lookupTable.isNumaNodeRequested) {
+        for (auto rootDeviceIndex : this->rootDeviceIndices) {
+            if (!this->driverHandle->getMemoryManager()->isHostNumaNodeSelectionSupported(rootDeviceIndex)) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+        }
+        unifiedMemoryProperties.allocationFlags.numaNode = static_cast<int32_t>(lookupTable.numaNode);
+    }
+
     auto usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
                                                                                           unifiedMemoryProperties);
     if (usmPtr == nullptr) {
@@ -957,6 +966,7 @@ ze_result_t ContextImp::createCommandList(ze_device_handle_t hDevice,
     auto ret = L0::Device::fromHandle(hDevice)->createCommandList(desc, commandList);
     if (*commandList) {
         L0::CommandList::fromHandle(*commandList)->setCmdListContext(this->toHandle());
+        L0::CommandList::fromHandle(*commandList)->getPrefetchContext().accessPatternLearningEnabled = this->learningPrefetchEnabled;
     }
     return ret;
 }
@@ -967,6 +977,7 @@ ze_result_t ContextImp::createCommandListImmediate(ze_device_handle_t hDevice,
     auto ret = L0::Device::fromHandle(hDevice)->createCommandListImmediate(desc, commandList);
     if (*commandList) {
         L0::CommandList::fromHandle(*commandList)->setCmdListContext(this->toHandle());
+        L0::CommandList::fromHandle(*commandList)->getPrefetchContext().accessPatternLearningEnabled = this->learningPrefetchEnabled;
     }
     return ret;
 }
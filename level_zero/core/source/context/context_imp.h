@@ -174,6 +174,12 @@ struct ContextImp : Context {
         this->numDevices = static_cast<uint32_t>(this->deviceHandles.size());
     }
     NEO::VirtualMemoryReservation *findSupportedVirtualReservation(const void *ptr, size_t size);
+    void setLearningPrefetchEnabled(bool enabled) {
+        this->learningPrefetchEnabled = enabled;
+    }
+    bool isLearningPrefetchEnabled() const {
+        return learningPrefetchEnabled;
+    }
     ze_result_t checkMemSizeLimit(Device *inDevice, size_t size, bool relaxedSizeAllowed, void **ptr);
 
     ze_result_t getPitchFor2dImage(
@@ -193,6 +199,7 @@ struct ContextImp : Context {
     std::vector<ze_device_handle_t> deviceHandles;
     DriverHandleImp *driverHandle = nullptr;
     uint32_t numDevices = 0;
+    bool learningPrefetchEnabled = false;
 };
 
 } // namespace L0
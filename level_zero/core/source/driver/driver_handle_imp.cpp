@@ -57,8 +57,8 @@ ze_result_t DriverHandleImp::createContext(const ze_context_desc_t *desc,
         return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
 
-    if (desc->pNext) {
-        const ze_base_desc_t *expDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    const ze_base_desc_t *expDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (expDesc) {
         if (expDesc->stype == ZE_STRUCTURE_TYPE_POWER_SAVING_HINT_EXP_DESC) {
             const ze_context_power_saving_hint_exp_desc_t *powerHintExpDesc =
                 reinterpret_cast<const ze_context_power_saving_hint_exp_desc_t *>(expDesc);
@@ -68,7 +68,15 @@ ze_result_t DriverHandleImp::createContext(const ze_context_desc_t *desc,
                 delete context;
                 return ZE_RESULT_ERROR_INVALID_ENUMERATION;
             }
+        } else if (expDesc->stype == ZEX_INTEL_STRUCTURE_TYPE_CONTEXT_LEARNING_PREFETCH_EXP_DESC) {
+            const zex_intel_context_learning_prefetch_exp_desc_t *learningPrefetchDesc =
+                reinterpret_cast<const zex_intel_context_learning_prefetch_exp_desc_t *>(expDesc);
+            context->setLearningPrefetchEnabled(learningPrefetchDesc->enable);
         }
+        expDesc = reinterpret_cast<const ze_base_desc_t *>(expDesc->pNext);
+    }
+    if (NEO::debugManager.flags.EnableLearningPrefetchForKmdMigratedSharedAllocations.get() != -1) {
+        context->setLearningPrefetchEnabled(NEO::debugManager.flags.EnableLearningPrefetchForKmdMigratedSharedAllocations.get() == 1);
     }
 
     *phContext = context->toHandle();
@@ -157,6 +165,14 @@ ze_result_t DriverHandleImp::getExtensionProperties(uint32_t *pCount,
         additionalExtensions.emplace_back(ZE_SYNCHRONIZED_DISPATCH_EXP_NAME, ZE_SYNCHRONIZED_DISPATCH_EXP_VERSION_CURRENT);
     }
 
+    bool hostNumaNodeSelectionSupported = true;
+    for (const auto device : devices) {
+        hostNumaNodeSelectionSupported &= memoryManager->isHostNumaNodeSelectionSupported(device->getRootDeviceIndex());
+    }
+    if (hostNumaNodeSelectionSupported) {
+        additionalExtensions.emplace_back(ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_NAME, ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_VERSION_CURRENT);
+    }
+
     auto extensionCount = static_cast<uint32_t>(this->extensionsSupported.size() + additionalExtensions.size());
 
     if (nullptr == pExtensionProperties) {
@@ -73,6 +73,9 @@ struct EventImp : public Event {
     void getSynchronizedKernelTimestamps(ze_synchronized_timestamp_result_ext_t *pSynchronizedTimestampsBuffer,
                                          const uint32_t count, const ze_kernel_timestamp_result_t *pKernelTimestampsBuffer);
     void copyDataToEventAlloc(void *dstHostAddr, uint64_t dstGpuVa, size_t copySize, const uint64_t &copyData);
+    size_t readKernelTimestampPackets();
+
+    std::vector<NEO::TimestampPacketValues> kernelTimestampPackets;
 };
 
 } // namespace L0
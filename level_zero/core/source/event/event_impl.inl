@@ -155,13 +155,23 @@ EventImp<TagSizeT>::EventImp(int index, Device *device, bool tbxMode)
     singlePacketSize = device->getL0GfxCoreHelper().getImmediateWritePostSyncOffset();
 }
 
+template <typename TagSizeT>
+size_t EventImp<TagSizeT>::readKernelTimestampPackets() {
+    kernelTimestampPackets.clear();
+    return NEO::TimestampPacketReadout::readPacketSets(kernelEventCompletionData.get(), kernelCount, kernelTimestampPackets);
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::calculateProfilingData() {
     constexpr uint32_t skipL3EventPacketIndex = 2u;
-    globalStartTS = kernelEventCompletionData[0].getGlobalStartValue(0);
-    globalEndTS = kernelEventCompletionData[0].getGlobalEndValue(0);
-    contextStartTS = kernelEventCompletionData[0].getContextStartValue(0);
-    contextEndTS = kernelEventCompletionData[0].getContextEndValue(0);
+    readKernelTimestampPackets();
+    if (kernelTimestampPackets.empty()) {
+        return ZE_RESULT_SUCCESS;
+    }
+    globalStartTS = kernelTimestampPackets[0].globalStart;
+    globalEndTS = kernelTimestampPackets[0].globalEnd;
+    contextStartTS = kernelTimestampPackets[0].contextStart;
+    contextEndTS = kernelTimestampPackets[0].contextEnd;
 
     auto getEndTS = [](bool &isOverflowed, const std::pair<uint64_t, uint64_t> &currTs, const uint64_t &end) {
         auto &[currStartTs, currEndTs] = currTs;
@@ -185,22 +195,23 @@ ze_result_t EventImp<TagSizeT>::calculateProfilingData() {
     bool isGlobalTsOverflowed = false;
     bool isContextTsOverflowed = false;
 
+    const NEO::TimestampPacketValues *kernelPackets = kernelTimestampPackets.data();
     for (uint32_t kernelId = 0; kernelId < kernelCount; kernelId++) {
-        const auto &eventCompletion = kernelEventCompletionData[kernelId];
-        for (auto packetId = 0u; packetId < eventCompletion.getPacketsUsed(); packetId++) {
+        auto packetsUsed = std::min(kernelEventCompletionData[kernelId].getPacketsUsed(), NEO::TimestampPacketConstants::preferredPacketCount);
+        for (auto packetId = 0u; packetId < packetsUsed; packetId++) {
             if (this->l3FlushAppliedOnKernel.test(kernelId) && ((packetId % skipL3EventPacketIndex) != 0)) {
                 continue;
             }
-            const std::pair<uint64_t, uint64_t> currentGlobal(eventCompletion.getGlobalStartValue(packetId),
-                                                              eventCompletion.getGlobalEndValue(packetId));
-            const std::pair<uint64_t, uint64_t> currentContext(eventCompletion.getContextStartValue(packetId),
-                                                               eventCompletion.getContextEndValue(packetId));
+            const auto &packet = kernelPackets[packetId];
+            const std::pair<uint64_t, uint64_t> currentGlobal(packet.globalStart, packet.globalEnd);
+            const std::pair<uint64_t, uint64_t> currentContext(packet.contextStart, packet.contextEnd);
 
             globalStartTS = std::min(globalStartTS, currentGlobal.first);
             contextStartTS = std::min(contextStartTS, currentContext.first);
             globalEndTS = getEndTS(isGlobalTsOverflowed, currentGlobal, globalEndTS);
             contextEndTS = getEndTS(isContextTsOverflowed, currentContext, contextEndTS);
         }
+        kernelPackets += packetsUsed;
     }
     return ZE_RESULT_SUCCESS;
 }
@@ -673,7 +684,6 @@ ze_result_t EventImp<TagSizeT>::queryKernelTimestamp(ze_kernel_timestamp_result_
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) {
-    uint32_t timestampPacket = 0;
     uint64_t globalStartTs, globalEndTs, contextStartTs, contextEndTs;
     globalStartTs = globalEndTs = contextStartTs = contextEndTs = Event::STATE_INITIAL;
     bool isStaticPartitioning = true;
@@ -694,25 +704,26 @@ ze_result_t EventImp<TagSizeT>::queryTimestampsExp(Device *device, uint32_t *cou
         return ZE_RESULT_SUCCESS;
     }
 
-    for (auto i = 0u; i < *count; i++) {
+    auto packetsRead = std::min(static_cast<uint32_t>(readKernelTimestampPackets()), *count);
+
+    for (auto i = 0u; i < packetsRead; i++) {
         ze_kernel_timestamp_result_t &result = *(timestamps + i);
 
         auto queryTsEventAssignFunc = [&](uint64_t &timestampFieldForWriting, uint64_t &timestampFieldToCopy) {
             memcpy_s(&timestampFieldForWriting, sizeof(uint64_t), static_cast<void *>(&timestampFieldToCopy), sizeof(uint64_t));
         };
 
-        auto packetId = i;
-
-        globalStartTs = kernelEventCompletionData[timestampPacket].getGlobalStartValue(packetId);
-        contextStartTs = kernelEventCompletionData[timestampPacket].getContextStartValue(packetId);
-        contextEndTs = kernelEventCompletionData[timestampPacket].getContextEndValue(packetId);
-        globalEndTs = kernelEventCompletionData[timestampPacket].getGlobalEndValue(packetId);
+        globalStartTs = kernelTimestampPackets[i].globalStart;
+        contextStartTs = kernelTimestampPackets[i].contextStart;
+        contextEndTs = kernelTimestampPackets[i].contextEnd;
+        globalEndTs = kernelTimestampPackets[i].globalEnd;
 
         queryTsEventAssignFunc(result.global.kernelStart, globalStartTs);
         queryTsEventAssignFunc(result.context.kernelStart, contextStartTs);
         queryTsEventAssignFunc(result.global.kernelEnd, globalEndTs);
         queryTsEventAssignFunc(result.context.kernelEnd, contextEndTs);
     }
+    *count = packetsRead;
 
     return ZE_RESULT_SUCCESS;
 }
@@ -750,34 +761,36 @@ void EventImp<TagSizeT>::getSynchronizedKernelTimestamps(ze_synchronized_timesta
     // Get offset between Device and Host timestamps
     const int64_t tsOffsetInNs = referenceHostTsInNs - deviceTsInNs;
 
-    auto calculateSynchronizedTs = [&](ze_synchronized_timestamp_data_ext_t *synchronizedTs, const ze_kernel_timestamp_data_t *deviceTs) {
+    // Global start ticks and global/context durations of all timestamps are converted to nanoseconds in one pass
+    std::vector<uint64_t> ticks(3 * static_cast<size_t>(count));
+    std::vector<uint64_t> ticksInNs(ticks.size());
+    auto globalStartTicks = ticks.data();
+    auto globalDurationTicks = globalStartTicks + count;
+    auto contextDurationTicks = globalDurationTicks + count;
+    for (uint32_t index = 0; index < count; index++) {
+        globalStartTicks[index] = pKernelTimestampsBuffer[index].global.kernelStart;
+        globalDurationTicks[index] = getDuration(pKernelTimestampsBuffer[index].global.kernelStart, pKernelTimestampsBuffer[index].global.kernelEnd);
+        contextDurationTicks[index] = getDuration(pKernelTimestampsBuffer[index].context.kernelStart, pKernelTimestampsBuffer[index].context.kernelEnd);
+    }
+    NEO::TimestampPacketReadout::convertTicksToNanoseconds(ticks.data(), ticksInNs.data(), ticks.size(), resolution);
+
+    const auto globalStartNs = ticksInNs.data();
+    const auto globalDurationNs = globalStartNs + count;
+    const auto contextDurationNs = globalDurationNs + count;
+    for (uint32_t index = 0; index < count; index++) {
         // Add the offset to the kernel timestamp to find the start timestamp on the CPU timescale
         int64_t offset = tsOffsetInNs;
-        uint64_t startTimeStampInNs = static_cast<uint64_t>(deviceTs->kernelStart * resolution) + offset;
+        uint64_t startTimeStampInNs = globalStartNs[index] + offset;
         if (startTimeStampInNs < referenceHostTsInNs) {
             offset += static_cast<uint64_t>(maxNBitValue(gfxCoreHelper.getGlobalTimeStampBits()) * resolution);
-            startTimeStampInNs = static_cast<uint64_t>(deviceTs->kernelStart * resolution) + offset;
+            startTimeStampInNs = globalStartNs[index] + offset;
         }
 
-        // Get the kernel timestamp duration
-        uint64_t deviceDuration = getDuration(deviceTs->kernelStart, deviceTs->kernelEnd);
-        uint64_t deviceDurationNs = static_cast<uint64_t>(deviceDuration * resolution);
         // Add the duration to the startTimeStamp to get the endTimeStamp
-        uint64_t endTimeStampInNs = startTimeStampInNs + deviceDurationNs;
-
-        synchronizedTs->kernelStart = startTimeStampInNs;
-        synchronizedTs->kernelEnd = endTimeStampInNs;
-    };
-
-    for (uint32_t index = 0; index < count; index++) {
-        calculateSynchronizedTs(&pSynchronizedTimestampsBuffer[index].global, &pKernelTimestampsBuffer[index].global);
-
-        pSynchronizedTimestampsBuffer[index].context.kernelStart = pSynchronizedTimestampsBuffer[index].global.kernelStart;
-        uint64_t deviceDuration = getDuration(pKernelTimestampsBuffer[index].context.kernelStart,
-                                              pKernelTimestampsBuffer[index].context.kernelEnd);
-        uint64_t deviceDurationNs = static_cast<uint64_t>(deviceDuration * resolution);
-        pSynchronizedTimestampsBuffer[index].context.kernelEnd = pSynchronizedTimestampsBuffer[index].context.kernelStart +
-                                                                 deviceDurationNs;
+        pSynchronizedTimestampsBuffer[index].global.kernelStart = startTimeStampInNs;
+        pSynchronizedTimestampsBuffer[index].global.kernelEnd = startTimeStampInNs + globalDurationNs[index];
+        pSynchronizedTimestampsBuffer[index].context.kernelStart = startTimeStampInNs;
+        pSynchronizedTimestampsBuffer[index].context.kernelEnd = startTimeStampInNs + contextDurationNs[index];
     }
 }
 
@@ -38,6 +38,8 @@ enum class RTASDeviceFormatInternal {
 };
 
 struct Event;
+struct StallSumIpData;
+class StallSumIpDataMap;
 struct Device;
 struct EventPool;
 
@@ -94,9 +96,8 @@ class L0GfxCoreHelper : public NEO::ApiGfxCoreHelper {
     virtual ze_mutable_command_exp_flags_t getPlatformCmdListUpdateCapabilities() const = 0;
     virtual void appendPlatformSpecificExtensions(std::vector<std::pair<std::string, uint32_t>> &extensions, const NEO::ProductHelper &productHelper, const NEO::HardwareInfo &hwInfo) const = 0;
     virtual std::vector<std::pair<const char *, const char *>> getStallSamplingReportMetrics() const = 0;
-    virtual void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) = 0;
-    virtual bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) = 0;
-    virtual void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) = 0;
+    virtual void stallSumIpDataToTypedValues(uint64_t ip, const StallSumIpData &sumIpData, std::vector<zet_typed_value_t> &ipDataValues) = 0;
+    virtual bool stallIpDataMapUpdate(StallSumIpDataMap &stallSumIpDataMap, const uint8_t *pRawIpData, size_t rawReportCount) = 0;
     virtual bool synchronizedDispatchSupported() const = 0;
     virtual bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const = 0;
 
@@ -142,9 +143,8 @@ class L0GfxCoreHelperHw : public L0GfxCoreHelper {
     ze_mutable_command_exp_flags_t getPlatformCmdListUpdateCapabilities() const override;
     void appendPlatformSpecificExtensions(std::vector<std::pair<std::string, uint32_t>> &extensions, const NEO::ProductHelper &productHelper, const NEO::HardwareInfo &hwInfo) const override;
     std::vector<std::pair<const char *, const char *>> getStallSamplingReportMetrics() const override;
-    void stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) override;
-    bool stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) override;
-    void stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) override;
+    void stallSumIpDataToTypedValues(uint64_t ip, const StallSumIpData &sumIpData, std::vector<zet_typed_value_t> &ipDataValues) override;
+    bool stallIpDataMapUpdate(StallSumIpDataMap &stallSumIpDataMap, const uint8_t *pRawIpData, size_t rawReportCount) override;
     bool synchronizedDispatchSupported() const override;
     bool implicitSynchronizedDispatchForCooperativeKernelsAllowed() const override;
 
@@ -9,8 +9,9 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_stall_data.h"
 
-#include <map>
+#include <cstring>
 
 namespace L0 {
 
@@ -57,116 +58,81 @@ bool L0GfxCoreHelperHw<Family>::forceDefaultUsmCompressionSupport() const {
  *
  * total size 64 bytes
  */
-typedef struct StallSumIpData {
-    uint64_t activeCount;
-    uint64_t otherCount;
-    uint64_t controlCount;
-    uint64_t pipeStallCount;
-    uint64_t sendCount;
-    uint64_t distAccCount;
-    uint64_t sbidCount;
-    uint64_t syncCount;
-    uint64_t instFetchCount;
-} StallSumIpData_t;
-
 template <typename Family>
-void L0GfxCoreHelperHw<Family>::stallIpDataMapDelete(std::map<uint64_t, void *> &stallSumIpDataMap) {
-    for (auto i = stallSumIpDataMap.begin(); i != stallSumIpDataMap.end(); i++) {
-        StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(i->second);
-        if (stallSumData) {
-            delete stallSumData;
-        }
+bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(StallSumIpDataMap &stallSumIpDataMap, const uint8_t *pRawIpData, size_t rawReportCount) {
+    constexpr size_t rawReportSize = 64u;
+    constexpr uint64_t ipMask = 0x1fffffff;
+    constexpr uint32_t ipBits = 29u;
+    constexpr uint64_t countMask = 0xff;
+    constexpr uint16_t overflowDropFlag = (1 << 8);
+
+    bool dataOverflow = false;
+    for (size_t report = 0; report < rawReportCount; report++, pRawIpData += rawReportSize) {
+        uint64_t rawData[2];
+        memcpy(rawData, pRawIpData, sizeof(rawData));
+
+        // eight 8 bit counts following IP are moved to consecutive bytes of one word with a single funnel shift
+        const uint64_t counts = (rawData[0] >> ipBits) | (rawData[1] << (64u - ipBits));
+        auto &stallSumData = stallSumIpDataMap.get(rawData[0] & ipMask);
+        stallSumData.activeCount += counts & countMask;
+        stallSumData.otherCount += (counts >> 8) & countMask;
+        stallSumData.controlCount += (counts >> 16) & countMask;
+        stallSumData.pipeStallCount += (counts >> 24) & countMask;
+        stallSumData.sendCount += (counts >> 32) & countMask;
+        stallSumData.distAccCount += (counts >> 40) & countMask;
+        stallSumData.sbidCount += (counts >> 48) & countMask;
+        stallSumData.syncCount += counts >> 56;
+        stallSumData.instFetchCount += (rawData[1] >> ipBits) & countMask;
+
+        uint16_t flags = 0;
+        memcpy(&flags, pRawIpData + 50, sizeof(flags));
+        dataOverflow |= (flags & overflowDropFlag) != 0;
     }
-}
-
-template <typename Family>
-bool L0GfxCoreHelperHw<Family>::stallIpDataMapUpdate(std::map<uint64_t, void *> &stallSumIpDataMap, const uint8_t *pRawIpData) {
-    const uint8_t *tempAddr = pRawIpData;
-    uint64_t ip = 0ULL;
-    memcpy_s(reinterpret_cast<uint8_t *>(&ip), sizeof(ip), tempAddr, sizeof(ip));
-    ip &= 0x1fffffff;
-    StallSumIpData_t *stallSumData = nullptr;
-    if (stallSumIpDataMap.count(ip) == 0) {
-        stallSumData = new StallSumIpData_t{};
-        stallSumIpDataMap[ip] = stallSumData;
-    } else {
-        stallSumData = reinterpret_cast<StallSumIpData_t *>(stallSumIpDataMap[ip]);
-    }
-    tempAddr += 3;
-
-    auto getCount = [&tempAddr]() {
-        uint16_t tempCount = 0;
-        memcpy_s(reinterpret_cast<uint8_t *>(&tempCount), sizeof(tempCount), tempAddr, sizeof(tempCount));
-        tempCount = (tempCount >> 5) & 0xff;
-        tempAddr += 1;
-        return static_cast<uint8_t>(tempCount);
-    };
-
-    stallSumData->activeCount += getCount();
-    stallSumData->otherCount += getCount();
-    stallSumData->controlCount += getCount();
-    stallSumData->pipeStallCount += getCount();
-    stallSumData->sendCount += getCount();
-    stallSumData->distAccCount += getCount();
-    stallSumData->sbidCount += getCount();
-    stallSumData->syncCount += getCount();
-    stallSumData->instFetchCount += getCount();
-
-    struct StallCntrInfo {
-        uint16_t subslice;
-        uint16_t flags;
-    } stallCntrInfo = {};
-
-    tempAddr = pRawIpData + 48;
-    memcpy_s(reinterpret_cast<uint8_t *>(&stallCntrInfo), sizeof(stallCntrInfo), tempAddr, sizeof(stallCntrInfo));
-
-    constexpr int overflowDropFlag = (1 << 8);
-    return stallCntrInfo.flags & overflowDropFlag;
+    return dataOverflow;
 }
 
 // The order of push_back calls must match the order of stallSamplingReportList.
 template <typename Family>
-void L0GfxCoreHelperHw<Family>::stallSumIpDataToTypedValues(uint64_t ip, void *sumIpData, std::vector<zet_typed_value_t> &ipDataValues) {
-    StallSumIpData_t *stallSumData = reinterpret_cast<StallSumIpData_t *>(sumIpData);
+void L0GfxCoreHelperHw<Family>::stallSumIpDataToTypedValues(uint64_t ip, const StallSumIpData &sumIpData, std::vector<zet_typed_value_t> &ipDataValues) {
     zet_typed_value_t tmpValueData;
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
     tmpValueData.value.ui64 = ip;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->activeCount;
+    tmpValueData.value.ui64 = sumIpData.activeCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->controlCount;
+    tmpValueData.value.ui64 = sumIpData.controlCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->pipeStallCount;
+    tmpValueData.value.ui64 = sumIpData.pipeStallCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->sendCount;
+    tmpValueData.value.ui64 = sumIpData.sendCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->distAccCount;
+    tmpValueData.value.ui64 = sumIpData.distAccCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->sbidCount;
+    tmpValueData.value.ui64 = sumIpData.sbidCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->syncCount;
+    tmpValueData.value.ui64 = sumIpData.syncCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->instFetchCount;
+    tmpValueData.value.ui64 = sumIpData.instFetchCount;
     ipDataValues.push_back(tmpValueData);
 
     tmpValueData.type = ZET_VALUE_TYPE_UINT64;
-    tmpValueData.value.ui64 = stallSumData->otherCount;
+    tmpValueData.value.ui64 = sumIpData.otherCount;
     ipDataValues.push_back(tmpValueData);
 }
 
@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/buffered_log_writer.h"
+
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/sysman/source/driver/sysman_driver_handle_imp.h"
 
@@ -19,5 +21,6 @@ void globalDriverTeardown() {
         delete Sysman::globalSysmanDriver;
         Sysman::globalSysmanDriver = nullptr;
     }
+    NEO::BufferedLogWriter::stopAll();
 }
 } // namespace L0
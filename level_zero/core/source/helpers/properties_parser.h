@@ -12,9 +12,11 @@
 
 #include "level_zero/api/driver_experimental/public/ze_bindless_image_exp.h"
 #include "level_zero/api/driver_experimental/public/zex_common.h"
+#include "level_zero/include/ze_intel_gpu.h"
 #include <level_zero/ze_api.h>
 
 #include <cstdint>
+#include <limits>
 #include <optional>
 
 namespace L0 {
@@ -77,6 +79,8 @@ struct StructuresLookupTable {
     bool uncompressedHint;
     bool rayTracingMemory;
     bool bindlessImage;
+    bool isNumaNodeRequested;
+    uint32_t numaNode;
 };
 
 inline ze_result_t prepareL0StructuresLookupTable(StructuresLookupTable &lookupTable, const void *desc) {
@@ -154,6 +158,13 @@ inline ze_result_t prepareL0StructuresLookupTable(StructuresLookupTable &lookupT
             }
         } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_RAYTRACING_MEM_ALLOC_EXT_DESC) {
             lookupTable.rayTracingMemory = true;
+        } else if (extendedDesc->stype == ZEX_INTEL_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_NODE_EXP_DESC) {
+            auto numaNodeDesc = reinterpret_cast<const zex_intel_host_mem_alloc_numa_node_exp_desc_t *>(extendedDesc);
+            if (numaNodeDesc->numaNode > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            lookupTable.isNumaNodeRequested = true;
+            lookupTable.numaNode = numaNodeDesc->numaNode;
         } else {
             return ZE_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
@@ -22,10 +23,12 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     UNRECOVERABLE_IF(allocData == nullptr);
 
+    // ptr points to migrated chunk when allocation is migrated in chunks
+    auto offset = ptrDiff(ptr, allocData->cpuAllocation->getUnderlyingBuffer());
     auto ret =
-        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
-                                                             allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->size, true);
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation, offset,
+                                                             allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()), offset,
+                                                             size, true);
     UNRECOVERABLE_IF(ret);
 }
 void PageFaultManager::transferToGpu(void *ptr, void *device) {
@@ -35,13 +38,44 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
     UNRECOVERABLE_IF(allocData == nullptr);
 
     auto ret =
-        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->cpuAllocation,
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()), 0u,
+                                                             allocData->cpuAllocation, 0u,
                                                              allocData->size, false);
     UNRECOVERABLE_IF(ret);
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
 }
+void PageFaultManager::transferChunkToGpu(void *allocPtr, void *chunkPtr, size_t chunkSize, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(allocPtr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto offset = ptrDiff(chunkPtr, allocPtr);
+    auto ret =
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()), offset,
+                                                             allocData->cpuAllocation, offset,
+                                                             chunkSize, false);
+    UNRECOVERABLE_IF(ret);
+
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
+}
+bool PageFaultManager::isChunkedMigrationSupported() const {
+    return true;
+}
+bool PageFaultManager::isCpuMigrationBlocked(void *allocPtr, PageFaultData &pageFaultData) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(pageFaultData.cmdQ);
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(allocPtr);
+
+    auto memAdvise = deviceImp->memAdviseSharedAllocations.find(allocData);
+    if (memAdvise != deviceImp->memAdviseSharedAllocations.end()) {
+        if (memAdvise->second.readOnly && memAdvise->second.devicePreferredLocation) {
+            memAdvise->second.cpuMigrationBlocked = 1;
+            return true;
+        }
+    }
+    return false;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(pageFaultData.cmdQ);
 
@@ -62,15 +96,7 @@ namespace L0 {
 void transferAndUnprotectMemoryWithHints(NEO::PageFaultManager *pageFaultHandler, void *allocPtr, NEO::PageFaultManager::PageFaultData &pageFaultData) {
     bool migration = true;
     if (pageFaultData.domain == NEO::PageFaultManager::AllocationDomain::gpu) {
-        L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(pageFaultData.cmdQ);
-        NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(allocPtr);
-
-        if (deviceImp->memAdviseSharedAllocations.find(allocData) != deviceImp->memAdviseSharedAllocations.end()) {
-            if (deviceImp->memAdviseSharedAllocations[allocData].readOnly && deviceImp->memAdviseSharedAllocations[allocData].devicePreferredLocation) {
-                migration = false;
-                deviceImp->memAdviseSharedAllocations[allocData].cpuMigrationBlocked = 1;
-            }
-        }
+        migration = !pageFaultHandler->isCpuMigrationBlocked(allocPtr, pageFaultData);
         if (migration) {
             std::chrono::steady_clock::time_point start;
             std::chrono::steady_clock::time_point end;
@@ -80,6 +106,8 @@ void transferAndUnprotectMemoryWithHints(NEO::PageFaultManager *pageFaultHandler
             end = std::chrono::steady_clock::now();
             long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
             pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+            pageFaultData.statistics.transfersToCpu++;
+            pageFaultData.statistics.bytesTransferredToCpu += pageFaultData.size;
 
             if (NEO::debugManager.flags.PrintUmdSharedMigration.get()) {
                 printf("UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(allocPtr), pageFaultData.size, elapsedTime / 1e3);
@@ -37,6 +37,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/kernel_info.h"
@@ -515,6 +516,14 @@ ModuleImp::~ModuleImp() {
             destroyPrintfKernel(kernel->toHandle());
         }
     }
+    if (!this->kernelImmDatas.empty()) {
+        auto prefetchManager = this->device->getNEODevice()->getMemoryManager()->getPrefetchManager();
+        if (prefetchManager) {
+            for (auto &kernelImmData : this->kernelImmDatas) {
+                prefetchManager->removeKernelAccesses(kernelImmData.get());
+            }
+        }
+    }
     this->kernelImmDatas.clear();
     if (this->kernelsIsaParentRegion) {
         DEBUG_BREAK_IF(this->device->getNEODevice()->getMemoryManager() == nullptr);
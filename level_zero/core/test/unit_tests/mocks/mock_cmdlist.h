@@ -87,6 +87,7 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::indirectAllocationsAllowed;
     using BaseClass::initialize;
     using BaseClass::inOrderAtomicSignalingEnabled;
+    using BaseClass::inOrderBatchedPatchCmds;
     using BaseClass::inOrderExecInfo;
     using BaseClass::inOrderPatchCmds;
     using BaseClass::isFlushTaskSubmissionEnabled;
@@ -202,6 +203,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::hostSynchronize;
     using BaseClass::immediateCmdListHeapSharing;
     using BaseClass::inOrderAtomicSignalingEnabled;
+    using BaseClass::inOrderBatchedPatchCmds;
     using BaseClass::inOrderExecInfo;
     using BaseClass::inOrderPatchCmds;
     using BaseClass::isBcsSplitNeeded;
@@ -434,7 +436,9 @@ struct MockCommandList : public CommandList {
 
     ADDMETHOD_NOBASE(appendPageFaultCopy, ze_result_t, ZE_RESULT_SUCCESS,
                      (NEO::GraphicsAllocation * dstptr,
+                      size_t dstOffset,
                       NEO::GraphicsAllocation *srcptr,
+                      size_t srcOffset,
                       size_t size,
                       bool flushHost));
 
@@ -549,6 +549,53 @@ TEST_F(CommandListMemAdvisePageFault, givenValidPtrAndPageFaultHandlerAndGpuDoma
     ASSERT_EQ(res, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(CommandListMemAdvisePageFault, givenReadOnlyAndDevicePreferredHintsWhenChunkOfAllocationInGpuDomainIsAccessedThenChunkIsNotMigrated) {
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto res = context->allocDeviceMem(device->toHandle(),
+                                       &deviceDesc,
+                                       size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+
+    ze_result_t returnValue;
+    NEO::MemAdviseFlags flags;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, commandList);
+
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>((L0::Device::fromHandle(device)));
+
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_READ_MOSTLY);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    NEO::PageFaultManager::PageFaultData pageData;
+    pageData.cmdQ = deviceImp;
+    pageData.size = size;
+    pageData.domain = NEO::PageFaultManager::AllocationDomain::gpu;
+    pageData.chunkSize = size / 2;
+    pageData.cpuChunks.resize(2, false);
+    mockPageFaultManager->handleChunkFault(ptr, pageData, 1u);
+
+    EXPECT_EQ(0, mockPageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, mockPageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(ptrOffset(ptr, size / 2), mockPageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(size / 2, mockPageFaultManager->accessAllowedSize);
+    EXPECT_EQ(NEO::PageFaultManager::AllocationDomain::gpu, pageData.domain);
+    EXPECT_FALSE(pageData.cpuChunks[1]);
+    flags = deviceImp->memAdviseSharedAllocations[allocData];
+    EXPECT_EQ(1, flags.cpuMigrationBlocked);
+
+    res = context->freeMem(ptr);
+    ASSERT_EQ(res, ZE_RESULT_SUCCESS);
+}
+
 TEST_F(CommandListMemAdvisePageFault, givenValidPtrAndPageFaultHandlerAndGpuDomainHandlerWithHintsSetAndOnlyReadOnlyOrDevicePreferredHintThenHandlerAllowsCpuMigration) {
     size_t size = 10;
     size_t alignment = 1u;
@@ -1167,7 +1214,7 @@ HWTEST2_F(CommandListCreate, givenDirectSubmissionAndImmCmdListWhenDispatchingTh
 
     verifyFlags(commandList->appendSignalEvent(event), true, true);
 
-    verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), kernel.getIsaAllocation(), 1, false), false, false);
+    verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), 0u, kernel.getIsaAllocation(), 0u, 1, false), false, false);
 
     verifyFlags(commandList->appendWaitOnEvents(1, &event, nullptr, false, true, false, false), true, true);
 
@@ -1563,7 +1610,7 @@ HWTEST2_F(CommandListCreate, givenDirectSubmissionAndImmCmdListWhenDispatchingTh
 
         verifyFlags(commandList->appendSignalEvent(event), false, false);
 
-        verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), kernel.getIsaAllocation(), 1, false),
+        verifyFlags(commandList->appendPageFaultCopy(kernel.getIsaAllocation(), 0u, kernel.getIsaAllocation(), 0u, 1, false),
                     false, false);
 
         verifyFlags(commandList->appendWaitOnEvents(1, &event, nullptr, false, true, false, false), false, false);
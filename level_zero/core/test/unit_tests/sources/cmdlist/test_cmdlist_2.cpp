@@ -56,6 +56,8 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
                                              bool isStateless,
                                              CmdListKernelLaunchParams &launchParams) override {
         appendMemoryCopyKernelWithGACalledTimes++;
+        appendMemoryCopyKernelWithGADstOffsets.push_back(dstOffset);
+        appendMemoryCopyKernelWithGASrcOffsets.push_back(srcOffset);
         if (isStateless) {
             appendMemoryCopyKernelWithGAStatelessCalledTimes++;
         }
@@ -77,6 +79,8 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
                                      uint64_t srcOffset,
                                      uint64_t size) override {
         appendMemoryCopyBlitCalledTimes++;
+        appendMemoryCopyBlitDstOffset = dstOffset;
+        appendMemoryCopyBlitSrcOffset = srcOffset;
         if (failOnFirstCopy && appendMemoryCopyBlitCalledTimes == 1) {
             return ZE_RESULT_ERROR_UNKNOWN;
         }
@@ -171,6 +175,10 @@ class MockCommandListHw : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFam
     uint32_t appendBlitFillCalledTimes = 0;
     uint32_t appendCopyImageBlitCalledTimes = 0;
     uint32_t getAlignedAllocationCalledTimes = 0;
+    std::vector<uint64_t> appendMemoryCopyKernelWithGADstOffsets;
+    std::vector<uint64_t> appendMemoryCopyKernelWithGASrcOffsets;
+    uint64_t appendMemoryCopyBlitDstOffset = 0;
+    uint64_t appendMemoryCopyBlitSrcOffset = 0;
     bool failOnFirstCopy = false;
     bool useEvents = false;
     bool failAlignedAlloc = false;
@@ -335,7 +343,7 @@ HWTEST2_F(CommandListCreate, givenCommandListWhenPageFaultCopyCalledThenappendPa
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
 }
@@ -366,7 +374,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngi
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
 }
 
@@ -396,7 +404,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledThenappendPa
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 2u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
 }
@@ -427,7 +435,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledAndErrorOnMi
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 0u);
 }
@@ -455,10 +463,79 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngi
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
 }
 
+HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithOffsetsThenOffsetsArePassedToKernelCopies, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SelectCmdListHeapAddressModel.set(0);
+
+    MockCommandListHw<gfxCoreFamily> cmdList;
+    size_t allocationSize = MemoryConstants::pageSize * 4;
+    size_t size = MemoryConstants::pageSize + 1;
+    size_t dstOffset = MemoryConstants::pageSize;
+    size_t srcOffset = MemoryConstants::pageSize * 2;
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    auto ptr = reinterpret_cast<void *>(0x1234);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto canonizedGpuAddress = gmmHelper->canonize(castToUint64(ptr));
+    NEO::MockGraphicsAllocation mockAllocationSrc(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  allocationSize,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    NEO::MockGraphicsAllocation mockAllocationDst(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  allocationSize,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, dstOffset, &mockAllocationSrc, srcOffset, size, false);
+    ASSERT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 2u);
+    EXPECT_EQ(dstOffset, cmdList.appendMemoryCopyKernelWithGADstOffsets[0]);
+    EXPECT_EQ(srcOffset, cmdList.appendMemoryCopyKernelWithGASrcOffsets[0]);
+    EXPECT_EQ(dstOffset + size - 1, cmdList.appendMemoryCopyKernelWithGADstOffsets[1]);
+    EXPECT_EQ(srcOffset + size - 1, cmdList.appendMemoryCopyKernelWithGASrcOffsets[1]);
+}
+
+HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngineAndOffsetsThenOffsetsArePassedToBlit, IsAtLeastSkl) {
+    MockCommandListHw<gfxCoreFamily> cmdList;
+    size_t allocationSize = MemoryConstants::pageSize * 4;
+    size_t size = MemoryConstants::pageSize;
+    size_t dstOffset = MemoryConstants::pageSize;
+    size_t srcOffset = MemoryConstants::pageSize * 2;
+    cmdList.initialize(device, NEO::EngineGroupType::copy, 0u);
+    auto ptr = reinterpret_cast<void *>(0x1234);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto canonizedGpuAddress = gmmHelper->canonize(castToUint64(ptr));
+    NEO::MockGraphicsAllocation mockAllocationSrc(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  allocationSize,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    NEO::MockGraphicsAllocation mockAllocationDst(0,
+                                                  AllocationType::internalHostMemory,
+                                                  ptr,
+                                                  allocationSize,
+                                                  0u,
+                                                  MemoryPool::system4KBPages,
+                                                  MemoryManager::maxOsContextCount,
+                                                  canonizedGpuAddress);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, dstOffset, &mockAllocationSrc, srcOffset, size, false);
+    EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
+    EXPECT_EQ(dstOffset, cmdList.appendMemoryCopyBlitDstOffset);
+    EXPECT_EQ(srcOffset, cmdList.appendMemoryCopyBlitSrcOffset);
+}
+
 HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngineAndErrorOnMidOperationThenappendPageFaultCopyWithappendMemoryCopyKernelWithGACalledForMiddleIsCalled, IsAtLeastSkl) {
     MockCommandListHw<gfxCoreFamily> cmdList(true);
     size_t size = ((sizeof(uint32_t) * 4) + 1);
@@ -482,7 +559,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhenPageFaultCopyCalledWithCopyEngi
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyBlitCalledTimes, 1u);
 }
 
@@ -509,7 +586,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhen4GBytePageFaultCopyCalledThenPa
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 1u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 1u);
 }
@@ -537,7 +614,7 @@ HWTEST2_F(CommandListAppend, givenCommandListWhen4GBytePageFaultCopyCalledThenPa
                                                   MemoryPool::system4KBPages,
                                                   MemoryManager::maxOsContextCount,
                                                   canonizedGpuAddress);
-    cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, size, false);
+    cmdList.appendPageFaultCopy(&mockAllocationDst, 0u, &mockAllocationSrc, 0u, size, false);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGACalledTimes, 2u);
     EXPECT_EQ(cmdList.appendMemoryCopyKernelWithGAStatelessCalledTimes, 2u);
 }
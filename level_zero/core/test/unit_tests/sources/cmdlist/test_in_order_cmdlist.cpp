@@ -5462,6 +5462,46 @@ HWTEST2_F(InOrderRegularCmdListTests, whenUsingRegularCmdListThenAddCmdsToPatch,
     }
 }
 
+HWTEST2_F(InOrderRegularCmdListTests, givenBatchedPatchingEnabledWhenExecutingRegularCmdListThenPatchCmdsThroughBatches, IsAtLeastXeHpCore) {
+    using MI_STORE_DATA_IMM = typename FamilyType::MI_STORE_DATA_IMM;
+
+    debugManager.flags.EnableInOrderBatchedPatching.set(1);
+
+    ze_command_queue_desc_t desc = {};
+
+    auto mockCmdQHw = makeZeUniquePtr<MockCommandQueueHw<gfxCoreFamily>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQHw->initialize(true, false, false);
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(true);
+
+    uint32_t copyData = 0;
+
+    regularCmdList->appendMemoryCopy(&copyData, &copyData, 1, nullptr, 0, nullptr, false, false);
+    regularCmdList->appendMemoryCopy(&copyData, &copyData, 1, nullptr, 0, nullptr, false, false);
+    ASSERT_EQ(3u, regularCmdList->inOrderPatchCmds.size());
+    EXPECT_FALSE(regularCmdList->inOrderBatchedPatchCmds.isValid());
+
+    auto sdi1 = genCmdCast<MI_STORE_DATA_IMM *>(regularCmdList->inOrderPatchCmds[0].cmd1);
+    auto sdi2 = genCmdCast<MI_STORE_DATA_IMM *>(regularCmdList->inOrderPatchCmds[2].cmd1);
+    ASSERT_NE(nullptr, sdi1);
+    ASSERT_NE(nullptr, sdi2);
+
+    regularCmdList->close();
+
+    auto handle = regularCmdList->toHandle();
+
+    for (uint64_t executionCounter = 0; executionCounter < 3; executionCounter++) {
+        mockCmdQHw->executeCommandLists(1, &handle, nullptr, false, nullptr, 0, nullptr);
+        EXPECT_TRUE(regularCmdList->inOrderBatchedPatchCmds.isValid());
+
+        auto appendValue = regularCmdList->inOrderExecInfo->getCounterValue() * executionCounter;
+        EXPECT_EQ(getLowPart(1u + appendValue), sdi1->getDataDword0());
+        EXPECT_EQ(getLowPart(2u + appendValue), sdi2->getDataDword0());
+    }
+
+    regularCmdList->reset();
+    EXPECT_FALSE(regularCmdList->inOrderBatchedPatchCmds.isValid());
+}
+
 HWTEST2_F(InOrderRegularCmdListTests, givenCrossRegularCmdListDependenciesWhenExecutingThenDontPatchWhenExecutedOnlyOnce, IsAtLeastSkl) {
     using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
 
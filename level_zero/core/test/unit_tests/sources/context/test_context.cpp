@@ -29,6 +29,7 @@
 #include "level_zero/core/test/unit_tests/fixtures/host_pointer_manager_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_driver_handle.h"
+#include "level_zero/include/ze_intel_gpu.h"
 
 #include "gtest/gtest.h"
 
@@ -372,10 +373,12 @@ struct SVMAllocsManagerContextMock : public NEO::SVMAllocsManager {
                   memoryProperties.rootDeviceIndices.end());
         EXPECT_NE(std::find(memoryProperties.rootDeviceIndices.begin(), memoryProperties.rootDeviceIndices.end(), expectedRootDeviceIndexes[1]),
                   memoryProperties.rootDeviceIndices.end());
+        passedNumaNode = memoryProperties.allocationFlags.numaNode;
         return NEO::SVMAllocsManager::createHostUnifiedMemoryAllocation(size, memoryProperties);
     }
 
     std::vector<uint32_t> expectedRootDeviceIndexes;
+    int32_t passedNumaNode = -1;
 };
 
 struct ContextHostAllocTests : public ::testing::Test {
@@ -440,6 +443,98 @@ TEST_F(ContextHostAllocTests,
     context->destroy();
 }
 
+TEST_F(ContextHostAllocTests,
+       givenNumaNodeDescriptorWhenAllocatingHostMemoryThenRequestedNumaNodeIsPassedToAllocation) {
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+    ze_result_t res = driverHandle->createContext(&desc,
+                                                  numberOfDevicesInContext,
+                                                  zeDevices.data(),
+                                                  &hContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto context = static_cast<ContextImp *>(Context::fromHandle(hContext));
+
+    void *hostPtr = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    size_t size = 1024;
+    res = context->allocHostMem(&hostDesc, size, 0u, &hostPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(-1, currSvmAllocsManager->passedNumaNode);
+    context->freeMem(hostPtr);
+
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->hostNumaNodeSelectionSupported = true;
+    auto memoryManager = driverHandle->getMemoryManager();
+    driverHandle->setMemoryManager(mockMemoryManager.get());
+
+    zex_intel_host_mem_alloc_numa_node_exp_desc_t numaNodeDesc = {};
+    numaNodeDesc.stype = ZEX_INTEL_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_NODE_EXP_DESC;
+    numaNodeDesc.numaNode = 1u;
+    hostDesc.pNext = &numaNodeDesc;
+    res = context->allocHostMem(&hostDesc, size, 0u, &hostPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, hostPtr);
+    EXPECT_EQ(1, currSvmAllocsManager->passedNumaNode);
+    context->freeMem(hostPtr);
+
+    driverHandle->setMemoryManager(memoryManager);
+    context->destroy();
+}
+
+TEST_F(ContextHostAllocTests,
+       givenNumaNodeDescriptorWhenNumaNodeSelectionIsNotSupportedThenUnsupportedFeatureIsReturned) {
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+    ze_result_t res = driverHandle->createContext(&desc,
+                                                  numberOfDevicesInContext,
+                                                  zeDevices.data(),
+                                                  &hContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto context = static_cast<ContextImp *>(Context::fromHandle(hContext));
+
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->hostNumaNodeSelectionSupported = false;
+    auto memoryManager = driverHandle->getMemoryManager();
+    driverHandle->setMemoryManager(mockMemoryManager.get());
+
+    zex_intel_host_mem_alloc_numa_node_exp_desc_t numaNodeDesc = {};
+    numaNodeDesc.stype = ZEX_INTEL_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_NODE_EXP_DESC;
+    numaNodeDesc.numaNode = 1u;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    hostDesc.pNext = &numaNodeDesc;
+    void *hostPtr = nullptr;
+    res = context->allocHostMem(&hostDesc, 1024, 0u, &hostPtr);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(nullptr, hostPtr);
+
+    driverHandle->setMemoryManager(memoryManager);
+    context->destroy();
+}
+
+TEST_F(ContextHostAllocTests,
+       givenNumaNodeDescriptorWithInvalidNodeWhenAllocatingHostMemoryThenInvalidArgumentIsReturned) {
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+    ze_result_t res = driverHandle->createContext(&desc,
+                                                  numberOfDevicesInContext,
+                                                  zeDevices.data(),
+                                                  &hContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto context = static_cast<ContextImp *>(Context::fromHandle(hContext));
+
+    zex_intel_host_mem_alloc_numa_node_exp_desc_t numaNodeDesc = {};
+    numaNodeDesc.stype = ZEX_INTEL_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_NODE_EXP_DESC;
+    numaNodeDesc.numaNode = std::numeric_limits<uint32_t>::max();
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    hostDesc.pNext = &numaNodeDesc;
+    void *hostPtr = nullptr;
+    res = context->allocHostMem(&hostDesc, 1024, 0u, &hostPtr);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+    EXPECT_EQ(nullptr, hostPtr);
+
+    context->destroy();
+}
+
 using ContextGetStatusTest = Test<DeviceFixture>;
 TEST_F(ContextGetStatusTest, givenCallToContextGetStatusThenCorrectErrorCodeIsReturnedWhenResourcesHaveBeenReleased) {
     ze_context_handle_t hContext;
@@ -462,6 +557,69 @@ TEST_F(ContextGetStatusTest, givenCallToContextGetStatusThenCorrectErrorCodeIsRe
     context->destroy();
 }
 
+using ContextLearningPrefetchTest = Test<DeviceFixture>;
+TEST_F(ContextLearningPrefetchTest, givenLearningPrefetchDescChainedAfterPowerHintDescWhenCreatingContextsThenSettingIsAppliedPerContext) {
+    ze_context_desc_t ctxtDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_power_saving_hint_exp_desc_t powerHintContext = {};
+    powerHintContext.stype = ZE_STRUCTURE_TYPE_POWER_SAVING_HINT_EXP_DESC;
+    powerHintContext.hint = 1;
+    zex_intel_context_learning_prefetch_exp_desc_t learningPrefetchDesc = {};
+    learningPrefetchDesc.stype = ZEX_INTEL_STRUCTURE_TYPE_CONTEXT_LEARNING_PREFETCH_EXP_DESC;
+    learningPrefetchDesc.enable = true;
+    powerHintContext.pNext = &learningPrefetchDesc;
+    ctxtDesc.pNext = &powerHintContext;
+
+    ze_context_handle_t hLearningContext;
+    ze_result_t res = driverHandle->createContext(&ctxtDesc, 0u, nullptr, &hLearningContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(powerHintContext.hint, driverHandle->powerHint);
+
+    ze_context_desc_t defaultCtxtDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hDefaultContext;
+    res = driverHandle->createContext(&defaultCtxtDesc, 0u, nullptr, &hDefaultContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    auto learningContext = static_cast<ContextImp *>(L0::Context::fromHandle(hLearningContext));
+    auto defaultContext = static_cast<ContextImp *>(L0::Context::fromHandle(hDefaultContext));
+    EXPECT_TRUE(learningContext->isLearningPrefetchEnabled());
+    EXPECT_FALSE(defaultContext->isLearningPrefetchEnabled());
+
+    ze_command_list_desc_t commandListDesc = {};
+    ze_command_list_handle_t hCommandList = nullptr;
+    res = learningContext->createCommandList(device->toHandle(), &commandListDesc, &hCommandList);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_TRUE(L0::CommandList::fromHandle(hCommandList)->getPrefetchContext().accessPatternLearningEnabled);
+    L0::CommandList::fromHandle(hCommandList)->destroy();
+
+    ze_command_queue_desc_t queueDesc = {};
+    res = defaultContext->createCommandListImmediate(device->toHandle(), &queueDesc, &hCommandList);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_FALSE(L0::CommandList::fromHandle(hCommandList)->getPrefetchContext().accessPatternLearningEnabled);
+    L0::CommandList::fromHandle(hCommandList)->destroy();
+
+    learningContext->destroy();
+    defaultContext->destroy();
+}
+
+TEST_F(ContextLearningPrefetchTest, givenLearningPrefetchDebugFlagSetWhenCreatingContextThenFlagOverridesContextSetting) {
+    DebugManagerStateRestore restorer;
+    zex_intel_context_learning_prefetch_exp_desc_t learningPrefetchDesc = {};
+    learningPrefetchDesc.stype = ZEX_INTEL_STRUCTURE_TYPE_CONTEXT_LEARNING_PREFETCH_EXP_DESC;
+    learningPrefetchDesc.enable = true;
+    ze_context_desc_t ctxtDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ctxtDesc.pNext = &learningPrefetchDesc;
+
+    for (int32_t flagValue : {0, 1}) {
+        debugManager.flags.EnableLearningPrefetchForKmdMigratedSharedAllocations.set(flagValue);
+        ze_context_handle_t hContext;
+        ze_result_t res = driverHandle->createContext(&ctxtDesc, 0u, nullptr, &hContext);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+        auto context = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
+        EXPECT_EQ(flagValue == 1, context->isLearningPrefetchEnabled());
+        context->destroy();
+    }
+}
+
 using ContextPowerSavingHintTest = Test<DeviceFixture>;
 TEST_F(ContextPowerSavingHintTest, givenCallToContextCreateWithPowerHintDescThenPowerHintSetInDriverHandle) {
     ze_context_handle_t hContext;
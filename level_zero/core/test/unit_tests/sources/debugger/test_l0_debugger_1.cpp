@@ -578,7 +578,7 @@ HWTEST2_F(L0DebuggerSimpleTest, givenUseCsrImmediateSubmissionEnabledCommandList
                                    reinterpret_cast<void *>(0x2345), size, 0, sizeof(uint32_t),
                                    MemoryPool::system4KBPages, MemoryManager::maxOsContextCount);
 
-    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0x100, false);
+    auto result = commandList->appendPageFaultCopy(&dstPtr, 0u, &srcPtr, 0u, 0x100, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
     commandList->destroy();
@@ -601,7 +601,7 @@ HWTEST2_F(L0DebuggerSimpleTest, givenUseCsrImmediateSubmissionDisabledCommandLis
                                    reinterpret_cast<void *>(0x2345), size, 0, sizeof(uint32_t),
                                    MemoryPool::system4KBPages, MemoryManager::maxOsContextCount);
 
-    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0x100, false);
+    auto result = commandList->appendPageFaultCopy(&dstPtr, 0u, &srcPtr, 0u, 0x100, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
     commandList->destroy();
@@ -24,6 +24,7 @@
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_io_functions.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -153,6 +154,30 @@ TEST_F(DriverVersionTest, givenCallToGetExtensionPropertiesThenSupportedExtensio
     delete[] extensionProperties;
 }
 
+TEST_F(DriverVersionTest, givenHostNumaNodeSelectionSupportWhenCallingGetExtensionPropertiesThenNumaNodeExtensionIsReturnedOnlyWhenSupported) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    auto memoryManager = driverHandle->getMemoryManager();
+    driverHandle->setMemoryManager(mockMemoryManager.get());
+
+    auto isNumaNodeExtensionReturned = [this]() {
+        uint32_t count = 0;
+        driverHandle->getExtensionProperties(&count, nullptr);
+        std::vector<ze_driver_extension_properties_t> extensionProperties(count);
+        driverHandle->getExtensionProperties(&count, extensionProperties.data());
+        return std::any_of(extensionProperties.begin(), extensionProperties.end(), [](const auto &extension) {
+            return strcmp(extension.name, ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_NAME) == 0;
+        });
+    };
+
+    mockMemoryManager->hostNumaNodeSelectionSupported = false;
+    EXPECT_FALSE(isNumaNodeExtensionReturned());
+
+    mockMemoryManager->hostNumaNodeSelectionSupported = true;
+    EXPECT_TRUE(isNumaNodeExtensionReturned());
+
+    driverHandle->setMemoryManager(memoryManager);
+}
+
 TEST_F(DriverVersionTest, givenExternalAllocatorWhenCallingGetExtensionPropertiesThenBindlessImageExtensionIsReturned) {
     DebugManagerStateRestore restorer;
     NEO::debugManager.flags.UseBindlessMode.set(1);
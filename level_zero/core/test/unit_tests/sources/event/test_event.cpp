@@ -2485,6 +2485,47 @@ TEST_F(TimestampEventUsedPacketSignalCreate, givenEventWhenQueryingTimestampExpT
     }
 }
 
+TEST_F(TimestampEventCreateMultiKernel, givenEventUsedOnTwoKernelsWhenQueryingTimestampExpThenPacketsOfAllKernelsAreReturned) {
+    event->setPacketsInUse(NEO::TimestampPacketConstants::preferredPacketCount);
+    event->increaseKernelCount();
+    event->setPacketsInUse(2u);
+
+    constexpr uint32_t requestedCount = NEO::TimestampPacketConstants::preferredPacketCount + 2;
+    ASSERT_EQ(requestedCount, event->getPacketsInUse());
+
+    typename MockTimestampPackets32::Packet packetData[requestedCount];
+    for (uint32_t i = 0; i < requestedCount; i++) {
+        packetData[i].contextStart = 4 * i;
+        packetData[i].globalStart = 4 * i + 1;
+        packetData[i].contextEnd = 4 * i + 2;
+        packetData[i].globalEnd = 4 * i + 3;
+    }
+    for (uint32_t packetId = 0; packetId < NEO::TimestampPacketConstants::preferredPacketCount; packetId++) {
+        event->kernelEventCompletionData[0].assignDataToAllTimestamps(packetId, &packetData[packetId]);
+    }
+    for (uint32_t packetId = 0; packetId < 2u; packetId++) {
+        event->kernelEventCompletionData[1].assignDataToAllTimestamps(packetId, &packetData[NEO::TimestampPacketConstants::preferredPacketCount + packetId]);
+    }
+
+    ze_kernel_timestamp_result_t results[requestedCount];
+    uint32_t pCount = requestedCount;
+    auto result = event->queryTimestampsExp(device, &pCount, results);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_EQ(requestedCount, pCount);
+    for (uint32_t i = 0; i < pCount; i++) {
+        EXPECT_EQ(packetData[i].contextStart, results[i].context.kernelStart);
+        EXPECT_EQ(packetData[i].globalStart, results[i].global.kernelStart);
+        EXPECT_EQ(packetData[i].contextEnd, results[i].context.kernelEnd);
+        EXPECT_EQ(packetData[i].globalEnd, results[i].global.kernelEnd);
+    }
+
+    pCount = 3u;
+    result = event->queryTimestampsExp(device, &pCount, results);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(3u, pCount);
+}
+
 HWTEST2_F(TimestampEventCreateMultiKernel, givenTimeStampEventUsedOnTwoKernelsWhenL3FlushSetOnFirstKernelThenDoNotUseSecondPacketOfFirstKernel, IsAtLeastXeHpCore) {
     typename MockTimestampPackets32::Packet packetData[4];
 
@@ -24,6 +24,7 @@
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/mock_file_io.h"
+#include "shared/test/common/memory_manager/mock_prefetch_manager.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -4724,6 +4725,40 @@ TEST_F(ModuleKernelImmDatasTest, givenDeviceOOMWhenMemoryManagerFailsToAllocateM
     EXPECT_EQ(result, ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY);
 };
 
+TEST_F(ModuleKernelImmDatasTest, givenKernelAccessesLearnedByPrefetchManagerWhenModuleIsDestroyedThenKernelAccessHistoryIsRemoved) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.FailBuildProgramWithStatefulAccess.set(0);
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    const auto &src = zebinData->storage;
+
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(src.data());
+    moduleDesc.inputSize = src.size();
+
+    auto mockMemoryManager = static_cast<NEO::MockMemoryManager *>(neoDevice->getMemoryManager());
+    auto prefetchManager = new MockPrefetchManager();
+    mockMemoryManager->prefetchManager.reset(prefetchManager);
+
+    ModuleBuildLog *moduleBuildLog = nullptr;
+    auto module = std::make_unique<Module>(device, moduleBuildLog, ModuleType::user);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, module->initialize(&moduleDesc, neoDevice));
+    ASSERT_FALSE(module->kernelImmDatas.empty());
+
+    NEO::PrefetchContext prefetchContext;
+    int allocation = 0;
+    for (auto &kernelImmData : module->kernelImmDatas) {
+        prefetchManager->learnKernelAccesses(prefetchContext, kernelImmData.get(), {&allocation});
+    }
+    auto kernelsCount = module->kernelImmDatas.size();
+    EXPECT_EQ(kernelsCount, prefetchManager->kernelAccessHistory.size());
+
+    module.reset();
+    EXPECT_EQ(kernelsCount, prefetchManager->removeKernelAccessesCalled);
+    EXPECT_TRUE(prefetchManager->kernelAccessHistory.empty());
+}
+
 using MultiTileModuleTest = Test<MultiTileModuleFixture>;
 HWTEST2_F(MultiTileModuleTest, givenTwoKernelPrivateAllocsWhichExceedGlobalMemSizeOfSingleTileButNotEntireGlobalMemSizeThenPrivateMemoryShouldBeAllocatedPerDispatch, IsAtLeastSkl) {
     auto devInfo = device->getNEODevice()->getDeviceInfo();
@@ -633,6 +633,98 @@ HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenAppendMemoryPrefetchForKmdMigr
     commandQueue->destroy();
 }
 
+HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenContextWithLearningPrefetchEnabledWhenKernelIsLaunchedThenSharedAllocationsBoundToLaunchArePrefetchedOnce, IsXeHpcCore) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.UseKmdMigration.set(1);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    createKernel();
+    context->setLearningPrefetchEnabled(true);
+    ze_command_list_desc_t commandListDesc = {};
+    ze_command_list_handle_t commandListHandle = nullptr;
+    auto result = context->createCommandList(device->toHandle(), &commandListDesc, &commandListHandle);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    std::unique_ptr<L0::CommandList> commandList(CommandList::fromHandle(commandListHandle));
+    EXPECT_TRUE(commandList->getPrefetchContext().accessPatternLearningEnabled);
+
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, alignment, &ptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, allocData);
+    kernel->residencyContainer.push_back(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_TRUE(commandList->isMemoryPrefetchRequested());
+    ASSERT_EQ(1u, commandList->getPrefetchContext().allocations.size());
+    EXPECT_EQ(ptr, commandList->getPrefetchContext().allocations[0]);
+    EXPECT_EQ(0u, commandList->getPrefetchContext().statistics.hits);
+    EXPECT_EQ(1u, commandList->getPrefetchContext().statistics.misses);
+
+    result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_TRUE(commandList->isMemoryPrefetchRequested());
+    ASSERT_EQ(1u, commandList->getPrefetchContext().allocations.size());
+    EXPECT_EQ(ptr, commandList->getPrefetchContext().allocations[0]);
+    EXPECT_EQ(1u, commandList->getPrefetchContext().statistics.hits);
+    EXPECT_EQ(1u, commandList->getPrefetchContext().statistics.misses);
+
+    kernel->residencyContainer.pop_back();
+    context->freeMem(ptr);
+}
+
+HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenContextWithLearningPrefetchDisabledWhenKernelIsLaunchedAgainThenNoAllocationIsPrefetched, IsXeHpcCore) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.UseKmdMigration.set(1);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    createKernel();
+    EXPECT_FALSE(context->isLearningPrefetchEnabled());
+    ze_command_list_desc_t commandListDesc = {};
+    ze_command_list_handle_t commandListHandle = nullptr;
+    auto result = context->createCommandList(device->toHandle(), &commandListDesc, &commandListHandle);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    std::unique_ptr<L0::CommandList> commandList(CommandList::fromHandle(commandListHandle));
+    EXPECT_FALSE(commandList->getPrefetchContext().accessPatternLearningEnabled);
+
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, alignment, &ptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, allocData);
+    kernel->residencyContainer.push_back(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+    EXPECT_FALSE(commandList->isMemoryPrefetchRequested());
+    EXPECT_EQ(0u, commandList->getPrefetchContext().allocations.size());
+    EXPECT_EQ(0u, commandList->getPrefetchContext().statistics.misses);
+
+    kernel->residencyContainer.pop_back();
+    context->freeMem(ptr);
+}
+
 using CommandListEventFenceTestsXeHpcCore = Test<ModuleFixture>;
 
 HWTEST2_F(CommandListEventFenceTestsXeHpcCore, givenCommandListWithProfilingEventAfterCommandWhenRevId03ThenMiFenceIsAdded, IsXeHpcCore) {
@@ -896,7 +988,7 @@ HWTEST2_F(CommandListAppendLaunchKernelXeHpcCore,
     result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
-    result = commandList->appendPageFaultCopy(dstAllocation, srcAllocation, size, false);
+    result = commandList->appendPageFaultCopy(dstAllocation, 0u, srcAllocation, 0u, size, false);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_TRUE(commandList->usedKernelLaunchParams.isBuiltInKernel);
     EXPECT_FALSE(commandList->usedKernelLaunchParams.isKernelSplitOperation);
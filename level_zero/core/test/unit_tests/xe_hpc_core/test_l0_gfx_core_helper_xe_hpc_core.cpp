@@ -12,6 +12,7 @@
 
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_stall_data.h"
 
 namespace L0 {
 namespace ult {
@@ -83,12 +84,39 @@ XE_HPC_CORETEST_F(L0GfxCoreHelperTestXeHpc, GivenXeHpcWhenGettingCmdlistUpdateCa
     EXPECT_EQ(63u, l0GfxCoreHelper.getPlatformCmdListUpdateCapabilities());
 }
 
-XE_HPC_CORETEST_F(L0GfxCoreHelperTestXeHpc, GivenXeHpcWhenCheckingL0HelperForDeletingIpSamplingEntryWithNullValuesThenMapRemainstheSameSize) {
+XE_HPC_CORETEST_F(L0GfxCoreHelperTestXeHpc, GivenRawIpSamplingReportsWhenUpdatingStallIpDataMapThenCountsAreSummedPerIp) {
     auto &l0GfxCoreHelper = getHelper<L0GfxCoreHelper>();
-    std::map<uint64_t, void *> stallSumIpDataMap;
-    stallSumIpDataMap.emplace(std::pair<uint64_t, void *>(0ull, nullptr));
-    l0GfxCoreHelper.stallIpDataMapDelete(stallSumIpDataMap);
-    EXPECT_NE(0u, stallSumIpDataMap.size());
+
+    // ip 0x123 with counts 1 to 8 and instFetch 9, send count crosses the first qword
+    uint64_t rawReports[3][8] = {};
+    rawReports[0][0] = 0x123ull | (1ull << 29) | (2ull << 37) | (3ull << 45) | (4ull << 53) | ((0xf5ull & 0x7) << 61);
+    rawReports[0][1] = ((0xf5ull & 0xf8) >> 3) | (6ull << 5) | (7ull << 13) | (8ull << 21) | (9ull << 29);
+    rawReports[1][0] = rawReports[0][0];
+    rawReports[1][1] = rawReports[0][1];
+    rawReports[2][0] = 0x1fffffffull;
+    rawReports[2][6] = 0x100ull << 16;
+
+    StallSumIpDataMap stallSumIpDataMap;
+    EXPECT_TRUE(l0GfxCoreHelper.stallIpDataMapUpdate(stallSumIpDataMap, reinterpret_cast<const uint8_t *>(rawReports), 3));
+    stallSumIpDataMap.sortByIp();
+
+    ASSERT_EQ(2u, stallSumIpDataMap.size());
+    auto &entry = stallSumIpDataMap.getEntries()[0];
+    EXPECT_EQ(0x123u, entry.ip);
+    EXPECT_EQ(2u, entry.data.activeCount);
+    EXPECT_EQ(4u, entry.data.otherCount);
+    EXPECT_EQ(6u, entry.data.controlCount);
+    EXPECT_EQ(8u, entry.data.pipeStallCount);
+    EXPECT_EQ(2u * 0xf5u, entry.data.sendCount);
+    EXPECT_EQ(12u, entry.data.distAccCount);
+    EXPECT_EQ(14u, entry.data.sbidCount);
+    EXPECT_EQ(16u, entry.data.syncCount);
+    EXPECT_EQ(18u, entry.data.instFetchCount);
+    EXPECT_EQ(0x1fffffffu, stallSumIpDataMap.getEntries()[1].ip);
+
+    StallSumIpDataMap stallSumIpDataMapWithoutOverflow;
+    EXPECT_FALSE(l0GfxCoreHelper.stallIpDataMapUpdate(stallSumIpDataMapWithoutOverflow, reinterpret_cast<const uint8_t *>(rawReports), 2));
+    EXPECT_EQ(1u, stallSumIpDataMapWithoutOverflow.size());
 }
 
 } // namespace ult
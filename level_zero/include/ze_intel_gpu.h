@@ -156,6 +156,73 @@ typedef struct _zex_intel_queue_allocate_msix_hint_exp_desc_t {
 
 #define ZEX_INTEL_STRUCTURE_TYPE_QUEUE_ALLOCATE_MSIX_HINT_EXP_PROPERTIES (ze_structure_type_t)0x00030018
 
+#ifndef ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_NAME
+/// @brief Host memory allocation NUMA node extension name
+#define ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_NAME "ZEX_intel_experimental_host_mem_alloc_numa_node"
+#endif // ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_NAME
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Host memory allocation NUMA node extension Version(s)
+typedef enum _zex_intel_host_mem_alloc_numa_node_exp_version_t {
+    ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_VERSION_1_0 = ZE_MAKE_VERSION(1, 0),     ///< version 1.0
+    ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_VERSION_CURRENT = ZE_MAKE_VERSION(1, 0), ///< latest known version
+    ZEX_INTEL_HOST_MEM_ALLOC_NUMA_NODE_EXP_VERSION_FORCE_UINT32 = 0x7fffffff
+} zex_intel_host_mem_alloc_numa_node_exp_version_t;
+
+#ifndef ZEX_INTEL_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_NODE_EXP_DESC
+/// @brief stype for _zex_intel_host_mem_alloc_numa_node_exp_desc_t
+#define ZEX_INTEL_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_NODE_EXP_DESC (ze_structure_type_t)0x00030019
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Extended descriptor selecting NUMA node of host memory allocation
+///
+/// @details
+///     - Implementation must support ::ZEX_intel_experimental_host_mem_alloc_numa_node extension
+///     - May be passed to ze_host_mem_alloc_desc_t through pNext.
+///     - Without this descriptor host memory allocated by driver is placed on NUMA node closest to device, when known.
+typedef struct _zex_intel_host_mem_alloc_numa_node_exp_desc_t {
+    ze_structure_type_t stype; ///< [in] type of this structure
+    const void *pNext;         ///< [in][optional] must be null or a pointer to an extension-specific
+                               ///< structure (i.e. contains stype and pNext).
+    uint32_t numaNode;         ///< [in] NUMA node preferred for host memory pages. Pages are placed on other nodes
+                               ///< when preferred node is out of memory.
+} zex_intel_host_mem_alloc_numa_node_exp_desc_t;
+
+#ifndef ZEX_INTEL_CONTEXT_LEARNING_PREFETCH_EXP_NAME
+/// @brief Context learning prefetch extension name
+#define ZEX_INTEL_CONTEXT_LEARNING_PREFETCH_EXP_NAME "ZEX_intel_experimental_context_learning_prefetch"
+#endif // ZEX_INTEL_CONTEXT_LEARNING_PREFETCH_EXP_NAME
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Context learning prefetch extension Version(s)
+typedef enum _zex_intel_context_learning_prefetch_exp_version_t {
+    ZEX_INTEL_CONTEXT_LEARNING_PREFETCH_EXP_VERSION_1_0 = ZE_MAKE_VERSION(1, 0),     ///< version 1.0
+    ZEX_INTEL_CONTEXT_LEARNING_PREFETCH_EXP_VERSION_CURRENT = ZE_MAKE_VERSION(1, 0), ///< latest known version
+    ZEX_INTEL_CONTEXT_LEARNING_PREFETCH_EXP_VERSION_FORCE_UINT32 = 0x7fffffff
+} zex_intel_context_learning_prefetch_exp_version_t;
+
+#ifndef ZEX_INTEL_STRUCTURE_TYPE_CONTEXT_LEARNING_PREFETCH_EXP_DESC
+/// @brief stype for _zex_intel_context_learning_prefetch_exp_desc_t
+#define ZEX_INTEL_STRUCTURE_TYPE_CONTEXT_LEARNING_PREFETCH_EXP_DESC (ze_structure_type_t)0x0003001A
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Extended descriptor enabling learning prefetch of shared allocations
+///
+/// @details
+///     - Implementation must support ::ZEX_intel_experimental_context_learning_prefetch extension
+///     - May be passed to ze_context_desc_t through pNext.
+///     - Command lists created in the context remember shared allocations bound to each kernel
+///       and prefetch them ahead of the launch expected to follow. Used only with KMD migration.
+typedef struct _zex_intel_context_learning_prefetch_exp_desc_t {
+    ze_structure_type_t stype; ///< [in] type of this structure
+    const void *pNext;         ///< [in][optional] must be null or a pointer to an extension-specific
+                               ///< structure (i.e. contains stype and pNext).
+    ze_bool_t enable;          ///< [in] If set, command lists created in the context learn kernel accesses
+                               ///< to shared allocations and prefetch them.
+} zex_intel_context_learning_prefetch_exp_desc_t;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
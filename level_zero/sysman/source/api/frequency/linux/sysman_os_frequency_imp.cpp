@@ -124,7 +124,8 @@ ze_result_t LinuxFrequencyImp::osFrequencySetRange(const zes_freq_range_t *pLimi
 
 bool LinuxFrequencyImp::getThrottleReasonStatus(void) {
     uint32_t val = 0;
-    auto result = pSysfsAccess->read(throttleReasonStatusFile, val);
+    uint64_t timestamp = 0;
+    auto result = pSysfsAccess->readTelemetry(throttleReasonStatusFile, val, timestamp);
     if (ZE_RESULT_SUCCESS == result) {
         return (val == 0 ? false : true);
     } else {
@@ -171,20 +172,21 @@ ze_result_t LinuxFrequencyImp::osFrequencyGetState(zes_freq_state_t *pState) {
     pState->throttleReasons = 0u;
     if (getThrottleReasonStatus()) {
         uint32_t val = 0;
+        uint64_t timestamp = 0;
         ze_result_t result;
-        result = pSysfsAccess->read(throttleReasonPL1File, val);
+        result = pSysfsAccess->readTelemetry(throttleReasonPL1File, val, timestamp);
         if (val && (result == ZE_RESULT_SUCCESS)) {
             pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_AVE_PWR_CAP;
         }
-        result = pSysfsAccess->read(throttleReasonPL2File, val);
+        result = pSysfsAccess->readTelemetry(throttleReasonPL2File, val, timestamp);
         if (val && (result == ZE_RESULT_SUCCESS)) {
             pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_BURST_PWR_CAP;
         }
-        result = pSysfsAccess->read(throttleReasonPL4File, val);
+        result = pSysfsAccess->readTelemetry(throttleReasonPL4File, val, timestamp);
         if (val && (result == ZE_RESULT_SUCCESS)) {
             pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_CURRENT_LIMIT;
         }
-        result = pSysfsAccess->read(throttleReasonThermalFile, val);
+        result = pSysfsAccess->readTelemetry(throttleReasonThermalFile, val, timestamp);
         if (val && (result == ZE_RESULT_SUCCESS)) {
             pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_THERMAL_LIMIT;
         }
@@ -303,8 +305,9 @@ ze_result_t LinuxFrequencyImp::setMax(double max) {
 
 ze_result_t LinuxFrequencyImp::getRequest(double &request) {
     double freqVal = 0;
+    uint64_t timestamp = 0;
 
-    ze_result_t result = pSysfsAccess->read(requestFreqFile, freqVal);
+    ze_result_t result = pSysfsAccess->readTelemetry(requestFreqFile, freqVal, timestamp);
     if (ZE_RESULT_SUCCESS != result) {
         if (result == ZE_RESULT_ERROR_NOT_AVAILABLE) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -320,9 +323,10 @@ ze_result_t LinuxFrequencyImp::getRequest(double &request) {
 ze_result_t LinuxFrequencyImp::getTdp(double &tdp) {
     ze_result_t result = ZE_RESULT_ERROR_NOT_AVAILABLE;
     double freqVal = 0;
+    uint64_t timestamp = 0;
 
     if (pSysmanKmdInterface->isTdpFrequencyAvailable()) {
-        result = pSysfsAccess->read(tdpFreqFile, freqVal);
+        result = pSysfsAccess->readTelemetry(tdpFreqFile, freqVal, timestamp);
         if (ZE_RESULT_SUCCESS != result) {
             if (result == ZE_RESULT_ERROR_NOT_AVAILABLE) {
                 result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -340,8 +344,9 @@ ze_result_t LinuxFrequencyImp::getTdp(double &tdp) {
 
 ze_result_t LinuxFrequencyImp::getActual(double &actual) {
     double freqVal = 0;
+    uint64_t timestamp = 0;
 
-    ze_result_t result = pSysfsAccess->read(actualFreqFile, freqVal);
+    ze_result_t result = pSysfsAccess->readTelemetry(actualFreqFile, freqVal, timestamp);
     if (ZE_RESULT_SUCCESS != result) {
         if (result == ZE_RESULT_ERROR_NOT_AVAILABLE) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -356,8 +361,9 @@ ze_result_t LinuxFrequencyImp::getActual(double &actual) {
 
 ze_result_t LinuxFrequencyImp::getEfficient(double &efficient) {
     double freqVal = 0;
+    uint64_t timestamp = 0;
 
-    ze_result_t result = pSysfsAccess->read(efficientFreqFile, freqVal);
+    ze_result_t result = pSysfsAccess->readTelemetry(efficientFreqFile, freqVal, timestamp);
     if (ZE_RESULT_SUCCESS != result) {
         if (result == ZE_RESULT_ERROR_NOT_AVAILABLE) {
             result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
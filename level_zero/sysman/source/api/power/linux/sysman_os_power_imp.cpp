@@ -88,16 +88,15 @@ ze_result_t LinuxPowerImp::getPmtEnergyCounter(zes_power_energy_counter_t *pEner
     const std::string key("PACKAGE_ENERGY");
     uint64_t energy = 0;
     constexpr uint64_t fixedPointToJoule = 1048576;
-    ze_result_t result = pPmt->readValue(key, energy);
+    ze_result_t result = pPmt->readValue(key, energy, pEnergy->timestamp);
     // PMT will return energy counter in Q20 format(fixed point representation) where first 20 bits(from LSB) represent decimal part and remaining integral part which is converted into joule by division with 1048576(2^20) and then converted into microjoules
     pEnergy->energy = (energy / fixedPointToJoule) * convertJouleToMicroJoule;
     return result;
 }
 
 ze_result_t LinuxPowerImp::getEnergyCounter(zes_power_energy_counter_t *pEnergy) {
-    pEnergy->timestamp = SysmanDevice::getSysmanTimestamp();
     std::string energyCounterNode = intelGraphicsHwmonDir + "/" + pSysmanKmdInterface->getSysfsFilePath(SysfsName::sysfsNameEnergyCounterNode, subdeviceId, false);
-    ze_result_t result = pSysfsAccess->read(energyCounterNode, pEnergy->energy);
+    ze_result_t result = pSysfsAccess->readTelemetry(energyCounterNode, pEnergy->energy, pEnergy->timestamp);
     if (result != ZE_RESULT_SUCCESS) {
         if (pPmt != nullptr) {
             return getPmtEnergyCounter(pEnergy);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 
 #include "level_zero/sysman/source/device/sysman_device_imp.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
 #include "level_zero/sysman/source/shared/linux/zes_os_sysman_imp.h"
 
 #include <algorithm>
@@ -29,38 +30,57 @@ std::string PlatformMonitoringTech::getGuid() {
     return guid;
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
+template <typename T>
+ze_result_t PlatformMonitoringTech::readTelemetryValue(const std::string &key, T &value, uint64_t &timestamp) {
     auto offset = keyOffsetMap.find(key);
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    if (pTelemetrySampler) {
+        auto counterId = pTelemetrySampler->acquireCounter(telemetryDeviceEntry, baseOffset + offset->second, sizeof(T));
+        if (counterId != SysmanTelemetrySampler::invalidCounterId && pTelemetrySampler->readValue(counterId, value, timestamp)) {
+            return ZE_RESULT_SUCCESS;
+        }
+    }
     auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
     if (fd == -1) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
     ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint32_t), baseOffset + offset->second) != sizeof(uint32_t)) {
+    if (this->preadFunction(fd, &value, sizeof(T), baseOffset + offset->second) != sizeof(T)) {
         res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
+    timestamp = SysmanDevice::getSysmanTimestamp();
     return res;
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
-    auto offset = keyOffsetMap.find(key);
-    if (offset == keyOffsetMap.end()) {
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
-    }
-    auto fd = NEO::FileDescriptor(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
-        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+template <typename T>
+ze_result_t PlatformMonitoringTech::readTimestampedValue(const std::string &key, T &value, uint64_t &timestamp) {
+    if (pTelemetrySampler) {
+        return readTelemetryValue(key, value, timestamp);
     }
+    auto result = readValue(key, value);
+    timestamp = SysmanDevice::getSysmanTimestamp();
+    return result;
+}
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint64_t), baseOffset + offset->second) != sizeof(uint64_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
-    }
-    return res;
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
+    uint64_t timestamp = 0;
+    return readTelemetryValue(key, value, timestamp);
+}
+
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
+    uint64_t timestamp = 0;
+    return readTelemetryValue(key, value, timestamp);
+}
+
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value, uint64_t &timestamp) {
+    return readTimestampedValue(key, value, timestamp);
+}
+
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value, uint64_t &timestamp) {
+    return readTimestampedValue(key, value, timestamp);
 }
 
 bool compareTelemNodes(std::string &telemNode1, std::string &telemNode2) {
@@ -196,6 +216,7 @@ void PlatformMonitoringTech::create(LinuxSysmanImp *pLinuxSysmanImp, std::string
             auto productFamily = pLinuxSysmanImp->getSysmanDeviceImp()->getProductFamily();
             auto pPmt = new PlatformMonitoringTech(&pLinuxSysmanImp->getFsAccess(), onSubdevice, subdeviceId);
             UNRECOVERABLE_IF(nullptr == pPmt);
+            pPmt->pTelemetrySampler = pLinuxSysmanImp->getTelemetrySampler();
             PlatformMonitoringTech::doInitPmtObject(&pLinuxSysmanImp->getFsAccess(), subdeviceId, pPmt,
                                                     gpuUpstreamPortPath, mapOfSubDeviceIdToPmtObject, productFamily);
             subdeviceId++;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@ namespace L0 {
 namespace Sysman {
 class LinuxSysmanImp;
 class FsAccessInterface;
+class SysmanTelemetrySampler;
 
 class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
   public:
@@ -31,6 +32,9 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
 
     virtual ze_result_t readValue(const std::string key, uint32_t &value);
     virtual ze_result_t readValue(const std::string key, uint64_t &value);
+    // timestamp pairs value with the time it was read, which for sampled telemetry is the time of sampling pass
+    ze_result_t readValue(const std::string key, uint32_t &value, uint64_t &timestamp);
+    ze_result_t readValue(const std::string key, uint64_t &value, uint64_t &timestamp);
     std::string getGuid();
     static ze_result_t enumerateRootTelemIndex(FsAccessInterface *pFsAccess, std::string &gpuUpstreamPortPath);
     static void create(LinuxSysmanImp *pLinuxSysmanImp, std::string &gpuUpstreamPortPath,
@@ -45,7 +49,12 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     ze_result_t init(FsAccessInterface *pFsAccess, const std::string &gpuUpstreamPortPath, PRODUCT_FAMILY productFamily);
     static void doInitPmtObject(FsAccessInterface *pFsAccess, uint32_t subdeviceId, PlatformMonitoringTech *pPmt, const std::string &gpuUpstreamPortPath,
                                 std::map<uint32_t, L0::Sysman::PlatformMonitoringTech *> &mapOfSubDeviceIdToPmtObject, PRODUCT_FAMILY productFamily);
+    template <typename T>
+    ze_result_t readTelemetryValue(const std::string &key, T &value, uint64_t &timestamp);
+    template <typename T>
+    ze_result_t readTimestampedValue(const std::string &key, T &value, uint64_t &timestamp);
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
+    SysmanTelemetrySampler *pTelemetrySampler = nullptr;
 
   private:
     static const std::string baseTelemSysFS;
@@ -82,7 +82,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
     for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
         uint32_t counterValue = 0;
         std::string readCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_READ";
-        result = pPmt->readValue(readCounterKey, counterValue);
+        result = pPmt->readValue(readCounterKey, counterValue, pBandwidth->timestamp);
         if (result != ZE_RESULT_SUCCESS) {
             NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterKey returning error:0x%x \n", __FUNCTION__, result);
             return result;
@@ -91,7 +91,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
 
         counterValue = 0;
         std::string writeCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_WRITE";
-        result = pPmt->readValue(writeCounterKey, counterValue);
+        result = pPmt->readValue(writeCounterKey, counterValue, pBandwidth->timestamp);
         if (result != ZE_RESULT_SUCCESS) {
             NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterKey returning error:0x%x \n", __FUNCTION__, result);
             return result;
@@ -102,7 +102,6 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
     constexpr uint64_t transactionSize = 32;
     pBandwidth->readCounter = pBandwidth->readCounter * transactionSize;
     pBandwidth->writeCounter = pBandwidth->writeCounter * transactionSize;
-    pBandwidth->timestamp = SysmanDevice::getSysmanTimestamp();
 
     uint64_t hbmFrequency = 0;
     getHBMFrequency(pSysmanKmdInterface, pSysFsAccess, hbmFrequency, subdeviceId, stepping);
@@ -138,7 +137,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
 
     uint32_t readCounterL = 0;
     std::string readCounterKey = vfId + "_HBM_READ_L";
-    result = pPmt->readValue(readCounterKey, readCounterL);
+    result = pPmt->readValue(readCounterKey, readCounterL, pBandwidth->timestamp);
     if (result != ZE_RESULT_SUCCESS) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterL returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -146,7 +145,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
 
     uint32_t readCounterH = 0;
     readCounterKey = vfId + "_HBM_READ_H";
-    result = pPmt->readValue(readCounterKey, readCounterH);
+    result = pPmt->readValue(readCounterKey, readCounterH, pBandwidth->timestamp);
     if (result != ZE_RESULT_SUCCESS) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterH returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -159,7 +158,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
 
     uint32_t writeCounterL = 0;
     std::string writeCounterKey = vfId + "_HBM_WRITE_L";
-    result = pPmt->readValue(writeCounterKey, writeCounterL);
+    result = pPmt->readValue(writeCounterKey, writeCounterL, pBandwidth->timestamp);
     if (result != ZE_RESULT_SUCCESS) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterL returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -167,7 +166,7 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
 
     uint32_t writeCounterH = 0;
     writeCounterKey = vfId + "_HBM_WRITE_H";
-    result = pPmt->readValue(writeCounterKey, writeCounterH);
+    result = pPmt->readValue(writeCounterKey, writeCounterH, pBandwidth->timestamp);
     if (result != ZE_RESULT_SUCCESS) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for writeCounterH returning error:0x%x \n", __FUNCTION__, result);
         return result;
@@ -176,7 +175,6 @@ ze_result_t getHBMBandwidth(zes_mem_bandwidth_t *pBandwidth, PlatformMonitoringT
     pBandwidth->writeCounter = writeCounterH;
     pBandwidth->writeCounter = (pBandwidth->writeCounter << 32) | static_cast<uint64_t>(writeCounterL);
     pBandwidth->writeCounter = (pBandwidth->writeCounter * transactionSize);
-    pBandwidth->timestamp = SysmanDevice::getSysmanTimestamp();
 
     uint64_t hbmFrequency = 0;
     getHBMFrequency(pSysmanKmdInterface, pSysFsAccess, hbmFrequency, subdeviceId, stepping);
@@ -20,7 +20,7 @@ RasInterfaceType SysmanProductHelperHw<gfxProduct>::getGtRasUtilInterface() {
 
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper_xe_hp_and_later.inl"
 
-ze_result_t readMcChannelCounters(PlatformMonitoringTech *pPmt, uint64_t &readCounters, uint64_t &writeCounters) {
+ze_result_t readMcChannelCounters(PlatformMonitoringTech *pPmt, uint64_t &readCounters, uint64_t &writeCounters, uint64_t &timestamp) {
     uint32_t numMcChannels = 16u;
     ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
     std::vector<std::string> nameOfCounters{"IDI_READS", "IDI_WRITES", "DISPLAY_VC1_READS"};
@@ -29,7 +29,7 @@ ze_result_t readMcChannelCounters(PlatformMonitoringTech *pPmt, uint64_t &readCo
         for (uint32_t mcChannelIndex = 0; mcChannelIndex < numMcChannels; mcChannelIndex++) {
             uint64_t val = 0;
             std::string readCounterKey = nameOfCounters[counterIndex] + "[" + std::to_string(mcChannelIndex) + "]";
-            result = pPmt->readValue(readCounterKey, val);
+            result = pPmt->readValue(readCounterKey, val, timestamp);
             if (result != ZE_RESULT_SUCCESS) {
                 NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readValue for readCounterKey returning error:0x%x \n", __FUNCTION__, result);
                 return result;
@@ -52,7 +52,7 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryBandwidth(zes_mem_bandwi
     pBandwidth->writeCounter = 0;
     pBandwidth->timestamp = 0;
     pBandwidth->maxBandwidth = 0;
-    result = readMcChannelCounters(pPmt, pBandwidth->readCounter, pBandwidth->writeCounter);
+    result = readMcChannelCounters(pPmt, pBandwidth->readCounter, pBandwidth->writeCounter, pBandwidth->timestamp);
     if (result != ZE_RESULT_SUCCESS) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s():readMcChannelCounters returning error:0x%x  \n", __FUNCTION__, result);
         return result;
@@ -66,7 +66,6 @@ ze_result_t SysmanProductHelperHw<gfxProduct>::getMemoryBandwidth(zes_mem_bandwi
         return result;
     }
     pBandwidth->maxBandwidth = maxBw * mbpsToBytesPerSecond;
-    pBandwidth->timestamp = SysmanDevice::getSysmanTimestamp();
     return result;
 }
 
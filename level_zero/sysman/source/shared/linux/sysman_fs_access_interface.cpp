@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,14 @@
 
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 
+#include "level_zero/sysman/source/device/sysman_device.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
+
+#include <cerrno>
 #include <csignal>
+#include <cstdlib>
 #include <fcntl.h>
+#include <limits>
 #include <fstream>
 #include <sstream>
 #include <unistd.h>
@@ -69,24 +75,67 @@ FdCacheInterface::~FdCacheInterface() {
     fdMap.clear();
 }
 
+bool FsAccessInterface::parseValue(const char *text, uint64_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto value = std::strtoull(text, &end, 10);
+    if (end == text || errno == ERANGE) {
+        return false;
+    }
+    val = value;
+    return true;
+}
+
+bool FsAccessInterface::parseValue(const char *text, double &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto value = std::strtod(text, &end);
+    if (end == text || errno == ERANGE) {
+        return false;
+    }
+    val = value;
+    return true;
+}
+
+bool FsAccessInterface::parseValue(const char *text, uint32_t &val) {
+    uint64_t value = 0;
+    if (!parseValue(text, value) || (value > std::numeric_limits<uint32_t>::max() && value < static_cast<uint64_t>(std::numeric_limits<int64_t>::min()))) {
+        return false;
+    }
+    // negative values wrap around, same as with stream extraction
+    val = static_cast<uint32_t>(value);
+    return true;
+}
+
+bool FsAccessInterface::parseValue(const char *text, int32_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto value = std::strtoll(text, &end, 10);
+    if (end == text || errno == ERANGE || value > std::numeric_limits<int32_t>::max() || value < std::numeric_limits<int32_t>::min()) {
+        return false;
+    }
+    val = static_cast<int32_t>(value);
+    return true;
+}
+
 template <typename T>
 ze_result_t FsAccessInterface::readValue(const std::string file, T &val) {
-    auto lock = this->obtainMutex();
+    char readVal[maxValueLength + 1] = {};
+    {
+        auto lock = this->obtainMutex();
 
-    std::string readVal(64, '\0');
-    int fd = pFdCacheInterface->getFd(file);
-    if (fd < 0) {
-        return getResult(errno);
-    }
+        int fd = pFdCacheInterface->getFd(file);
+        if (fd < 0) {
+            return getResult(errno);
+        }
 
-    ssize_t bytesRead = NEO::SysCalls::pread(fd, readVal.data(), readVal.size(), 0);
-    if (bytesRead < 0) {
-        return getResult(errno);
+        ssize_t bytesRead = NEO::SysCalls::pread(fd, readVal, maxValueLength, 0);
+        if (bytesRead < 0) {
+            return getResult(errno);
+        }
     }
 
-    std::istringstream stream(readVal);
-    stream >> val;
-    if (stream.fail()) {
+    if (!parseValue(readVal, val)) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 
@@ -466,6 +515,31 @@ ze_result_t SysFsAccessInterface::read(const std::string file, uint64_t &val) {
     return FsAccessInterface::read(fullPath(file), val);
 }
 
+template <typename T>
+ze_result_t SysFsAccessInterface::readTelemetryValue(const std::string &file, T &val, uint64_t &timestamp) {
+    if (pTelemetrySampler) {
+        auto counterId = pTelemetrySampler->acquireTextCounter(fullPath(file));
+        if (counterId != SysmanTelemetrySampler::invalidCounterId && pTelemetrySampler->readTextValue(counterId, val, timestamp)) {
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+    auto result = read(file, val);
+    timestamp = SysmanDevice::getSysmanTimestamp();
+    return result;
+}
+
+ze_result_t SysFsAccessInterface::readTelemetry(const std::string file, uint64_t &val, uint64_t &timestamp) {
+    return readTelemetryValue(file, val, timestamp);
+}
+
+ze_result_t SysFsAccessInterface::readTelemetry(const std::string file, double &val, uint64_t &timestamp) {
+    return readTelemetryValue(file, val, timestamp);
+}
+
+ze_result_t SysFsAccessInterface::readTelemetry(const std::string file, uint32_t &val, uint64_t &timestamp) {
+    return readTelemetryValue(file, val, timestamp);
+}
+
 ze_result_t SysFsAccessInterface::read(const std::string file, std::vector<std::string> &val) {
     // Prepend sysfs directory path and call the base read
     return FsAccessInterface::read(fullPath(file), val);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,8 @@
 namespace L0 {
 namespace Sysman {
 
+class SysmanTelemetrySampler;
+
 class FdCacheInterface {
   public:
     FdCacheInterface() = default;
@@ -62,6 +64,14 @@ class FsAccessInterface {
     virtual bool fileExists(const std::string file);
     virtual bool directoryExists(const std::string path);
 
+    // text is null terminated content of sysfs file, parsed without allocations
+    static bool parseValue(const char *text, uint64_t &val);
+    static bool parseValue(const char *text, double &val);
+    static bool parseValue(const char *text, uint32_t &val);
+    static bool parseValue(const char *text, int32_t &val);
+
+    static constexpr size_t maxValueLength = 64u;
+
   protected:
     FsAccessInterface();
     MOCKABLE_VIRTUAL std::unique_lock<std::mutex> obtainMutex();
@@ -128,12 +138,22 @@ class SysFsAccessInterface : protected FsAccessInterface {
     bool directoryExists(const std::string path) override;
     bool isRootUser() override;
 
+    // for frequently changing counters, served from sampler snapshot when sampling is enabled,
+    // timestamp is the time of sampling pass or of the direct read
+    ze_result_t readTelemetry(const std::string file, uint64_t &val, uint64_t &timestamp);
+    ze_result_t readTelemetry(const std::string file, double &val, uint64_t &timestamp);
+    ze_result_t readTelemetry(const std::string file, uint32_t &val, uint64_t &timestamp);
+    void setTelemetrySampler(SysmanTelemetrySampler *sampler) { pTelemetrySampler = sampler; }
+
   protected:
     SysFsAccessInterface();
     SysFsAccessInterface(const std::string file);
     std::vector<std::string> deviceNames;
+    SysmanTelemetrySampler *pTelemetrySampler = nullptr;
 
   private:
+    template <typename T>
+    ze_result_t readTelemetryValue(const std::string &file, T &val, uint64_t &timestamp);
     std::string fullPath(const std::string file);
     std::string dirname;
     static const std::string drmPath;
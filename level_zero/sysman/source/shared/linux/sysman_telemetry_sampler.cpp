@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "level_zero/sysman/source/device/sysman_device.h"
+#include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
+
+#include <algorithm>
+#include <fcntl.h>
+
+namespace L0 {
+namespace Sysman {
+
+std::unique_ptr<SysmanTelemetrySampler> SysmanTelemetrySampler::create() {
+    auto samplingPeriod = NEO::debugManager.flags.SysmanTelemetrySamplingPeriod.get();
+    if (samplingPeriod <= 0) {
+        return nullptr;
+    }
+    return std::make_unique<SysmanTelemetrySampler>(std::chrono::microseconds(samplingPeriod));
+}
+
+SysmanTelemetrySampler::SysmanTelemetrySampler(std::chrono::microseconds samplingPeriod)
+    : samplingPeriod(samplingPeriod), counters(new Counter[maxCounters]) {
+    stagingBuffer.resize(maxCounters * maxValueSize);
+    stagingSizes.resize(maxCounters);
+    coalescedReadBuffer.resize(maxCoalescedReadSize);
+    sampledFiles.reserve(maxCounters);
+}
+
+SysmanTelemetrySampler::~SysmanTelemetrySampler() {
+    stop();
+}
+
+uint32_t SysmanTelemetrySampler::acquireCounter(const std::string &file, uint64_t offset, uint32_t size) {
+    return acquire(file, offset, size, false);
+}
+
+uint32_t SysmanTelemetrySampler::acquireTextCounter(const std::string &file) {
+    static_assert(maxValueSize >= FsAccessInterface::maxValueLength);
+    return acquire(file, 0, FsAccessInterface::maxValueLength, true);
+}
+
+uint32_t SysmanTelemetrySampler::acquire(const std::string &file, uint64_t offset, uint32_t size, bool text) {
+    {
+        std::shared_lock<std::shared_mutex> lock(requestsMutex);
+        auto requests = counterRequests.find(CounterKeyView{file, offset});
+        if (requests != counterRequests.end() && requests->second.counterId != invalidCounterId) {
+            return requests->second.counterId;
+        }
+        if (countersCount.load(std::memory_order_acquire) == maxCounters) {
+            return invalidCounterId;
+        }
+    }
+    if (size == 0 || size > maxValueSize) {
+        return invalidCounterId;
+    }
+
+    std::lock_guard<std::mutex> samplingLock(samplingMutex);
+    std::unique_lock<std::shared_mutex> lock(requestsMutex);
+    auto requests = counterRequests.find(CounterKeyView{file, offset});
+    if (requests == counterRequests.end()) {
+        requests = counterRequests.emplace(CounterKey{file, offset}, CounterRequests{}).first;
+    }
+    auto &counterRequest = requests->second;
+    if (counterRequest.counterId != invalidCounterId) {
+        return counterRequest.counterId;
+    }
+    counterRequest.requests++;
+    auto counterId = countersCount.load(std::memory_order_relaxed);
+    if (counterRequest.requests < requestsToStartSampling || counterId == maxCounters) {
+        return invalidCounterId;
+    }
+
+    auto &counter = counters[counterId];
+    counter.offset = offset;
+    counter.readSize = size;
+    counter.text = text;
+
+    auto sampledFile = std::find_if(sampledFiles.begin(), sampledFiles.end(), [&](const SampledFile &sampled) {
+        return sampled.path == file;
+    });
+    if (sampledFile == sampledFiles.end()) {
+        sampledFiles.emplace_back();
+        sampledFile = sampledFiles.end() - 1;
+        sampledFile->path = file;
+    }
+    sampledFile->counterIds.push_back(counterId);
+    updateCoalescedRange(*sampledFile);
+
+    counterRequest.counterId = counterId;
+    countersCount.store(counterId + 1, std::memory_order_release);
+    return counterId;
+}
+
+void SysmanTelemetrySampler::updateCoalescedRange(SampledFile &sampledFile) {
+    sampledFile.coalescedSize = 0;
+    uint64_t begin = std::numeric_limits<uint64_t>::max();
+    uint64_t end = 0;
+    for (auto counterId : sampledFile.counterIds) {
+        begin = std::min(begin, counters[counterId].offset);
+        end = std::max(end, counters[counterId].offset + counters[counterId].readSize);
+    }
+    if (end - begin <= maxCoalescedReadSize) {
+        sampledFile.coalescedOffset = begin;
+        sampledFile.coalescedSize = static_cast<uint32_t>(end - begin);
+    }
+}
+
+bool SysmanTelemetrySampler::readSnapshot(uint32_t counterId, uint8_t *data, uint32_t &size, uint64_t &timestamp) const {
+    if (counterId >= countersCount.load(std::memory_order_acquire)) {
+        return false;
+    }
+    auto &counter = counters[counterId];
+    uint64_t words[maxValueSize / sizeof(uint64_t)];
+    uint64_t valueTimestamp = 0;
+    bool valid = false;
+    while (true) {
+        auto sequenceBegin = sequence.load(std::memory_order_acquire);
+        if (sequenceBegin & 1) {
+            continue;
+        }
+        valid = counter.valid.load(std::memory_order_relaxed);
+        size = counter.size.load(std::memory_order_relaxed);
+        valueTimestamp = sampleTimestamp.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < counter.value.size(); i++) {
+            words[i] = counter.value[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == sequenceBegin) {
+            break;
+        }
+    }
+    if (!valid) {
+        return false;
+    }
+    memcpy(data, words, size);
+    timestamp = valueTimestamp;
+    return true;
+}
+
+template <typename T>
+bool SysmanTelemetrySampler::readText(uint32_t counterId, T &value, uint64_t &timestamp) const {
+    if (counterId >= countersCount.load(std::memory_order_acquire) || !counters[counterId].text) {
+        return false;
+    }
+    char data[maxValueSize + 1];
+    uint32_t size = 0;
+    uint64_t valueTimestamp = 0;
+    if (!readSnapshot(counterId, reinterpret_cast<uint8_t *>(data), size, valueTimestamp)) {
+        return false;
+    }
+    data[size] = '\0';
+    if (!FsAccessInterface::parseValue(data, value)) {
+        return false;
+    }
+    timestamp = valueTimestamp;
+    return true;
+}
+
+bool SysmanTelemetrySampler::readTextValue(uint32_t counterId, uint64_t &value, uint64_t &timestamp) const {
+    return readText(counterId, value, timestamp);
+}
+
+bool SysmanTelemetrySampler::readTextValue(uint32_t counterId, double &value, uint64_t &timestamp) const {
+    return readText(counterId, value, timestamp);
+}
+
+bool SysmanTelemetrySampler::readTextValue(uint32_t counterId, uint32_t &value, uint64_t &timestamp) const {
+    return readText(counterId, value, timestamp);
+}
+
+bool SysmanTelemetrySampler::readTextValue(uint32_t counterId, int32_t &value, uint64_t &timestamp) const {
+    return readText(counterId, value, timestamp);
+}
+
+// binary counters have to be read whole, text counters hold as many bytes as the file has
+uint32_t SysmanTelemetrySampler::getSampledSize(const Counter &counter, uint32_t begin, uint32_t bytesRead) const {
+    if (begin >= bytesRead) {
+        return 0;
+    }
+    auto available = bytesRead - begin;
+    if (counter.text) {
+        return std::min(available, counter.readSize);
+    }
+    return available >= counter.readSize ? counter.readSize : 0;
+}
+
+bool SysmanTelemetrySampler::readFile(SampledFile &sampledFile, uint8_t *buffer, uint64_t offset, uint32_t size, uint32_t &bytesRead) {
+    if (sampledFile.fd < 0) {
+        sampledFile.fd = NEO::SysCalls::open(sampledFile.path.c_str(), O_RDONLY);
+        if (sampledFile.fd < 0) {
+            return false;
+        }
+    }
+    auto result = NEO::SysCalls::pread(sampledFile.fd, buffer, size, static_cast<off_t>(offset));
+    if (result < 0) {
+        // file is reopened during next pass, it may be recreated e.g. after device reset
+        NEO::SysCalls::close(sampledFile.fd);
+        sampledFile.fd = -1;
+        return false;
+    }
+    bytesRead = static_cast<uint32_t>(result);
+    return true;
+}
+
+void SysmanTelemetrySampler::sample() {
+    constexpr uint32_t failedRead = std::numeric_limits<uint32_t>::max();
+
+    std::lock_guard<std::mutex> lock(samplingMutex);
+    auto count = countersCount.load(std::memory_order_acquire);
+
+    for (auto &sampledFile : sampledFiles) {
+        if (sampledFile.coalescedSize > 0) {
+            uint32_t bytesRead = 0;
+            bool success = readFile(sampledFile, coalescedReadBuffer.data(), sampledFile.coalescedOffset, sampledFile.coalescedSize, bytesRead);
+            for (auto counterId : sampledFile.counterIds) {
+                auto &counter = counters[counterId];
+                auto begin = static_cast<uint32_t>(counter.offset - sampledFile.coalescedOffset);
+                auto size = success ? getSampledSize(counter, begin, bytesRead) : 0u;
+                if (size == 0) {
+                    stagingSizes[counterId] = failedRead;
+                    continue;
+                }
+                memcpy(&stagingBuffer[counterId * maxValueSize], &coalescedReadBuffer[begin], size);
+                stagingSizes[counterId] = size;
+            }
+            continue;
+        }
+        for (auto counterId : sampledFile.counterIds) {
+            auto &counter = counters[counterId];
+            uint32_t bytesRead = 0;
+            bool success = readFile(sampledFile, &stagingBuffer[counterId * maxValueSize], counter.offset, counter.readSize, bytesRead);
+            auto size = success ? getSampledSize(counter, 0, bytesRead) : 0u;
+            if (size == 0) {
+                stagingSizes[counterId] = failedRead;
+                continue;
+            }
+            stagingSizes[counterId] = size;
+        }
+    }
+
+    // published with the values, so that getters pair counters with the time they were read and not with the time of the call
+    auto timestamp = SysmanDevice::getSysmanTimestamp();
+
+    auto sequenceBegin = sequence.load(std::memory_order_relaxed);
+    sequence.store(sequenceBegin + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    sampleTimestamp.store(timestamp, std::memory_order_relaxed);
+    for (uint32_t counterId = 0; counterId < count; counterId++) {
+        auto &counter = counters[counterId];
+        if (stagingSizes[counterId] == failedRead) {
+            counter.valid.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        uint64_t words[maxValueSize / sizeof(uint64_t)] = {};
+        memcpy(words, &stagingBuffer[counterId * maxValueSize], stagingSizes[counterId]);
+        for (size_t i = 0; i < counter.value.size(); i++) {
+            counter.value[i].store(words[i], std::memory_order_relaxed);
+        }
+        counter.size.store(stagingSizes[counterId], std::memory_order_relaxed);
+        counter.valid.store(true, std::memory_order_relaxed);
+    }
+    sequence.store(sequenceBegin + 2, std::memory_order_release);
+    samplesCount++;
+}
+
+void *SysmanTelemetrySampler::samplingLoop(void *arg) {
+    auto sampler = reinterpret_cast<SysmanTelemetrySampler *>(arg);
+
+    std::unique_lock<std::mutex> lock(sampler->threadMutex);
+    while (sampler->samplingActive) {
+        lock.unlock();
+        sampler->sample();
+        lock.lock();
+        sampler->threadCondition.wait_for(lock, sampler->samplingPeriod, [sampler] { return !sampler->samplingActive; });
+    }
+    return nullptr;
+}
+
+void SysmanTelemetrySampler::start() {
+    std::lock_guard<std::mutex> lock(threadMutex);
+    if (samplingActive) {
+        return;
+    }
+    samplingActive = true;
+    samplingThread = NEO::Thread::create(samplingLoop, reinterpret_cast<void *>(this));
+}
+
+void SysmanTelemetrySampler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(threadMutex);
+        samplingActive = false;
+    }
+    threadCondition.notify_one();
+    if (samplingThread) {
+        samplingThread->join();
+        samplingThread.reset();
+    }
+    closeFiles();
+}
+
+void SysmanTelemetrySampler::closeFiles() {
+    std::lock_guard<std::mutex> lock(samplingMutex);
+    for (auto &sampledFile : sampledFiles) {
+        if (sampledFile.fd >= 0) {
+            NEO::SysCalls::close(sampledFile.fd);
+            sampledFile.fd = -1;
+        }
+        for (auto counterId : sampledFile.counterIds) {
+            counters[counterId].valid.store(false, std::memory_order_release);
+        }
+    }
+}
+
+} // namespace Sysman
+} // namespace L0
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+namespace Sysman {
+
+// Periodically reads registered PMT telemetry counters and sysfs text counters in background and publishes them
+// together with sampling timestamp as one snapshot protected by sequence lock.
+// Getters copy values from the snapshot without syscalls and without taking locks.
+// Counters are registered on demand, counter becomes sampled once it is requested repeatedly.
+class SysmanTelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t maxCounters = 256u;
+    static constexpr uint32_t maxValueSize = 64u;
+    static constexpr uint32_t requestsToStartSampling = 2u;
+    static constexpr uint32_t maxCoalescedReadSize = 4096u;
+    static constexpr uint32_t invalidCounterId = std::numeric_limits<uint32_t>::max();
+
+    static std::unique_ptr<SysmanTelemetrySampler> create();
+
+    SysmanTelemetrySampler(std::chrono::microseconds samplingPeriod);
+    MOCKABLE_VIRTUAL ~SysmanTelemetrySampler();
+
+    uint32_t acquireCounter(const std::string &file, uint64_t offset, uint32_t size);
+    // whole content of sysfs file holding single decimal value, read with single pread from offset 0
+    uint32_t acquireTextCounter(const std::string &file);
+
+    // data has to hold maxValueSize bytes, timestamp is the sysman timestamp of sampling pass which read the value
+    bool readSnapshot(uint32_t counterId, uint8_t *data, uint32_t &size, uint64_t &timestamp) const;
+    template <typename T>
+    bool readValue(uint32_t counterId, T &value, uint64_t &timestamp) const;
+    bool readTextValue(uint32_t counterId, uint64_t &value, uint64_t &timestamp) const;
+    bool readTextValue(uint32_t counterId, double &value, uint64_t &timestamp) const;
+    bool readTextValue(uint32_t counterId, uint32_t &value, uint64_t &timestamp) const;
+    bool readTextValue(uint32_t counterId, int32_t &value, uint64_t &timestamp) const;
+
+    void sample();
+    void start();
+    void stop();
+
+    uint32_t getCountersCount() const { return countersCount.load(std::memory_order_acquire); }
+    uint64_t getSamplesCount() const { return samplesCount; }
+
+  protected:
+    struct CounterKey {
+        std::string file;
+        uint64_t offset;
+    };
+    struct CounterKeyView {
+        const std::string &file;
+        uint64_t offset;
+    };
+    struct CounterKeyCompare {
+        using is_transparent = void;
+        template <typename KeyA, typename KeyB>
+        bool operator()(const KeyA &a, const KeyB &b) const {
+            int result = a.file.compare(b.file);
+            return result < 0 || (result == 0 && a.offset < b.offset);
+        }
+    };
+    struct CounterRequests {
+        uint32_t requests = 0;
+        uint32_t counterId = invalidCounterId;
+    };
+
+    // configuration fields are written once, before counter becomes visible through countersCount
+    struct Counter {
+        uint64_t offset = 0;
+        uint32_t readSize = 0;
+        bool text = false;
+        std::array<std::atomic<uint64_t>, maxValueSize / sizeof(uint64_t)> value{};
+        std::atomic<uint32_t> size{0};
+        std::atomic<bool> valid{false};
+    };
+
+    // counters reading the same file share descriptor and are read with single pread when they are close to each other
+    struct SampledFile {
+        std::string path;
+        int fd = -1;
+        uint64_t coalescedOffset = 0;
+        uint32_t coalescedSize = 0;
+        std::vector<uint32_t> counterIds;
+    };
+
+    uint32_t acquire(const std::string &file, uint64_t offset, uint32_t size, bool text);
+    template <typename T>
+    bool readText(uint32_t counterId, T &value, uint64_t &timestamp) const;
+    uint32_t getSampledSize(const Counter &counter, uint32_t begin, uint32_t bytesRead) const;
+    static void *samplingLoop(void *arg);
+    MOCKABLE_VIRTUAL bool readFile(SampledFile &sampledFile, uint8_t *buffer, uint64_t offset, uint32_t size, uint32_t &bytesRead);
+    void updateCoalescedRange(SampledFile &sampledFile);
+    void closeFiles();
+
+    const std::chrono::microseconds samplingPeriod;
+    std::unique_ptr<Counter[]> counters;
+    std::atomic<uint32_t> countersCount{0};
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<uint64_t> sampleTimestamp{0};
+    uint64_t samplesCount = 0;
+
+    std::shared_mutex requestsMutex;
+    std::map<CounterKey, CounterRequests, CounterKeyCompare> counterRequests;
+
+    // guards sampled files and staging buffers, sample pass is serialized with registration and invalidation
+    std::mutex samplingMutex;
+    std::vector<SampledFile> sampledFiles;
+    std::vector<uint8_t> stagingBuffer;
+    std::vector<uint8_t> coalescedReadBuffer;
+    std::vector<uint32_t> stagingSizes;
+
+    std::mutex threadMutex;
+    std::condition_variable threadCondition;
+    bool samplingActive = false;
+    std::unique_ptr<NEO::Thread> samplingThread;
+};
+
+template <typename T>
+bool SysmanTelemetrySampler::readValue(uint32_t counterId, T &value, uint64_t &timestamp) const {
+    uint8_t data[maxValueSize];
+    uint32_t size = 0;
+    if (!readSnapshot(counterId, data, size, timestamp) || size != sizeof(T)) {
+        return false;
+    }
+    memcpy(&value, data, sizeof(T));
+    return true;
+}
+
+} // namespace Sysman
+} // namespace L0
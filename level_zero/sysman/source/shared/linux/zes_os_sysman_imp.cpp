@@ -25,6 +25,7 @@
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
 #include "level_zero/sysman/source/shared/linux/sysman_kmd_interface.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
 
 namespace L0 {
 namespace Sysman {
@@ -58,6 +59,12 @@ ze_result_t LinuxSysmanImp::init() {
     rootPath = NEO::getPciRootPath(myDeviceFd).value_or("");
     pSysfsAccess->getRealPath(deviceDir, gtDevicePath);
 
+    pTelemetrySampler = SysmanTelemetrySampler::create();
+    if (pTelemetrySampler) {
+        pTelemetrySampler->start();
+    }
+    pSysfsAccess->setTelemetrySampler(pTelemetrySampler.get());
+
     osInterface.getDriverModel()->as<NEO::Drm>()->cleanup();
     pPmuInterface = PmuInterface::create(this);
     return createPmtHandles();
@@ -215,6 +222,9 @@ void LinuxSysmanImp::releaseFwUtilInterface() {
 }
 
 LinuxSysmanImp::~LinuxSysmanImp() {
+    if (nullptr != pTelemetrySampler) {
+        pTelemetrySampler->stop();
+    }
     if (nullptr != pPmuInterface) {
         delete pPmuInterface;
         pPmuInterface = nullptr;
@@ -286,6 +296,9 @@ ze_result_t LinuxSysmanImp::gpuProcessCleanup(ze_bool_t force) {
 }
 
 void LinuxSysmanImp::releaseSysmanDeviceResources() {
+    if (nullptr != pTelemetrySampler) {
+        pTelemetrySampler->stop();
+    }
     getSysmanDeviceImp()->pEngineHandleContext->releaseEngines();
     getSysmanDeviceImp()->pRasHandleContext->releaseRasHandles();
     getSysmanDeviceImp()->pMemoryHandleContext->releaseMemoryHandles();
@@ -303,6 +316,9 @@ void LinuxSysmanImp::releaseSysmanDeviceResources() {
 
 ze_result_t LinuxSysmanImp::reInitSysmanDeviceResources() {
     createPmtHandles();
+    if (nullptr != pTelemetrySampler) {
+        pTelemetrySampler->start();
+    }
     if (!diagnosticsReset) {
         if (pFwUtilInterface == nullptr) {
             createFwUtilInterface();
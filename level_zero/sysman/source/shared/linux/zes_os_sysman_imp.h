@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@ class SysmanKmdInterface;
 class FsAccessInterface;
 class SysFsAccessInterface;
 class ProcFsAccessInterface;
+class SysmanTelemetrySampler;
 
 class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
   public:
@@ -79,10 +80,12 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
     bool isMemoryDiagnostics = false;
     std::string gtDevicePath;
     SysmanKmdInterface *getSysmanKmdInterface() { return pSysmanKmdInterface.get(); }
+    SysmanTelemetrySampler *getTelemetrySampler() { return pTelemetrySampler.get(); }
 
   protected:
     std::unique_ptr<SysmanProductHelper> pSysmanProductHelper;
     std::unique_ptr<SysmanKmdInterface> pSysmanKmdInterface;
+    std::unique_ptr<SysmanTelemetrySampler> pTelemetrySampler;
     FsAccessInterface *pFsAccess = nullptr;
     ProcFsAccessInterface *pProcfsAccess = nullptr;
     SysFsAccessInterface *pSysfsAccess = nullptr;
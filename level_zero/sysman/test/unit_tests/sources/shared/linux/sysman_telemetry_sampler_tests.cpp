@@ -0,0 +1,491 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+
+#include "level_zero/sysman/source/device/sysman_device.h"
+#include "level_zero/sysman/source/shared/linux/pmt/sysman_pmt.h"
+#include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace L0 {
+namespace Sysman {
+namespace ult {
+
+namespace {
+constexpr int fakeFdBase = 1000;
+std::map<std::string, std::vector<uint8_t>> fakeFiles;
+std::vector<std::string> openedFiles;
+uint32_t preadCalls = 0;
+bool failPread = false;
+
+void setFakeTelemetryValue(const std::string &path, uint64_t offset, uint32_t value) {
+    auto &content = fakeFiles[path];
+    content.resize(std::max(content.size(), static_cast<size_t>(offset + sizeof(value))));
+    memcpy(&content[offset], &value, sizeof(value));
+}
+
+void setFakeSysfsValue(const std::string &path, const std::string &value) {
+    fakeFiles[path] = std::vector<uint8_t>(value.begin(), value.end());
+}
+
+int fakeOpen(const char *pathname, int flags) {
+    if (fakeFiles.find(pathname) == fakeFiles.end()) {
+        errno = ENOENT;
+        return -1;
+    }
+    openedFiles.push_back(pathname);
+    return fakeFdBase + static_cast<int>(openedFiles.size()) - 1;
+}
+
+int fakeClose(int fd) {
+    return 0;
+}
+
+ssize_t fakePread(int fd, void *buf, size_t count, off_t offset) {
+    preadCalls++;
+    if (failPread || fd < fakeFdBase || fd - fakeFdBase >= static_cast<int>(openedFiles.size())) {
+        errno = EIO;
+        return -1;
+    }
+    auto &content = fakeFiles[openedFiles[fd - fakeFdBase]];
+    if (static_cast<size_t>(offset) >= content.size()) {
+        return 0;
+    }
+    auto bytes = std::min(count, content.size() - static_cast<size_t>(offset));
+    memcpy(buf, content.data() + offset, bytes);
+    return static_cast<ssize_t>(bytes);
+}
+} // namespace
+
+class MockSysmanTelemetrySampler : public SysmanTelemetrySampler {
+  public:
+    using SysmanTelemetrySampler::SysmanTelemetrySampler;
+    using SysmanTelemetrySampler::sampledFiles;
+};
+
+class TelemetrySamplerPmt : public PlatformMonitoringTech {
+  public:
+    TelemetrySamplerPmt() : PlatformMonitoringTech(nullptr, 0, 0) {}
+    using PlatformMonitoringTech::keyOffsetMap;
+    using PlatformMonitoringTech::pTelemetrySampler;
+    using PlatformMonitoringTech::telemetryDeviceEntry;
+};
+
+class TelemetrySamplerSysfsAccess : public SysFsAccessInterface {
+  public:
+    TelemetrySamplerSysfsAccess() = default;
+    using SysFsAccessInterface::pTelemetrySampler;
+};
+
+class SysmanTelemetrySamplerTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        fakeFiles.clear();
+        openedFiles.clear();
+        preadCalls = 0;
+        failPread = false;
+    }
+
+    void TearDown() override {
+        fakeFiles.clear();
+        openedFiles.clear();
+    }
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> mockOpen{&NEO::SysCalls::sysCallsOpen, &fakeOpen};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsClose)> mockClose{&NEO::SysCalls::sysCallsClose, &fakeClose};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> mockPread{&NEO::SysCalls::sysCallsPread, &fakePread};
+};
+
+TEST_F(SysmanTelemetrySamplerTest, givenSamplingPeriodDebugFlagWhenCreatingSamplerThenSamplerIsCreatedOnlyWhenPeriodIsPositive) {
+    DebugManagerStateRestore restore;
+    EXPECT_EQ(nullptr, SysmanTelemetrySampler::create());
+
+    NEO::debugManager.flags.SysmanTelemetrySamplingPeriod.set(0);
+    EXPECT_EQ(nullptr, SysmanTelemetrySampler::create());
+
+    NEO::debugManager.flags.SysmanTelemetrySamplingPeriod.set(1000);
+    EXPECT_NE(nullptr, SysmanTelemetrySampler::create());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenCounterRequestedRepeatedlyWhenSampledThenValueIsReturnedFromSnapshotWithoutSyscalls) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    setFakeTelemetryValue(file, 0x40, 300u);
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+
+    EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.acquireCounter(file, 0x40, sizeof(uint32_t)));
+    auto counterId = sampler.acquireCounter(file, 0x40, sizeof(uint32_t));
+    ASSERT_NE(SysmanTelemetrySampler::invalidCounterId, counterId);
+    EXPECT_EQ(counterId, sampler.acquireCounter(file, 0x40, sizeof(uint32_t)));
+    EXPECT_EQ(1u, sampler.getCountersCount());
+
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    EXPECT_FALSE(sampler.readValue(counterId, value, timestamp));
+
+    sampler.sample();
+    EXPECT_EQ(1u, preadCalls);
+    EXPECT_TRUE(sampler.readValue(counterId, value, timestamp));
+    EXPECT_EQ(300u, value);
+
+    setFakeTelemetryValue(file, 0x40, 1300u);
+    EXPECT_TRUE(sampler.readValue(counterId, value, timestamp));
+    EXPECT_EQ(300u, value);
+    EXPECT_EQ(1u, preadCalls);
+
+    sampler.sample();
+    EXPECT_TRUE(sampler.readValue(counterId, value, timestamp));
+    EXPECT_EQ(1300u, value);
+    EXPECT_EQ(2u, preadCalls);
+    EXPECT_EQ(1u, openedFiles.size());
+    EXPECT_EQ(2u, sampler.getSamplesCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenZeroSizedCounterWhenAcquiringCounterThenInvalidIdIsReturned) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    for (uint32_t i = 0; i < SysmanTelemetrySampler::requestsToStartSampling; i++) {
+        EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.acquireCounter(file, 0u, 0u));
+    }
+    EXPECT_EQ(0u, sampler.getCountersCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSampledCounterWhenReadingThenTimestampOfSamplingPassIsReturned) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    setFakeTelemetryValue(file, 0x40, 300u);
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    sampler.acquireCounter(file, 0x40, sizeof(uint32_t));
+    auto counterId = sampler.acquireCounter(file, 0x40, sizeof(uint32_t));
+
+    auto timestampBeforeSample = SysmanDevice::getSysmanTimestamp();
+    sampler.sample();
+    auto timestampAfterSample = SysmanDevice::getSysmanTimestamp();
+
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    EXPECT_TRUE(sampler.readValue(counterId, value, timestamp));
+    EXPECT_LE(timestampBeforeSample, timestamp);
+    EXPECT_GE(timestampAfterSample, timestamp);
+
+    while (SysmanDevice::getSysmanTimestamp() == timestampAfterSample) {
+    }
+    uint64_t timestampOfSameSample = 0;
+    EXPECT_TRUE(sampler.readValue(counterId, value, timestampOfSameSample));
+    EXPECT_EQ(timestamp, timestampOfSameSample);
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenPmtWithSamplerWhenReadingValueWithTimestampThenTimestampIsPairedWithSampledValue) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    setFakeTelemetryValue(file, 0x40, 300u);
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    TelemetrySamplerPmt pmt;
+    pmt.telemetryDeviceEntry = file;
+    pmt.keyOffsetMap["PACKAGE_ENERGY"] = 0x40;
+    pmt.pTelemetrySampler = &sampler;
+
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    auto timestampBeforeRead = SysmanDevice::getSysmanTimestamp();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pmt.readValue("PACKAGE_ENERGY", value, timestamp));
+    EXPECT_EQ(300u, value);
+    EXPECT_LE(timestampBeforeRead, timestamp);
+    EXPECT_EQ(0u, sampler.getCountersCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pmt.readValue("PACKAGE_ENERGY", value, timestamp));
+    EXPECT_EQ(1u, sampler.getCountersCount());
+
+    sampler.sample();
+    auto timestampAfterSample = SysmanDevice::getSysmanTimestamp();
+    setFakeTelemetryValue(file, 0x40, 500u);
+    while (SysmanDevice::getSysmanTimestamp() == timestampAfterSample) {
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pmt.readValue("PACKAGE_ENERGY", value, timestamp));
+    EXPECT_EQ(300u, value);
+    EXPECT_GE(timestampAfterSample, timestamp);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pmt.readValue("UNKNOWN_KEY", value, timestamp));
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenBinaryCountersInSameFileWhenSampledThenCountersAreReadWithSinglePread) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    std::vector<uint8_t> telemetry(256, 0);
+    uint64_t energy = 0x123456789abcdef0;
+    uint32_t temperature = 56;
+    memcpy(&telemetry[0x40], &energy, sizeof(energy));
+    memcpy(&telemetry[0x80], &temperature, sizeof(temperature));
+    fakeFiles[file] = telemetry;
+
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    sampler.acquireCounter(file, 0x40, sizeof(uint64_t));
+    auto energyCounter = sampler.acquireCounter(file, 0x40, sizeof(uint64_t));
+    sampler.acquireCounter(file, 0x80, sizeof(uint32_t));
+    auto temperatureCounter = sampler.acquireCounter(file, 0x80, sizeof(uint32_t));
+    ASSERT_NE(SysmanTelemetrySampler::invalidCounterId, energyCounter);
+    ASSERT_NE(SysmanTelemetrySampler::invalidCounterId, temperatureCounter);
+
+    ASSERT_EQ(1u, sampler.sampledFiles.size());
+    EXPECT_EQ(0x40u, sampler.sampledFiles[0].coalescedOffset);
+    EXPECT_EQ(0x80u + sizeof(uint32_t) - 0x40u, sampler.sampledFiles[0].coalescedSize);
+
+    sampler.sample();
+    EXPECT_EQ(1u, preadCalls);
+
+    uint64_t energyRead = 0;
+    uint32_t temperatureRead = 0;
+    uint64_t energyTimestamp = 0;
+    uint64_t temperatureTimestamp = 0;
+    EXPECT_TRUE(sampler.readValue(energyCounter, energyRead, energyTimestamp));
+    EXPECT_TRUE(sampler.readValue(temperatureCounter, temperatureRead, temperatureTimestamp));
+    EXPECT_EQ(energy, energyRead);
+    EXPECT_EQ(temperature, temperatureRead);
+    EXPECT_EQ(energyTimestamp, temperatureTimestamp);
+
+    EXPECT_FALSE(sampler.readValue(temperatureCounter, energyRead, energyTimestamp));
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenBinaryCountersTooFarApartWhenSampledThenEachCounterIsReadSeparately) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    fakeFiles[file] = std::vector<uint8_t>(3 * SysmanTelemetrySampler::maxCoalescedReadSize, 0x11);
+
+    MockSysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    uint32_t counterIds[2] = {};
+    uint64_t offsets[2] = {0u, 2 * SysmanTelemetrySampler::maxCoalescedReadSize};
+    for (uint32_t i = 0; i < 2; i++) {
+        sampler.acquireCounter(file, offsets[i], sizeof(uint32_t));
+        counterIds[i] = sampler.acquireCounter(file, offsets[i], sizeof(uint32_t));
+    }
+    EXPECT_EQ(0u, sampler.sampledFiles[0].coalescedSize);
+
+    sampler.sample();
+    EXPECT_EQ(2u, preadCalls);
+    for (auto counterId : counterIds) {
+        uint32_t value = 0;
+        uint64_t timestamp = 0;
+        EXPECT_TRUE(sampler.readValue(counterId, value, timestamp));
+        EXPECT_EQ(0x11111111u, value);
+    }
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenFailingReadWhenSampledThenCounterIsInvalidAndFileIsReopenedDuringNextSample) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    setFakeTelemetryValue(file, 0u, 300u);
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    sampler.acquireCounter(file, 0u, sizeof(uint32_t));
+    auto counterId = sampler.acquireCounter(file, 0u, sizeof(uint32_t));
+
+    sampler.sample();
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    EXPECT_TRUE(sampler.readValue(counterId, value, timestamp));
+
+    failPread = true;
+    sampler.sample();
+    EXPECT_FALSE(sampler.readValue(counterId, value, timestamp));
+
+    failPread = false;
+    sampler.sample();
+    EXPECT_TRUE(sampler.readValue(counterId, value, timestamp));
+    EXPECT_EQ(2u, openedFiles.size());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSamplerStoppedWhenReadingThenCountersAreInvalidUntilSampledAgain) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    setFakeTelemetryValue(file, 0u, 300u);
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(100));
+    sampler.acquireCounter(file, 0u, sizeof(uint32_t));
+    auto counterId = sampler.acquireCounter(file, 0u, sizeof(uint32_t));
+
+    sampler.start();
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    while (!sampler.readValue(counterId, value, timestamp)) {
+    }
+    EXPECT_EQ(300u, value);
+
+    sampler.stop();
+    EXPECT_FALSE(sampler.readValue(counterId, value, timestamp));
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenMaxCountersRegisteredWhenAcquiringNextCounterThenInvalidIdIsReturned) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    fakeFiles[file] = std::vector<uint8_t>(SysmanTelemetrySampler::maxCounters * sizeof(uint32_t) + sizeof(uint32_t), 0);
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    for (uint32_t i = 0; i < SysmanTelemetrySampler::maxCounters; i++) {
+        sampler.acquireCounter(file, i * sizeof(uint32_t), sizeof(uint32_t));
+        EXPECT_EQ(i, sampler.acquireCounter(file, i * sizeof(uint32_t), sizeof(uint32_t)));
+    }
+    auto offset = SysmanTelemetrySampler::maxCounters * sizeof(uint32_t);
+    EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.acquireCounter(file, offset, sizeof(uint32_t)));
+    EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.acquireCounter(file, offset, sizeof(uint32_t)));
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenBinaryCounterLargerThanMaxValueSizeWhenAcquiringCounterThenInvalidIdIsReturned) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    for (uint32_t i = 0; i < SysmanTelemetrySampler::requestsToStartSampling; i++) {
+        EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.acquireCounter(file, 0u, SysmanTelemetrySampler::maxValueSize + 1));
+    }
+    EXPECT_EQ(0u, sampler.getCountersCount());
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSysfsTextCounterRequestedRepeatedlyWhenSampledThenParsedValueIsReturnedFromSnapshot) {
+    const std::string file = "/sys/class/drm/card0/gt/gt0/rps_act_freq_mhz";
+    setFakeSysfsValue(file, "1300\n");
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+
+    EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.acquireTextCounter(file));
+    auto counterId = sampler.acquireTextCounter(file);
+    ASSERT_NE(SysmanTelemetrySampler::invalidCounterId, counterId);
+
+    sampler.sample();
+    EXPECT_EQ(1u, preadCalls);
+    double frequency = 0;
+    uint64_t timestamp = 0;
+    EXPECT_TRUE(sampler.readTextValue(counterId, frequency, timestamp));
+    EXPECT_EQ(1300.0, frequency);
+
+    setFakeSysfsValue(file, "350\n");
+    EXPECT_TRUE(sampler.readTextValue(counterId, frequency, timestamp));
+    EXPECT_EQ(1300.0, frequency);
+
+    sampler.sample();
+    uint32_t frequencyInteger = 0;
+    EXPECT_TRUE(sampler.readTextValue(counterId, frequencyInteger, timestamp));
+    EXPECT_EQ(350u, frequencyInteger);
+    EXPECT_EQ(2u, preadCalls);
+    EXPECT_EQ(1u, openedFiles.size());
+
+    uint32_t binaryValue = 0;
+    EXPECT_FALSE(sampler.readValue(counterId, binaryValue, timestamp));
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSysfsTextCounterWithInvalidContentWhenReadingThenFalseIsReturned) {
+    const std::string file = "/sys/class/drm/card0/gt/gt0/throttle_reason_status";
+    setFakeSysfsValue(file, "not a number\n");
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    sampler.acquireTextCounter(file);
+    auto counterId = sampler.acquireTextCounter(file);
+
+    sampler.sample();
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    EXPECT_FALSE(sampler.readTextValue(counterId, value, timestamp));
+
+    setFakeSysfsValue(file, "");
+    sampler.sample();
+    EXPECT_FALSE(sampler.readTextValue(counterId, value, timestamp));
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenBinaryCounterWhenReadingAsTextThenFalseIsReturned) {
+    const std::string file = "/sys/class/intel_pmt/telem1/telem";
+    setFakeTelemetryValue(file, 0u, 0x30303030u);
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    sampler.acquireCounter(file, 0u, sizeof(uint32_t));
+    auto counterId = sampler.acquireCounter(file, 0u, sizeof(uint32_t));
+
+    sampler.sample();
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    EXPECT_FALSE(sampler.readTextValue(counterId, value, timestamp));
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenSysfsTreeAndSamplerWhenReadingTelemetryThenValuesAreReadDirectlyUntilCounterIsSampled) {
+    const std::string actualFreqFile = "/sys/class/drm/card0/gt/gt0/rps_act_freq_mhz";
+    const std::string energyFile = "/sys/class/drm/card0/device/hwmon/hwmon2/energy1_input";
+    setFakeSysfsValue(actualFreqFile, "1300\n");
+    setFakeSysfsValue(energyFile, "123456789012\n");
+
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    TelemetrySamplerSysfsAccess sysfsAccess;
+    sysfsAccess.setTelemetrySampler(&sampler);
+
+    double frequency = 0;
+    uint64_t energy = 0;
+    uint64_t frequencyTimestamp = 0;
+    uint64_t energyTimestamp = 0;
+    auto timestampBeforeRead = SysmanDevice::getSysmanTimestamp();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry(actualFreqFile, frequency, frequencyTimestamp));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry(energyFile, energy, energyTimestamp));
+    EXPECT_EQ(1300.0, frequency);
+    EXPECT_EQ(123456789012u, energy);
+    EXPECT_LE(timestampBeforeRead, frequencyTimestamp);
+    EXPECT_LE(timestampBeforeRead, energyTimestamp);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry(actualFreqFile, frequency, frequencyTimestamp));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry(energyFile, energy, energyTimestamp));
+    EXPECT_EQ(2u, sampler.getCountersCount());
+
+    setFakeSysfsValue(actualFreqFile, "400\n");
+    setFakeSysfsValue(energyFile, "123456789999\n");
+    sampler.sample();
+    auto preadCallsAfterSample = preadCalls;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry(actualFreqFile, frequency, frequencyTimestamp));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry(energyFile, energy, energyTimestamp));
+    EXPECT_EQ(400.0, frequency);
+    EXPECT_EQ(123456789999u, energy);
+    EXPECT_EQ(frequencyTimestamp, energyTimestamp);
+    EXPECT_EQ(preadCallsAfterSample, preadCalls);
+
+    sampler.stop();
+    setFakeSysfsValue(actualFreqFile, "500\n");
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry(actualFreqFile, frequency, frequencyTimestamp));
+    EXPECT_EQ(500.0, frequency);
+}
+
+TEST_F(SysmanTelemetrySamplerTest, givenMissingSysfsFileWhenReadingTelemetryThenErrorIsReturned) {
+    SysmanTelemetrySampler sampler(std::chrono::microseconds(1000));
+    TelemetrySamplerSysfsAccess sysfsAccess;
+    sysfsAccess.setTelemetrySampler(&sampler);
+
+    uint32_t value = 0;
+    uint64_t timestamp = 0;
+    for (uint32_t i = 0; i < SysmanTelemetrySampler::requestsToStartSampling; i++) {
+        EXPECT_NE(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry("/sys/class/drm/card0/gt/gt0/throttle_reason_pl1", value, timestamp));
+    }
+    sampler.sample();
+    EXPECT_NE(ZE_RESULT_SUCCESS, sysfsAccess.readTelemetry("/sys/class/drm/card0/gt/gt0/throttle_reason_pl1", value, timestamp));
+}
+
+TEST(SysmanFsAccessParseValueTest, givenSysfsContentWhenParsingThenValueIsParsedWithoutStreams) {
+    uint64_t value64 = 0;
+    EXPECT_TRUE(FsAccessInterface::parseValue("18446744073709551615\n", value64));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), value64);
+    EXPECT_FALSE(FsAccessInterface::parseValue("18446744073709551616\n", value64));
+
+    uint32_t value32 = 0;
+    EXPECT_TRUE(FsAccessInterface::parseValue(" 1300\n", value32));
+    EXPECT_EQ(1300u, value32);
+    EXPECT_FALSE(FsAccessInterface::parseValue("4294967296\n", value32));
+    EXPECT_FALSE(FsAccessInterface::parseValue("\n", value32));
+
+    int32_t signedValue = 0;
+    EXPECT_TRUE(FsAccessInterface::parseValue("-25\n", signedValue));
+    EXPECT_EQ(-25, signedValue);
+    EXPECT_FALSE(FsAccessInterface::parseValue("2147483648\n", signedValue));
+
+    double doubleValue = 0;
+    EXPECT_TRUE(FsAccessInterface::parseValue("1250.5\n", doubleValue));
+    EXPECT_EQ(1250.5, doubleValue);
+    EXPECT_FALSE(FsAccessInterface::parseValue("abc", doubleValue));
+}
+
+} // namespace ult
+} // namespace Sysman
+} // namespace L0
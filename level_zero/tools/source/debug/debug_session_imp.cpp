@@ -21,6 +21,8 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/include/zet_intel_gpu_debug.h"
 
+#include <thread>
+
 namespace L0 {
 
 DebugSession::DebugSession(const zet_debug_config_t &config, Device *device) : connectedDevice(device), config(config) {
@@ -400,6 +402,7 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
     DEBUG_BREAK_IF(sipCommandResult != true);
 
     auto result = resumeImp(resumeThreadIds, deviceIndex);
+    invalidateStateSaveAreaSnapshots();
 
     // For resume(ALL) and multiple threads to resume - read whole state save area
     // to avoid multiple calls to KMD
@@ -773,6 +776,7 @@ void DebugSessionImp::addThreadToNewlyStoppedFromRaisedAttention(EuThread::Threa
 
     if (!wasStopped) {
         newlyStoppedThreads.push_back(threadId);
+        invalidateStateSaveAreaSnapshots();
     }
 }
 
@@ -874,6 +878,40 @@ void DebugSessionImp::fillResumeAndStoppedThreadsFromNewlyStopped(std::vector<Eu
     newlyStoppedThreads.clear();
 }
 
+void DebugSessionImp::generateEventsAndResumeStoppedThreadsForTileSessions() {
+    size_t tilesWithPendingEvents = 0;
+    for (auto &tileSession : tileSessions) {
+        if (tileSession.first->triggerEvents || tileSession.first->interruptSent) {
+            tilesWithPendingEvents++;
+        }
+    }
+
+    if (NEO::debugManager.flags.DebuggerParallelTileEventProcessing.get() == 1 && tilesWithPendingEvents > 1) {
+        // tiles keep separate thread states and are resumed separately,
+        // threads stopped on one tile do not wait for threads of other tiles to be resumed
+        std::vector<std::thread> workers;
+        workers.reserve(tileSessions.size() - 1);
+        for (size_t tileIndex = 1; tileIndex < tileSessions.size(); tileIndex++) {
+            workers.emplace_back([tileSession = tileSessions[tileIndex].first]() {
+                tileSession->generateEventsAndResumeStoppedThreads();
+                tileSession->sendInterrupts();
+            });
+        }
+        tileSessions[0].first->generateEventsAndResumeStoppedThreads();
+        tileSessions[0].first->sendInterrupts();
+
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        return;
+    }
+
+    for (auto &tileSession : tileSessions) {
+        tileSession.first->generateEventsAndResumeStoppedThreads();
+        tileSession.first->sendInterrupts();
+    }
+}
+
 void DebugSessionImp::generateEventsForPendingInterrupts() {
     zet_debug_event_t debugEvent = {};
 
@@ -917,6 +955,7 @@ void DebugSessionImp::resumeAccidentallyStoppedThreads(const std::vector<EuThrea
             [[maybe_unused]] auto writeSipCommandResult = writeResumeCommand(threadIdsPerDevice[i]);
             DEBUG_BREAK_IF(writeSipCommandResult != true);
             resumeImp(threadIdsPerDevice[i], i);
+            invalidateStateSaveAreaSnapshots();
         }
 
         for (auto &threadID : threadIdsPerDevice[i]) {
@@ -1325,6 +1364,71 @@ ze_result_t DebugSessionImp::registersAccessHelper(const EuThread *thread, const
     return ret == 0 ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
 }
 
+ze_result_t DebugSessionImp::readRegistersFromStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc,
+                                                                    uint32_t start, uint32_t count, void *pRegisterValues) {
+    if (start >= regdesc->num) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (start + count > regdesc->num) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const auto memoryHandle = thread->getMemoryHandle();
+    const auto startRegOffset = calculateThreadSlotOffset(thread->getThreadId()) + calculateRegisterOffsetInThreadSlot(regdesc, start);
+    const size_t size = count * regdesc->bytes;
+
+    {
+        std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+        auto snapshot = stateSaveAreaSnapshots.find(memoryHandle);
+
+        if (snapshot == stateSaveAreaSnapshots.end()) {
+            auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+            auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
+
+            if (gpuVa != 0 && stateSaveAreaSize != 0) {
+                std::vector<char> stateSaveArea(stateSaveAreaSize);
+                if (readGpuMemory(memoryHandle, stateSaveArea.data(), stateSaveAreaSize, gpuVa) == ZE_RESULT_SUCCESS) {
+                    PRINT_DEBUGGER_INFO_LOG("State save area snapshot taken for memory handle %" PRIu64 ", size = %zu\n", memoryHandle, stateSaveAreaSize);
+                    snapshot = stateSaveAreaSnapshots.emplace(memoryHandle, std::move(stateSaveArea)).first;
+                }
+            }
+        }
+
+        if (snapshot != stateSaveAreaSnapshots.end() && startRegOffset + size <= snapshot->second.size()) {
+            memcpy_s(pRegisterValues, size, snapshot->second.data() + startRegOffset, size);
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
+    return registersAccessHelper(thread, regdesc, start, count, pRegisterValues, false);
+}
+
+void DebugSessionImp::updateStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc,
+                                                  uint32_t start, uint32_t count, const void *pRegisterValues) {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    auto snapshot = stateSaveAreaSnapshots.find(thread->getMemoryHandle());
+    if (snapshot == stateSaveAreaSnapshots.end()) {
+        return;
+    }
+
+    const auto startRegOffset = calculateThreadSlotOffset(thread->getThreadId()) + calculateRegisterOffsetInThreadSlot(regdesc, start);
+    const size_t size = count * regdesc->bytes;
+    if (startRegOffset + size > snapshot->second.size()) {
+        stateSaveAreaSnapshots.erase(snapshot);
+        return;
+    }
+    memcpy_s(snapshot->second.data() + startRegOffset, size, pRegisterValues, size);
+}
+
+void DebugSessionImp::invalidateStateSaveAreaSnapshots() {
+    if (!stateSaveAreaSnapshotEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    stateSaveAreaSnapshots.clear();
+}
+
 ze_result_t DebugSessionImp::cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write) {
     auto stateSaveAreaHeader = getStateSaveAreaHeader();
     auto *regdesc = &stateSaveAreaHeader->regHeader.cmd;
@@ -1367,6 +1471,10 @@ ze_result_t DebugSessionImp::readRegistersImp(EuThread::ThreadId threadId, uint3
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    if (stateSaveAreaSnapshotEnabled) {
+        return readRegistersFromStateSaveAreaSnapshot(allThreads[threadId].get(), regdesc, start, count, pRegisterValues);
+    }
+
     return registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, false);
 }
 
@@ -1398,7 +1506,11 @@ ze_result_t DebugSessionImp::writeRegistersImp(EuThread::ThreadId threadId, uint
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    return registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, true);
+    auto ret = registersAccessHelper(allThreads[threadId].get(), regdesc, start, count, pRegisterValues, true);
+    if (ret == ZE_RESULT_SUCCESS && stateSaveAreaSnapshotEnabled) {
+        updateStateSaveAreaSnapshot(allThreads[threadId].get(), regdesc, start, count, pRegisterValues);
+    }
+    return ret;
 }
 
 bool DebugSessionImp::isValidGpuAddress(const zet_debug_memory_space_desc_t *desc) const {
@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SIP {
@@ -40,6 +41,7 @@ struct DebugSessionImp : DebugSession {
 
     DebugSessionImp(const zet_debug_config_t &config, Device *device) : DebugSession(config, device) {
         tileAttachEnabled = NEO::debugManager.flags.ExperimentalEnableTileAttach.get();
+        stateSaveAreaSnapshotEnabled = NEO::debugManager.flags.DebuggerStateSaveAreaSnapshot.get() == 1;
     }
 
     ze_result_t interrupt(ze_device_thread_t thread) override;
@@ -106,6 +108,7 @@ struct DebugSessionImp : DebugSession {
     MOCKABLE_VIRTUAL void resumeAccidentallyStoppedThreads(const std::vector<EuThread::ThreadId> &threadIds);
     MOCKABLE_VIRTUAL void generateEventsForStoppedThreads(const std::vector<EuThread::ThreadId> &threadIds);
     MOCKABLE_VIRTUAL void generateEventsForPendingInterrupts();
+    void generateEventsAndResumeStoppedThreadsForTileSessions();
 
     const SIP::StateSaveAreaHeader *getStateSaveAreaHeader();
     void validateAndSetStateSaveAreaHeader(uint64_t vmHandle, uint64_t gpuVa);
@@ -116,6 +119,11 @@ struct DebugSessionImp : DebugSession {
 
     ze_result_t registersAccessHelper(const EuThread *thread, const SIP::regset_desc *regdesc,
                                       uint32_t start, uint32_t count, void *pRegisterValues, bool write);
+    ze_result_t readRegistersFromStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc,
+                                                       uint32_t start, uint32_t count, void *pRegisterValues);
+    void updateStateSaveAreaSnapshot(const EuThread *thread, const SIP::regset_desc *regdesc,
+                                     uint32_t start, uint32_t count, const void *pRegisterValues);
+    void invalidateStateSaveAreaSnapshots();
 
     void slmSipVersionCheck();
     MOCKABLE_VIRTUAL ze_result_t cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write);
@@ -171,6 +179,12 @@ struct DebugSessionImp : DebugSession {
     bool sipSupportsSlm = false;
     std::vector<char> stateSaveAreaMemory;
 
+    // Whole state save areas read once per memory handle, register reads of stopped threads are served
+    // from them instead of separate reads of GPU memory. Dropped when threads are resumed or stopped.
+    bool stateSaveAreaSnapshotEnabled = false;
+    std::mutex stateSaveAreaSnapshotMutex;
+    std::unordered_map<uint64_t, std::vector<char>> stateSaveAreaSnapshots;
+
     std::vector<std::pair<DebugSessionImp *, bool>> tileSessions; // DebugSession, attached
     bool tileAttachEnabled = false;
     bool tileSessionsEnabled = false;
@@ -257,6 +271,7 @@ ze_result_t DebugSessionImp::slmMemoryAccess(EuThread::ThreadId threadId, const
         }
 
         status = resumeImp(std::vector<EuThread::ThreadId>{threadId}, threadId.tileIndex);
+        invalidateStateSaveAreaSnapshots();
         if (status != ZE_RESULT_SUCCESS) {
             return status;
         }
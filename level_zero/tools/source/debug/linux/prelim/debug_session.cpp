@@ -114,10 +114,7 @@ void *DebugSessionLinuxi915::asyncThreadFunction(void *arg) {
         self->handleEventsAsync();
 
         if (self->tileSessionsEnabled) {
-            for (size_t tileIndex = 0; tileIndex < self->tileSessions.size(); tileIndex++) {
-                static_cast<TileDebugSessionLinuxi915 *>(self->tileSessions[tileIndex].first)->generateEventsAndResumeStoppedThreads();
-                static_cast<TileDebugSessionLinuxi915 *>(self->tileSessions[tileIndex].first)->sendInterrupts();
-            }
+            self->generateEventsAndResumeStoppedThreadsForTileSessions();
         } else {
             self->generateEventsAndResumeStoppedThreads();
             self->sendInterrupts();
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include "level_zero/tools/source/metrics/metric_streamer_export.h"
+
+#include <fcntl.h>
+
+namespace L0 {
+
+class MetricExportFileLinux : public MetricExportFile {
+  public:
+    MetricExportFileLinux(int fd, uint8_t *data, size_t size) : fd(fd) {
+        this->data = data;
+        this->size = size;
+    }
+
+    ~MetricExportFileLinux() override {
+        NEO::SysCalls::munmap(data, size);
+        NEO::SysCalls::ftruncate(fd, static_cast<off_t>(usedSize));
+        NEO::SysCalls::close(fd);
+    }
+
+  protected:
+    int fd = -1;
+};
+
+std::unique_ptr<MetricExportFile> MetricExportFile::create(const std::string &path, size_t size) {
+    const int fd = NEO::SysCalls::openWithMode(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        return nullptr;
+    }
+    if (NEO::SysCalls::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        NEO::SysCalls::close(fd);
+        return nullptr;
+    }
+    auto data = NEO::SysCalls::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        NEO::SysCalls::close(fd);
+        return nullptr;
+    }
+    return std::make_unique<MetricExportFileLinux>(fd, static_cast<uint8_t *>(data), size);
+}
+
+} // namespace L0
@@ -16,6 +16,7 @@
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
 #include "level_zero/tools/source/metrics/metric_oa_source.h"
+#include "level_zero/tools/source/metrics/metric_streamer_export.h"
 
 #include <map>
 #include <utility>
@@ -292,7 +293,12 @@ ze_result_t metricGroupGet(zet_device_handle_t hDevice, uint32_t *pCount, zet_me
 ze_result_t metricStreamerOpen(zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup,
                                zet_metric_streamer_desc_t *pDesc, ze_event_handle_t hNotificationEvent,
                                zet_metric_streamer_handle_t *phMetricStreamer) {
-    return MetricGroup::fromHandle(hMetricGroup)->streamerOpen(hContext, hDevice, pDesc, hNotificationEvent, phMetricStreamer);
+    auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+    auto result = metricGroup->streamerOpen(hContext, hDevice, pDesc, hNotificationEvent, phMetricStreamer);
+    if (result == ZE_RESULT_SUCCESS) {
+        *phMetricStreamer = ExportingMetricStreamer::create(*MetricStreamer::fromHandle(*phMetricStreamer), *metricGroup)->toHandle();
+    }
+    return result;
 }
 
 ze_result_t MetricGroup::getMetricGroupExtendedProperties(MetricSource &metricSource, void *pNext) {
@@ -21,7 +21,9 @@
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 #include <level_zero/zet_api.h>
 
+#include <atomic>
 #include <cstring>
+#include <thread>
 
 namespace L0 {
 constexpr uint32_t ipSamplinMetricCount = 10u;
@@ -383,18 +385,13 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricCount(const uint8_t *pM
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pMultiMetricData,
-                                                                uint32_t &metricValueCount,
-                                                                zet_typed_value_t *pCalculatedData, const uint32_t setIndex) {
-
+bool IpSamplingMetricGroupImp::collectRawDataChunks(const uint8_t *pMultiMetricData, const size_t rawDataSize, const uint32_t setIndex,
+                                                    std::vector<IpSamplingRawDataChunk> &chunks) {
     auto processedSize = 0u;
-    auto isDataDropped = false;
-    auto requestTotalMetricValueCount = metricValueCount;
-
-    while (processedSize < rawDataSize && requestTotalMetricValueCount > 0) {
+    while (processedSize < rawDataSize) {
         auto processMetricData = pMultiMetricData + processedSize;
         if (!isMultiDeviceCaptureData(rawDataSize - processedSize, processMetricData)) {
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+            return false;
         }
 
         auto header = reinterpret_cast<const IpSamplingMetricDataHeader *>(processMetricData);
@@ -403,21 +400,126 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
             continue;
         }
 
-        auto processMetricRawData = processMetricData + sizeof(IpSamplingMetricDataHeader);
-        auto currTotalMetricValueCount = requestTotalMetricValueCount;
-        auto result = this->calculateMetricValues(type, header->rawDataSize, processMetricRawData, &currTotalMetricValueCount, pCalculatedData);
-        if (result != ZE_RESULT_SUCCESS) {
-            if (result == ZE_RESULT_WARNING_DROPPED_DATA) {
-                isDataDropped = true;
-            } else {
-                metricValueCount = 0;
-                return result;
-            }
+        chunks.emplace_back();
+        chunks.back().pRawData = processMetricData + sizeof(IpSamplingMetricDataHeader);
+        chunks.back().rawDataSize = header->rawDataSize;
+    }
+    return true;
+}
+
+void IpSamplingMetricGroupImp::aggregateRawDataChunks(const std::vector<IpSamplingRawDataChunk *> &chunks) {
+    DeviceImp *deviceImp = static_cast<DeviceImp *>(&this->getMetricSource().getMetricDeviceContext().getDevice());
+    auto &l0GfxCoreHelper = deviceImp->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    const uint32_t rawReportSize = IpSamplingMetricGroupBase::rawReportSize;
+
+    auto aggregateChunk = [&l0GfxCoreHelper, rawReportSize](IpSamplingRawDataChunk &chunk) {
+        // invalid size is reported when values of the chunk are requested
+        if ((chunk.rawDataSize % rawReportSize) != 0) {
+            return;
+        }
+        chunk.dataOverflow = l0GfxCoreHelper.stallIpDataMapUpdate(chunk.stallSumIpDataMap, chunk.pRawData, chunk.rawDataSize / rawReportSize);
+        chunk.stallSumIpDataMap.sortByIp();
+    };
+
+    size_t rawReportCount = 0;
+    for (auto chunk : chunks) {
+        rawReportCount += chunk->rawDataSize / rawReportSize;
+    }
+    const size_t workerCount = std::min<size_t>(chunks.size(), std::max(1u, std::thread::hardware_concurrency()));
+    if (workerCount < 2 || rawReportCount < minRawReportsForParallelCalculation) {
+        for (auto chunk : chunks) {
+            aggregateChunk(*chunk);
         }
+        return;
+    }
+
+    std::atomic<size_t> nextChunk{0};
+    auto worker = [&chunks, &nextChunk, &aggregateChunk]() {
+        for (auto chunkIndex = nextChunk++; chunkIndex < chunks.size(); chunkIndex = nextChunk++) {
+            aggregateChunk(*chunks[chunkIndex]);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &workerThread : workers) {
+        workerThread.join();
+    }
+}
+
+uint32_t IpSamplingMetricGroupImp::writeCalculatedMetricValues(const StallSumIpDataMap &stallSumIpDataMap, const uint32_t metricValueCount,
+                                                               zet_typed_value_t *pCalculatedData) {
+    DeviceImp *deviceImp = static_cast<DeviceImp *>(&this->getMetricSource().getMetricDeviceContext().getDevice());
+    auto &l0GfxCoreHelper = deviceImp->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+
+    std::vector<zet_typed_value_t> ipDataValues;
+    ipDataValues.reserve(properties.metricCount);
+    uint32_t i = 0;
+    for (auto &entry : stallSumIpDataMap.getEntries()) {
+        if (i >= metricValueCount) {
+            break;
+        }
+        l0GfxCoreHelper.stallSumIpDataToTypedValues(entry.ip, entry.data, ipDataValues);
+        for (auto jt = ipDataValues.begin(); (jt != ipDataValues.end()) && (i < metricValueCount); jt++, i++) {
+            *(pCalculatedData + i) = *jt;
+        }
+        ipDataValues.clear();
+    }
+    return i;
+}
+
+ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pMultiMetricData,
+                                                                uint32_t &metricValueCount,
+                                                                zet_typed_value_t *pCalculatedData, const uint32_t setIndex) {
+    std::vector<IpSamplingRawDataChunk> chunks;
+    const bool invalidDataFound = !collectRawDataChunks(pMultiMetricData, rawDataSize, setIndex, chunks);
+
+    if (metricValueCount > 0) {
+        std::vector<IpSamplingRawDataChunk *> chunksToAggregate;
+        for (auto &chunk : chunks) {
+            chunksToAggregate.push_back(&chunk);
+        }
+        aggregateRawDataChunks(chunksToAggregate);
+    }
+    return getCalculatedMetricValues(type, chunks, invalidDataFound, metricValueCount, pCalculatedData);
+}
+
+ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, std::vector<IpSamplingRawDataChunk> &chunks,
+                                                                const bool invalidDataFound, uint32_t &metricValueCount, zet_typed_value_t *pCalculatedData) {
+    auto isDataDropped = false;
+    auto requestTotalMetricValueCount = metricValueCount;
+
+    for (auto &chunk : chunks) {
+        if (requestTotalMetricValueCount == 0) {
+            break;
+        }
+        if (isMultiDeviceCaptureData(chunk.rawDataSize, chunk.pRawData)) {
+            METRICS_LOG_INFO("The call is not supported for multiple devices");
+            metricValueCount = 0;
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        // MAX_METRIC_VALUES is not supported yet.
+        if (type != ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES) {
+            metricValueCount = 0;
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        if ((chunk.rawDataSize % IpSamplingMetricGroupBase::rawReportSize) != 0) {
+            metricValueCount = 0;
+            return ZE_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        auto currTotalMetricValueCount = writeCalculatedMetricValues(chunk.stallSumIpDataMap, requestTotalMetricValueCount, pCalculatedData);
+        isDataDropped |= chunk.dataOverflow;
         pCalculatedData += currTotalMetricValueCount;
         requestTotalMetricValueCount -= currTotalMetricValueCount;
     }
 
+    if (invalidDataFound && requestTotalMetricValueCount > 0) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+
     metricValueCount -= requestTotalMetricValueCount;
     return isDataDropped ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
 }
@@ -425,9 +527,6 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pRawData,
                                                                 uint32_t &metricValueCount,
                                                                 zet_typed_value_t *pCalculatedData) {
-    bool dataOverflow = false;
-    std::map<uint64_t, void *> stallReportDataMap;
-
     // MAX_METRIC_VALUES is not supported yet.
     if (type != ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -435,34 +534,17 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 
     DEBUG_BREAK_IF(pCalculatedData == nullptr);
 
-    const uint32_t rawReportSize = IpSamplingMetricGroupBase::rawReportSize;
-
-    if ((rawDataSize % rawReportSize) != 0) {
+    if ((rawDataSize % IpSamplingMetricGroupBase::rawReportSize) != 0) {
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
-    const uint32_t rawReportCount = static_cast<uint32_t>(rawDataSize) / rawReportSize;
+    IpSamplingRawDataChunk chunk;
+    chunk.pRawData = pRawData;
+    chunk.rawDataSize = rawDataSize;
+    aggregateRawDataChunks({&chunk});
 
-    DeviceImp *deviceImp = static_cast<DeviceImp *>(&this->getMetricSource().getMetricDeviceContext().getDevice());
-    auto &l0GfxCoreHelper = deviceImp->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
-
-    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
-        dataOverflow |= l0GfxCoreHelper.stallIpDataMapUpdate(stallReportDataMap, pRawIpData);
-    }
-
-    metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallReportDataMap.size()) * properties.metricCount);
-    std::vector<zet_typed_value_t> ipDataValues;
-    uint32_t i = 0;
-    for (auto it = stallReportDataMap.begin(); it != stallReportDataMap.end(); ++it) {
-        l0GfxCoreHelper.stallSumIpDataToTypedValues(it->first, it->second, ipDataValues);
-        for (auto jt = ipDataValues.begin(); (jt != ipDataValues.end()) && (i < metricValueCount); jt++, i++) {
-            *(pCalculatedData + i) = *jt;
-        }
-        ipDataValues.clear();
-    }
-    l0GfxCoreHelper.stallIpDataMapDelete(stallReportDataMap);
-
-    return dataOverflow ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
+    metricValueCount = writeCalculatedMetricValues(chunk.stallSumIpDataMap, metricValueCount, pCalculatedData);
+    return chunk.dataOverflow ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
 }
 
 zet_metric_group_handle_t IpSamplingMetricGroupImp::getMetricGroupForSubDevice(const uint32_t subDeviceIndex) {
@@ -513,10 +595,22 @@ ze_result_t MultiDeviceIpSamplingMetricGroupImp::calculateMetricValuesExp(const
         memset(pMetricCounts, 0, *pSetCount);
         const auto maxSets = std::min<uint32_t>(static_cast<uint32_t>(subDeviceMetricGroup.size()), *pSetCount);
 
+        // data of all sub-devices is aggregated at once, so it is processed in parallel
+        std::vector<std::vector<IpSamplingRawDataChunk>> chunksPerSet(maxSets);
+        std::vector<uint8_t> invalidDataFound(maxSets, 0u);
+        std::vector<IpSamplingRawDataChunk *> chunksToAggregate;
+        for (uint32_t setIndex = 0; setIndex < maxSets; setIndex++) {
+            invalidDataFound[setIndex] = !subDeviceMetricGroup[setIndex]->collectRawDataChunks(pRawData, rawDataSize, setIndex, chunksPerSet[setIndex]);
+            for (auto &chunk : chunksPerSet[setIndex]) {
+                chunksToAggregate.push_back(&chunk);
+            }
+        }
+        subDeviceMetricGroup[0]->aggregateRawDataChunks(chunksToAggregate);
+
         auto tempTotalMetricValueCount = *pTotalMetricValueCount;
         for (uint32_t setIndex = 0; setIndex < maxSets; setIndex++) {
             uint32_t currTotalMetricValueCount = tempTotalMetricValueCount;
-            result = subDeviceMetricGroup[setIndex]->getCalculatedMetricValues(type, rawDataSize, pRawData, currTotalMetricValueCount, pMetricValues, setIndex);
+            result = subDeviceMetricGroup[setIndex]->getCalculatedMetricValues(type, chunksPerSet[setIndex], invalidDataFound[setIndex], currTotalMetricValueCount, pMetricValues);
             if (result != ZE_RESULT_SUCCESS) {
                 if (result == ZE_RESULT_WARNING_DROPPED_DATA) {
                     isDroppedData = true;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "level_zero/tools/source/metrics/metric.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_stall_data.h"
 #include "level_zero/tools/source/metrics/os_interface_metric.h"
 
 namespace L0 {
@@ -81,6 +82,14 @@ struct IpSamplingMetricGroupBase : public MetricGroupImp {
     }
 };
 
+// Raw data captured on one device, aggregated independently of other chunks
+struct IpSamplingRawDataChunk {
+    const uint8_t *pRawData = nullptr;
+    size_t rawDataSize = 0;
+    StallSumIpDataMap stallSumIpDataMap;
+    bool dataOverflow = false;
+};
+
 struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
     IpSamplingMetricGroupImp(IpSamplingMetricSourceImp &metricSource, std::vector<IpSamplingMetricImp> &metrics);
     ~IpSamplingMetricGroupImp() override = default;
@@ -111,6 +120,12 @@ struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
     ze_result_t getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pMultiMetricData,
                                           uint32_t &metricValueCount,
                                           zet_typed_value_t *pCalculatedData, const uint32_t setIndex);
+    bool collectRawDataChunks(const uint8_t *pMultiMetricData, const size_t rawDataSize, const uint32_t setIndex, std::vector<IpSamplingRawDataChunk> &chunks);
+    void aggregateRawDataChunks(const std::vector<IpSamplingRawDataChunk *> &chunks);
+    ze_result_t getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, std::vector<IpSamplingRawDataChunk> &chunks, const bool invalidDataFound,
+                                          uint32_t &metricValueCount, zet_typed_value_t *pCalculatedData);
+
+    static constexpr size_t minRawReportsForParallelCalculation = 16 * 1024;
 
   private:
     std::vector<std::unique_ptr<IpSamplingMetricImp>> metrics = {};
@@ -119,6 +134,7 @@ struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
     ze_result_t getCalculatedMetricValues(const zet_metric_group_calculation_type_t type, const size_t rawDataSize, const uint8_t *pRawData,
                                           uint32_t &metricValueCount,
                                           zet_typed_value_t *pCalculatedData);
+    uint32_t writeCalculatedMetricValues(const StallSumIpDataMap &stallSumIpDataMap, const uint32_t metricValueCount, zet_typed_value_t *pCalculatedData);
     bool isMultiDeviceCaptureData(const size_t rawDataSize, const uint8_t *pRawData);
 };
 
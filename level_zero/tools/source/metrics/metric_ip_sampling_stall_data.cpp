@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_stall_data.h"
+
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+size_t StallSumIpDataMap::getSlotIndex(uint64_t ip) const {
+    // fibonacci hashing spreads consecutive instruction addresses over the whole table
+    return static_cast<size_t>((ip * 0x9e3779b97f4a7c15ull) >> slotShift);
+}
+
+void StallSumIpDataMap::rehash(size_t slotCount) {
+    slots.assign(slotCount, Slot{0u, emptySlot});
+    slotShift = 64u - Math::log2(static_cast<uint64_t>(slotCount));
+
+    const auto mask = slotCount - 1;
+    for (size_t entryIndex = 0; entryIndex < entries.size(); entryIndex++) {
+        auto slotIndex = getSlotIndex(entries[entryIndex].ip);
+        while (slots[slotIndex].entryIndexPlusOne != emptySlot) {
+            slotIndex = (slotIndex + 1) & mask;
+        }
+        slots[slotIndex] = {entries[entryIndex].ip, static_cast<uint32_t>(entryIndex + 1)};
+    }
+}
+
+void StallSumIpDataMap::reserve(size_t ipCount) {
+    entries.reserve(ipCount);
+    auto slotCount = std::max(initialSlotCount, static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(ipCount) * 2)));
+    if (slotCount > slots.size()) {
+        rehash(slotCount);
+    }
+}
+
+StallSumIpData &StallSumIpDataMap::get(uint64_t ip) {
+    if (slots.empty()) {
+        rehash(initialSlotCount);
+    }
+
+    auto mask = slots.size() - 1;
+    auto slotIndex = getSlotIndex(ip);
+    while (slots[slotIndex].entryIndexPlusOne != emptySlot) {
+        if (slots[slotIndex].ip == ip) {
+            return entries[slots[slotIndex].entryIndexPlusOne - 1].data;
+        }
+        slotIndex = (slotIndex + 1) & mask;
+    }
+
+    entries.push_back({ip, {}});
+    slots[slotIndex] = {ip, static_cast<uint32_t>(entries.size())};
+
+    // keep load factor at most 1/2 to bound probe sequences
+    if (entries.size() * 2 > slots.size()) {
+        rehash(slots.size() * 2);
+    }
+    return entries.back().data;
+}
+
+void StallSumIpDataMap::sortByIp() {
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.ip < b.ip; });
+    if (!slots.empty()) {
+        rehash(slots.size());
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace L0 {
+
+struct StallSumIpData {
+    uint64_t activeCount;
+    uint64_t otherCount;
+    uint64_t controlCount;
+    uint64_t pipeStallCount;
+    uint64_t sendCount;
+    uint64_t distAccCount;
+    uint64_t sbidCount;
+    uint64_t syncCount;
+    uint64_t instFetchCount;
+};
+
+// Stall counters summed per IP.
+// Entries are stored in one contiguous array indexed by open addressing table with linear probing,
+// so accumulating a report neither allocates nor walks a tree.
+// References returned by get() are valid until next insertion.
+class StallSumIpDataMap {
+  public:
+    struct Entry {
+        uint64_t ip;
+        StallSumIpData data;
+    };
+
+    static constexpr size_t initialSlotCount = 1024u;
+
+    StallSumIpData &get(uint64_t ip);
+    void reserve(size_t ipCount);
+    void sortByIp();
+
+    size_t size() const { return entries.size(); }
+    const std::vector<Entry> &getEntries() const { return entries; }
+
+  protected:
+    static constexpr uint32_t emptySlot = 0u;
+
+    struct Slot {
+        uint64_t ip;
+        uint32_t entryIndexPlusOne;
+    };
+
+    size_t getSlotIndex(uint64_t ip) const;
+    void rehash(size_t slotCount);
+
+    std::vector<Slot> slots;
+    std::vector<Entry> entries;
+    uint32_t slotShift = 64u;
+};
+
+} // namespace L0
@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_streamer_export.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace L0 {
+
+namespace {
+constexpr size_t chunkAlignment = sizeof(uint64_t);
+std::atomic<uint32_t> exportersCount{0};
+
+uint64_t getHostTimestamp() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+std::unique_ptr<MetricStreamerExporter> MetricStreamerExporter::create(MetricStreamer &streamer, MetricGroup &metricGroup) {
+    const auto &pathPrefix = NEO::debugManager.flags.MetricStreamerExportFile.get();
+    if (pathPrefix == "unk") {
+        return nullptr;
+    }
+
+    size_t segmentSize = defaultSegmentSize;
+    if (NEO::debugManager.flags.MetricStreamerExportSegmentSize.get() > 0) {
+        segmentSize = static_cast<size_t>(NEO::debugManager.flags.MetricStreamerExportSegmentSize.get()) * MemoryConstants::kiloByte;
+    }
+    uint32_t segmentCount = defaultSegmentCount;
+    if (NEO::debugManager.flags.MetricStreamerExportSegmentCount.get() > 0) {
+        segmentCount = static_cast<uint32_t>(NEO::debugManager.flags.MetricStreamerExportSegmentCount.get());
+    }
+    auto period = defaultPeriod;
+    if (NEO::debugManager.flags.MetricStreamerExportPeriod.get() > 0) {
+        period = std::chrono::microseconds(NEO::debugManager.flags.MetricStreamerExportPeriod.get());
+    }
+
+    auto exporter = std::make_unique<MetricStreamerExporter>(streamer, metricGroup, pathPrefix, segmentSize, segmentCount, period);
+    if (!exporter->initialize()) {
+        METRICS_LOG_ERR("%s", "Metric streamer export could not be initialized");
+        return nullptr;
+    }
+    METRICS_LOG_INFO("Metric streamer data is exported to %s, zetMetricStreamerReadData returns only data not drained by export", pathPrefix.c_str());
+    return exporter;
+}
+
+MetricStreamerExporter::MetricStreamerExporter(MetricStreamer &streamer, MetricGroup &metricGroup, const std::string &pathPrefix,
+                                               size_t segmentSize, uint32_t segmentCount, std::chrono::microseconds period)
+    : streamer(streamer), metricGroup(metricGroup), pathPrefix(pathPrefix), exporterId(exportersCount++), segmentSize(segmentSize),
+      segmentCount(segmentCount), period(period) {}
+
+MetricStreamerExporter::~MetricStreamerExporter() {
+    stop();
+    releaseSegment();
+}
+
+bool MetricStreamerExporter::initialize() {
+    size_t metadataSize = 0;
+    if (metricGroup.getExportData(nullptr, 0, &metadataSize, nullptr) != ZE_RESULT_SUCCESS || metadataSize == 0) {
+        return false;
+    }
+    metadata.resize(metadataSize);
+    if (metricGroup.getExportData(nullptr, 0, &metadataSize, metadata.data()) != ZE_RESULT_SUCCESS) {
+        return false;
+    }
+
+    if (streamer.readData(UINT32_MAX, &maxReadSize, nullptr) != ZE_RESULT_SUCCESS || maxReadSize == 0) {
+        return false;
+    }
+
+    // every segment has to fit at least one full read
+    const size_t minSegmentSize = alignUp(sizeof(MetricExportFileHeader), chunkAlignment) + alignUp(metadata.size(), chunkAlignment) +
+                                  alignUp(sizeof(MetricExportChunkHeader) + maxReadSize, chunkAlignment);
+    segmentSize = std::max(segmentSize, minSegmentSize);
+
+    // streamer is not taken over when data could not be exported
+    return startNextSegment();
+}
+
+std::unique_ptr<MetricExportFile> MetricStreamerExporter::createFile(const std::string &path, size_t size) {
+    return MetricExportFile::create(path, size);
+}
+
+std::string MetricStreamerExporter::getSegmentPath(uint32_t segmentIndex) const {
+    return pathPrefix + "_" + std::to_string(NEO::SysCalls::getProcessId()) + "_" + std::to_string(exporterId) + "_" + std::to_string(segmentIndex) + ".bin";
+}
+
+bool MetricStreamerExporter::startNextSegment() {
+    releaseSegment();
+
+    const auto segmentIndex = static_cast<uint32_t>(segmentSequence % segmentCount);
+    segment = createFile(getSegmentPath(segmentIndex), segmentSize);
+    if (!segment) {
+        return false;
+    }
+
+    auto header = reinterpret_cast<MetricExportFileHeader *>(segment->getData());
+    memset(header, 0, sizeof(MetricExportFileHeader));
+    header->magic = MetricExportFileHeader::magicValue;
+    header->version = MetricExportFileHeader::currentVersion;
+    header->segmentIndex = segmentIndex;
+    header->segmentSequence = segmentSequence++;
+    header->metadataOffset = alignUp(sizeof(MetricExportFileHeader), chunkAlignment);
+    header->metadataSize = metadata.size();
+    memcpy_s(segment->getData() + header->metadataOffset, segment->getSize() - header->metadataOffset, metadata.data(), metadata.size());
+
+    header->hostTimestamp = getHostTimestamp();
+    metricGroup.getMetricTimestampsExp(true, &header->globalTimestamp, &header->metricTimestamp);
+    zet_metric_group_properties_t properties = {ZET_STRUCTURE_TYPE_METRIC_GROUP_PROPERTIES, nullptr};
+    if (metricGroup.getProperties(&properties) == ZE_RESULT_SUCCESS) {
+        strncpy_s(header->metricGroupName, sizeof(header->metricGroupName), properties.name, sizeof(properties.name) - 1);
+    }
+
+    segmentUsedSize = alignUp(header->metadataOffset + header->metadataSize, chunkAlignment);
+    publishSegmentState();
+    return true;
+}
+
+void MetricStreamerExporter::releaseSegment() {
+    if (segment) {
+        segment->setUsedSize(segmentUsedSize);
+        segment.reset();
+    }
+}
+
+uint8_t *MetricStreamerExporter::reserveChunk(size_t rawDataSize) {
+    const auto chunkSize = alignUp(sizeof(MetricExportChunkHeader) + rawDataSize, chunkAlignment);
+    if (!segment || segmentUsedSize + chunkSize > segment->getSize()) {
+        if (!startNextSegment() || segmentUsedSize + chunkSize > segment->getSize()) {
+            return nullptr;
+        }
+    }
+    return segment->getData() + segmentUsedSize + sizeof(MetricExportChunkHeader);
+}
+
+void MetricStreamerExporter::commitChunk(size_t rawDataSize, bool dataDropped) {
+    auto chunkHeader = reinterpret_cast<MetricExportChunkHeader *>(segment->getData() + segmentUsedSize);
+    chunkHeader->magic = MetricExportChunkHeader::magicValue;
+    chunkHeader->flags = dataDropped ? MetricExportChunkHeader::dataDroppedFlag : 0u;
+    chunkHeader->sequence = chunkCount++;
+    chunkHeader->hostTimestamp = getHostTimestamp();
+    chunkHeader->rawDataSize = rawDataSize;
+    if (dataDropped) {
+        droppedDataChunkCount++;
+    }
+    segmentUsedSize += alignUp(sizeof(MetricExportChunkHeader) + rawDataSize, chunkAlignment);
+    publishSegmentState();
+}
+
+void MetricStreamerExporter::publishSegmentState() {
+    auto header = reinterpret_cast<MetricExportFileHeader *>(segment->getData());
+    header->chunkCount = chunkCount;
+    header->droppedDataChunkCount = droppedDataChunkCount;
+    header->lostChunkCount = lostChunkCount;
+    header->failedReadCount = failedReadCount;
+    // chunk is complete before it is covered by used size, file may be observed while it is written
+    std::atomic_thread_fence(std::memory_order_release);
+    header->usedSize = segmentUsedSize;
+}
+
+size_t MetricStreamerExporter::drain() {
+    std::lock_guard<std::mutex> lock(streamerMutex);
+
+    auto pRawData = reserveChunk(maxReadSize);
+    if (pRawData == nullptr) {
+        return 0;
+    }
+
+    size_t rawDataSize = maxReadSize;
+    const auto result = streamer.readData(UINT32_MAX, &rawDataSize, pRawData);
+    if (result != ZE_RESULT_SUCCESS && result != ZE_RESULT_WARNING_DROPPED_DATA) {
+        failedReadCount++;
+        publishSegmentState();
+        return 0;
+    }
+    if (rawDataSize == 0) {
+        return 0;
+    }
+    commitChunk(rawDataSize, result == ZE_RESULT_WARNING_DROPPED_DATA);
+    return rawDataSize;
+}
+
+ze_result_t MetricStreamerExporter::readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+    std::lock_guard<std::mutex> lock(streamerMutex);
+
+    const bool sizeQuery = *pRawDataSize == 0;
+    const auto result = streamer.readData(maxReportCount, pRawDataSize, pRawData);
+    if (sizeQuery || (result != ZE_RESULT_SUCCESS && result != ZE_RESULT_WARNING_DROPPED_DATA) || *pRawDataSize == 0) {
+        return result;
+    }
+
+    auto pChunkData = reserveChunk(*pRawDataSize);
+    if (pChunkData == nullptr) {
+        lostChunkCount++;
+        return result;
+    }
+    memcpy_s(pChunkData, segment->getSize() - (pChunkData - segment->getData()), pRawData, *pRawDataSize);
+    commitChunk(*pRawDataSize, result == ZE_RESULT_WARNING_DROPPED_DATA);
+    return result;
+}
+
+void *MetricStreamerExporter::drainingLoop(void *arg) {
+    auto exporter = reinterpret_cast<MetricStreamerExporter *>(arg);
+
+    std::unique_lock<std::mutex> lock(exporter->threadMutex);
+    while (exporter->drainingActive) {
+        lock.unlock();
+        const auto exportedSize = exporter->drain();
+        lock.lock();
+        if (exportedSize * 2 >= exporter->maxReadSize) {
+            continue;
+        }
+        exporter->threadCondition.wait_for(lock, exporter->period, [exporter] { return !exporter->drainingActive; });
+    }
+    return nullptr;
+}
+
+void MetricStreamerExporter::start() {
+    std::lock_guard<std::mutex> lock(threadMutex);
+    if (drainingActive) {
+        return;
+    }
+    drainingActive = true;
+    drainingThread = NEO::Thread::create(drainingLoop, reinterpret_cast<void *>(this));
+}
+
+void MetricStreamerExporter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(threadMutex);
+        drainingActive = false;
+    }
+    threadCondition.notify_one();
+    if (drainingThread) {
+        drainingThread->join();
+        drainingThread.reset();
+    }
+}
+
+MetricStreamer *ExportingMetricStreamer::create(MetricStreamer &streamer, MetricGroup &metricGroup) {
+    auto exporter = MetricStreamerExporter::create(streamer, metricGroup);
+    if (!exporter) {
+        return &streamer;
+    }
+    exporter->start();
+    return new ExportingMetricStreamer(streamer, std::move(exporter));
+}
+
+ExportingMetricStreamer::ExportingMetricStreamer(MetricStreamer &streamer, std::unique_ptr<MetricStreamerExporter> exporter)
+    : streamer(streamer), exporter(std::move(exporter)) {}
+
+ExportingMetricStreamer::~ExportingMetricStreamer() = default;
+
+ze_result_t ExportingMetricStreamer::readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
+    return exporter->readData(maxReportCount, pRawDataSize, pRawData);
+}
+
+ze_result_t ExportingMetricStreamer::close() {
+    exporter->stop();
+    // export reports collected since last pass
+    exporter->drain();
+    exporter.reset();
+
+    const auto result = streamer.close();
+    delete this;
+    return result;
+}
+
+ze_result_t ExportingMetricStreamer::appendStreamerMarker(CommandList &commandList, uint32_t value) {
+    return streamer.appendStreamerMarker(commandList, value);
+}
+
+Event::State ExportingMetricStreamer::getNotificationState() {
+    return streamer.getNotificationState();
+}
+
+} // namespace L0
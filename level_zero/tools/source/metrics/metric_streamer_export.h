@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "level_zero/tools/source/metrics/metric.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+
+// Layout of export file segment:
+//   MetricExportFileHeader
+//   metadata - export data of metric group with empty raw data, as returned by zetMetricGroupGetExportDataExp
+//   MetricExportChunkHeader followed by raw data read from streamer, repeated until usedSize
+// Chunks are 8 byte aligned. Raw data of all chunks may be concatenated and decoded offline with metadata.
+struct MetricExportFileHeader {
+    static constexpr uint64_t magicValue = 0x3130504d58454d4cull; // "LMEXMP01"
+    static constexpr uint32_t currentVersion = 1u;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t segmentIndex;
+    uint64_t segmentSequence;
+    uint64_t metadataOffset;
+    uint64_t metadataSize;
+    uint64_t usedSize;
+    uint64_t chunkCount;
+    uint64_t droppedDataChunkCount;
+    uint64_t lostChunkCount;
+    uint64_t failedReadCount;
+    uint64_t hostTimestamp;
+    uint64_t globalTimestamp;
+    uint64_t metricTimestamp;
+    char metricGroupName[ZET_MAX_METRIC_GROUP_NAME];
+};
+
+struct MetricExportChunkHeader {
+    static constexpr uint32_t magicValue = 0x4b4e4843; // "CHNK"
+    static constexpr uint32_t dataDroppedFlag = 1u;
+
+    uint32_t magic;
+    uint32_t flags;
+    uint64_t sequence;
+    uint64_t hostTimestamp;
+    uint64_t rawDataSize;
+};
+
+class MetricExportFile : NEO::NonCopyableOrMovableClass {
+  public:
+    static std::unique_ptr<MetricExportFile> create(const std::string &path, size_t size);
+    virtual ~MetricExportFile() = default;
+
+    uint8_t *getData() const { return data; }
+    size_t getSize() const { return size; }
+    // file is trimmed to used size when it is released
+    void setUsedSize(size_t usedSize) { this->usedSize = usedSize; }
+
+  protected:
+    uint8_t *data = nullptr;
+    size_t size = 0;
+    size_t usedSize = 0;
+};
+
+// Drains metric streamer in background into memory mapped file segments reused in round robin.
+// Reads are done directly into mapped segment. Streamer is drained again without waiting
+// when previous read returned at least half of streamer buffer, so it does not overflow under load.
+// Exporter takes over streamer data: reports drained by background thread are not returned to application,
+// zetMetricStreamerReadData returns only reports collected since last drain and exports them as well.
+// Complete stream is available only in export files.
+class MetricStreamerExporter : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultSegmentSize = 64 * MemoryConstants::megaByte;
+    static constexpr uint32_t defaultSegmentCount = 2u;
+    static constexpr std::chrono::microseconds defaultPeriod{1000};
+
+    static std::unique_ptr<MetricStreamerExporter> create(MetricStreamer &streamer, MetricGroup &metricGroup);
+
+    MetricStreamerExporter(MetricStreamer &streamer, MetricGroup &metricGroup, const std::string &pathPrefix,
+                           size_t segmentSize, uint32_t segmentCount, std::chrono::microseconds period);
+    MOCKABLE_VIRTUAL ~MetricStreamerExporter();
+
+    bool initialize();
+    size_t drain();
+    ze_result_t readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData);
+    void start();
+    void stop();
+
+    uint64_t getChunkCount() const { return chunkCount; }
+
+  protected:
+    static void *drainingLoop(void *arg);
+    MOCKABLE_VIRTUAL std::unique_ptr<MetricExportFile> createFile(const std::string &path, size_t size);
+    std::string getSegmentPath(uint32_t segmentIndex) const;
+    bool startNextSegment();
+    uint8_t *reserveChunk(size_t rawDataSize);
+    void commitChunk(size_t rawDataSize, bool dataDropped);
+    void publishSegmentState();
+    void releaseSegment();
+
+    MetricStreamer &streamer;
+    MetricGroup &metricGroup;
+    const std::string pathPrefix;
+    const uint32_t exporterId;
+    size_t segmentSize;
+    const uint32_t segmentCount;
+    const std::chrono::microseconds period;
+    std::vector<uint8_t> metadata;
+    size_t maxReadSize = 0;
+
+    // guards streamer reads and current segment
+    std::mutex streamerMutex;
+    std::unique_ptr<MetricExportFile> segment;
+    size_t segmentUsedSize = 0;
+    uint64_t segmentSequence = 0;
+    uint64_t chunkCount = 0;
+    uint64_t droppedDataChunkCount = 0;
+    uint64_t lostChunkCount = 0;
+    uint64_t failedReadCount = 0;
+
+    std::mutex threadMutex;
+    std::condition_variable threadCondition;
+    bool drainingActive = false;
+    std::unique_ptr<NEO::Thread> drainingThread;
+};
+
+// Returned to application instead of streamer when export is enabled and first export segment could be created.
+struct ExportingMetricStreamer : MetricStreamer {
+    static MetricStreamer *create(MetricStreamer &streamer, MetricGroup &metricGroup);
+
+    ExportingMetricStreamer(MetricStreamer &streamer, std::unique_ptr<MetricStreamerExporter> exporter);
+    ~ExportingMetricStreamer() override;
+
+    ze_result_t readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) override;
+    ze_result_t close() override;
+    ze_result_t appendStreamerMarker(CommandList &commandList, uint32_t value) override;
+    Event::State getNotificationState() override;
+
+  protected:
+    MetricStreamer &streamer;
+    std::unique_ptr<MetricStreamerExporter> exporter;
+};
+
+} // namespace L0
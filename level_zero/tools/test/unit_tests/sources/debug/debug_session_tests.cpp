@@ -2140,6 +2140,39 @@ TEST_F(MultiTileDebugSessionTest, givenTileAttachEnabledWhenSendingInterruptsThe
     EXPECT_EQ(0u, tileSession0->interruptedDevices[0]);
 }
 
+TEST_F(MultiTileDebugSessionTest, givenPendingEventsOnAllTilesWhenGeneratingEventsForTileSessionsThenEventsAreGeneratedForEachTile) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.ExperimentalEnableTileAttach.set(1);
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+
+    for (auto parallelTileEventProcessing : {-1, 1}) {
+        NEO::debugManager.flags.DebuggerParallelTileEventProcessing.set(parallelTileEventProcessing);
+
+        auto sessionMock = std::make_unique<MockDebugSession>(config, driverHandle->devices[0]);
+        sessionMock->tileAttachEnabled = true;
+        sessionMock->initialize();
+        ASSERT_EQ(numSubDevices, sessionMock->tileSessions.size());
+
+        ze_device_thread_t apiThread = {0, 0, 0, 0};
+        for (auto &tileSession : sessionMock->tileSessions) {
+            auto tileSessionMock = static_cast<MockDebugSession *>(tileSession.first);
+            tileSessionMock->pendingInterrupts.push_back(std::pair<ze_device_thread_t, bool>(apiThread, false));
+            tileSessionMock->triggerEvents = true;
+        }
+
+        sessionMock->generateEventsAndResumeStoppedThreadsForTileSessions();
+
+        for (auto &tileSession : sessionMock->tileSessions) {
+            auto tileSessionMock = static_cast<MockDebugSession *>(tileSession.first);
+            EXPECT_FALSE(tileSessionMock->triggerEvents);
+            EXPECT_EQ(0u, tileSessionMock->pendingInterrupts.size());
+            ASSERT_EQ(1u, tileSessionMock->apiEvents.size());
+            EXPECT_EQ(ZET_DEBUG_EVENT_TYPE_THREAD_UNAVAILABLE, tileSessionMock->apiEvents.front().type);
+        }
+    }
+}
+
 TEST_F(MultiTileDebugSessionTest, givenAllSlicesInRequestWhenSendingInterruptsThenTwoInterruptsCalled) {
     zet_debug_config_t config = {};
     config.pid = 0x1234;
@@ -2665,6 +2698,96 @@ TEST_F(DebugSessionRegistersAccessTest, GivenBindlessSipVersion2WhenCallingResum
     EXPECT_EQ(1u, session->writeResumeCommandCalled);
 }
 
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotFlagWhenCreatingSessionThenSnapshotIsEnabledOnlyWhenFlagIsSetToOne) {
+    DebugManagerStateRestore restorer;
+    zet_debug_config_t config = {};
+
+    EXPECT_FALSE(session->stateSaveAreaSnapshotEnabled);
+
+    NEO::debugManager.flags.DebuggerStateSaveAreaSnapshot.set(0);
+    EXPECT_FALSE(std::make_unique<MockDebugSession>(config, deviceImp.get())->stateSaveAreaSnapshotEnabled);
+
+    NEO::debugManager.flags.DebuggerStateSaveAreaSnapshot.set(1);
+    EXPECT_TRUE(std::make_unique<MockDebugSession>(config, deviceImp.get())->stateSaveAreaSnapshotEnabled);
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotEnabledWhenReadingRegistersOfStoppedThreadsThenStateSaveAreaIsReadOnce) {
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+    session->stateSaveAreaSnapshotEnabled = true;
+
+    ze_device_thread_t thread1 = {0, 0, 0, 1};
+    EuThread::ThreadId threadId1(0, thread1);
+    session->allThreads[threadId1]->stopThread(1u);
+    session->allThreads[threadId1]->reportAsStopped();
+
+    const auto regSize = session->getRegisterSize(ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU);
+    auto *regdesc = &(reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data()))->regHeader.grf;
+    std::vector<uint8_t> grf(regSize, 0);
+    for (uint32_t thread = 0; thread < 2; thread++) {
+        memset(grf.data(), static_cast<int>(thread + 1), regSize);
+        session->registersAccessHelper(session->allThreads[EuThread::ThreadId(0, 0, 0, 0, thread)].get(), regdesc, 1, 1, grf.data(), true);
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 1, 1, grf.data()));
+    EXPECT_EQ(1u, grf[0]);
+    EXPECT_EQ(1u, grf[regSize - 1]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(thread1, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 1, 1, grf.data()));
+    EXPECT_EQ(2u, grf[0]);
+    EXPECT_EQ(2u, grf[regSize - 1]);
+
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+    EXPECT_EQ(1u, session->stateSaveAreaSnapshots.size());
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotWhenWritingRegistersThenSnapshotIsUpdatedAndItIsDroppedOnResume) {
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+    session->stateSaveAreaSnapshotEnabled = true;
+
+    const auto regSize = session->getRegisterSize(ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU);
+    std::vector<uint8_t> grf(regSize, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf.data()));
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+
+    memset(grf.data(), 0x5a, regSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->writeRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf.data()));
+
+    memset(grf.data(), 0, regSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf.data()));
+    EXPECT_EQ(0x5au, grf[0]);
+    EXPECT_EQ(0x5au, grf[regSize - 1]);
+    EXPECT_EQ(1u, session->readGpuMemoryCallCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->resume(stoppedThread));
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.size());
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotEnabledAndStateSaveAreaCannotBeReadWhenReadingRegistersThenRegistersAreReadDirectly) {
+    session->stateSaveAreaHeader.resize(session->getContextStateSaveAreaSize(0));
+    session->stateSaveAreaSnapshotEnabled = true;
+    session->readMemoryResult = ZE_RESULT_ERROR_UNKNOWN;
+
+    const auto regSize = session->getRegisterSize(ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU);
+    std::vector<uint8_t> grf(regSize, 0);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf.data()));
+    EXPECT_EQ(2u, session->readGpuMemoryCallCount);
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.size());
+
+    session->readMemoryResult = ZE_RESULT_SUCCESS;
+    session->returnStateSaveAreaGpuVa = false;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, 0, 1, grf.data()));
+    EXPECT_EQ(0u, session->stateSaveAreaSnapshots.size());
+}
+
+TEST_F(DebugSessionRegistersAccessTest, GivenStateSaveAreaSnapshotEnabledWhenReadingRegistersWithInvalidIndicesThenErrorInvalidArgumentIsReturned) {
+    session->stateSaveAreaSnapshotEnabled = true;
+    auto *regdesc = &(reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data()))->regHeader.grf;
+
+    std::vector<uint8_t> grf(session->getRegisterSize(ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU) * 2, 0);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, regdesc->num, 1, grf.data()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, session->readRegisters(stoppedThread, ZET_DEBUG_REGSET_TYPE_GRF_INTEL_GPU, regdesc->num - 1, 2, grf.data()));
+    EXPECT_EQ(0u, session->readGpuMemoryCallCount);
+}
+
 TEST_F(DebugSessionRegistersAccessTest, WhenReadingSbaRegistersThenCorrectAddressesAreReturned) {
 
     {
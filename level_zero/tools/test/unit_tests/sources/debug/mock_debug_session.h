@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -156,6 +156,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::checkTriggerEventsForAttention;
     using L0::DebugSessionImp::fillResumeAndStoppedThreadsFromNewlyStopped;
     using L0::DebugSessionImp::generateEventsAndResumeStoppedThreads;
+    using L0::DebugSessionImp::generateEventsAndResumeStoppedThreadsForTileSessions;
     using L0::DebugSessionImp::generateEventsForPendingInterrupts;
     using L0::DebugSessionImp::generateEventsForStoppedThreads;
     using L0::DebugSessionImp::getRegisterSize;
@@ -184,6 +185,8 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::sipSupportsSlm;
     using L0::DebugSessionImp::slmMemoryAccess;
     using L0::DebugSessionImp::slmSipVersionCheck;
+    using L0::DebugSessionImp::stateSaveAreaSnapshotEnabled;
+    using L0::DebugSessionImp::stateSaveAreaSnapshots;
     using L0::DebugSessionImp::tileAttachEnabled;
     using L0::DebugSessionImp::tileSessions;
 
@@ -287,6 +290,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
     }
 
     ze_result_t readGpuMemory(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) override {
+        readGpuMemoryCallCount++;
         if (gpuVa != 0 && gpuVa >= reinterpret_cast<uint64_t>(stateSaveAreaHeader.data()) &&
             ((gpuVa + size) <= reinterpret_cast<uint64_t>(stateSaveAreaHeader.data() + stateSaveAreaHeader.size()))) {
             [[maybe_unused]] auto offset = ptrDiff(gpuVa, reinterpret_cast<uint64_t>(stateSaveAreaHeader.data()));
@@ -510,6 +514,7 @@ struct MockDebugSession : public L0::DebugSessionImp {
 
     uint32_t readStateSaveAreaHeaderCalled = 0;
     uint32_t readRegistersCallCount = 0;
+    uint32_t readGpuMemoryCallCount = 0;
     uint32_t readRegistersReg = 0;
     uint32_t writeRegistersCallCount = 0;
     uint32_t writeRegistersReg = 0;
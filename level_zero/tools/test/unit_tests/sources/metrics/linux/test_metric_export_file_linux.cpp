@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/tools/source/metrics/metric_streamer_export.h"
+
+#include <fcntl.h>
+
+namespace NEO {
+namespace SysCalls {
+extern bool failMmap;
+} // namespace SysCalls
+} // namespace NEO
+
+namespace L0 {
+namespace ult {
+
+constexpr int exportFileDescriptor = 77;
+
+TEST(MetricExportFileLinuxTest, GivenFileCanBeOpenedWhenCreatingExportFileThenFileIsResizedAndMappedAndTrimmedToUsedSizeOnRelease) {
+    static std::vector<off_t> truncatedSizes;
+    static int openFlags = 0;
+    truncatedSizes.clear();
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        openFlags = flags;
+        return exportFileDescriptor;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFtruncate)> ftruncateBackup(&NEO::SysCalls::sysCallsFtruncate, [](int fd, off_t length) -> int {
+        EXPECT_EQ(exportFileDescriptor, fd);
+        truncatedSizes.push_back(length);
+        return 0;
+    });
+    VariableBackup<uint32_t> munmapBackup(&NEO::SysCalls::munmapFuncCalled, 0u);
+    VariableBackup<uint32_t> closeBackup(&NEO::SysCalls::closeFuncCalled, 0u);
+    VariableBackup<int> closeArgBackup(&NEO::SysCalls::closeFuncArgPassed, 0);
+
+    auto file = MetricExportFile::create("export_0.bin", MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, file);
+    EXPECT_NE(nullptr, file->getData());
+    EXPECT_EQ(MemoryConstants::pageSize, file->getSize());
+    EXPECT_EQ(O_RDWR | O_CREAT | O_TRUNC, openFlags);
+    ASSERT_EQ(1u, truncatedSizes.size());
+    EXPECT_EQ(static_cast<off_t>(MemoryConstants::pageSize), truncatedSizes[0]);
+
+    file->setUsedSize(100u);
+    file.reset();
+    ASSERT_EQ(2u, truncatedSizes.size());
+    EXPECT_EQ(100, truncatedSizes[1]);
+    EXPECT_EQ(1u, NEO::SysCalls::munmapFuncCalled);
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+    EXPECT_EQ(exportFileDescriptor, NEO::SysCalls::closeFuncArgPassed);
+}
+
+TEST(MetricExportFileLinuxTest, GivenFileCannotBeOpenedWhenCreatingExportFileThenNullptrIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        return -1;
+    });
+    VariableBackup<int> ftruncateCalledBackup(&NEO::SysCalls::ftruncateCalled, 0);
+
+    EXPECT_EQ(nullptr, MetricExportFile::create("export_0.bin", MemoryConstants::pageSize));
+    EXPECT_EQ(0, NEO::SysCalls::ftruncateCalled);
+}
+
+TEST(MetricExportFileLinuxTest, GivenFileCannotBeResizedWhenCreatingExportFileThenFileIsClosedAndNullptrIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        return exportFileDescriptor;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFtruncate)> ftruncateBackup(&NEO::SysCalls::sysCallsFtruncate, [](int fd, off_t length) -> int {
+        return -1;
+    });
+    VariableBackup<uint32_t> mmapBackup(&NEO::SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<uint32_t> closeBackup(&NEO::SysCalls::closeFuncCalled, 0u);
+
+    EXPECT_EQ(nullptr, MetricExportFile::create("export_0.bin", MemoryConstants::pageSize));
+    EXPECT_EQ(0u, NEO::SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+}
+
+TEST(MetricExportFileLinuxTest, GivenFileCannotBeMappedWhenCreatingExportFileThenFileIsClosedAndNullptrIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        return exportFileDescriptor;
+    });
+    VariableBackup<bool> failMmapBackup(&NEO::SysCalls::failMmap, true);
+    VariableBackup<uint32_t> closeBackup(&NEO::SysCalls::closeFuncCalled, 0u);
+
+    EXPECT_EQ(nullptr, MetricExportFile::create("export_0.bin", MemoryConstants::pageSize));
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+}
+
+} // namespace ult
+} // namespace L0
@@ -434,6 +434,55 @@ HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhen
     }
 }
 
+HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenRawDataOfAllSubDevicesLargeEnoughForParallelCalculationWhenCalculateMultipleMetricValuesExpIsCalledThenValuesAreSummedPerSet, IsGen9ThruPVC) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+
+    auto device = testDevices[0];
+    uint32_t metricGroupCount = 1;
+    zet_metric_group_handle_t metricGroup = nullptr;
+    ASSERT_EQ(zetMetricGroupGet(device->toHandle(), &metricGroupCount, &metricGroup), ZE_RESULT_SUCCESS);
+    ASSERT_NE(metricGroup, nullptr);
+
+    const size_t repeatCount = IpSamplingMetricGroupImp::minRawReportsForParallelCalculation / rawDataVector.size();
+    std::vector<MockStallRawIpData> largeRawDataVector;
+    largeRawDataVector.reserve(rawDataVector.size() * repeatCount);
+    for (size_t i = 0; i < repeatCount; i++) {
+        largeRawDataVector.insert(largeRawDataVector.end(), rawDataVector.begin(), rawDataVector.end());
+    }
+    const size_t largeRawDataVectorSize = sizeof(largeRawDataVector[0]) * largeRawDataVector.size();
+    const size_t chunkSize = largeRawDataVectorSize + sizeof(IpSamplingMetricDataHeader);
+
+    std::vector<uint8_t> rawDataWithHeader(2 * chunkSize);
+    addHeader(rawDataWithHeader.data(), chunkSize, reinterpret_cast<uint8_t *>(largeRawDataVector.data()), largeRawDataVectorSize, 0);
+    addHeader(rawDataWithHeader.data() + chunkSize, chunkSize, reinterpret_cast<uint8_t *>(largeRawDataVector.data()), largeRawDataVectorSize, 1);
+
+    uint32_t setCount = 0;
+    uint32_t totalMetricValueCount = 0;
+    std::vector<uint32_t> metricCounts(2);
+    EXPECT_EQ(L0::zetMetricGroupCalculateMultipleMetricValuesExp(metricGroup,
+                                                                 ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES, rawDataWithHeader.size(), rawDataWithHeader.data(),
+                                                                 &setCount, &totalMetricValueCount, metricCounts.data(), nullptr),
+              ZE_RESULT_SUCCESS);
+    EXPECT_EQ(setCount, 2u);
+
+    std::vector<zet_typed_value_t> metricValues(totalMetricValueCount);
+    EXPECT_EQ(L0::zetMetricGroupCalculateMultipleMetricValuesExp(metricGroup,
+                                                                 ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES, rawDataWithHeader.size(), rawDataWithHeader.data(),
+                                                                 &setCount, &totalMetricValueCount, metricCounts.data(), metricValues.data()),
+              ZE_RESULT_SUCCESS);
+    EXPECT_EQ(totalMetricValueCount, 40u);
+    EXPECT_EQ(metricCounts[0], 20u);
+    EXPECT_EQ(metricCounts[1], 20u);
+
+    const uint32_t metricCount = 10u;
+    for (uint32_t i = 0; i < totalMetricValueCount; i++) {
+        const auto &expectedValue = expectedMetricValues[i % expectedMetricValues.size()];
+        const bool isIp = (i % metricCount) == 0;
+        EXPECT_EQ(expectedValue.type, metricValues[i].type);
+        EXPECT_EQ(isIp ? expectedValue.value.ui64 : expectedValue.value.ui64 * repeatCount, metricValues[i].value.ui64);
+    }
+}
+
 HWTEST2_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhenCalculateMultipleMetricValuesExpIsCalledWithInvalidHeaderThenErrorIsReturned, IsGen9ThruPVC) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
 
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_stall_data.h"
+
+namespace L0 {
+namespace ult {
+
+class MockStallSumIpDataMap : public StallSumIpDataMap {
+  public:
+    using StallSumIpDataMap::slots;
+};
+
+TEST(StallSumIpDataMapTest, GivenEmptyMapWhenGettingIpThenZeroedEntryIsAdded) {
+    StallSumIpDataMap stallSumIpDataMap;
+    EXPECT_EQ(0u, stallSumIpDataMap.size());
+
+    auto &stallSumIpData = stallSumIpDataMap.get(0x100);
+    EXPECT_EQ(1u, stallSumIpDataMap.size());
+    EXPECT_EQ(0u, stallSumIpData.activeCount);
+    EXPECT_EQ(0u, stallSumIpData.instFetchCount);
+    EXPECT_EQ(0x100u, stallSumIpDataMap.getEntries()[0].ip);
+}
+
+TEST(StallSumIpDataMapTest, GivenIpAlreadyInMapWhenGettingIpThenSameEntryIsReturned) {
+    StallSumIpDataMap stallSumIpDataMap;
+    stallSumIpDataMap.get(0x100).activeCount += 3;
+    stallSumIpDataMap.get(0x200).activeCount += 5;
+    stallSumIpDataMap.get(0x100).activeCount += 4;
+
+    EXPECT_EQ(2u, stallSumIpDataMap.size());
+    EXPECT_EQ(7u, stallSumIpDataMap.get(0x100).activeCount);
+    EXPECT_EQ(5u, stallSumIpDataMap.get(0x200).activeCount);
+}
+
+TEST(StallSumIpDataMapTest, GivenIpZeroWhenGettingIpThenEntryIsAdded) {
+    StallSumIpDataMap stallSumIpDataMap;
+    stallSumIpDataMap.get(0).syncCount++;
+    stallSumIpDataMap.get(0).syncCount++;
+
+    EXPECT_EQ(1u, stallSumIpDataMap.size());
+    EXPECT_EQ(2u, stallSumIpDataMap.get(0).syncCount);
+}
+
+TEST(StallSumIpDataMapTest, GivenMoreIpsThanHalfOfSlotsWhenGettingIpsThenTableGrowsAndKeepsSums) {
+    MockStallSumIpDataMap stallSumIpDataMap;
+    const uint64_t ipCount = 4 * StallSumIpDataMap::initialSlotCount;
+    for (uint64_t ip = 0; ip < ipCount; ip++) {
+        stallSumIpDataMap.get(ip).activeCount += ip;
+    }
+    for (uint64_t ip = 0; ip < ipCount; ip++) {
+        stallSumIpDataMap.get(ip).activeCount += 1;
+    }
+
+    EXPECT_EQ(ipCount, stallSumIpDataMap.size());
+    EXPECT_LE(2 * ipCount, stallSumIpDataMap.slots.size());
+    for (auto &entry : stallSumIpDataMap.getEntries()) {
+        EXPECT_EQ(entry.ip + 1, entry.data.activeCount);
+    }
+}
+
+TEST(StallSumIpDataMapTest, GivenIpsWithSameLowBitsWhenGettingIpsThenEntriesAreKeptSeparately) {
+    MockStallSumIpDataMap stallSumIpDataMap;
+    stallSumIpDataMap.get(0);
+    const auto slotCount = stallSumIpDataMap.slots.size();
+
+    std::vector<uint64_t> collidingIps;
+    for (uint64_t i = 1; i <= 8; i++) {
+        collidingIps.push_back(i * slotCount * 0x10000);
+    }
+    for (auto ip : collidingIps) {
+        stallSumIpDataMap.get(ip).sbidCount += ip;
+    }
+    for (auto ip : collidingIps) {
+        EXPECT_EQ(ip, stallSumIpDataMap.get(ip).sbidCount);
+    }
+    EXPECT_EQ(collidingIps.size() + 1, stallSumIpDataMap.size());
+}
+
+TEST(StallSumIpDataMapTest, GivenReservedMapWhenGettingReservedNumberOfIpsThenTableIsNotRehashed) {
+    MockStallSumIpDataMap stallSumIpDataMap;
+    stallSumIpDataMap.reserve(3000);
+    const auto slotCount = stallSumIpDataMap.slots.size();
+    EXPECT_LE(6000u, slotCount);
+
+    for (uint64_t ip = 0; ip < 3000; ip++) {
+        stallSumIpDataMap.get(ip * 64);
+    }
+    EXPECT_EQ(slotCount, stallSumIpDataMap.slots.size());
+}
+
+TEST(StallSumIpDataMapTest, GivenUnsortedIpsWhenSortingByIpThenEntriesAreOrderedAndStillFound) {
+    StallSumIpDataMap stallSumIpDataMap;
+    std::vector<uint64_t> ips = {0x500, 0x10, 0x1fffffff, 0x300, 0x20};
+    for (auto ip : ips) {
+        stallSumIpDataMap.get(ip).otherCount = ip + 1;
+    }
+
+    stallSumIpDataMap.sortByIp();
+
+    auto &entries = stallSumIpDataMap.getEntries();
+    ASSERT_EQ(ips.size(), entries.size());
+    for (size_t i = 1; i < entries.size(); i++) {
+        EXPECT_LT(entries[i - 1].ip, entries[i].ip);
+    }
+    for (auto ip : ips) {
+        EXPECT_EQ(ip + 1, stallSumIpDataMap.get(ip).otherCount);
+    }
+    EXPECT_EQ(ips.size(), stallSumIpDataMap.size());
+}
+
+} // namespace ult
+} // namespace L0
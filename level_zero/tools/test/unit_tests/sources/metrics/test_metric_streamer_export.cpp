@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/string.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "level_zero/tools/source/metrics/metric_streamer_export.h"
+#include "level_zero/tools/test/unit_tests/sources/metrics/mock_metric_source.h"
+
+#include <atomic>
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+class MockExportFile : public MetricExportFile {
+  public:
+    MockExportFile(size_t size, std::vector<size_t> &releasedUsedSizes) : storage(size), releasedUsedSizes(releasedUsedSizes) {
+        this->data = storage.data();
+        this->size = size;
+    }
+    ~MockExportFile() override {
+        releasedUsedSizes.push_back(usedSize);
+    }
+
+    std::vector<uint8_t> storage;
+    std::vector<size_t> &releasedUsedSizes;
+};
+
+class MockMetricStreamerExporter : public MetricStreamerExporter {
+  public:
+    using MetricStreamerExporter::maxReadSize;
+    using MetricStreamerExporter::MetricStreamerExporter;
+    using MetricStreamerExporter::segment;
+    using MetricStreamerExporter::segmentSize;
+
+    std::unique_ptr<MetricExportFile> createFile(const std::string &path, size_t size) override {
+        createdPaths.push_back(path);
+        if (failCreateFile) {
+            return nullptr;
+        }
+        auto file = std::make_unique<MockExportFile>(size, *releasedUsedSizes);
+        lastFileData = file->storage.data();
+        return file;
+    }
+
+    const MetricExportFileHeader &getHeader() const {
+        return *reinterpret_cast<const MetricExportFileHeader *>(lastFileData);
+    }
+
+    std::vector<std::string> createdPaths;
+    std::vector<size_t> *releasedUsedSizes = nullptr;
+    uint8_t *lastFileData = nullptr;
+    bool failCreateFile = false;
+};
+
+class MockExportedMetricStreamer : public MetricStreamer {
+  public:
+    ze_result_t readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) override {
+        if (*pRawDataSize == 0) {
+            *pRawDataSize = maxReadSize;
+            return ZE_RESULT_SUCCESS;
+        }
+        readDataCalled++;
+        if (readDataResult != ZE_RESULT_SUCCESS && readDataResult != ZE_RESULT_WARNING_DROPPED_DATA) {
+            return readDataResult;
+        }
+        *pRawDataSize = std::min(*pRawDataSize, availableSize);
+        for (size_t i = 0; i < *pRawDataSize; i++) {
+            pRawData[i] = static_cast<uint8_t>(readDataCalled + i);
+        }
+        return readDataResult;
+    }
+    ze_result_t close() override {
+        closeCalled++;
+        return ZE_RESULT_SUCCESS;
+    }
+    ze_result_t appendStreamerMarker(CommandList &commandList, uint32_t value) override {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    Event::State getNotificationState() override {
+        return Event::State::STATE_SIGNALED;
+    }
+
+    size_t maxReadSize = 256u;
+    size_t availableSize = 100u;
+    ze_result_t readDataResult = ZE_RESULT_SUCCESS;
+    std::atomic<uint32_t> readDataCalled{0};
+    uint32_t closeCalled = 0;
+};
+
+class MockExportMetricGroup : public MockMetricGroup {
+  public:
+    MockExportMetricGroup(MetricSource &metricSource) : MockMetricGroup(metricSource) {}
+
+    ze_result_t getProperties(zet_metric_group_properties_t *pProperties) override {
+        strcpy_s(pProperties->name, sizeof(pProperties->name), "ExportedGroup");
+        return ZE_RESULT_SUCCESS;
+    }
+    ze_result_t getExportData(const uint8_t *pRawData, size_t rawDataSize, size_t *pExportDataSize,
+                              uint8_t *pExportData) override {
+        if (!exportDataSupported) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        if (*pExportDataSize == 0) {
+            *pExportDataSize = metadataSize;
+            return ZE_RESULT_SUCCESS;
+        }
+        memset(pExportData, 0xab, metadataSize);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    size_t metadataSize = 36u;
+    bool exportDataSupported = true;
+};
+
+class MetricStreamerExportTest : public ::testing::Test {
+  public:
+    std::unique_ptr<MockMetricStreamerExporter> createExporter(size_t segmentSize, uint32_t segmentCount) {
+        auto exporter = std::make_unique<MockMetricStreamerExporter>(streamer, metricGroup, "export", segmentSize, segmentCount, std::chrono::microseconds(10));
+        exporter->releasedUsedSizes = &releasedUsedSizes;
+        EXPECT_TRUE(exporter->initialize());
+        return exporter;
+    }
+
+    const MetricExportChunkHeader &getChunk(MockMetricStreamerExporter &exporter, size_t offset) {
+        return *reinterpret_cast<const MetricExportChunkHeader *>(exporter.lastFileData + offset);
+    }
+
+    MockMetricSource metricSource;
+    MockExportMetricGroup metricGroup{metricSource};
+    MockExportedMetricStreamer streamer;
+    std::vector<size_t> releasedUsedSizes;
+};
+
+TEST_F(MetricStreamerExportTest, GivenExportFileNotSetWhenCreatingExportingStreamerThenStreamerIsReturned) {
+    EXPECT_EQ(&streamer, ExportingMetricStreamer::create(streamer, metricGroup));
+}
+
+TEST_F(MetricStreamerExportTest, GivenMetricGroupWithoutExportDataWhenCreatingExportingStreamerThenStreamerIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.MetricStreamerExportFile.set("export");
+    metricGroup.exportDataSupported = false;
+
+    EXPECT_EQ(&streamer, ExportingMetricStreamer::create(streamer, metricGroup));
+    EXPECT_EQ(0u, streamer.readDataCalled.load());
+}
+
+TEST_F(MetricStreamerExportTest, GivenSegmentSmallerThanSingleReadWhenInitializingThenSegmentSizeIsIncreased) {
+    auto exporter = createExporter(64u, 2u);
+    EXPECT_EQ(streamer.maxReadSize, exporter->maxReadSize);
+    EXPECT_LE(sizeof(MetricExportFileHeader) + metricGroup.metadataSize + sizeof(MetricExportChunkHeader) + streamer.maxReadSize, exporter->segmentSize);
+}
+
+TEST_F(MetricStreamerExportTest, GivenStreamerWithDataWhenDrainingThenChunkIsWrittenAfterMetadata) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+
+    EXPECT_EQ(streamer.availableSize, exporter->drain());
+    ASSERT_EQ(1u, exporter->createdPaths.size());
+    EXPECT_NE(std::string::npos, exporter->createdPaths[0].find("export_"));
+    EXPECT_NE(std::string::npos, exporter->createdPaths[0].find("_0.bin"));
+
+    auto &header = exporter->getHeader();
+    EXPECT_EQ(MetricExportFileHeader::magicValue, header.magic);
+    EXPECT_EQ(MetricExportFileHeader::currentVersion, header.version);
+    EXPECT_EQ(0u, header.segmentIndex);
+    EXPECT_EQ(0u, header.segmentSequence);
+    EXPECT_EQ(1u, header.chunkCount);
+    EXPECT_EQ(0u, header.droppedDataChunkCount);
+    EXPECT_STREQ("ExportedGroup", header.metricGroupName);
+    EXPECT_EQ(metricGroup.metadataSize, header.metadataSize);
+    EXPECT_EQ(0u, header.metadataOffset % sizeof(uint64_t));
+    for (size_t i = 0; i < header.metadataSize; i++) {
+        EXPECT_EQ(0xab, exporter->lastFileData[header.metadataOffset + i]);
+    }
+
+    const auto chunkOffset = alignUp(header.metadataOffset + header.metadataSize, sizeof(uint64_t));
+    auto &chunk = getChunk(*exporter, chunkOffset);
+    EXPECT_EQ(MetricExportChunkHeader::magicValue, chunk.magic);
+    EXPECT_EQ(0u, chunk.flags);
+    EXPECT_EQ(0u, chunk.sequence);
+    EXPECT_EQ(streamer.availableSize, chunk.rawDataSize);
+    auto rawData = exporter->lastFileData + chunkOffset + sizeof(MetricExportChunkHeader);
+    for (size_t i = 0; i < chunk.rawDataSize; i++) {
+        EXPECT_EQ(static_cast<uint8_t>(1 + i), rawData[i]);
+    }
+    EXPECT_EQ(alignUp(chunkOffset + sizeof(MetricExportChunkHeader) + streamer.availableSize, sizeof(uint64_t)), header.usedSize);
+}
+
+TEST_F(MetricStreamerExportTest, GivenStreamerWithoutDataWhenDrainingThenChunkIsNotWritten) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+    streamer.availableSize = 0;
+
+    EXPECT_EQ(0u, exporter->drain());
+    EXPECT_EQ(0u, exporter->getChunkCount());
+    EXPECT_EQ(0u, exporter->getHeader().chunkCount);
+}
+
+TEST_F(MetricStreamerExportTest, GivenStreamerReportingDroppedDataWhenDrainingThenChunkIsMarked) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+    streamer.readDataResult = ZE_RESULT_WARNING_DROPPED_DATA;
+
+    exporter->drain();
+    exporter->drain();
+
+    auto &header = exporter->getHeader();
+    EXPECT_EQ(2u, header.chunkCount);
+    EXPECT_EQ(2u, header.droppedDataChunkCount);
+    auto &chunk = getChunk(*exporter, alignUp(header.metadataOffset + header.metadataSize, sizeof(uint64_t)));
+    EXPECT_EQ(MetricExportChunkHeader::dataDroppedFlag, chunk.flags);
+}
+
+TEST_F(MetricStreamerExportTest, GivenFailingStreamerReadWhenDrainingThenFailedReadIsCounted) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+    streamer.readDataResult = ZE_RESULT_ERROR_UNKNOWN;
+
+    EXPECT_EQ(0u, exporter->drain());
+    EXPECT_EQ(0u, exporter->getHeader().chunkCount);
+    EXPECT_EQ(1u, exporter->getHeader().failedReadCount);
+}
+
+TEST_F(MetricStreamerExportTest, GivenFileCannotBeCreatedWhenInitializingThenInitializationFailsAndStreamerIsNotRead) {
+    auto exporter = std::make_unique<MockMetricStreamerExporter>(streamer, metricGroup, "export", MemoryConstants::pageSize, 2u, std::chrono::microseconds(10));
+    exporter->releasedUsedSizes = &releasedUsedSizes;
+    exporter->failCreateFile = true;
+
+    EXPECT_FALSE(exporter->initialize());
+    EXPECT_EQ(1u, exporter->createdPaths.size());
+    EXPECT_EQ(0u, streamer.readDataCalled.load());
+}
+
+TEST_F(MetricStreamerExportTest, GivenInitializedExporterWhenNotDrainedYetThenFirstSegmentIsAlreadyCreated) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+
+    ASSERT_EQ(1u, exporter->createdPaths.size());
+    EXPECT_EQ(0u, exporter->getHeader().segmentSequence);
+    EXPECT_EQ(0u, exporter->getHeader().chunkCount);
+    EXPECT_EQ(0u, streamer.readDataCalled.load());
+}
+
+TEST_F(MetricStreamerExportTest, GivenNextFileCannotBeCreatedWhenDrainingThenStreamerIsNotRead) {
+    auto exporter = createExporter(64u, 2u);
+    streamer.availableSize = streamer.maxReadSize;
+    EXPECT_EQ(streamer.maxReadSize, exporter->drain());
+
+    exporter->failCreateFile = true;
+    EXPECT_EQ(0u, exporter->drain());
+    EXPECT_EQ(1u, streamer.readDataCalled.load());
+    EXPECT_EQ(1u, exporter->getChunkCount());
+}
+
+TEST_F(MetricStreamerExportTest, GivenFullSegmentWhenDrainingThenNextSegmentIsUsedInRoundRobin) {
+    auto exporter = createExporter(64u, 2u);
+    const auto segmentSize = exporter->segmentSize;
+    streamer.availableSize = streamer.maxReadSize;
+
+    // segment fits exactly one full read
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(streamer.maxReadSize, exporter->drain());
+        EXPECT_EQ(i, exporter->getHeader().segmentSequence);
+        EXPECT_EQ(i % 2, exporter->getHeader().segmentIndex);
+        EXPECT_EQ(i + 1, exporter->getHeader().chunkCount);
+    }
+
+    ASSERT_EQ(3u, exporter->createdPaths.size());
+    EXPECT_EQ(exporter->createdPaths[0], exporter->createdPaths[2]);
+    EXPECT_NE(exporter->createdPaths[0], exporter->createdPaths[1]);
+    ASSERT_EQ(2u, releasedUsedSizes.size());
+    EXPECT_EQ(segmentSize, releasedUsedSizes[0]);
+    EXPECT_EQ(segmentSize, releasedUsedSizes[1]);
+}
+
+TEST_F(MetricStreamerExportTest, GivenApplicationReadingStreamerWhenReadDataIsCalledThenDataIsReturnedAndExported) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+
+    size_t rawDataSize = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, exporter->readData(UINT32_MAX, &rawDataSize, nullptr));
+    EXPECT_EQ(streamer.maxReadSize, rawDataSize);
+    EXPECT_EQ(0u, exporter->getChunkCount());
+
+    std::vector<uint8_t> rawData(rawDataSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, exporter->readData(UINT32_MAX, &rawDataSize, rawData.data()));
+    EXPECT_EQ(streamer.availableSize, rawDataSize);
+    EXPECT_EQ(1u, exporter->getChunkCount());
+
+    auto &header = exporter->getHeader();
+    const auto chunkOffset = alignUp(header.metadataOffset + header.metadataSize, sizeof(uint64_t));
+    EXPECT_EQ(rawDataSize, getChunk(*exporter, chunkOffset).rawDataSize);
+    EXPECT_EQ(0, memcmp(rawData.data(), exporter->lastFileData + chunkOffset + sizeof(MetricExportChunkHeader), rawDataSize));
+}
+
+TEST_F(MetricStreamerExportTest, GivenFileCannotBeCreatedWhenApplicationReadsDataThenDataIsReturnedAndChunkIsLost) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+    exporter->drain();
+    exporter->failCreateFile = true;
+    streamer.availableSize = MemoryConstants::pageSize;
+
+    std::vector<uint8_t> rawData(MemoryConstants::pageSize);
+    size_t rawDataSize = rawData.size();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, exporter->readData(UINT32_MAX, &rawDataSize, rawData.data()));
+    EXPECT_EQ(rawData.size(), rawDataSize);
+    EXPECT_EQ(1u, exporter->getChunkCount());
+}
+
+TEST_F(MetricStreamerExportTest, GivenStartedExporterWhenStreamerHasDataThenItIsDrainedInBackground) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+    exporter->start();
+    exporter->start();
+
+    while (streamer.readDataCalled < 2) {
+        std::this_thread::yield();
+    }
+    exporter->stop();
+    EXPECT_LE(2u, exporter->getChunkCount());
+}
+
+TEST_F(MetricStreamerExportTest, GivenExportingStreamerWhenClosingThenRemainingDataIsExportedAndStreamerIsClosed) {
+    auto exporter = createExporter(MemoryConstants::pageSize, 2u);
+    auto exportingStreamer = new ExportingMetricStreamer(streamer, std::move(exporter));
+
+    EXPECT_EQ(Event::State::STATE_SIGNALED, exportingStreamer->getNotificationState());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, exportingStreamer->close());
+    EXPECT_EQ(1u, streamer.closeCalled);
+    EXPECT_EQ(1u, streamer.readDataCalled.load());
+    EXPECT_EQ(1u, releasedUsedSizes.size());
+}
+
+} // namespace ult
+} // namespace L0
@@ -44,6 +44,7 @@
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 #include "opencl/source/mem_obj/pipe.h"
 #include "opencl/source/platform/platform.h"
+#include "opencl/source/program/async_program_builds_handler.h"
 #include "opencl/source/program/program.h"
 #include "opencl/source/sampler/sampler.h"
 #include "opencl/source/sharings/sharing_factory.h"
@@ -1587,8 +1588,12 @@ cl_int CL_API_CALL clBuildProgram(cl_program program,
         retVal = Program::processInputDevices(deviceVectorPtr, numDevices, deviceList, pProgram->getDevices());
     }
     if (CL_SUCCESS == retVal) {
-        retVal = pProgram->build(*deviceVectorPtr, options);
-        pProgram->invokeCallback(funcNotify, userData);
+        if ((funcNotify != nullptr) && (AsyncProgramBuildsHandler::getWorkersCount() > 0)) {
+            retVal = pProgram->buildAsync(*deviceVectorPtr, options, funcNotify, userData);
+        } else {
+            retVal = pProgram->build(*deviceVectorPtr, options);
+            pProgram->invokeCallback(funcNotify, userData);
+        }
     }
 
     TRACING_EXIT(ClBuildProgram, &retVal);
@@ -1043,6 +1043,19 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::hostPtrStagingAllowed(size_t size, cl_uint numEventsInWaitList, const cl_event *event) {
+    auto &stagingRing = getContext().getHostPtrStagingRing();
+    if (!stagingRing.canBeStaged(size)) {
+        return false;
+    }
+    // transfer split into chunks signals event with last chunk copy, it marks completion of whole transfer only in in-order queue
+    if (size > stagingRing.getChunkSize() && (isOOQEnabled() || (event && isProfilingEnabled()))) {
+        return false;
+    }
+    // host pointer is accessed at enqueue time, command must not wait for anything that could still change it
+    return numEventsInWaitList == 0 && !isQueueBlocked();
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || debugManager.flags.OmitTimestampPacketDependencies.get();
 }
@@ -404,6 +404,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void overrideEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool hostPtrStagingAllowed(size_t size, cl_uint numEventsInWaitList, const cl_event *event);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(const CsrSelectionArgs &args) const;
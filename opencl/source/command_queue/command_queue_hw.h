@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/engine_control.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/memory_manager/host_ptr_staging_ring.h"
 #include "shared/source/os_interface/os_context.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -459,6 +460,10 @@ class CommandQueueHw : public CommandQueue {
                                                             const cl_event *eventWaitList, cl_event *event);
     cl_int enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                               const cl_event *eventWaitList, cl_event *event);
+    cl_int enqueueWriteBufferStaged(Buffer *buffer, cl_bool blockingWrite, size_t offset, size_t size, const void *ptr,
+                                    const HostPtrStagingRing::Chunks &stagingChunks, cl_event *event, CommandStreamReceiver &csr, TransferDirection direction);
+    cl_int enqueueReadBufferStaged(Buffer *buffer, size_t offset, size_t size, void *ptr,
+                                   const HostPtrStagingRing::Chunks &stagingChunks, CommandStreamReceiver &csr, TransferDirection direction);
 
     MOCKABLE_VIRTUAL void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection);
     void setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo);
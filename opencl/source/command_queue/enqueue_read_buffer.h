@@ -76,13 +76,19 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
 
     void *dstPtr = ptr;
 
+    auto bcsSplit = this->isSplitEnqueueBlitNeeded(csrSelectionArgs.direction, size, csr);
+
+    // staged data is copied to ptr after copy completes, so read must not be observable through event before that
+    HostPtrStagingRing::Chunks stagingChunks;
+    if (!mapAllocation && !bcsSplit && blockingRead && !event && hostPtrStagingAllowed(size, numEventsInWaitList, event) && getContext().getHostPtrStagingRing().acquireChunks(size, stagingChunks)) {
+        return enqueueReadBufferStaged(buffer, offset, size, ptr, stagingChunks, csr, csrSelectionArgs.direction);
+    }
+
     MemObjSurface bufferSurf(buffer);
     HostPtrSurface hostPtrSurf(dstPtr, size);
     GeneralSurface mapSurface;
     Surface *surfaces[] = {&bufferSurf, nullptr};
 
-    auto bcsSplit = this->isSplitEnqueueBlitNeeded(csrSelectionArgs.direction, size, csr);
-
     if (mapAllocation) {
         surfaces[1] = &mapSurface;
         mapSurface.setGraphicsAllocation(mapAllocation);
@@ -123,4 +129,63 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     return dispatchBcsOrGpgpuEnqueue<CL_COMMAND_READ_BUFFER>(dispatchInfo, surfaces, builtInType, numEventsInWaitList, eventWaitList, event, blockingRead, csr);
 }
 
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueReadBufferStaged(Buffer *buffer, size_t offset, size_t size, void *ptr,
+                                                          const HostPtrStagingRing::Chunks &stagingChunks, CommandStreamReceiver &csr, TransferDirection direction) {
+    auto &stagingRing = getContext().getHostPtrStagingRing();
+    auto stagingAllocation = stagingRing.getAllocation(getDevice().getRootDeviceIndex());
+
+    const bool useStateless = forceStateless(buffer->getSize());
+    const bool useHeapless = this->getHeaplessModeEnabled();
+    auto builtInType = EBuiltInOps::adjustBuiltinType<EBuiltInOps::copyBufferToBuffer>(useStateless, useHeapless);
+
+    MemObjSurface bufferSurf(buffer);
+    GeneralSurface stagingSurface(stagingAllocation);
+    Surface *surfaces[] = {&bufferSurf, &stagingSurface};
+
+    if (context->isProvidingPerformanceHints()) {
+        context->providePerformanceHintForMemoryTransfer(CL_COMMAND_READ_BUFFER, true, static_cast<cl_mem>(buffer), ptr);
+    }
+
+    const auto chunkSize = stagingRing.getChunkSize();
+    StackVec<TaskCountType, 8> chunkTaskCounts;
+    cl_int retVal = CL_SUCCESS;
+    for (size_t chunkId = 0u; chunkId < stagingChunks.size(); chunkId++) {
+        const auto chunkOffset = chunkId * chunkSize;
+
+        BuiltinOpParams dc;
+        dc.dstPtr = convertAddressWithOffsetToGpuVa(stagingChunks[chunkId].ptr, InternalMemoryType::hostUnifiedMemory, *stagingAllocation);
+        dc.dstOffset = {0, 0, 0};
+        dc.srcMemObj = buffer;
+        dc.srcOffset = {offset + chunkOffset, 0, 0};
+        dc.size = {std::min(chunkSize, size - chunkOffset), 0, 0};
+        dc.transferAllocation = stagingAllocation;
+        dc.direction = direction;
+
+        MultiDispatchInfo dispatchInfo(dc);
+        retVal = dispatchBcsOrGpgpuEnqueue<CL_COMMAND_READ_BUFFER>(dispatchInfo, surfaces, builtInType, 0, nullptr, nullptr, false, csr);
+        if (retVal != CL_SUCCESS) {
+            break;
+        }
+        chunkTaskCounts.push_back(csr.peekTaskCount());
+        csr.flushBatchedSubmissions();
+    }
+
+    // chunk is copied to ptr as soon as its copy completes, while copies of next chunks still run on GPU
+    for (size_t chunkId = 0u; chunkId < chunkTaskCounts.size() && retVal == CL_SUCCESS; chunkId++) {
+        if (csr.waitForTaskCount(chunkTaskCounts[chunkId]) == WaitStatus::gpuHang) {
+            retVal = CL_OUT_OF_RESOURCES;
+            break;
+        }
+        const auto chunkOffset = chunkId * chunkSize;
+        const auto chunkTransferSize = std::min(chunkSize, size - chunkOffset);
+        memcpy_s(ptrOffset(ptr, chunkOffset), chunkTransferSize, stagingChunks[chunkId].ptr, chunkTransferSize);
+    }
+    for (size_t chunkId = 0u; chunkId < stagingChunks.size(); chunkId++) {
+        const bool submitted = chunkId < chunkTaskCounts.size();
+        stagingRing.releaseChunk(stagingChunks[chunkId], submitted ? &csr : nullptr, submitted ? chunkTaskCounts[chunkId] : 0u);
+    }
+    return retVal;
+}
+
 } // namespace NEO
@@ -62,6 +62,13 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    auto bcsSplit = this->isSplitEnqueueBlitNeeded(csrSelectionArgs.direction, size, csr);
+
+    HostPtrStagingRing::Chunks stagingChunks;
+    if (!mapAllocation && !bcsSplit && hostPtrStagingAllowed(size, numEventsInWaitList, event) && getContext().getHostPtrStagingRing().acquireChunks(size, stagingChunks)) {
+        return enqueueWriteBufferStaged(buffer, blockingWrite, offset, size, ptr, stagingChunks, event, csr, csrSelectionArgs.direction);
+    }
+
     const bool useStateless = forceStateless(buffer->getSize());
     const bool useHeapless = this->getHeaplessModeEnabled();
     auto builtInType = EBuiltInOps::adjustBuiltinType<EBuiltInOps::copyBufferToBuffer>(useStateless, useHeapless);
@@ -73,8 +80,6 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
     GeneralSurface mapSurface;
     Surface *surfaces[] = {&bufferSurf, nullptr};
 
-    auto bcsSplit = this->isSplitEnqueueBlitNeeded(csrSelectionArgs.direction, size, csr);
-
     if (mapAllocation) {
         surfaces[1] = &mapSurface;
         mapSurface.setGraphicsAllocation(mapAllocation);
@@ -116,4 +121,66 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
     return CL_SUCCESS;
 }
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueWriteBufferStaged(Buffer *buffer, cl_bool blockingWrite, size_t offset, size_t size, const void *ptr,
+                                                           const HostPtrStagingRing::Chunks &stagingChunks, cl_event *event, CommandStreamReceiver &csr, TransferDirection direction) {
+    auto &stagingRing = getContext().getHostPtrStagingRing();
+    auto stagingAllocation = stagingRing.getAllocation(getDevice().getRootDeviceIndex());
+    stagingAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
+    stagingAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+
+    const bool useStateless = forceStateless(buffer->getSize());
+    const bool useHeapless = this->getHeaplessModeEnabled();
+    auto builtInType = EBuiltInOps::adjustBuiltinType<EBuiltInOps::copyBufferToBuffer>(useStateless, useHeapless);
+
+    MemObjSurface bufferSurf(buffer);
+    GeneralSurface stagingSurface(stagingAllocation);
+    Surface *surfaces[] = {&bufferSurf, &stagingSurface};
+
+    const auto chunkSize = stagingRing.getChunkSize();
+    cl_int retVal = CL_SUCCESS;
+    size_t chunkId = 0u;
+    for (; chunkId < stagingChunks.size(); chunkId++) {
+        const auto &chunk = stagingChunks[chunkId];
+        const auto chunkOffset = chunkId * chunkSize;
+        const auto chunkTransferSize = std::min(chunkSize, size - chunkOffset);
+        const bool lastChunk = chunkId + 1 == stagingChunks.size();
+
+        // host data is copied on submit, so application may reuse ptr as soon as call returns,
+        // copy of previous chunk is already flushed and runs on GPU while next chunk is copied on CPU
+        memcpy_s(chunk.ptr, chunkSize, ptrOffset(ptr, chunkOffset), chunkTransferSize);
+
+        BuiltinOpParams dc;
+        dc.srcPtr = convertAddressWithOffsetToGpuVa(chunk.ptr, InternalMemoryType::hostUnifiedMemory, *stagingAllocation);
+        dc.srcOffset = {0, 0, 0};
+        dc.dstMemObj = buffer;
+        dc.dstOffset = {offset + chunkOffset, 0, 0};
+        dc.size = {chunkTransferSize, 0, 0};
+        dc.transferAllocation = stagingAllocation;
+        dc.direction = direction;
+
+        MultiDispatchInfo dispatchInfo(dc);
+        retVal = dispatchBcsOrGpgpuEnqueue<CL_COMMAND_WRITE_BUFFER>(dispatchInfo, surfaces, builtInType, 0, nullptr, lastChunk ? event : nullptr, false, csr);
+        if (retVal != CL_SUCCESS) {
+            break;
+        }
+        stagingRing.releaseChunk(chunk, &csr, csr.peekTaskCount());
+        if (!lastChunk || blockingWrite) {
+            csr.flushBatchedSubmissions();
+        }
+    }
+    for (; chunkId < stagingChunks.size(); chunkId++) {
+        stagingRing.releaseChunk(stagingChunks[chunkId], nullptr, 0u);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if (context->isProvidingPerformanceHints()) {
+        context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_NEUTRAL_INTEL, CL_ENQUEUE_WRITE_BUFFER_REQUIRES_COPY_DATA, static_cast<cl_mem>(buffer));
+    }
+
+    return CL_SUCCESS;
+}
 } // namespace NEO
@@ -526,11 +526,29 @@ void Context::initializeUsmAllocationPools() {
                                                                    getRootDeviceIndices(), subDeviceBitfields);
         usmHostMemAllocPool.initialize(svmMemoryManager, memoryProperties, poolSize);
     }
+
+    if (debugManager.flags.EnableHostPtrStagingRing.get() == 1) {
+        size_t chunkSize = HostPtrStagingRing::defaultChunkSize;
+        if (debugManager.flags.HostPtrStagingRingChunkSize.get() > 0) {
+            chunkSize = debugManager.flags.HostPtrStagingRingChunkSize.get() * MemoryConstants::kiloByte;
+        }
+        uint32_t chunkCount = HostPtrStagingRing::defaultChunkCount;
+        if (debugManager.flags.HostPtrStagingRingChunkCount.get() > 0) {
+            chunkCount = static_cast<uint32_t>(debugManager.flags.HostPtrStagingRingChunkCount.get());
+        }
+        auto subDeviceBitfields = getDeviceBitfields();
+        auto &neoDevice = devices[0]->getDevice();
+        subDeviceBitfields[neoDevice.getRootDeviceIndex()] = neoDevice.getDeviceBitfield();
+        SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M,
+                                                                   getRootDeviceIndices(), subDeviceBitfields);
+        hostPtrStagingRing.initialize(svmMemoryManager, memoryProperties, chunkSize, chunkCount);
+    }
 }
 
 void Context::cleanupUsmAllocationPools() {
     usmDeviceMemAllocPool.cleanup();
     usmHostMemAllocPool.cleanup();
+    hostPtrStagingRing.cleanup();
 }
 
 bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *context) const {
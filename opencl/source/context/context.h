@@ -9,6 +9,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/host_ptr_staging_ring.h"
 #include "shared/source/memory_manager/unified_memory_pooling.h"
 #include "shared/source/utilities/buffer_pool_allocator.h"
 #include "shared/source/utilities/stackvec.h"
@@ -22,6 +23,7 @@
 #include "opencl/source/helpers/destructor_callbacks.h"
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
+#include <atomic>
 #include <map>
 
 enum class InternalMemoryType : uint32_t;
@@ -41,6 +43,22 @@ class Program;
 class Platform;
 class TagAllocatorBase;
 
+struct EventsReadyQueueMetrics {
+    std::atomic<uint64_t> unblockedEvents{0};
+    std::atomic<uint32_t> maxDependencyDepth{0};
+    std::atomic<uint32_t> maxReadyQueueSize{0};
+    std::atomic<uint64_t> totalReadyQueueLatencyNs{0};
+    std::atomic<uint64_t> maxReadyQueueLatencyNs{0};
+
+    void reset() {
+        unblockedEvents = 0;
+        maxDependencyDepth = 0;
+        maxReadyQueueSize = 0;
+        totalReadyQueueLatencyNs = 0;
+        maxReadyQueueLatencyNs = 0;
+    }
+};
+
 template <>
 struct OpenCLObjectMapper<_cl_context> {
     typedef class Context DerivedType;
@@ -246,6 +264,12 @@ class Context : public BaseObject<_cl_context> {
     UsmMemAllocPool &getHostMemAllocPool() {
         return usmHostMemAllocPool;
     }
+    HostPtrStagingRing &getHostPtrStagingRing() {
+        return hostPtrStagingRing;
+    }
+    EventsReadyQueueMetrics &getEventsReadyQueueMetrics() {
+        return eventsReadyQueueMetrics;
+    }
 
     TagAllocatorBase *getMultiRootDeviceTimestampPacketAllocator();
     std::unique_lock<std::mutex> obtainOwnershipForMultiRootDeviceAllocator();
@@ -293,6 +317,8 @@ class Context : public BaseObject<_cl_context> {
     BufferPoolAllocator smallBufferPoolAllocator;
     UsmDeviceMemAllocPool usmDeviceMemAllocPool;
     UsmHostMemAllocPool usmHostMemAllocPool;
+    HostPtrStagingRing hostPtrStagingRing;
+    EventsReadyQueueMetrics eventsReadyQueueMetrics;
 
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     cl_bool preferD3dSharedResources = 0u;
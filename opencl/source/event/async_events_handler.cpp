@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,16 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace NEO {
@@ -21,6 +25,8 @@ AsyncEventsHandler::AsyncEventsHandler() {
     registerList.reserve(64);
     list.reserve(64);
     pendingList.reserve(64);
+    completedList.reserve(64);
+    useTaskCountHeaps = (debugManager.flags.AsyncEventsHandlerUseTaskCountHeaps.get() == 1);
 }
 
 AsyncEventsHandler::~AsyncEventsHandler() {
@@ -45,6 +51,10 @@ Event *AsyncEventsHandler::processList() {
     for (auto event : list) {
         event->updateExecutionStatus();
         if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+            if (useTaskCountHeaps && canBeTrackedByTaskCount(event)) {
+                pushToCompletionHeap(event);
+                continue;
+            }
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -56,6 +66,71 @@ Event *AsyncEventsHandler::processList() {
     }
 
     list.swap(pendingList);
+
+    if (useTaskCountHeaps) {
+        sleepCandidate = processCompletionHeaps(sleepCandidate);
+    }
+    return sleepCandidate;
+}
+
+bool AsyncEventsHandler::TaskCountGreater::operator()(const Event *lhs, const Event *rhs) const {
+    return lhs->peekTaskCount() > rhs->peekTaskCount();
+}
+
+bool AsyncEventsHandler::canBeTrackedByTaskCount(Event *event) const {
+    auto executionStatus = event->peekExecutionStatus();
+    return (event->getCommandQueue() != nullptr) &&
+           !event->isExternallySynchronized() &&
+           !event->isBcsEvent() &&
+           (event->peekTaskCount() != CompletionStamp::notReady) &&
+           (executionStatus == CL_SUBMITTED || executionStatus == CL_RUNNING);
+}
+
+void AsyncEventsHandler::pushToCompletionHeap(Event *event) {
+    auto &heap = completionHeaps[&event->getCommandQueue()->getGpgpuCommandStreamReceiver()];
+    heap.push_back(event);
+    std::push_heap(heap.begin(), heap.end(), TaskCountGreater{});
+}
+
+Event *AsyncEventsHandler::processCompletionHeaps(Event *sleepCandidate) {
+    completedList.clear();
+
+    for (auto it = completionHeaps.begin(); it != completionHeaps.end();) {
+        auto &heap = it->second;
+
+        // events of a CSR complete in task count order, stop at first one that is still in flight
+        while (!heap.empty()) {
+            auto event = heap.front();
+            if (!event->isStatusCompleted(event->peekExecutionStatus()) && !event->isCompleted()) {
+                break;
+            }
+            std::pop_heap(heap.begin(), heap.end(), TaskCountGreater{});
+            heap.pop_back();
+            completedList.push_back(event);
+        }
+
+        if (heap.empty()) {
+            it = completionHeaps.erase(it);
+            continue;
+        }
+
+        auto lowestOutstanding = heap.front();
+        if (!sleepCandidate || lowestOutstanding->peekTaskCount() < sleepCandidate->peekTaskCount()) {
+            sleepCandidate = lowestOutstanding;
+        }
+        ++it;
+    }
+
+    for (auto event : completedList) {
+        event->updateExecutionStatus();
+        if (event->peekHasCallbacks()) {
+            list.push_back(event);
+        } else {
+            event->decRefInternal();
+        }
+    }
+    completedList.clear();
+
     return sleepCandidate;
 }
 
@@ -73,7 +148,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (self->list.empty() && self->completionHeaps.empty()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -119,6 +194,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &heap : completionHeaps) {
+        for (auto event : heap.second) {
+            event->decRefInternal();
+        }
+    }
+    completionHeaps.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,9 +10,11 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,7 +26,15 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    struct TaskCountGreater {
+        bool operator()(const Event *lhs, const Event *rhs) const;
+    };
+    using CompletionHeap = std::vector<Event *>;
+
     Event *processList();
+    Event *processCompletionHeaps(Event *sleepCandidate);
+    bool canBeTrackedByTaskCount(Event *event) const;
+    void pushToCompletionHeap(Event *event);
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
@@ -32,10 +42,13 @@ class AsyncEventsHandler {
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::vector<Event *> completedList;
+    std::unordered_map<CommandStreamReceiver *, CompletionHeap> completionHeaps;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
     std::condition_variable asyncCond;
     std::atomic<bool> allowAsyncProcess;
+    bool useTaskCountHeaps = false;
 };
 } // namespace NEO
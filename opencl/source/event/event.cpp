@@ -34,9 +34,41 @@
 #include "opencl/source/helpers/task_information.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 
 namespace NEO {
+namespace {
+struct EventsReadyQueueEntry {
+    enum class Type : uint8_t {
+        unblock,
+        executeCallbacks,
+        updateExecutionStatus
+    };
+    Type type;
+    Event *childEvent;
+    Event *parentEvent;
+    TaskCountType taskLevel;
+    int32_t transitionStatus;
+    uint32_t depth;
+    std::chrono::steady_clock::time_point readyTime;
+};
+
+// Entries are processed from the back, so the queue is walked in the same depth-first order as recursive unblocking.
+// Work which recursive unblocking does after the subtree of an event is processed is placed below entries of that subtree.
+struct EventsReadyQueue {
+    std::vector<EventsReadyQueueEntry> entries;
+    uint32_t currentDepth = 0;
+    bool draining = false;
+
+    void deferAt(size_t position, EventsReadyQueueEntry::Type type, Event *event, int32_t status) {
+        entries.insert(entries.begin() + position, {type, event, nullptr, 0, status, currentDepth, std::chrono::steady_clock::now()});
+    }
+};
+
+thread_local EventsReadyQueue eventsReadyQueue;
+} // namespace
+
 Event::Event(
     Context *ctx,
     CommandQueue *cmdQueue,
@@ -461,18 +493,13 @@ void Event::getBoundaryTimestampValues(TimestampPacketContainer *timestampContai
     globalStartTS = timestamps[0]->getGlobalStartValue(0);
     globalEndTS = timestamps[0]->getGlobalEndValue(0);
 
+    TimestampPacketValues packets[TimestampPacketConstants::preferredPacketCount];
     for (const auto &timestamp : timestamps) {
         if (!timestamp->isProfilingCapable()) {
             continue;
         }
-        for (auto i = 0u; i < timestamp->getPacketsUsed(); ++i) {
-            if (globalStartTS > timestamp->getGlobalStartValue(i)) {
-                globalStartTS = timestamp->getGlobalStartValue(i);
-            }
-            if (globalEndTS < timestamp->getGlobalEndValue(i)) {
-                globalEndTS = timestamp->getGlobalEndValue(i);
-            }
-        }
+        auto packetsRead = timestamp->readTimestampPackets(packets, TimestampPacketConstants::preferredPacketCount);
+        TimestampPacketReadout::updateGlobalBoundaryValues(packets, packetsRead, globalStartTS, globalEndTS);
     }
 }
 
@@ -583,17 +610,76 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
         }
     }
 
+    const bool useReadyQueue = (debugManager.flags.ExperimentalEnableEventsReadyQueue.get() == 1);
+
+    const auto firstChildEntry = eventsReadyQueue.entries.size();
     auto childEventRef = childEventsToNotify.detachNodes();
     while (childEventRef != nullptr) {
         auto childEvent = childEventRef->ref;
 
-        childEvent->unblockEventBy(*this, taskLevelToPropagate, transitionStatus);
-
-        childEvent->decRefInternal();
+        if (useReadyQueue) {
+            // child reference is moved to the queue entry, parent is kept alive until the entry is processed
+            this->incRefInternal();
+            eventsReadyQueue.entries.push_back({EventsReadyQueueEntry::Type::unblock, childEvent, this, taskLevelToPropagate, transitionStatus,
+                                                eventsReadyQueue.currentDepth + 1, std::chrono::steady_clock::now()});
+        } else {
+            childEvent->unblockEventBy(*this, taskLevelToPropagate, transitionStatus);
+            childEvent->decRefInternal();
+        }
         auto next = childEventRef->next;
         delete childEventRef;
         childEventRef = next;
     }
+
+    if (useReadyQueue) {
+        // first child is processed first, as with recursive unblocking
+        std::reverse(eventsReadyQueue.entries.begin() + firstChildEntry, eventsReadyQueue.entries.end());
+        processEventsReadyQueue();
+    }
+}
+
+void Event::processEventsReadyQueue() {
+    auto &readyQueue = eventsReadyQueue;
+    if (readyQueue.draining) {
+        // entries are processed by outermost call on this thread, so dependency chains don't grow the call stack
+        return;
+    }
+    readyQueue.draining = true;
+
+    while (!readyQueue.entries.empty()) {
+        auto queueSize = static_cast<uint32_t>(readyQueue.entries.size());
+        auto entry = readyQueue.entries.back();
+        readyQueue.entries.pop_back();
+        readyQueue.currentDepth = entry.depth;
+
+        if (entry.type == EventsReadyQueueEntry::Type::executeCallbacks) {
+            entry.childEvent->executeCallbacks(entry.transitionStatus);
+            entry.childEvent->decRefInternal();
+            continue;
+        }
+        if (entry.type == EventsReadyQueueEntry::Type::updateExecutionStatus) {
+            entry.childEvent->updateExecutionStatus();
+            entry.childEvent->decRefInternal();
+            continue;
+        }
+
+        if (auto context = entry.childEvent->getContext()) {
+            auto &metrics = context->getEventsReadyQueueMetrics();
+            auto latencyNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - entry.readyTime).count());
+            metrics.unblockedEvents++;
+            metrics.totalReadyQueueLatencyNs += latencyNs;
+            MultiThreadHelpers::interlockedMax(metrics.maxReadyQueueLatencyNs, latencyNs);
+            MultiThreadHelpers::interlockedMax(metrics.maxDependencyDepth, entry.depth);
+            MultiThreadHelpers::interlockedMax(metrics.maxReadyQueueSize, queueSize);
+        }
+
+        entry.childEvent->unblockEventBy(*entry.parentEvent, entry.taskLevel, entry.transitionStatus);
+        entry.childEvent->decRefInternal();
+        entry.parentEvent->decRefInternal();
+    }
+
+    readyQueue.currentDepth = 0;
+    readyQueue.draining = false;
 }
 
 bool Event::setStatus(cl_int status) {
@@ -619,10 +705,16 @@ bool Event::setStatus(cl_int status) {
     }
 
     this->incRefInternal();
+    const auto readyQueuePosition = eventsReadyQueue.entries.size();
     transitionExecutionStatus(status);
     if (isStatusCompleted(status) || (status == CL_SUBMITTED)) {
         unblockEventsBlockedByThis(status);
     }
+    if (eventsReadyQueue.draining) {
+        // callbacks run after events unblocked by this one, reference is released by the queue entry
+        eventsReadyQueue.deferAt(readyQueuePosition, EventsReadyQueueEntry::Type::executeCallbacks, this, status);
+        return true;
+    }
     executeCallbacks(status);
     this->decRefInternal();
     return true;
@@ -861,9 +953,15 @@ inline void Event::unblockEventBy(Event &event, TaskCountType taskLevel, int32_t
     if (isStatusCompletedByTermination(blockerStatus)) {
         statusToPropagate = blockerStatus;
     }
+    const auto readyQueuePosition = eventsReadyQueue.entries.size();
     setStatus(statusToPropagate);
 
     // event may be completed after this operation, transtition the state to not block others.
+    if (eventsReadyQueue.draining) {
+        this->incRefInternal();
+        eventsReadyQueue.deferAt(readyQueuePosition, EventsReadyQueueEntry::Type::updateExecutionStatus, this, statusToPropagate);
+        return;
+    }
     this->updateExecutionStatus();
 }
 
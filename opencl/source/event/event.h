@@ -353,6 +353,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     // vector storing events that needs to be notified when this event is ready to go
     IFRefList<Event, true, true> childEventsToNotify;
     void unblockEventsBlockedByThis(int32_t transitionStatus);
+    static void processEventsReadyQueue();
     void submitCommand(bool abortBlockedTasks);
 
     static void setExecutionStatusToAbortedDueToGpuHang(cl_event *first, cl_event *last);
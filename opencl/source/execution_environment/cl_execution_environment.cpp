@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,18 +9,25 @@
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/event/async_events_handler.h"
+#include "opencl/source/program/async_program_builds_handler.h"
 
 namespace NEO {
 
 ClExecutionEnvironment::ClExecutionEnvironment() : ExecutionEnvironment() {
     asyncEventsHandler.reset(new AsyncEventsHandler());
+    asyncProgramBuildsHandler.reset(new AsyncProgramBuildsHandler());
 }
 
 AsyncEventsHandler *ClExecutionEnvironment::getAsyncEventsHandler() const {
     return asyncEventsHandler.get();
 }
 
+AsyncProgramBuildsHandler *ClExecutionEnvironment::getAsyncProgramBuildsHandler() const {
+    return asyncProgramBuildsHandler.get();
+}
+
 ClExecutionEnvironment::~ClExecutionEnvironment() {
+    asyncProgramBuildsHandler->closeThreads();
     asyncEventsHandler->closeThread();
 };
 void ClExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,12 +15,14 @@
 namespace NEO {
 
 class AsyncEventsHandler;
+class AsyncProgramBuildsHandler;
 class BuiltinDispatchInfoBuilder;
 
 class ClExecutionEnvironment : public ExecutionEnvironment {
   public:
     ClExecutionEnvironment();
     AsyncEventsHandler *getAsyncEventsHandler() const;
+    AsyncProgramBuildsHandler *getAsyncProgramBuildsHandler() const;
     ~ClExecutionEnvironment() override;
     void prepareRootDeviceEnvironments(uint32_t numRootDevices) override;
     using BuilderT = std::pair<std::unique_ptr<BuiltinDispatchInfoBuilder>, std::once_flag>;
@@ -29,5 +31,6 @@ class ClExecutionEnvironment : public ExecutionEnvironment {
   protected:
     std::vector<std::unique_ptr<BuilderT[]>> builtinOpsBuilders;
     std::unique_ptr<AsyncEventsHandler> asyncEventsHandler;
+    std::unique_ptr<AsyncProgramBuildsHandler> asyncProgramBuildsHandler;
 };
 } // namespace NEO
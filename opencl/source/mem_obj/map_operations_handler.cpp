@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,6 @@
 
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
-#include "shared/source/helpers/ptr_math.h"
-
 using namespace NEO;
 
 size_t MapOperationsHandler::size() const {
@@ -26,7 +24,8 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    auto start = reinterpret_cast<uintptr_t>(mapInfo.ptr);
+    mappedPointers.insert(start, start + mapInfo.ptrLength, mapInfo);
     return true;
 }
 
@@ -34,29 +33,20 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
-
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    auto inputStart = reinterpret_cast<uintptr_t>(inputMapInfo.ptr);
+    auto inputEnd = inputStart + inputMapInfo.ptrLength;
 
-        // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
-            return true;
-        }
-    }
-    return false;
+    // Requested ptr starts before or inside existing ptr range and overlapping end, mapped range starting exactly at input end is treated as overlapping
+    return mappedPointers.findOverlapping(inputStart, inputEnd + 1) != nullptr;
 }
 
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto mapInfo = mappedPointers.findByStart(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (mapInfo) {
+        outMapInfo = *mapInfo;
+        return true;
     }
     return false;
 }
@@ -64,29 +54,18 @@ bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
 bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        void *ptrStart = mapInfo.ptr;
-        void *ptrEnd = ptrOffset(mapInfo.ptr, mapInfo.ptrLength);
-
-        if (ptrStart <= ptr && ptrOffset(ptr, size) <= ptrEnd) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto start = reinterpret_cast<uintptr_t>(ptr);
+    auto mapInfo = mappedPointers.findContaining(start, start + size);
+    if (mapInfo) {
+        outMapInfo = *mapInfo;
+        return true;
     }
     return false;
 }
 
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
-
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
-    }
+    mappedPointers.remove(reinterpret_cast<uintptr_t>(mappedPtr));
 }
 
 MapOperationsHandler &NEO::MapOperationsStorage::getHandler(cl_mem memObj) {
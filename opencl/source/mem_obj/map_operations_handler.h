@@ -1,16 +1,17 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/utilities/interval_tree.h"
+
 #include "opencl/source/helpers/properties_helper.h"
 
 #include <mutex>
 #include <unordered_map>
-#include <vector>
 
 namespace NEO {
 
@@ -26,7 +27,7 @@ class MapOperationsHandler {
 
   protected:
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    IntervalTree<MapInfo> mappedPointers;
     mutable std::mutex mtx;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -33,6 +34,33 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     UNRECOVERABLE_IF(allocData == nullptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+void PageFaultManager::transferChunkToGpu(void *allocPtr, void *chunkPtr, size_t chunkSize, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto &pageFaultData = memoryData[allocPtr];
+    auto unifiedMemoryManager = pageFaultData.unifiedMemoryManager;
+    // range can merge chunks mapped separately on CPU faults, their map operations are replaced by single one covering whole range
+    for (size_t mappedChunkOffset = 0; mappedChunkOffset < chunkSize; mappedChunkOffset += pageFaultData.chunkSize) {
+        auto mappedChunkPtr = ptrOffset(chunkPtr, mappedChunkOffset);
+        if (unifiedMemoryManager->getSvmMapOperation(mappedChunkPtr)) {
+            unifiedMemoryManager->removeSvmMapOperation(mappedChunkPtr);
+        }
+    }
+    unifiedMemoryManager->insertSvmMapOperation(chunkPtr, chunkSize, allocPtr, ptrDiff(chunkPtr, allocPtr), false);
+    auto retVal = commandQueue->enqueueSVMUnmap(chunkPtr, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    auto allocData = unifiedMemoryManager->getSVMAlloc(allocPtr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
+bool PageFaultManager::isChunkedMigrationSupported() const {
+    return true;
+}
+bool PageFaultManager::isCpuMigrationBlocked(void *allocPtr, PageFaultData &pageFaultData) {
+    return false;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
     auto commandQueue = static_cast<CommandQueue *>(pageFaultData.cmdQ);
 
@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/buffered_log_writer.h"
+
 #include "opencl/source/platform/platform.h"
 
 namespace NEO {
@@ -14,5 +16,6 @@ void __attribute__((constructor)) platformsConstructor() {
 void __attribute__((destructor)) platformsDestructor() {
     delete platformsImpl;
     platformsImpl = nullptr;
+    BufferedLogWriter::stopAll();
 }
 } // namespace NEO
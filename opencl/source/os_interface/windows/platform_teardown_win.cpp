@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/buffered_log_writer.h"
+
 #include "opencl/source/platform/platform.h"
 
 using namespace NEO;
@@ -12,6 +14,7 @@ using namespace NEO;
 BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) { // NOLINT(readability-identifier-naming)
     if (fdwReason == DLL_PROCESS_DETACH) {
         delete platformsImpl;
+        BufferedLogWriter::stopAll();
     }
     if (fdwReason == DLL_PROCESS_ATTACH) {
         platformsImpl = new std::vector<std::unique_ptr<Platform>>;
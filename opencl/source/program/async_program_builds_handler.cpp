@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/program/async_program_builds_handler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "opencl/source/program/program.h"
+
+#include <algorithm>
+
+namespace NEO {
+AsyncProgramBuildsHandler::AsyncProgramBuildsHandler() = default;
+
+AsyncProgramBuildsHandler::~AsyncProgramBuildsHandler() {
+    closeThreads();
+}
+
+uint32_t AsyncProgramBuildsHandler::getWorkersCount() {
+    auto workersCount = debugManager.flags.AsyncProgramBuildWorkers.get();
+    return workersCount > 0 ? static_cast<uint32_t>(workersCount) : 0u;
+}
+
+void AsyncProgramBuildsHandler::registerBuild(Program *program, const ClDeviceVector &deviceVector, const char *buildOptions, NotifyFunctionT funcNotify, void *userData) {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+    // Create on first use
+    openThreads();
+
+    BuildTask task;
+    task.program = program;
+    task.deviceVector = deviceVector;
+    task.hasBuildOptions = (buildOptions != nullptr);
+    if (task.hasBuildOptions) {
+        task.buildOptions = buildOptions;
+    }
+    task.funcNotify = funcNotify;
+    task.userData = userData;
+
+    tasks.push_back(std::move(task));
+    asyncCond.notify_one();
+}
+
+void *AsyncProgramBuildsHandler::asyncProcess(void *arg) {
+    auto self = reinterpret_cast<AsyncProgramBuildsHandler *>(arg);
+    std::unique_lock<std::mutex> lock(self->asyncMtx);
+
+    while (true) {
+        self->asyncCond.wait(lock, [self] { return !self->tasks.empty() || !self->allowAsyncProcess; });
+        if (self->tasks.empty()) {
+            // builds scheduled before closing are still completed, so every registered callback is invoked
+            break;
+        }
+
+        auto task = std::move(self->tasks.front());
+        self->tasks.pop_front();
+        lock.unlock();
+
+        self->processTask(task);
+
+        lock.lock();
+    }
+    return nullptr;
+}
+
+void AsyncProgramBuildsHandler::processTask(BuildTask &task) {
+    task.program->processAsyncBuild(task.deviceVector, task.hasBuildOptions ? task.buildOptions.c_str() : nullptr, task.funcNotify, task.userData);
+}
+
+void AsyncProgramBuildsHandler::closeThreads() {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+    if (allowAsyncProcess) {
+        allowAsyncProcess = false;
+        asyncCond.notify_all();
+        lock.unlock();
+        for (auto &thread : threads) {
+            thread->join();
+        }
+        threads.clear();
+    }
+}
+
+void AsyncProgramBuildsHandler::openThreads() {
+    if (threads.empty()) {
+        DEBUG_BREAK_IF(allowAsyncProcess);
+        allowAsyncProcess = true;
+        auto workersCount = std::max(getWorkersCount(), 1u);
+        for (uint32_t i = 0; i < workersCount; i++) {
+            threads.push_back(Thread::create(asyncProcess, reinterpret_cast<void *>(this)));
+        }
+    }
+}
+} // namespace NEO
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "opencl/source/cl_device/cl_device_vector.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class Program;
+class Thread;
+
+class AsyncProgramBuildsHandler {
+  public:
+    using NotifyFunctionT = void(CL_CALLBACK *)(cl_program program, void *userData);
+
+    AsyncProgramBuildsHandler();
+    virtual ~AsyncProgramBuildsHandler();
+
+    static uint32_t getWorkersCount();
+
+    void registerBuild(Program *program, const ClDeviceVector &deviceVector, const char *buildOptions, NotifyFunctionT funcNotify, void *userData);
+    void closeThreads();
+
+  protected:
+    struct BuildTask {
+        Program *program = nullptr;
+        ClDeviceVector deviceVector;
+        std::string buildOptions;
+        bool hasBuildOptions = false;
+        NotifyFunctionT funcNotify = nullptr;
+        void *userData = nullptr;
+    };
+
+    static void *asyncProcess(void *arg);
+    MOCKABLE_VIRTUAL void processTask(BuildTask &task);
+    MOCKABLE_VIRTUAL void openThreads();
+
+    std::deque<BuildTask> tasks;
+    std::vector<std::unique_ptr<Thread>> threads;
+    std::mutex asyncMtx;
+    std::condition_variable asyncCond;
+    bool allowAsyncProcess = false;
+};
+} // namespace NEO
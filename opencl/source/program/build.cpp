@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,20 +19,37 @@
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
+#include "opencl/source/execution_environment/cl_execution_environment.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/helpers/cl_validators.h"
 #include "opencl/source/platform/platform.h"
+#include "opencl/source/program/async_program_builds_handler.h"
 #include "opencl/source/program/program.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iterator>
 #include <sstream>
+#include <thread>
 
 namespace NEO {
 
 cl_int Program::build(
     const ClDeviceVector &deviceVector,
     const char *buildOptions) {
+    return buildImpl(deviceVector, buildOptions, false);
+}
+
+cl_int Program::buildImpl(const ClDeviceVector &deviceVector, const char *buildOptions, bool scheduledByBuildAsync) {
+    {
+        // build scheduled by buildAsync is already marked as in progress, any other build must not run concurrently with it
+        std::unique_lock<std::mutex> lock{lockMutex};
+        if (!scheduledByBuildAsync &&
+            (asyncBuildScheduled || std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; }))) {
+            return CL_INVALID_OPERATION;
+        }
+    }
+
     cl_int retVal = CL_SUCCESS;
     auto internalOptions = getInternalOptions();
     auto defaultClDevice = deviceVector[0];
@@ -44,12 +61,6 @@ cl_int Program::build(
         phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::init;
     }
     do {
-        // check to see if a previous build request is in progress
-        if (std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; })) {
-            retVal = CL_INVALID_OPERATION;
-            break;
-        }
-
         if (isCreatedFromBinary == false) {
             for (const auto &device : deviceVector) {
                 deviceBuildInfos[device].buildStatus = CL_BUILD_IN_PROGRESS;
@@ -113,31 +124,86 @@ cl_int Program::build(
             DBG_LOG(LogApiCalls,
                     "Build Options", inputArgs.apiOptions.begin(),
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
-            NEO::TranslationOutput compilerOuput = {};
 
+            // devices of the same root device share build state, so only builds for different root devices may run in parallel
+            struct RootDeviceBuild {
+                std::vector<ClDevice *> devices;
+                cl_int retVal = CL_SUCCESS;
+                std::unique_ptr<char[]> irBinary;
+                size_t irBinarySize = 0;
+                bool isSpirV = false;
+                bool hasIrBinary = false;
+            };
+            std::vector<RootDeviceBuild> rootDeviceBuilds;
             for (const auto &clDevice : deviceVector) {
-                if (requiresRebuild && !shouldSuppressRebuildWarning) {
-                    this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
+                auto rootDeviceBuild = std::find_if(rootDeviceBuilds.begin(), rootDeviceBuilds.end(), [&](const auto &build) {
+                    return build.devices[0]->getRootDeviceIndex() == clDevice->getRootDeviceIndex();
+                });
+                if (rootDeviceBuild == rootDeviceBuilds.end()) {
+                    rootDeviceBuilds.emplace_back();
+                    rootDeviceBuild = rootDeviceBuilds.end() - 1;
+                }
+                rootDeviceBuild->devices.push_back(clDevice);
+            }
+
+            auto buildForRootDevice = [&](RootDeviceBuild &rootDeviceBuild) {
+                NEO::TranslationOutput compilerOuput = {};
+                for (const auto &clDevice : rootDeviceBuild.devices) {
+                    if (requiresRebuild && !shouldSuppressRebuildWarning) {
+                        this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
+                    }
+                    auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
+                    this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
+                    this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
+                    rootDeviceBuild.retVal = asClError(compilerErr);
+                    if (rootDeviceBuild.retVal != CL_SUCCESS) {
+                        break;
+                    }
+                    if (inputArgs.srcType == IGC::CodeType::oclC) {
+                        rootDeviceBuild.irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
+                        rootDeviceBuild.irBinarySize = compilerOuput.intermediateRepresentation.size;
+                        rootDeviceBuild.isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
+                        rootDeviceBuild.hasIrBinary = true;
+                    }
+                    this->buildInfos[clDevice->getRootDeviceIndex()].debugData = std::move(compilerOuput.debugData.mem);
+                    this->buildInfos[clDevice->getRootDeviceIndex()].debugDataSize = compilerOuput.debugData.size;
+                    auto &rootDevicePhase = phaseReached.at(clDevice->getRootDeviceIndex());
+                    if (BuildPhase::binaryCreation == rootDevicePhase) {
+                        continue;
+                    }
+                    this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
+                    rootDevicePhase = BuildPhase::binaryCreation;
+                }
+            };
+
+            if ((debugManager.flags.EnableParallelProgramBuildForRootDevices.get() == 1) && (rootDeviceBuilds.size() > 1)) {
+                std::vector<std::thread> buildThreads;
+                for (size_t i = 1; i < rootDeviceBuilds.size(); i++) {
+                    buildThreads.emplace_back(buildForRootDevice, std::ref(rootDeviceBuilds[i]));
+                }
+                buildForRootDevice(rootDeviceBuilds[0]);
+                for (auto &buildThread : buildThreads) {
+                    buildThread.join();
+                }
+            } else {
+                for (auto &rootDeviceBuild : rootDeviceBuilds) {
+                    buildForRootDevice(rootDeviceBuild);
+                    if (rootDeviceBuild.retVal != CL_SUCCESS) {
+                        break;
+                    }
                 }
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
-                retVal = asClError(compilerErr);
+            }
+
+            for (auto &rootDeviceBuild : rootDeviceBuilds) {
+                retVal = rootDeviceBuild.retVal;
                 if (retVal != CL_SUCCESS) {
                     break;
                 }
-                if (inputArgs.srcType == IGC::CodeType::oclC) {
-                    this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
-                    this->irBinarySize = compilerOuput.intermediateRepresentation.size;
-                    this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
-                }
-                this->buildInfos[clDevice->getRootDeviceIndex()].debugData = std::move(compilerOuput.debugData.mem);
-                this->buildInfos[clDevice->getRootDeviceIndex()].debugDataSize = compilerOuput.debugData.size;
-                if (BuildPhase::binaryCreation == phaseReached[clDevice->getRootDeviceIndex()]) {
-                    continue;
+                if (rootDeviceBuild.hasIrBinary) {
+                    this->irBinary = std::move(rootDeviceBuild.irBinary);
+                    this->irBinarySize = rootDeviceBuild.irBinarySize;
+                    this->isSpirV = rootDeviceBuild.isSpirV;
                 }
-                this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
-                phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::binaryCreation;
             }
             if (retVal != CL_SUCCESS) {
                 break;
@@ -182,6 +248,39 @@ cl_int Program::build(
     return retVal;
 }
 
+cl_int Program::buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions,
+                          void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData) {
+    {
+        std::unique_lock<std::mutex> lock{lockMutex};
+        if (asyncBuildScheduled || (0 != exposedKernels) ||
+            std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; })) {
+            return CL_INVALID_OPERATION;
+        }
+        asyncBuildScheduled = true;
+        for (const auto &device : deviceVector) {
+            deviceBuildInfos[device].buildStatus = CL_BUILD_IN_PROGRESS;
+        }
+    }
+
+    // released after build completes and callback is invoked
+    this->retain();
+
+    auto clExecutionEnvironment = static_cast<ClExecutionEnvironment *>(deviceVector[0]->getExecutionEnvironment());
+    clExecutionEnvironment->getAsyncProgramBuildsHandler()->registerBuild(this, deviceVector, buildOptions, funcNotify, userData);
+    return CL_SUCCESS;
+}
+
+void Program::processAsyncBuild(const ClDeviceVector &deviceVector, const char *buildOptions,
+                                void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData) {
+    this->buildImpl(deviceVector, buildOptions, true);
+    {
+        std::unique_lock<std::mutex> lock{lockMutex};
+        asyncBuildScheduled = false;
+    }
+    this->invokeCallback(funcNotify, userData);
+    this->release();
+}
+
 cl_int Program::build(const ClDeviceVector &deviceVector, const char *buildOptions,
                       std::unordered_map<std::string, BuiltinDispatchInfoBuilder *> &builtinsMap) {
     auto ret = this->build(deviceVector, buildOptions);
@@ -133,6 +133,11 @@ class Program : public BaseObject<_cl_program> {
     cl_int build(const ClDeviceVector &deviceVector, const char *buildOptions,
                  std::unordered_map<std::string, BuiltinDispatchInfoBuilder *> &builtinsMap);
 
+    cl_int buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions,
+                      void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
+    void processAsyncBuild(const ClDeviceVector &deviceVector, const char *buildOptions,
+                           void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
+
     cl_int processGenBinaries(const ClDeviceVector &clDevices, std::unordered_map<uint32_t, BuildPhase> &phaseReached);
     MOCKABLE_VIRTUAL cl_int processGenBinary(const ClDevice &clDevice);
     MOCKABLE_VIRTUAL cl_int processProgramInfo(ProgramInfo &dst, const ClDevice &clDevice);
@@ -259,7 +264,7 @@ class Program : public BaseObject<_cl_program> {
     }
     bool isLocked() {
         std::unique_lock<std::mutex> lock{lockMutex};
-        return 0 != exposedKernels;
+        return (0 != exposedKernels) || asyncBuildScheduled;
     }
     bool getCreatedFromBinary() const {
         return isCreatedFromBinary;
@@ -380,6 +385,7 @@ class Program : public BaseObject<_cl_program> {
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     std::mutex lockMutex;
     uint32_t exposedKernels = 0;
+    bool asyncBuildScheduled = false;
 
     size_t exportedFunctionsKernelId = std::numeric_limits<size_t>::max();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/utilities/api_flight_recorder.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
 #include "opencl/source/tracing/tracing_handle.h"
@@ -30,6 +31,8 @@ namespace HostSideTracing {
 inline thread_local bool tracingInProgress = false;
 
 #define TRACING_ENTER(name, ...)                                                                                                                   \
+    NEO::ApiFlightRecorderCall apiFlightRecorderCall_##name(#name);                                                                                \
+    apiFlightRecorderCall_##name.enter(__VA_ARGS__);                                                                                               \
     bool isHostSideTracingEnabled_##name = false;                                                                                                  \
     bool currentlyTracedCall = false;                                                                                                              \
     HostSideTracing::name##Tracer tracer_##name;                                                                                                   \
@@ -43,6 +46,7 @@ inline thread_local bool tracingInProgress = false;
     }
 
 #define TRACING_EXIT(name, ...)                     \
+    apiFlightRecorderCall_##name.exit(__VA_ARGS__); \
     if (currentlyTracedCall) {                      \
         if (isHostSideTracingEnabled_##name) {      \
             tracer_##name.exit(__VA_ARGS__);        \
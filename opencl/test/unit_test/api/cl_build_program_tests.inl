@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,6 +18,9 @@
 
 #include "cl_api_tests.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace NEO;
 
 struct ClBuildProgramTests : public ApiTests {
@@ -447,6 +450,82 @@ TEST_F(ClBuildProgramTests, GivenValidCallbackInputWhenBuildProgramThenCallbackI
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST_F(ClBuildProgramTests, GivenAsyncProgramBuildsEnabledWhenBuildProgramWithCallbackThenProgramIsBuiltInBackgroundAndCallbackIsInvoked) {
+    debugManager.flags.AsyncProgramBuildWorkers.set(2);
+
+    cl_program pProgram = nullptr;
+    cl_int binaryStatus = CL_SUCCESS;
+
+    constexpr auto numBits = is32bit ? Elf::EI_CLASS_32 : Elf::EI_CLASS_64;
+    auto zebinData = std::make_unique<ZebinTestData::ZebinCopyBufferSimdModule<numBits>>(pDevice->getHardwareInfo(), 16);
+    const auto &src = zebinData->storage;
+    const size_t binarySize = src.size();
+
+    const unsigned char *binaries[1] = {reinterpret_cast<const unsigned char *>(src.data())};
+    pProgram = clCreateProgramWithBinary(
+        pContext,
+        1,
+        &testedClDevice,
+        &binarySize,
+        binaries,
+        &binaryStatus,
+        &retVal);
+
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, pProgram);
+
+    std::atomic<uint32_t> callbacksCount = 0;
+    auto notifyFunc = [](cl_program, void *userData) -> void {
+        reinterpret_cast<std::atomic<uint32_t> *>(userData)->fetch_add(1);
+    };
+
+    retVal = clBuildProgram(
+        pProgram,
+        1,
+        &testedClDevice,
+        nullptr,
+        notifyFunc,
+        &callbacksCount);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    while (callbacksCount.load() == 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(1u, callbacksCount.load());
+
+    cl_build_status buildStatus = CL_BUILD_NONE;
+    retVal = clGetProgramBuildInfo(pProgram, testedClDevice, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST_F(ClBuildProgramTests, GivenAsyncBuildScheduledWhenBuildingProgramAgainThenInvalidOperationErrorIsReturned) {
+    auto mockProgram = std::make_unique<MockProgram>(pContext, false, toClDeviceVector(*pDevice));
+    EXPECT_FALSE(mockProgram->isLocked());
+
+    mockProgram->asyncBuildScheduled = true;
+    EXPECT_TRUE(mockProgram->isLocked());
+
+    retVal = clBuildProgram(
+        mockProgram.get(),
+        1,
+        &testedClDevice,
+        nullptr,
+        nullptr,
+        nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(CL_BUILD_NONE, mockProgram->deviceBuildInfos[mockProgram->getDevices()[0]].buildStatus);
+
+    retVal = mockProgram->buildAsync(mockProgram->getDevices(), nullptr, notifyFuncProgram, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(CL_BUILD_NONE, mockProgram->deviceBuildInfos[mockProgram->getDevices()[0]].buildStatus);
+
+    mockProgram->asyncBuildScheduled = false;
+}
+
 TEST_F(ClBuildProgramTests, givenProgramWhenBuildingForInvalidDevicesInputThenInvalidDeviceErrorIsReturned) {
     cl_program pProgram = nullptr;
     size_t sourceSize = 0;
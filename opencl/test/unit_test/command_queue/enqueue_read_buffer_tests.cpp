@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -827,3 +827,112 @@ HWTEST_F(EnqueueReadBufferHw, givenHostPtrIsFromMappedBufferWhenReadBufferIsCall
     EXPECT_EQ(CL_SUCCESS, retVal);
     EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
 }
+
+HWTEST_F(EnqueueReadBufferHw, givenHostPtrStagingRingEnabledWhenBlockingReadBufferToNonUsmHostPtrThenDataIsCopiedFromStagingChunkWithoutHostPtrAllocation) {
+    if (device->getDeviceInfo().svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restore{};
+    debugManager.flags.DisableZeroCopyForBuffers.set(1);
+    debugManager.flags.DoCpuCopyOnReadBuffer.set(0);
+    debugManager.flags.EnableDeviceUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostPtrStagingRing.set(1);
+    debugManager.flags.HostPtrStagingRingChunkSize.set(4);
+    context->initializeUsmAllocationPools();
+    auto &stagingRing = context->getHostPtrStagingRing();
+    ASSERT_TRUE(stagingRing.isInitialized());
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    BufferDefaults::context = context.get();
+    auto buffer = clUniquePtr(BufferHelper<>::create());
+    const auto size = buffer->getSize();
+
+    // staging chunk content stands for data copied by GPU
+    auto ringPtr = stagingRing.getAllocation(device->getRootDeviceIndex())->getUnderlyingBuffer();
+    memset(ringPtr, 0x5a, size);
+    auto hostPtr = std::make_unique<char[]>(size);
+    memset(hostPtr.get(), 0, size);
+
+    auto retVal = queue.enqueueReadBuffer(buffer.get(), CL_TRUE, 0, size, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, csr.createAllocationForHostSurfaceCalled);
+    EXPECT_EQ(0, memcmp(ringPtr, hostPtr.get(), size));
+}
+
+HWTEST_F(EnqueueReadBufferHw, givenHostPtrStagingRingEnabledWhenReadBufferIsNonBlockingOrReturnsEventThenHostPtrAllocationIsCreated) {
+    if (device->getDeviceInfo().svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restore{};
+    debugManager.flags.DisableZeroCopyForBuffers.set(1);
+    debugManager.flags.DoCpuCopyOnReadBuffer.set(0);
+    debugManager.flags.EnableDeviceUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostPtrStagingRing.set(1);
+    context->initializeUsmAllocationPools();
+    ASSERT_TRUE(context->getHostPtrStagingRing().isInitialized());
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    BufferDefaults::context = context.get();
+    auto buffer = clUniquePtr(BufferHelper<>::create());
+    const auto size = buffer->getSize();
+    auto hostPtr = std::make_unique<char[]>(size);
+
+    auto retVal = queue.enqueueReadBuffer(buffer.get(), CL_FALSE, 0, size, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
+
+    cl_event event = nullptr;
+    retVal = queue.enqueueReadBuffer(buffer.get(), CL_TRUE, 0, size, hostPtr.get(), nullptr, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(2u, csr.createAllocationForHostSurfaceCalled);
+    clReleaseEvent(event);
+}
+
+HWTEST_F(EnqueueReadBufferHw, givenHostPtrStagingRingEnabledWhenBlockingReadBufferLargerThanChunkThenEachChunkIsCopiedToHostPtrAfterItsCopyCompletes) {
+    if (device->getDeviceInfo().svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restore{};
+    debugManager.flags.DisableZeroCopyForBuffers.set(1);
+    debugManager.flags.DoCpuCopyOnReadBuffer.set(0);
+    debugManager.flags.EnableDeviceUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostPtrStagingRing.set(1);
+    debugManager.flags.HostPtrStagingRingChunkSize.set(4);
+    debugManager.flags.HostPtrStagingRingChunkCount.set(3);
+    context->initializeUsmAllocationPools();
+    auto &stagingRing = context->getHostPtrStagingRing();
+    ASSERT_TRUE(stagingRing.isInitialized());
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    const size_t size = 2 * 4 * MemoryConstants::kiloByte + 1;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr(Buffer::create(context.get(), CL_MEM_READ_WRITE, size, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+
+    // staging chunks content stands for data copied by GPU
+    auto ringPtr = static_cast<char *>(stagingRing.getAllocation(device->getRootDeviceIndex())->getUnderlyingBuffer());
+    for (size_t i = 0; i < size; i++) {
+        ringPtr[i] = static_cast<char>(i);
+    }
+    auto hostPtr = std::make_unique<char[]>(size);
+    memset(hostPtr.get(), 0, size);
+    const auto taskCountBefore = csr.peekTaskCount();
+
+    retVal = queue.enqueueReadBuffer(buffer.get(), CL_TRUE, 0, size, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, csr.createAllocationForHostSurfaceCalled);
+    EXPECT_EQ(taskCountBefore + 3, csr.peekTaskCount());
+    EXPECT_EQ(0, memcmp(ringPtr, hostPtr.get(), size));
+
+    HostPtrStagingRing::Chunks chunks;
+    EXPECT_TRUE(stagingRing.acquireChunks(size, chunks));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -612,3 +612,118 @@ HWTEST_F(EnqueueWriteBufferHw, givenHostPtrIsFromMappedBufferWhenWriteBufferIsCa
     EXPECT_EQ(CL_SUCCESS, retVal);
     EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
 }
+
+HWTEST_F(EnqueueWriteBufferHw, givenHostPtrStagingRingEnabledWhenWritingBufferFromNonUsmHostPtrThenDataIsCopiedThroughConsecutiveChunksWithoutHostPtrAllocation) {
+    if (device->getDeviceInfo().svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restore{};
+    debugManager.flags.DisableZeroCopyForBuffers.set(1);
+    debugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    debugManager.flags.EnableDeviceUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostPtrStagingRing.set(1);
+    debugManager.flags.HostPtrStagingRingChunkSize.set(4);
+    debugManager.flags.HostPtrStagingRingChunkCount.set(2);
+    context->initializeUsmAllocationPools();
+    auto &stagingRing = context->getHostPtrStagingRing();
+    ASSERT_TRUE(stagingRing.isInitialized());
+    auto ringAllocation = stagingRing.getAllocation(device->getRootDeviceIndex());
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    BufferDefaults::context = context.get();
+    auto buffer = clUniquePtr(BufferHelper<>::create());
+    const auto size = buffer->getSize();
+
+    auto hostPtr = std::make_unique<char[]>(size);
+    memset(hostPtr.get(), 0x5a, size);
+    auto retVal = queue.enqueueWriteBuffer(buffer.get(), CL_TRUE, 0, size, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, csr.createAllocationForHostSurfaceCalled);
+    EXPECT_EQ(0, memcmp(ringAllocation->getUnderlyingBuffer(), hostPtr.get(), size));
+    EXPECT_EQ(csr.peekTaskCount(), ringAllocation->getTaskCount(csr.getOsContext().getContextId()));
+
+    memset(hostPtr.get(), 0xa5, size);
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_FALSE, 0, size, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, csr.createAllocationForHostSurfaceCalled);
+    EXPECT_EQ(0, memcmp(ptrOffset(ringAllocation->getUnderlyingBuffer(), stagingRing.getChunkSize()), hostPtr.get(), size));
+}
+
+HWTEST_F(EnqueueWriteBufferHw, givenHostPtrStagingRingEnabledWhenWritingMoreThanChunkSizeThenTransferIsSplitIntoPerChunkCopies) {
+    if (device->getDeviceInfo().svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restore{};
+    debugManager.flags.DisableZeroCopyForBuffers.set(1);
+    debugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    debugManager.flags.EnableDeviceUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostPtrStagingRing.set(1);
+    debugManager.flags.HostPtrStagingRingChunkSize.set(4);
+    debugManager.flags.HostPtrStagingRingChunkCount.set(3);
+    context->initializeUsmAllocationPools();
+    auto &stagingRing = context->getHostPtrStagingRing();
+    ASSERT_TRUE(stagingRing.isInitialized());
+    auto ringPtr = stagingRing.getAllocation(device->getRootDeviceIndex())->getUnderlyingBuffer();
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    const size_t size = 2 * MemoryConstants::kiloByte * 4 + 1;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr(Buffer::create(context.get(), CL_MEM_READ_WRITE, size, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    auto hostPtr = std::make_unique<char[]>(size);
+    for (size_t i = 0; i < size; i++) {
+        hostPtr[i] = static_cast<char>(i);
+    }
+    const auto taskCountBefore = csr.peekTaskCount();
+
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_TRUE, 0, size, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, csr.createAllocationForHostSurfaceCalled);
+    EXPECT_EQ(taskCountBefore + 3, csr.peekTaskCount());
+    EXPECT_EQ(0, memcmp(ringPtr, hostPtr.get(), size));
+
+    auto oversizedBuffer = clUniquePtr(Buffer::create(context.get(), CL_MEM_READ_WRITE, 3 * 4 * MemoryConstants::kiloByte + 1, nullptr, retVal));
+    ASSERT_NE(nullptr, oversizedBuffer);
+    auto oversizedHostPtr = std::make_unique<char[]>(oversizedBuffer->getSize());
+    retVal = queue.enqueueWriteBuffer(oversizedBuffer.get(), CL_FALSE, 0, oversizedBuffer->getSize(), oversizedHostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
+}
+
+HWTEST_F(EnqueueWriteBufferHw, givenHostPtrStagingRingEnabledAndOutOfOrderQueueWhenWritingMoreThanChunkSizeThenHostPtrAllocationIsCreated) {
+    if (device->getDeviceInfo().svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restore{};
+    debugManager.flags.DisableZeroCopyForBuffers.set(1);
+    debugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    debugManager.flags.EnableDeviceUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostPtrStagingRing.set(1);
+    debugManager.flags.HostPtrStagingRingChunkSize.set(4);
+    context->initializeUsmAllocationPools();
+    ASSERT_TRUE(context->getHostPtrStagingRing().isInitialized());
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), properties);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    const size_t size = 4 * MemoryConstants::kiloByte + 1;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr(Buffer::create(context.get(), CL_MEM_READ_WRITE, size, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    auto hostPtr = std::make_unique<char[]>(size);
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_FALSE, 0, size, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
+
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_FALSE, 0, 4 * MemoryConstants::kiloByte, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
+}
@@ -95,4 +95,32 @@ TEST_F(ContextUsmPoolEnabledFlagsTest, givenEnabledDebugFlagsWhenCreatingContext
     EXPECT_EQ(CL_SUCCESS, retVal);
     EXPECT_NE(nullptr, pooledHostAlloc);
     clMemFreeINTEL(mockContext.get(), pooledHostAlloc);
-}
\ No newline at end of file
+}
+
+TEST(ContextHostPtrStagingRingTest, givenStagingRingDebugFlagsWhenInitializingUsmAllocationPoolsThenStagingRingIsInitializedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDeviceUsmAllocationPool.set(0);
+    debugManager.flags.EnableHostUsmAllocationPool.set(0);
+    auto mockContext = std::make_unique<MockContext>();
+    if (mockContext->getDevice(0u)->getDeviceInfo().svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    auto &stagingRing = mockContext->getHostPtrStagingRing();
+
+    mockContext->initializeUsmAllocationPools();
+    EXPECT_FALSE(stagingRing.isInitialized());
+
+    debugManager.flags.EnableHostPtrStagingRing.set(1);
+    debugManager.flags.HostPtrStagingRingChunkSize.set(8);
+    debugManager.flags.HostPtrStagingRingChunkCount.set(3);
+    mockContext->initializeUsmAllocationPools();
+    EXPECT_TRUE(stagingRing.isInitialized());
+    EXPECT_EQ(8 * MemoryConstants::kiloByte, stagingRing.getChunkSize());
+    EXPECT_NE(nullptr, stagingRing.getAllocation(mockContext->getDevice(0u)->getRootDeviceIndex()));
+    EXPECT_EQ(3u, stagingRing.getChunkCount());
+    EXPECT_TRUE(stagingRing.canBeStaged(3 * 8 * MemoryConstants::kiloByte));
+    EXPECT_FALSE(stagingRing.canBeStaged(3 * 8 * MemoryConstants::kiloByte + 1));
+
+    mockContext->cleanupUsmAllocationPools();
+    EXPECT_FALSE(stagingRing.isInitialized());
+}
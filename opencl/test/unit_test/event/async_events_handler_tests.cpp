@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -388,3 +388,92 @@ TEST_F(AsyncEventsHandlerTests, WhenReturningThenAsyncProcessWillCallProcessList
 
     event->release();
 }
+
+TEST_F(AsyncEventsHandlerTests, givenTaskCountHeapsDisabledByDefaultWhenHandlerIsCreatedThenHeapsAreNotUsed) {
+    MockHandler myHandler;
+    EXPECT_FALSE(myHandler.useTaskCountHeaps);
+
+    debugManager.flags.AsyncEventsHandlerUseTaskCountHeaps.set(1);
+    MockHandler myHandlerWithHeaps;
+    EXPECT_TRUE(myHandlerWithHeaps.useTaskCountHeaps);
+}
+
+TEST_F(AsyncEventsHandlerTests, givenTaskCountHeapsEnabledWhenSubmittedEventsAreProcessedThenOnlyCompletedTaskCountsAreFired) {
+    debugManager.flags.AsyncEventsHandlerUseTaskCountHeaps.set(1);
+    auto myHandler = std::make_unique<MockHandler>();
+    auto tagAddress = commandQueue->getGpgpuCommandStreamReceiver().getTagAddress();
+
+    int event1Counter(0), event2Counter(0), event3Counter(0);
+    event1->setTaskStamp(0, 1);
+    event2->setTaskStamp(0, 2);
+    event3->setTaskStamp(0, 3);
+    event3->addCallback(&this->callbackFcn, CL_COMPLETE, &event3Counter);
+    myHandler->registerEvent(event3.get());
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    myHandler->registerEvent(event1.get());
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    myHandler->registerEvent(event2.get());
+
+    auto sleepCandidate = myHandler->process();
+    EXPECT_EQ(event1.get(), sleepCandidate);
+    EXPECT_TRUE(myHandler->peekIsListEmpty());
+    ASSERT_EQ(1u, myHandler->completionHeaps.size());
+    EXPECT_EQ(3u, myHandler->completionHeaps.begin()->second.size());
+
+    *tagAddress = 2;
+    sleepCandidate = myHandler->process();
+    EXPECT_EQ(event3.get(), sleepCandidate);
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(0, event3Counter);
+    EXPECT_EQ(1u, myHandler->completionHeaps.begin()->second.size());
+    EXPECT_EQ(1, event1->getRefInternalCount());
+    EXPECT_EQ(1, event2->getRefInternalCount());
+
+    *tagAddress = 3;
+    sleepCandidate = myHandler->process();
+    EXPECT_EQ(nullptr, sleepCandidate);
+    EXPECT_EQ(1, event3Counter);
+    EXPECT_TRUE(myHandler->completionHeaps.empty());
+    EXPECT_TRUE(myHandler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenTaskCountHeapsEnabledWhenEventIsNotSubmittedThenItStaysOnPolledList) {
+    debugManager.flags.AsyncEventsHandlerUseTaskCountHeaps.set(1);
+    auto myHandler = std::make_unique<MockHandler>();
+
+    int submittedCounter(0), completeCounter(0);
+    event1->setTaskStamp(CompletionStamp::notReady, 0);
+    event1->addCallback(&this->callbackFcn, CL_SUBMITTED, &submittedCounter);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &completeCounter);
+    myHandler->registerEvent(event1.get());
+
+    myHandler->process();
+    EXPECT_FALSE(myHandler->peekIsListEmpty());
+    EXPECT_TRUE(myHandler->completionHeaps.empty());
+
+    event1->setStatus(CL_COMPLETE);
+    myHandler->process();
+    EXPECT_EQ(1, submittedCounter);
+    EXPECT_EQ(1, completeCounter);
+    EXPECT_TRUE(myHandler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenTaskCountHeapsEnabledWhenEventsAreInHeapsAndAsyncProcessIsInterruptedThenUnreferenceAll) {
+    debugManager.flags.AsyncEventsHandlerUseTaskCountHeaps.set(1);
+    auto myHandler = std::make_unique<MockHandler>();
+
+    event1->setTaskStamp(0, 1);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    myHandler->registerEvent(event1.get());
+    myHandler->process();
+    EXPECT_FALSE(myHandler->completionHeaps.empty());
+    EXPECT_EQ(3, event1->getRefInternalCount());
+
+    myHandler->allowAsyncProcess.store(false);
+    MockHandler::asyncProcess(myHandler.get());
+    EXPECT_TRUE(myHandler->completionHeaps.empty());
+    EXPECT_EQ(2, event1->getRefInternalCount());
+
+    event1->setStatus(CL_COMPLETE);
+}
@@ -1719,6 +1719,137 @@ HWTEST_F(EventTest, givenEventWithNotReadyTaskLevelWhenUnblockedThenGetTaskLevel
     EXPECT_EQ(csr.taskLevel, childEvent1.getTaskLevel());
 }
 
+HWTEST_F(EventTest, givenEventsReadyQueueEnabledWhenChainOfEventsIsUnblockedThenAllEventsAreSubmittedWithIncreasingTaskLevels) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.ExperimentalEnableEventsReadyQueue.set(1);
+
+    constexpr uint32_t chainLength = 64;
+    auto &metrics = pCmdQ->getContext().getEventsReadyQueueMetrics();
+    metrics.reset();
+
+    auto &csr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> &>(pCmdQ->getGpgpuCommandStreamReceiver());
+    csr.taskLevel = 1;
+
+    Event parentEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 5, 0);
+    std::vector<std::unique_ptr<Event>> chain;
+    Event *previousEvent = &parentEvent;
+    for (uint32_t i = 0; i < chainLength; i++) {
+        chain.push_back(std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady));
+        previousEvent->addChild(*chain.back());
+        previousEvent = chain.back().get();
+    }
+
+    parentEvent.setStatus(CL_COMPLETE);
+
+    for (uint32_t i = 0; i < chainLength; i++) {
+        EXPECT_EQ(0u, chain[i]->peekNumEventsBlockingThis());
+        EXPECT_FALSE(chain[i]->peekIsBlocked());
+        EXPECT_EQ(parentEvent.getTaskLevel() + i + 1, chain[i]->getTaskLevel());
+    }
+    EXPECT_EQ(chainLength, metrics.unblockedEvents.load());
+    EXPECT_EQ(chainLength, metrics.maxDependencyDepth.load());
+
+    metrics.reset();
+    EXPECT_EQ(0u, metrics.unblockedEvents.load());
+    EXPECT_EQ(0u, metrics.maxDependencyDepth.load());
+    EXPECT_EQ(0u, metrics.maxReadyQueueSize.load());
+    EXPECT_EQ(0u, metrics.totalReadyQueueLatencyNs.load());
+    EXPECT_EQ(0u, metrics.maxReadyQueueLatencyNs.load());
+}
+
+HWTEST_F(EventTest, givenEventsReadyQueueEnabledWhenEventWithManyChildrenIsCompletedThenChildrenAreUnblockedLikeWithRecursiveUnblocking) {
+    constexpr uint32_t childrenCount = 8;
+    auto &csr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> &>(pCmdQ->getGpgpuCommandStreamReceiver());
+    csr.taskLevel = 3;
+
+    TaskCountType taskLevels[2][childrenCount] = {};
+    for (int32_t readyQueueEnabled = 0; readyQueueEnabled < 2; readyQueueEnabled++) {
+        DebugManagerStateRestore stateRestore;
+        debugManager.flags.ExperimentalEnableEventsReadyQueue.set(readyQueueEnabled);
+        auto &metrics = pCmdQ->getContext().getEventsReadyQueueMetrics();
+        metrics.reset();
+
+        Event parentEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 10, 0);
+        std::vector<std::unique_ptr<Event>> children;
+        for (uint32_t i = 0; i < childrenCount; i++) {
+            children.push_back(std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady));
+            parentEvent.addChild(*children.back());
+        }
+
+        parentEvent.setStatus(CL_COMPLETE);
+
+        for (uint32_t i = 0; i < childrenCount; i++) {
+            EXPECT_FALSE(children[i]->peekIsBlocked());
+            taskLevels[readyQueueEnabled][i] = children[i]->getTaskLevel();
+        }
+        auto expectedUnblockedEvents = readyQueueEnabled ? childrenCount : 0u;
+        EXPECT_EQ(expectedUnblockedEvents, metrics.unblockedEvents.load());
+    }
+
+    for (uint32_t i = 0; i < childrenCount; i++) {
+        EXPECT_EQ(taskLevels[0][i], taskLevels[1][i]);
+    }
+}
+
+HWTEST_F(EventTest, givenEventsReadyQueueEnabledWhenEventIsAbortedThenTerminationStatusIsPropagatedThroughWholeChain) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.ExperimentalEnableEventsReadyQueue.set(1);
+
+    UserEvent userEvent(&mockContext);
+    Event childEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady);
+    Event grandChildEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady);
+    userEvent.addChild(childEvent);
+    childEvent.addChild(grandChildEvent);
+
+    userEvent.setStatus(-1);
+
+    EXPECT_TRUE(childEvent.isStatusCompletedByTermination(childEvent.peekExecutionStatus()));
+    EXPECT_TRUE(grandChildEvent.isStatusCompletedByTermination(grandChildEvent.peekExecutionStatus()));
+}
+
+TEST_F(EventTest, givenEventsReadyQueueWhenAbortedTreeIsUnblockedThenCallbacksRunInSameOrderAsWithRecursiveUnblocking) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.EnableAsyncEventsHandler.set(false);
+
+    static std::vector<std::string> callbacksOrder;
+    auto callback = [](cl_event event, cl_int status, void *userData) -> void {
+        callbacksOrder.push_back(static_cast<const char *>(userData));
+    };
+    const char *childNames[] = {"child0", "child1"};
+    const char *grandChildNames[] = {"grandChild00", "grandChild01", "grandChild10", "grandChild11"};
+
+    std::vector<std::string> recursiveOrder;
+    for (int32_t readyQueueEnabled = 0; readyQueueEnabled < 2; readyQueueEnabled++) {
+        debugManager.flags.ExperimentalEnableEventsReadyQueue.set(readyQueueEnabled);
+        callbacksOrder.clear();
+
+        UserEvent userEvent(&mockContext);
+        std::vector<std::unique_ptr<Event>> events;
+        for (uint32_t i = 0; i < 2; i++) {
+            events.push_back(std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady));
+            auto child = events.back().get();
+            userEvent.addChild(*child);
+            child->addCallback(callback, CL_COMPLETE, const_cast<char *>(childNames[i]));
+            for (uint32_t j = 0; j < 2; j++) {
+                events.push_back(std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady));
+                child->addChild(*events.back());
+                events.back()->addCallback(callback, CL_COMPLETE, const_cast<char *>(grandChildNames[2 * i + j]));
+            }
+        }
+        userEvent.addCallback(callback, CL_COMPLETE, const_cast<char *>("userEvent"));
+
+        userEvent.setStatus(-1);
+
+        ASSERT_EQ(7u, callbacksOrder.size());
+        EXPECT_EQ("userEvent", callbacksOrder.back());
+        if (readyQueueEnabled) {
+            EXPECT_EQ(recursiveOrder, callbacksOrder);
+        } else {
+            recursiveOrder = callbacksOrder;
+        }
+    }
+}
+
 TEST_F(EventTest, GivenCompletedEventWhenAddingChildThenNumEventsBlockingThisIsZero) {
     VirtualEvent virtualEvent(pCmdQ, &mockContext);
     {
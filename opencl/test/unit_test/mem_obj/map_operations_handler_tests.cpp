@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,10 @@ using namespace NEO;
 struct MockMapOperationsHandler : public MapOperationsHandler {
     using MapOperationsHandler::isOverlapping;
     using MapOperationsHandler::mappedPointers;
+
+    MapInfo *peekMapInfo(void *ptr) {
+        return mappedPointers.findByStart(reinterpret_cast<uintptr_t>(ptr));
+    }
 };
 
 struct MapOperationsHandlerTests : public ::testing::Test {
@@ -82,27 +86,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -112,7 +116,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(1u, mockHandler.size());
@@ -124,11 +128,11 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.peekMapInfo(mappedPtrs[0].ptr)->readOnly);
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -221,3 +225,67 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenRemoveHandlerIsUsedT
     storage.removeHandler(&buffer);
     EXPECT_EQ(0u, storage.handlers.size());
 }
+
+TEST_F(MapOperationsHandlerTests, givenMappedSubRegionsWhenFindingInfoForHostPtrThenReturnRegionContainingWholeRange) {
+    MapInfo subRegions[3] = {
+        {(void *)0x10000, 0x100, {{0x100, 1, 1}}, {{0, 0, 0}}, 0},
+        {(void *)0x10200, 0x100, {{0x100, 1, 1}}, {{0x200, 0, 0}}, 0},
+        {(void *)0x10400, 0x100, {{0x100, 1, 1}}, {{0x400, 0, 0}}, 0},
+    };
+    mapFlags = CL_MAP_WRITE;
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(mockHandler.add(subRegions[i].ptr, subRegions[i].ptrLength, mapFlags, subRegions[i].size, subRegions[i].offset, 0, allocations[i].get()));
+    }
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(ptrOffset(subRegions[1].ptr, 0x10), 0x20, receivedMapInfo));
+    EXPECT_EQ(subRegions[1].ptr, receivedMapInfo.ptr);
+    EXPECT_EQ(allocations[1].get(), receivedMapInfo.graphicsAllocation);
+
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(subRegions[2].ptr, subRegions[2].ptrLength, receivedMapInfo));
+    EXPECT_EQ(subRegions[2].ptr, receivedMapInfo.ptr);
+
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(ptrOffset(subRegions[0].ptr, 0xF0), 0x20, receivedMapInfo));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(ptrOffset(subRegions[0].ptr, 0x100), 0x10, receivedMapInfo));
+}
+
+TEST_F(MapOperationsHandlerTests, givenManyOutstandingMapsWhenAddingFindingAndRemovingThenAllOperationsAreConsistent) {
+    constexpr size_t mapsCount = 4096;
+    constexpr size_t regionSize = 0x40;
+    constexpr uintptr_t baseAddress = 0x100000;
+    MemObjSizeArray size = {{regionSize, 1, 1}};
+    mapFlags = CL_MAP_WRITE;
+
+    // map every other sub-region, so each request is adjacent to free space on both sides
+    for (size_t i = 0; i < mapsCount; i++) {
+        MemObjOffsetArray offset = {{i * 2 * regionSize, 0, 0}};
+        auto ptr = reinterpret_cast<void *>(baseAddress + i * 2 * regionSize);
+        EXPECT_TRUE(mockHandler.add(ptr, regionSize, mapFlags, size, offset, 0, allocations[i % 3].get()));
+    }
+    EXPECT_EQ(mapsCount, mockHandler.size());
+
+    for (size_t i = 0; i < mapsCount; i++) {
+        MemObjOffsetArray offset = {{i * 2 * regionSize, 0, 0}};
+        auto ptr = reinterpret_cast<void *>(baseAddress + i * 2 * regionSize);
+        EXPECT_FALSE(mockHandler.add(ptrOffset(ptr, regionSize / 2), regionSize, mapFlags, size, offset, 0, nullptr));
+
+        MapInfo receivedMapInfo;
+        EXPECT_TRUE(mockHandler.find(ptr, receivedMapInfo));
+        EXPECT_EQ(offset, receivedMapInfo.offset);
+        EXPECT_EQ(allocations[i % 3].get(), receivedMapInfo.graphicsAllocation);
+        EXPECT_TRUE(mockHandler.findInfoForHostPtr(ptrOffset(ptr, 1), regionSize - 1, receivedMapInfo));
+        EXPECT_EQ(ptr, receivedMapInfo.ptr);
+    }
+    EXPECT_EQ(mapsCount, mockHandler.size());
+
+    for (size_t i = 0; i < mapsCount; i += 2) {
+        mockHandler.remove(reinterpret_cast<void *>(baseAddress + i * 2 * regionSize));
+    }
+    EXPECT_EQ(mapsCount / 2, mockHandler.size());
+
+    for (size_t i = 0; i < mapsCount; i++) {
+        MapInfo receivedMapInfo;
+        auto ptr = reinterpret_cast<void *>(baseAddress + i * 2 * regionSize);
+        EXPECT_EQ((i % 2) == 1, mockHandler.find(ptr, receivedMapInfo));
+    }
+}
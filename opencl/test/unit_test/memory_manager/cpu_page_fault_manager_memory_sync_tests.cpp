@@ -1,19 +1,25 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
 #include "opencl/source/command_queue/command_queue.h"
+#include "opencl/test/unit_test/fixtures/cl_device_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
 
 #include "gtest/gtest.h"
 
@@ -136,3 +142,66 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenAllowCPUMemoryEvictionIs
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+template <typename GfxFamily>
+struct MockCommandQueueHwRecordingSvmUnmaps : public MockCommandQueueHw<GfxFamily> {
+    using MockCommandQueueHw<GfxFamily>::MockCommandQueueHw;
+
+    cl_int enqueueSVMUnmap(void *svmPtr,
+                           cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                           cl_event *event, bool externalAppCall) override {
+        auto mapOperation = this->context->getSVMAllocsManager()->getSvmMapOperation(svmPtr);
+        unmappedRegionSizes.push_back(mapOperation ? mapOperation->regionSize : 0u);
+        return MockCommandQueueHw<GfxFamily>::enqueueSVMUnmap(svmPtr, numEventsInWaitList, eventWaitList, event, externalAppCall);
+    }
+
+    std::vector<size_t> unmappedRegionSizes;
+};
+
+struct PageFaultManagerChunkedMigrationTest : public ClDeviceFixture,
+                                              public ::testing::Test {
+    void SetUp() override {
+        REQUIRE_SVM_OR_SKIP(defaultHwInfo);
+        debugManager.flags.EnableLocalMemory.set(1);
+        debugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(chunkSize));
+
+        ClDeviceFixture::setUp();
+        context = std::make_unique<MockContext>(pClDevice, true);
+        svmPtr = context->getSVMAllocsManager()->createSVMAlloc(allocationSize, {}, context->getRootDeviceIndices(), context->getDeviceBitfields());
+        ASSERT_NE(nullptr, svmPtr);
+        mockSvmManager = reinterpret_cast<MockSVMAllocsManager *>(context->getSVMAllocsManager());
+    }
+
+    void TearDown() override {
+        if (defaultHwInfo->capabilityTable.ftrSvm == false) {
+            return;
+        }
+        context->getSVMAllocsManager()->freeSVMAlloc(svmPtr);
+        context.reset(nullptr);
+        ClDeviceFixture::tearDown();
+    }
+
+    static constexpr size_t chunkSize = MemoryConstants::pageSize;
+    static constexpr size_t allocationSize = 3 * chunkSize;
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockContext> context;
+    MockSVMAllocsManager *mockSvmManager = nullptr;
+    void *svmPtr = nullptr;
+};
+
+HWTEST_F(PageFaultManagerChunkedMigrationTest, givenChunksMappedSeparatelyWhenMergedRangeIsTransferredToGpuThenWholeRangeIsUnmappedAndNoMapOperationIsLeft) {
+    MockCommandQueueHwRecordingSvmUnmaps<FamilyType> queue(context.get(), pClDevice, nullptr);
+    MockPageFaultManager pageFaultManager;
+    pageFaultManager.insertAllocation(svmPtr, allocationSize, context->getSVMAllocsManager(), &queue, {});
+    ASSERT_EQ(chunkSize, pageFaultManager.memoryData[svmPtr].chunkSize);
+
+    auto secondChunkPtr = ptrOffset(svmPtr, chunkSize);
+    pageFaultManager.baseCpuTransfer(svmPtr, chunkSize, &queue);
+    pageFaultManager.baseCpuTransfer(secondChunkPtr, chunkSize, &queue);
+    EXPECT_EQ(2u, mockSvmManager->svmMapOperations.getNumMapOperations());
+
+    pageFaultManager.baseChunkGpuTransfer(svmPtr, svmPtr, 2 * chunkSize, &queue);
+    ASSERT_EQ(1u, queue.unmappedRegionSizes.size());
+    EXPECT_EQ(2 * chunkSize, queue.unmappedRegionSizes[0]);
+    EXPECT_EQ(0u, mockSvmManager->svmMapOperations.getNumMapOperations());
+}
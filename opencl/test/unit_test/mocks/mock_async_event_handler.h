@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,8 +23,10 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::allowAsyncProcess;
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
+    using AsyncEventsHandler::completionHeaps;
     using AsyncEventsHandler::openThread;
     using AsyncEventsHandler::thread;
+    using AsyncEventsHandler::useTaskCountHeaps;
 
     ~MockHandler() override {
         if (!allowThreadCreating) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/offline_compiler/source/ocloc_arg_helper.h"
+#include "shared/source/device_binary_format/binary_writer.h"
 #include "shared/source/helpers/string.h"
 
 #include <algorithm>
@@ -41,6 +42,17 @@ class MockOclocArgHelper : public OclocArgHelper {
     MockOclocArgHelper(FilesMap &filesMap) : OclocArgHelper(0, nullptr, nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
                                              filesMap(filesMap){};
 
+    std::unique_ptr<OclocArgHelper> createHelperForParallelBuild() const override {
+        auto helper = std::make_unique<MockOclocArgHelper>(filesMap);
+        helper->callBaseFileExists = callBaseFileExists;
+        helper->callBaseReadBinaryFile = callBaseReadBinaryFile;
+        helper->callBaseLoadDataFromFile = callBaseLoadDataFromFile;
+        helper->callBaseReadFileToVectorOfStrings = callBaseReadFileToVectorOfStrings;
+        helper->hasOutput = hasOutput;
+        helper->messagePrinter.setSuppressMessages(true);
+        return helper;
+    }
+
     void setAllCallBase(bool value) {
         callBaseFileExists = value;
         callBaseReadBinaryFile = value;
@@ -115,4 +127,12 @@ class MockOclocArgHelper : public OclocArgHelper {
             OclocArgHelper::saveOutput(filename, pData, dataSize);
         }
     }
+
+    void saveOutput(const std::string &filename, const size_t dataSize, const std::function<bool(NEO::BinaryWriter &)> &writeData) override {
+        std::vector<uint8_t> data(dataSize);
+        NEO::BufferBinaryWriter writer{ArrayRef<uint8_t>(data)};
+        if (writeData(writer)) {
+            saveOutput(filename, data.data(), data.size());
+        }
+    }
 };
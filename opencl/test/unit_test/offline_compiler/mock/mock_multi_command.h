@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 
 #include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
 
+#include <atomic>
 #include <optional>
 #include <string>
 
@@ -20,10 +21,12 @@ class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
     using MultiCommand::lines;
+    using MultiCommand::parallelJobs;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
     using MultiCommand::addAdditionalOptionsToSingleCommandLine;
+    using MultiCommand::buildCommand;
     using MultiCommand::initialize;
     using MultiCommand::printHelp;
     using MultiCommand::runBuilds;
@@ -49,10 +52,23 @@ class MockMultiCommand : public MultiCommand {
         return OCLOC_SUCCESS;
     }
 
+    int buildCommand(const std::vector<std::string> &args, OclocArgHelper *buildArgHelper, std::string &buildOutFileName) override {
+        ++buildCommandCalledCount;
+
+        if (callBaseBuildCommand) {
+            return MultiCommand::buildCommand(args, buildArgHelper, buildOutFileName);
+        }
+
+        buildArgHelper->printf("Building %s\n", buildOutFileName.c_str());
+        return OCLOC_SUCCESS;
+    }
+
     std::map<std::string, std::string> filesMap{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
     int singleBuildCalledCount{0};
+    std::atomic<int> buildCommandCalledCount{0};
     bool callBaseSingleBuild{true};
+    bool callBaseBuildCommand{true};
 };
 
 } // namespace NEO
@@ -13,6 +13,7 @@
 #include "shared/source/device_binary_format/ar/ar.h"
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/compiler_product_helper.h"
@@ -1744,6 +1745,106 @@ TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArch
     ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(expectedArchivePath));
 }
 
+TEST_F(OclocFatBinaryTest, givenParallelJobsWhenBuildingFatbinaryThenArchiveIsIdenticalToSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto sequentialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-j");
+    args.push_back("2");
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    EXPECT_EQ(sequentialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST_F(OclocFatBinaryTest, givenCompressFlagWhenBuildingFatbinaryThenEachEntryIsCompressedContainerOfUncompressedEntry) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto uncompressedArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-compress");
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto compressedArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+
+    std::string outErrReason{};
+    std::string outWarning{};
+    const auto decodedUncompressed = NEO::Ar::decodeAr(ArrayRef<const std::uint8_t>::fromAny(uncompressedArchive.data(), uncompressedArchive.size()), outErrReason, outWarning);
+    const auto decodedCompressed = NEO::Ar::decodeAr(ArrayRef<const std::uint8_t>::fromAny(compressedArchive.data(), compressedArchive.size()), outErrReason, outWarning);
+    ASSERT_NE(nullptr, decodedUncompressed.magic);
+    ASSERT_NE(nullptr, decodedCompressed.magic);
+
+    for (const auto &file : decodedUncompressed.files) {
+        if (file.fileName.startsWith("pad_")) {
+            continue;
+        }
+        const auto compressedFileIt = searchInArchiveByFilename(decodedCompressed, file.fileName);
+        ASSERT_NE(decodedCompressed.files.end(), compressedFileIt);
+        ASSERT_TRUE(NEO::CompressedBinary::isCompressed(compressedFileIt->fileData));
+
+        size_t decompressedSize = 0U;
+        ASSERT_TRUE(NEO::CompressedBinary::getDecompressedSize(compressedFileIt->fileData, decompressedSize));
+        std::vector<uint8_t> decompressed(decompressedSize);
+        ASSERT_TRUE(NEO::CompressedBinary::decompress(compressedFileIt->fileData, decompressed));
+        EXPECT_EQ(std::vector<uint8_t>(file.fileData.begin(), file.fileData.end()), decompressed);
+    }
+}
+
+TEST_F(OclocFatBinaryTest, givenInvalidParallelJobsValueWhenBuildingFatbinaryThenErrorIsReported) {
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-file",
+        spirvFilename,
+        "-spirv_input",
+        "-device",
+        "tgllp,dg1",
+        "-j",
+        "many"};
+
+    ::testing::internal::CaptureStdout();
+    const auto buildResult = buildFatBinary(args, &mockArgHelper);
+    const auto output{::testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, buildResult);
+    EXPECT_EQ("Error! Invalid value for -j option: many\n", output);
+}
+
 TEST_F(OclocFatBinaryTest, givenSpirvInputAndExcludeIrFlagWhenFatBinaryIsRequestedThenArchiveDoesNotContainGenericIrFile) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/ocloc_api.h"
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
+
+#include "gtest/gtest.h"
+#include "mock/mock_argument_helper.h"
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+class OclocParallelBuildTest : public ::testing::Test {
+  public:
+    OclocParallelBuildTest() {
+        mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    }
+
+    MockOclocArgHelper::FilesMap mockArgHelperFilesMap{};
+    MockOclocArgHelper mockArgHelper{mockArgHelperFilesMap};
+};
+
+TEST_F(OclocParallelBuildTest, givenArgsWithoutJobsOptionWhenExtractingJobsCountThenSingleJobIsReturnedAndArgsAreNotModified) {
+    std::vector<std::string> args = {"ocloc", "-file", "kernel.cl", "-device", "tgllp"};
+    const auto expectedArgs = args;
+    uint32_t jobsCount = 0u;
+
+    EXPECT_EQ(OCLOC_SUCCESS, extractParallelJobsCount(args, jobsCount, &mockArgHelper));
+    EXPECT_EQ(1u, jobsCount);
+    EXPECT_EQ(expectedArgs, args);
+}
+
+TEST_F(OclocParallelBuildTest, givenJobsOptionWhenExtractingJobsCountThenValueIsReturnedAndOptionIsRemovedFromArgs) {
+    std::vector<std::string> args = {"ocloc", "-file", "kernel.cl", "-j", "6", "-device", "tgllp"};
+    const std::vector<std::string> expectedArgs = {"ocloc", "-file", "kernel.cl", "-device", "tgllp"};
+    uint32_t jobsCount = 0u;
+
+    EXPECT_EQ(OCLOC_SUCCESS, extractParallelJobsCount(args, jobsCount, &mockArgHelper));
+    EXPECT_EQ(6u, jobsCount);
+    EXPECT_EQ(expectedArgs, args);
+}
+
+TEST_F(OclocParallelBuildTest, givenZeroJobsWhenExtractingJobsCountThenNumberOfHardwareThreadsIsReturned) {
+    std::vector<std::string> args = {"ocloc", "-j", "0"};
+    uint32_t jobsCount = 0u;
+
+    EXPECT_EQ(OCLOC_SUCCESS, extractParallelJobsCount(args, jobsCount, &mockArgHelper));
+    EXPECT_EQ(std::max(std::thread::hardware_concurrency(), 1u), jobsCount);
+    EXPECT_EQ(1u, args.size());
+}
+
+TEST_F(OclocParallelBuildTest, givenInvalidJobsValueWhenExtractingJobsCountThenErrorIsReturned) {
+    for (const auto &value : {"-1", "two", "", "100000"}) {
+        std::vector<std::string> args = {"ocloc", "-j", value};
+        uint32_t jobsCount = 0u;
+
+        EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, extractParallelJobsCount(args, jobsCount, &mockArgHelper));
+    }
+}
+
+TEST_F(OclocParallelBuildTest, givenJobsOptionWithoutValueWhenExtractingJobsCountThenErrorIsPrinted) {
+    std::vector<std::string> args = {"ocloc", "-file", "kernel.cl", "-j"};
+    uint32_t jobsCount = 0u;
+    mockArgHelper.getPrinterRef().setSuppressMessages(false);
+
+    ::testing::internal::CaptureStdout();
+    const auto result = extractParallelJobsCount(args, jobsCount, &mockArgHelper);
+    const auto output{::testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+    EXPECT_EQ("Error! Missing value for -j option.\n", output);
+}
+
+TEST(OclocRunParallelTasksTest, givenMultipleJobsWhenRunningTasksThenEachTaskIsExecutedExactlyOnce) {
+    constexpr size_t tasksCount = 64u;
+    std::vector<std::atomic<uint32_t>> executions(tasksCount);
+
+    runParallelTasks(tasksCount, 4u, [&](size_t index) { executions[index]++; });
+
+    for (const auto &executionsCount : executions) {
+        EXPECT_EQ(1u, executionsCount.load());
+    }
+}
+
+TEST(OclocRunParallelTasksTest, givenSingleJobWhenRunningTasksThenTasksAreExecutedInOrderOnCallingThread) {
+    std::vector<size_t> executedTasks;
+    std::vector<std::thread::id> threadIds;
+
+    runParallelTasks(8u, 1u, [&](size_t index) {
+        executedTasks.push_back(index);
+        threadIds.push_back(std::this_thread::get_id());
+    });
+
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7}), executedTasks);
+    for (const auto &threadId : threadIds) {
+        EXPECT_EQ(std::this_thread::get_id(), threadId);
+    }
+}
+
+} // namespace NEO
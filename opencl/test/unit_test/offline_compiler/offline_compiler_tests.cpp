@@ -323,6 +323,50 @@ TEST_F(MultiCommandTests, GivenOutputFileListFlagWhenBuildingMultiCommandThenSuc
     delete pMultiCommand;
 }
 
+TEST_F(MultiCommandTests, GivenParallelJobsAndOutputFileListFlagWhenBuildingMultiCommandThenAllBuildsSucceedAndOutputsAreListedInCommandOrder) {
+    nameOfFileWithArgs = "ImAMulitiComandParallelFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "4",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get());
+
+    ASSERT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+    EXPECT_TRUE(fileExists(outFileList));
+
+    std::vector<std::string> listedOutputs;
+    oclocArgHelperWithoutInput->readFileToVectorOfStrings(outFileList, listedOutputs);
+    ASSERT_EQ(static_cast<size_t>(numOfBuild), listedOutputs.size());
+
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+        EXPECT_NE(std::string::npos, listedOutputs[i].find("build_no_" + std::to_string(i + 1) + ".bin"));
+    }
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+
 TEST(MultiCommandWhiteboxTest, GivenVerboseModeWhenShowingResultsThenLogsArePrintedForEachBuild) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.retValues = {OCLOC_SUCCESS, OCLOC_INVALID_FILE};
@@ -392,6 +436,10 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of commands built in parallel.
+                                0 uses number of hardware threads.
+                                Default is 1.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -526,6 +574,56 @@ TEST(MultiCommandWhiteboxTest, GivenInvalidArgsWhenInitializingThenErrorIsReturn
     EXPECT_NE(std::string::npos, errorPosition);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenInvalidParallelJobsValueWhenInitializingThenErrorIsReturnedAndNoBuildIsStarted) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-j",
+        "all"};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+    EXPECT_EQ(0, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_EQ("Error! Invalid value for -j option: all\n", output);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenParallelJobsAndVerboseModeWhenRunningBuildsThenReturnValuesAndLogsAreInCommandOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.callBaseBuildCommand = false;
+    mockMultiCommand.parallelJobs = 3u;
+
+    const std::string validLine{"-file test_files/copybuffer.cl -device " + gEnvironment->devicePrefix};
+    mockMultiCommand.lines.push_back(validLine);
+    mockMultiCommand.lines.push_back("-out_dir \"Some Directory");
+    mockMultiCommand.lines.push_back(validLine);
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(0, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_EQ(2, mockMultiCommand.buildCommandCalledCount.load());
+
+    ASSERT_EQ(3u, mockMultiCommand.retValues.size());
+    EXPECT_EQ(OCLOC_SUCCESS, mockMultiCommand.retValues[0]);
+    EXPECT_EQ(OCLOC_INVALID_FILE, mockMultiCommand.retValues[1]);
+    EXPECT_EQ(OCLOC_SUCCESS, mockMultiCommand.retValues[2]);
+
+    const auto expectedLogs{"Command number 1: \n"
+                            "Building build_no_1\n"
+                            "Command number 3: \n"
+                            "Building build_no_3\n"};
+    EXPECT_NE(std::string::npos, output.find(expectedLogs));
+}
+
 using MockOfflineCompilerTests = ::testing::Test;
 TEST_F(MockOfflineCompilerTests, givenProductConfigValueWhenInitHwInfoThenCorrectValueIsSet) {
     MockOfflineCompiler mockOfflineCompiler;
@@ -1119,6 +1217,28 @@ TEST_F(OfflineCompilerTests, givenIncorrectConfigFlagWhenParsingCommandLineThenE
     EXPECT_EQ(expectedErrorMessage, output);
 }
 
+TEST_F(OfflineCompilerTests, givenCompressFlagWhenParsingCommandLineForSingleTargetThenErrorLogIsPrintedAndFailureIsReturned) {
+    const std::vector<std::string> argv = {
+        "ocloc",
+        "compile",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-compress"};
+
+    MockOfflineCompiler mockOfflineCompiler{};
+
+    ::testing::internal::CaptureStdout();
+    const auto result = mockOfflineCompiler.parseCommandLine(argv.size(), argv);
+    const auto output{::testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+
+    const std::string expectedErrorMessage{"Error! -compress is supported only when building fatbinary for multiple target devices.\n"};
+    EXPECT_EQ(expectedErrorMessage, output);
+}
+
 TEST_F(OfflineCompilerTests, Given64BitModeFlagWhenParsingThenInternalOptionsContain64BitModeFlag) {
     const std::array<std::string, 2> flagsToTest = {
         "-64", CompilerOptions::arch64bit.str()};
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/utilities/linux/safety_guard_linux.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+namespace {
+thread_local bool previousHandlerCalled = false;
+
+void previousSigAction(int sigNum, siginfo_t *info, void *ucontext) {
+    previousHandlerCalled = true;
+}
+} // namespace
+
+TEST(SafetyGuardLinux, givenSafetyGuardActiveWhenSignalIsRaisedOnThreadWithoutGuardedCallThenPreviousHandlerIsCalled) {
+    struct sigaction testAction {};
+    testAction.sa_sigaction = previousSigAction;
+    testAction.sa_flags = SA_SIGINFO;
+    struct sigaction originalAction {};
+    sigaction(SIGILL, &testAction, &originalAction);
+
+    {
+        SafetyGuardLinux safetyGuard;
+        bool calledOnThread = false;
+        std::thread thread([&calledOnThread] {
+            raise(SIGILL);
+            calledOnThread = previousHandlerCalled;
+        });
+        thread.join();
+        EXPECT_TRUE(calledOnThread);
+    }
+
+    sigaction(SIGILL, &originalAction, nullptr);
+}
@@ -3202,6 +3202,53 @@ TEST_F(ProgramMultiRootDeviceTests, WhenProgramIsCreatedThenBuildInfosVectorIsPr
     }
 }
 
+TEST_F(ProgramMultiRootDeviceTests, givenParallelRootDeviceBuildEnabledWhenBuildingProgramFromSourceThenBinaryIsCreatedForEachRootDevice) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableParallelProgramBuildForRootDevices.set(1);
+
+    const char irBinary[] = "mock ir binary";
+    for (auto &device : {device1, device2}) {
+        auto cip = new MockCompilerInterfaceCaptureBuildOptions();
+        cip->output.intermediateRepresentation.mem = makeCopy(irBinary, sizeof(irBinary));
+        cip->output.intermediateRepresentation.size = sizeof(irBinary);
+        device->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->compilerInterface.reset(cip);
+    }
+
+    ClDeviceVector deviceVector;
+    deviceVector.push_back(device1);
+    deviceVector.push_back(device2);
+    auto program = std::make_unique<SucceedingGenBinaryProgram>(context.get(), false, deviceVector);
+    program->sourceCode = "__kernel mock() {}";
+    program->createdFrom = Program::CreatedFrom::source;
+
+    EXPECT_EQ(CL_SUCCESS, program->build(program->getDevices(), nullptr));
+    for (auto &device : {device1, device2}) {
+        auto rootDeviceIndex = device->getRootDeviceIndex();
+        EXPECT_EQ(sizeof(irBinary), program->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
+        EXPECT_NE(nullptr, program->buildInfos[rootDeviceIndex].unpackedDeviceBinary);
+        EXPECT_EQ(CL_BUILD_SUCCESS, program->deviceBuildInfos[device].buildStatus);
+    }
+    EXPECT_EQ(sizeof(irBinary), program->irBinarySize);
+}
+
+TEST_F(ProgramMultiRootDeviceTests, givenAsyncBuildScheduledWhenBuildingProgramThenBuildIsRejectedAndBuildStatusIsNotChanged) {
+    ClDeviceVector deviceVector;
+    deviceVector.push_back(device1);
+    deviceVector.push_back(device2);
+    auto program = std::make_unique<MockProgram>(context.get(), false, deviceVector);
+    program->asyncBuildScheduled = true;
+    program->deviceBuildInfos[device1].buildStatus = CL_BUILD_IN_PROGRESS;
+    program->deviceBuildInfos[device2].buildStatus = CL_BUILD_IN_PROGRESS;
+
+    EXPECT_EQ(CL_INVALID_OPERATION, program->build(program->getDevices(), nullptr));
+    EXPECT_EQ(CL_BUILD_IN_PROGRESS, program->deviceBuildInfos[device1].buildStatus);
+    EXPECT_EQ(CL_BUILD_IN_PROGRESS, program->deviceBuildInfos[device2].buildStatus);
+
+    program->asyncBuildScheduled = false;
+    program->deviceBuildInfos[device1].buildStatus = CL_BUILD_NONE;
+    program->deviceBuildInfos[device2].buildStatus = CL_BUILD_NONE;
+}
+
 class MockCompilerInterfaceWithGtpinParam : public CompilerInterface {
   public:
     TranslationOutput::ErrorCode link(
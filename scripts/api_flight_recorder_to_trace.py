@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2024 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Converts API flight recorder dump (ApiFlightRecorder=N, see api_flight_recorder.h)
+# to Chrome trace event JSON, which can be opened in chrome://tracing or Perfetto UI.
+
+import argparse
+import json
+import struct
+import sys
+
+HEADER_FORMAT = "<IIQQQQII"
+RECORD_FORMAT = "<QQ6QIIBB6x"
+MAGIC = 0x52464150
+VERSION = 1
+PHASE_ENTER = 0
+PHASE_EXIT = 1
+
+
+def normalize_name(name):
+    # OpenCL calls are recorded with tracer names, e.g. ClBuildProgram
+    if name.startswith("Cl"):
+        name = "cl" + name[2:]
+    return name
+
+
+def read_dump(path):
+    with open(path, "rb") as dump_file:
+        data = dump_file.read()
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    magic, version, start_tsc, start_ns, end_tsc, end_ns, names_count, records_count = struct.unpack_from(HEADER_FORMAT, data, 0)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("not an API flight recorder dump or unsupported version")
+
+    offset = header_size
+    names = []
+    for _ in range(names_count):
+        (length,) = struct.unpack_from("<I", data, offset)
+        offset += 4
+        names.append(data[offset:offset + length].decode("utf-8", "replace"))
+        offset += length
+
+    record_size = struct.calcsize(RECORD_FORMAT)
+    records = []
+    for _ in range(records_count):
+        fields = struct.unpack_from(RECORD_FORMAT, data, offset)
+        offset += record_size
+        records.append({
+            "timestamp": fields[0],
+            "correlation_id": fields[1],
+            "values": list(fields[2:8]),
+            "name": names[fields[8]],
+            "thread": fields[9],
+            "phase": fields[10],
+            "values_count": fields[11],
+        })
+
+    ticks = end_tsc - start_tsc
+    ns_per_tick = float(end_ns - start_ns) / ticks if ticks > 0 else 1.0
+
+    def to_us(tsc):
+        return (start_ns + (tsc - start_tsc) * ns_per_tick) / 1000.0
+
+    return records, to_us
+
+
+def convert(records, to_us, pid):
+    events = []
+    open_calls = {}
+    for record in records:
+        if record["phase"] == PHASE_ENTER:
+            open_calls[record["correlation_id"]] = record
+            continue
+
+        enter = open_calls.pop(record["correlation_id"], None)
+        if enter is None:
+            # enter record was already overwritten in ring
+            continue
+        args = {"arg%d" % i: hex(value) for i, value in enumerate(enter["values"][:enter["values_count"]])}
+        args["return"] = hex(record["values"][0])
+        args["correlationId"] = enter["correlation_id"]
+        start = to_us(enter["timestamp"])
+        events.append({
+            "name": normalize_name(enter["name"]),
+            "ph": "X",
+            "pid": pid,
+            "tid": enter["thread"],
+            "ts": start,
+            "dur": max(to_us(record["timestamp"]) - start, 0.0),
+            "args": args,
+        })
+
+    # calls still in progress when dump was taken
+    for enter in open_calls.values():
+        args = {"arg%d" % i: hex(value) for i, value in enumerate(enter["values"][:enter["values_count"]])}
+        args["correlationId"] = enter["correlation_id"]
+        events.append({
+            "name": normalize_name(enter["name"]),
+            "ph": "i",
+            "s": "t",
+            "pid": pid,
+            "tid": enter["thread"],
+            "ts": to_us(enter["timestamp"]),
+            "args": args,
+        })
+
+    events.sort(key=lambda event: event["ts"])
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert API flight recorder dump to Chrome trace JSON")
+    parser.add_argument("dump", help="dump file written by API flight recorder")
+    parser.add_argument("-o", "--output", help="output JSON file, stdout when not given")
+    parser.add_argument("--pid", type=int, default=0, help="process id to put in trace events")
+    args = parser.parse_args()
+
+    records, to_us = read_dump(args.dump)
+    trace = convert(records, to_us, args.pid)
+
+    if args.output:
+        with open(args.output, "w") as output_file:
+            json.dump(trace, output_file)
+    else:
+        json.dump(trace, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
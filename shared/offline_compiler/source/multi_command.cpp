@@ -10,6 +10,7 @@
 #include "shared/offline_compiler/source/ocloc_api.h"
 #include "shared/offline_compiler/source/ocloc_arg_helper.h"
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
 #include "shared/offline_compiler/source/offline_compiler.h"
 #include "shared/offline_compiler/source/utilities/get_current_dir.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
@@ -19,37 +20,45 @@
 
 namespace NEO {
 int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+    int retVal = buildCommand(args, argHelper, outFileName);
+    addToOutputFileList(retVal, outFileName);
+    return retVal;
+}
+
+int MultiCommand::buildCommand(const std::vector<std::string> &args, OclocArgHelper *buildArgHelper, std::string &buildOutFileName) {
     int retVal = OCLOC_SUCCESS;
 
-    if (requestedFatBinary(args, argHelper)) {
-        retVal = buildFatBinary(args, argHelper);
+    if (requestedFatBinary(args, buildArgHelper)) {
+        retVal = buildFatBinary(args, buildArgHelper);
     } else {
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
+        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, buildArgHelper)};
         if (retVal == OCLOC_SUCCESS) {
             retVal = buildWithSafetyGuard(pCompiler.get());
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
-                argHelper->printf("%s\n", buildLog.c_str());
+                buildArgHelper->printf("%s\n", buildLog.c_str());
             }
         }
-        outFileName += ".bin";
+        buildOutFileName += ".bin";
     }
     if (retVal == OCLOC_SUCCESS) {
         if (!quiet)
-            argHelper->printf("Build succeeded.\n");
+            buildArgHelper->printf("Build succeeded.\n");
     } else {
-        argHelper->printf("Build failed with error code: %d\n", retVal);
+        buildArgHelper->printf("Build failed with error code: %d\n", retVal);
     }
 
+    return retVal;
+}
+
+void MultiCommand::addToOutputFileList(int retVal, const std::string &buildOutFileName) {
     if (retVal == OCLOC_SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + buildOutFileName;
     } else {
         outputFile << "Unsuccessful build";
     }
     outputFile << '\n';
-
-    return retVal;
 }
 
 MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &retVal, OclocArgHelper *helper) {
@@ -94,12 +103,18 @@ void MultiCommand::addAdditionalOptionsToSingleCommandLine(std::vector<std::stri
         singleLineWithArguments.push_back("-q");
 }
 
-int MultiCommand::initialize(const std::vector<std::string> &args) {
-    if (args[args.size() - 1] == "--help") {
+int MultiCommand::initialize(const std::vector<std::string> &inputArgs) {
+    if (inputArgs[inputArgs.size() - 1] == "--help") {
         printHelp();
         return -1;
     }
 
+    std::vector<std::string> args(inputArgs);
+    auto parseRetVal = extractParallelJobsCount(args, parallelJobs, argHelper);
+    if (parseRetVal != OCLOC_SUCCESS) {
+        return parseRetVal;
+    }
+
     for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
         const auto &currArg = args[argIndex];
         const bool hasMoreArgs = (argIndex + 1 < args.size());
@@ -138,6 +153,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    if (parallelJobs > 1u && lines.size() > 1u) {
+        runBuildsInParallel(argZero);
+        return;
+    }
+
     for (size_t i = 0; i < lines.size(); ++i) {
         std::vector<std::string> args = {argZero};
 
@@ -157,6 +177,53 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+void MultiCommand::runBuildsInParallel(const std::string &argZero) {
+    struct CommandBuild {
+        std::vector<std::string> args;
+        std::string outFileName;
+        std::unique_ptr<OclocArgHelper> argHelper;
+        int retVal = OCLOC_SUCCESS;
+    };
+
+    std::vector<CommandBuild> builds(lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &build = builds[i];
+        build.args = {argZero};
+        build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+        if (build.retVal != OCLOC_SUCCESS) {
+            continue;
+        }
+
+        addAdditionalOptionsToSingleCommandLine(build.args, i);
+        build.outFileName = outFileName;
+        build.argHelper = argHelper->createHelperForParallelBuild();
+    }
+
+    runParallelTasks(builds.size(), parallelJobs, [&](size_t index) {
+        auto &build = builds[index];
+        if (build.argHelper) {
+            build.retVal = buildCommand(build.args, build.argHelper.get(), build.outFileName);
+        }
+    });
+
+    // messages of each command are printed together and in command file order
+    for (size_t i = 0; i < builds.size(); ++i) {
+        auto &build = builds[i];
+        if (build.argHelper) {
+            if (!quiet) {
+                argHelper->printf("Command number %zu: \n", i + 1);
+            }
+            auto log = build.argHelper->getPrinterRef().getLog().str();
+            if (log.empty() == false) {
+                argHelper->printf("%s", log.c_str());
+            }
+            argHelper->mergeOutputsFromParallelBuild(*build.argHelper);
+            addToOutputFileList(build.retVal, build.outFileName);
+        }
+        retValues.push_back(build.retVal);
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -172,6 +239,10 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of commands built in parallel.
+                                0 uses number of hardware threads.
+                                Default is 1.
+
 )===");
 }
 
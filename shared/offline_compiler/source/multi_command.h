@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -33,9 +34,12 @@ class MultiCommand {
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
     MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    MOCKABLE_VIRTUAL int buildCommand(const std::vector<std::string> &args, OclocArgHelper *buildArgHelper, std::string &buildOutFileName);
+    void addToOutputFileList(int retVal, const std::string &buildOutFileName);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsInParallel(const std::string &argZero);
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
@@ -44,5 +48,6 @@ class MultiCommand {
     std::string pathToCommandFile;
     std::stringstream outputFile;
     bool quiet = false;
+    uint32_t parallelJobs = 1u;
 };
 } // namespace NEO
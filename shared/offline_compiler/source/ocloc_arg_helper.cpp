@@ -7,6 +7,7 @@
 
 #include "ocloc_arg_helper.h"
 
+#include "shared/source/device_binary_format/binary_writer.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
@@ -50,6 +51,11 @@ Output::Output(const std::string &name, const void *data, const size_t &size)
     memcpy_s(this->data, this->size, data, size);
 };
 
+Output::Output(const std::string &name, const size_t &size)
+    : name(name), size(size) {
+    this->data = new uint8_t[size];
+};
+
 OclocArgHelper::OclocArgHelper(const uint32_t numSources, const uint8_t **dataSources,
                                const uint64_t *lenSources, const char **nameSources,
                                const uint32_t numInputHeaders,
@@ -73,13 +79,34 @@ OclocArgHelper::OclocArgHelper(const uint32_t numSources, const uint8_t **dataSo
 OclocArgHelper::OclocArgHelper() : OclocArgHelper(0, nullptr, nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr) {}
 
 OclocArgHelper::~OclocArgHelper() {
-    if (outputEnabled()) {
+    if (outputEnabled() && numOutputs != nullptr) {
         auto log = messagePrinter.getLog().str();
         OclocArgHelper::saveOutput(oclocStdoutLogName, log.c_str(), log.length() + 1);
         moveOutputs();
     }
 }
 
+std::unique_ptr<OclocArgHelper> OclocArgHelper::createHelperForParallelBuild() const {
+    auto helper = std::make_unique<OclocArgHelper>();
+    for (const auto &input : inputs) {
+        helper->inputs.push_back(input);
+    }
+    for (const auto &header : headers) {
+        helper->headers.push_back(header);
+    }
+    helper->hasOutput = hasOutput;
+    helper->verbose = verbose;
+    helper->messagePrinter.setSuppressMessages(true);
+    return helper;
+}
+
+void OclocArgHelper::mergeOutputsFromParallelBuild(OclocArgHelper &helper) {
+    for (auto &output : helper.outputs) {
+        outputs.push_back(std::move(output));
+    }
+    helper.outputs.clear();
+}
+
 bool OclocArgHelper::fileExists(const std::string &filename) const {
     return sourceFileExists(filename) || ::fileExists(filename);
 }
@@ -213,3 +240,19 @@ void OclocArgHelper::saveOutput(const std::string &filename, const void *pData,
         writeDataToFile(filename.c_str(), pData, dataSize);
     }
 }
+
+void OclocArgHelper::saveOutput(const std::string &filename, const size_t dataSize, const std::function<bool(NEO::BinaryWriter &)> &writeData) {
+    if (outputEnabled()) {
+        auto output = std::make_unique<Output>(filename, dataSize);
+        NEO::BufferBinaryWriter writer(ArrayRef<uint8_t>(output->data, dataSize));
+        if (writeData(writer)) {
+            outputs.push_back(std::move(output));
+        }
+    } else {
+        writeDataToFile(filename.c_str(), [&writeData](FILE *file) {
+            NEO::FileBinaryWriter writer(file);
+            writeData(writer);
+            return writer.getWrittenSize();
+        });
+    }
+}
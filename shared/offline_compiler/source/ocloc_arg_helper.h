@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -21,6 +22,7 @@ constexpr auto *oclocStdoutLogName = "stdout.log";
 
 struct ProductConfigHelper;
 namespace NEO {
+class BinaryWriter;
 class CompilerProductHelper;
 class ReleaseHelper;
 struct HardwareInfo;
@@ -43,6 +45,7 @@ struct Output {
     uint8_t *data;
     const size_t size;
     Output(const std::string &name, const void *data, const size_t &size);
+    Output(const std::string &name, const size_t &size);
 };
 
 class OclocArgHelper {
@@ -103,6 +106,12 @@ class OclocArgHelper {
     }
 
     MOCKABLE_VIRTUAL void saveOutput(const std::string &filename, const void *pData, const size_t &dataSize);
+    // writeData emits dataSize bytes directly to output file or output buffer, without intermediate copy
+    MOCKABLE_VIRTUAL void saveOutput(const std::string &filename, const size_t dataSize, const std::function<bool(NEO::BinaryWriter &)> &writeData);
+
+    // helper for build running in parallel with others, reads the same inputs and collects messages instead of printing them
+    MOCKABLE_VIRTUAL std::unique_ptr<OclocArgHelper> createHelperForParallelBuild() const;
+    void mergeOutputsFromParallelBuild(OclocArgHelper &helper);
 
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
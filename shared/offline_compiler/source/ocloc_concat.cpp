@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/offline_compiler/source/ocloc_arg_helper.h"
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/device_binary_format/binary_writer.h"
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 #include "shared/source/helpers/product_config_helper.h"
@@ -102,8 +103,12 @@ AOT::PRODUCT_CONFIG OclocConcat::getAOTProductConfigFromBinary(ArrayRef<const ui
 
 OclocConcat::ErrorCode OclocConcat::concatenate() {
     NEO::Ar::ArEncoder arEncoder(true);
+    arEncoder.setCopyFileData(false);
+    std::vector<std::vector<char>> files;
+    files.reserve(fileNamesToConcat.size());
     for (auto &fileName : fileNamesToConcat) {
-        auto file = argHelper->readBinaryFile(fileName);
+        files.push_back(argHelper->readBinaryFile(fileName));
+        auto &file = *files.rbegin();
         auto fileRef = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(file.data()), file.size());
 
         if (NEO::Ar::isAr(fileRef)) {
@@ -135,8 +140,7 @@ OclocConcat::ErrorCode OclocConcat::concatenate() {
         }
     }
 
-    auto arFile = arEncoder.encode();
-    argHelper->saveOutput(fatBinaryName, arFile.data(), arFile.size());
+    argHelper->saveOutput(fatBinaryName, arEncoder.getEncodedSize(), [&arEncoder](NEO::BinaryWriter &writer) { return arEncoder.encode(writer); });
     return OCLOC_SUCCESS;
 }
 
@@ -9,12 +9,14 @@
 
 #include "shared/offline_compiler/source/ocloc_api.h"
 #include "shared/offline_compiler/source/ocloc_arg_helper.h"
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
 #include "shared/offline_compiler/source/offline_compiler.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/compiler_interface/tokenized_string.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/device_binary_format/binary_writer.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/file_io.h"
@@ -265,30 +267,24 @@ std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceA
     return retVal;
 }
 
-int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
-                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
-
-    if (retVal == 0) {
-        retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+void printFatBinaryTargetBuildResult(int retVal, const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
     }
-    if (retVal) {
-        return retVal;
+    if (retVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
     }
+}
 
+void appendFatBinaryTargetEntry(const std::string &pointerSize, Ar::ArEncoder &fatbinary, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
     std::string entryName("");
     if (product.find(".") != std::string::npos) {
         entryName = product;
@@ -302,9 +298,74 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     }
 
     fatbinary.appendFileEntry(pointerSize + "." + entryName, pCompiler->getPackedDeviceBinaryOutput());
+}
+
+int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+
+    if (retVal == 0) {
+        retVal = buildWithSafetyGuard(pCompiler);
+        printFatBinaryTargetBuildResult(retVal, argsCopy, pCompiler, argHelper, product);
+    }
+    if (retVal) {
+        return retVal;
+    }
+
+    appendFatBinaryTargetEntry(pointerSize, fatbinary, pCompiler, argHelper, product);
     return retVal;
 }
 
+int buildFatBinaryTargetsInParallel(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts, uint32_t jobsCount,
+                                    const std::string &pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper, std::string &optionsForIr) {
+    struct TargetBuild {
+        std::vector<std::string> args;
+        std::unique_ptr<OclocArgHelper> argHelper;
+        std::unique_ptr<OfflineCompiler> compiler;
+        int retVal = OCLOC_SUCCESS;
+    };
+
+    std::vector<TargetBuild> targetBuilds(targetProducts.size());
+    for (size_t i = 0; i < targetProducts.size(); i++) {
+        targetBuilds[i].args = argsCopy;
+        targetBuilds[i].args[deviceArgIndex] = targetProducts[i].str();
+        targetBuilds[i].argHelper = argHelper->createHelperForParallelBuild();
+    }
+
+    runParallelTasks(targetBuilds.size(), jobsCount, [&](size_t index) {
+        auto &target = targetBuilds[index];
+        target.compiler.reset(OfflineCompiler::create(target.args.size(), target.args, false, target.retVal, target.argHelper.get()));
+        if (OCLOC_SUCCESS != target.retVal) {
+            target.argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return;
+        }
+        target.retVal = buildWithSafetyGuard(target.compiler.get());
+        printFatBinaryTargetBuildResult(target.retVal, target.args, target.compiler.get(), target.argHelper.get(), targetProducts[index].str());
+    });
+
+    if (std::find(argsCopy.begin(), argsCopy.end(), "-qq") != argsCopy.end()) {
+        argHelper->getPrinterRef().setSuppressMessages(true);
+    }
+
+    // messages and binaries are taken in target order, so output does not depend on which build finished first
+    for (size_t i = 0; i < targetBuilds.size(); i++) {
+        auto &target = targetBuilds[i];
+        auto log = target.argHelper->getPrinterRef().getLog().str();
+        if (log.empty() == false) {
+            argHelper->printf("%s", log.c_str());
+        }
+        argHelper->mergeOutputsFromParallelBuild(*target.argHelper);
+
+        if (target.retVal != OCLOC_SUCCESS) {
+            return target.retVal;
+        }
+        appendFatBinaryTargetEntry(pointerSize, fatbinary, target.compiler.get(), argHelper, targetProducts[i].str());
+        if (optionsForIr.empty()) {
+            optionsForIr = target.compiler->getOptions();
+        }
+    }
+    return OCLOC_SUCCESS;
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
@@ -313,13 +374,20 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    bool compress = false;
     std::set<std::string> deviceAcronymsFromDeviceOptions;
+    uint32_t parallelJobs = 1u;
 
     std::vector<std::string> argsCopy(args);
-    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
-        const auto &currArg = args[argIndex];
-        const bool hasMoreArgs = (argIndex + 1 < args.size());
-        const bool hasAtLeast2MoreArgs = (argIndex + 2 < args.size());
+    auto parseRetVal = extractParallelJobsCount(argsCopy, parallelJobs, argHelper);
+    if (parseRetVal != OCLOC_SUCCESS) {
+        return parseRetVal;
+    }
+
+    for (size_t argIndex = 1; argIndex < argsCopy.size(); argIndex++) {
+        const auto &currArg = argsCopy[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < argsCopy.size());
+        const bool hasAtLeast2MoreArgs = (argIndex + 2 < argsCopy.size());
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
@@ -328,20 +396,25 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
             pointerSizeInBits = "64";
         } else if ((ConstStringRef("-file") == currArg) && hasMoreArgs) {
-            inputFileName = args[argIndex + 1];
+            inputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if (((ConstStringRef("-output") == currArg) || (ConstStringRef("-o") == currArg)) && hasMoreArgs) {
-            outputFileName = args[argIndex + 1];
+            outputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
-            outputDirectory = args[argIndex + 1];
+            outputDirectory = argsCopy[argIndex + 1];
             ++argIndex;
         } else if (ConstStringRef("-exclude_ir") == currArg) {
             excludeIr = true;
         } else if (ConstStringRef("-spirv_input") == currArg) {
             spirvInput = true;
+        } else if (ConstStringRef("-compress") == currArg) {
+            // per-target compilers reject -compress, it applies only to fatbinary entries
+            compress = true;
+            argsCopy.erase(argsCopy.begin() + argIndex);
+            --argIndex;
         } else if (("-device_options" == currArg) && hasAtLeast2MoreArgs) {
-            const auto deviceAcronyms = CompilerOptions::tokenize(args[argIndex + 1], ',');
+            const auto deviceAcronyms = CompilerOptions::tokenize(argsCopy[argIndex + 1], ',');
             for (const auto &deviceAcronym : deviceAcronyms) {
                 deviceAcronymsFromDeviceOptions.insert(deviceAcronym.str());
             }
@@ -360,10 +433,11 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     }
 
     Ar::ArEncoder fatbinary(true);
+    fatbinary.setCompressFileData(compress);
     std::vector<ConstStringRef> targetProducts;
-    targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    targetProducts = getTargetProductsForFatbinary(ConstStringRef(argsCopy[deviceArgIndex]), argHelper);
     if (targetProducts.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", argsCopy[deviceArgIndex].c_str());
         return 1;
     }
 
@@ -373,22 +447,29 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
     std::string optionsForIr;
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OCLOC_SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
-        }
-
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+    if (parallelJobs > 1u && targetProducts.size() > 1u) {
+        auto retVal = buildFatBinaryTargetsInParallel(argsCopy, deviceArgIndex, targetProducts, parallelJobs, pointerSizeInBits, fatbinary, argHelper, optionsForIr);
         if (retVal) {
             return retVal;
         }
-        if (optionsForIr.empty()) {
-            optionsForIr = pCompiler->getOptions();
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OCLOC_SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
+            if (optionsForIr.empty()) {
+                optionsForIr = pCompiler->getOptions();
+            }
         }
     }
 
@@ -400,8 +481,6 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
 
-    auto fatbinaryData = fatbinary.encode();
-
     std::string fatbinaryFileName = "";
 
     if (false == outputDirectory.empty()) {
@@ -416,7 +495,7 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
 
-    argHelper->saveOutput(fatbinaryFileName, fatbinaryData.data(), fatbinaryData.size());
+    argHelper->saveOutput(fatbinaryFileName, fatbinary.getEncodedSize(), [&fatbinary](BinaryWriter &writer) { return fatbinary.encode(writer); });
 
     return 0;
 }
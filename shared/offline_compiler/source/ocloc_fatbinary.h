@@ -44,6 +44,10 @@ std::vector<NEO::ConstStringRef> getProductsForRange(unsigned int productFrom, u
 std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
                             OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+int buildFatBinaryTargetsInParallel(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts, uint32_t jobsCount,
+                                    const std::string &pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper, std::string &optionsForIr);
+void printFatBinaryTargetBuildResult(int retVal, const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product);
+void appendFatBinaryTargetEntry(const std::string &pointerSize, Ar::ArEncoder &fatbinary, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product);
 int appendGenericIr(Ar::ArEncoder &fatbinary, const std::string &inputFile, OclocArgHelper *argHelper, std::string options);
 std::vector<uint8_t> createEncodedElfWithSpirv(const ArrayRef<const uint8_t> &spirv, const ArrayRef<const uint8_t> &options);
 std::vector<ConstStringRef> getProductForSpecificTarget(const NEO::CompilerOptions::TokenizedString &targets, OclocArgHelper *argHelper);
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/offline_compiler/source/ocloc_parallel_build.h"
+
+#include "shared/offline_compiler/source/ocloc_api.h"
+#include "shared/offline_compiler/source/ocloc_arg_helper.h"
+#include "shared/source/utilities/const_stringref.h"
+
+namespace NEO {
+
+int extractParallelJobsCount(std::vector<std::string> &args, uint32_t &jobsCount, OclocArgHelper *argHelper) {
+    jobsCount = 1u;
+    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
+        if (ConstStringRef("-j") != args[argIndex]) {
+            continue;
+        }
+        if (argIndex + 1 >= args.size()) {
+            argHelper->printf("Error! Missing value for -j option.\n");
+            return OCLOC_INVALID_COMMAND_LINE;
+        }
+
+        const auto &value = args[argIndex + 1];
+        if (value.empty() || value.size() > 4 || !std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            argHelper->printf("Error! Invalid value for -j option: %s\n", value.c_str());
+            return OCLOC_INVALID_COMMAND_LINE;
+        }
+
+        jobsCount = static_cast<uint32_t>(std::stoul(value));
+        if (jobsCount == 0u) {
+            jobsCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        args.erase(args.begin() + argIndex, args.begin() + argIndex + 2);
+        argIndex--;
+    }
+    return OCLOC_SUCCESS;
+}
+
+} // namespace NEO
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+class OclocArgHelper;
+
+namespace NEO {
+
+// Removes "-j <jobs>" from args and returns requested number of parallel jobs in jobsCount.
+// Jobs count 0 selects number of hardware threads, jobs count is 1 when option is not present.
+int extractParallelJobsCount(std::vector<std::string> &args, uint32_t &jobsCount, OclocArgHelper *argHelper);
+
+// Runs task(index) for every index in [0, tasksCount) using up to jobsCount threads, calling thread takes part in execution.
+template <typename TaskT>
+void runParallelTasks(size_t tasksCount, uint32_t jobsCount, TaskT &&task) {
+    std::atomic<size_t> nextTask{0};
+    auto worker = [&]() {
+        for (auto index = nextTask++; index < tasksCount; index = nextTask++) {
+            task(index);
+        }
+    };
+
+    auto threadsCount = std::min(static_cast<size_t>(std::max(jobsCount, 1u)), tasksCount);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threadsCount; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace NEO
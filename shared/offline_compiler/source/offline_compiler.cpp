@@ -1049,6 +1049,13 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argIndex++;
         } else if ("-allow_caching" == currArg) {
             allowCaching = true;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // number of parallel jobs is used only when building for multiple targets
+            argIndex++;
+        } else if ("-compress" == currArg) {
+            argHelper->printf("Error! -compress is supported only when building fatbinary for multiple target devices.\n");
+            retVal = OCLOC_INVALID_COMMAND_LINE;
+            break;
         } else {
             argHelper->printf("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
             retVal = OCLOC_INVALID_COMMAND_LINE;
@@ -1248,6 +1255,18 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
                                             <device_type> can be: %s
                                             - can be single target device.
 
+  -j <jobs>                                 Number of targets built in parallel
+                                            when multiple target devices are provided.
+                                            0 uses number of hardware threads.
+                                            Default is 1.
+
+  -compress                                 Stores each target binary of fatbinary
+                                            in compressed form. Compressed entries
+                                            are decompressed transparently by the
+                                            runtime when the fatbinary is loaded.
+                                            Allowed only when multiple target devices
+                                            are provided.
+
   -o <filename>                             Optional output file name. 
                                             Must not be used with: 
                                             -gen_file | -cpp_file | -output_no_suffix | -output
@@ -1417,6 +1436,7 @@ bool OfflineCompiler::generateElfBinary() {
 
     using namespace NEO::Elf;
     ElfEncoder<EI_CLASS_64> elfEncoder;
+    elfEncoder.setCopySectionData(false);
     elfEncoder.getElfFileHeader().type = ET_OPENCL_EXECUTABLE;
     if (binary.buildOptions.empty() == false) {
         elfEncoder.appendSection(SHT_OPENCL_OPTIONS, SectionNamesOpenCl::buildOptions,
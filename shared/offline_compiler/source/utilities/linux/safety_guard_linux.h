@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,17 +8,25 @@
 #pragma once
 #include "shared/source/helpers/abort.h"
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <execinfo.h>
+#include <mutex>
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+inline thread_local jmp_buf jmpbuf;
+inline thread_local bool jmpbufValid = false;
 
 class SafetyGuardLinux {
   public:
     SafetyGuardLinux() {
+        // guards may be active on multiple threads during parallel builds, signal handlers are per process
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        if (activeGuardsCount++ > 0) {
+            return;
+        }
         struct sigaction sigact {};
 
         sigact.sa_sigaction = sigAction;
@@ -28,6 +36,10 @@ class SafetyGuardLinux {
     }
 
     ~SafetyGuardLinux() {
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        if (--activeGuardsCount > 0) {
+            return;
+        }
         if (previousSigSegvAction.sa_sigaction) {
             sigaction(SIGSEGV, &previousSigSegvAction, NULL);
         }
@@ -37,6 +49,12 @@ class SafetyGuardLinux {
     }
 
     static void sigAction(int sigNum, siginfo_t *info, void *ucontext) {
+        // handler is process wide, signal raised on thread without guarded call is not ours to handle
+        if (!jmpbufValid) {
+            callPreviousHandler(sigNum, info, ucontext);
+            return;
+        }
+
         const int callstackDepth = 30;
         void *addresses[callstackDepth];
         char **callstack;
@@ -53,14 +71,32 @@ class SafetyGuardLinux {
         longjmp(jmpbuf, 1);
     }
 
+    static void callPreviousHandler(int sigNum, siginfo_t *info, void *ucontext) {
+        // previous actions are stored before handler is installed, locking is not async signal safe
+        const auto &previousAction = (sigNum == SIGSEGV) ? previousSigSegvAction : previousSigIllvAction;
+
+        if (previousAction.sa_flags & SA_SIGINFO) {
+            previousAction.sa_sigaction(sigNum, info, ucontext);
+        } else if (previousAction.sa_handler == SIG_DFL) {
+            signal(sigNum, SIG_DFL);
+            raise(sigNum);
+        } else if (previousAction.sa_handler != SIG_IGN) {
+            previousAction.sa_handler(sigNum);
+        }
+    }
+
     template <typename T, typename Object, typename Method>
     T call(Object *object, Method method, T retValueOnCrash) {
         int jump = 0;
         jump = setjmp(jmpbuf);
 
         if (jump == 0) {
-            return (object->*method)();
+            jmpbufValid = true;
+            T retVal = (object->*method)();
+            jmpbufValid = false;
+            return retVal;
         } else {
+            jmpbufValid = false;
             if (onSigSegv) {
                 onSigSegv();
             } else {
@@ -72,6 +108,10 @@ class SafetyGuardLinux {
 
     typedef void (*callbackFunction)();
     callbackFunction onSigSegv = nullptr;
-    struct sigaction previousSigSegvAction {};
-    struct sigaction previousSigIllvAction {};
+
+  protected:
+    static inline std::mutex handlersMutex;
+    static inline uint32_t activeGuardsCount = 0;
+    static inline struct sigaction previousSigSegvAction {};
+    static inline struct sigaction previousSigIllvAction {};
 };
@@ -48,6 +48,20 @@ bool AubHelper::isOneTimeAubWritableAllocationType(const AllocationType &type) {
     }
 }
 
+bool AubHelper::isGpuReadOnlyAllocationType(const AllocationType &type) {
+    switch (type) {
+    case AllocationType::commandBuffer:
+    case AllocationType::constantSurface:
+    case AllocationType::internalHeap:
+    case AllocationType::kernelIsa:
+    case AllocationType::kernelIsaInternal:
+    case AllocationType::linearStream:
+        return true;
+    default:
+        return false;
+    }
+}
+
 uint64_t AubHelper::getTotalMemBankSize(const ReleaseHelper *releaseHelper) {
     if (releaseHelper) {
         return releaseHelper->getTotalMemBankSize();
@@ -20,6 +20,7 @@ struct HardwareInfo;
 class AubHelper : public NonCopyableOrMovableClass {
   public:
     static bool isOneTimeAubWritableAllocationType(const AllocationType &type);
+    static bool isGpuReadOnlyAllocationType(const AllocationType &type);
     static uint64_t getTotalMemBankSize(const ReleaseHelper *releaseHelper);
     static int getMemTrace(uint64_t pdEntryBits);
     static uint64_t getPTEntryBits(uint64_t pdEntryBits);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,10 @@
 
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
+#include "shared/source/utilities/async_file_writer.h"
 
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -143,6 +145,7 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+    std::unique_ptr<NEO::AsyncFileWriter> asyncFileWriter;
 };
 
 template <int addressingBits>
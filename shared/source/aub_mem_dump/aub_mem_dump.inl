@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/aub/aub_helper.h"
 #include "shared/source/aub_mem_dump/aub_mem_dump.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 
@@ -122,8 +123,10 @@ void AubDump<Traits>::reserveAddressGGTTAndWriteMmeory(typename Traits::Stream &
                                                        uint64_t additionalBits, const NEO::AubHelper &aubHelper) {
     auto vmAddr = (gfxAddress + offset) & ~(MemoryConstants::pageSize - 1);
     auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
+    // physically contiguous chunk may span multiple pages, reserve all of them with single set of page table writes
+    auto vmEnd = alignUp(gfxAddress + offset + size, MemoryConstants::pageSize);
 
-    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, MemoryConstants::pageSize, pAddr, additionalBits, aubHelper);
+    AubDump<Traits>::reserveAddressPPGTT(stream, vmAddr, vmEnd - vmAddr, pAddr, additionalBits, aubHelper);
 
     int hint = NEO::AubHelper::getMemTrace(additionalBits);
 
@@ -92,20 +92,33 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 extern const size_t dwordCountMax;
 
 void AubFileStream::open(const char *filePath) {
+    asyncFileWriter.reset();
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+    if (NEO::debugManager.flags.AUBDumpAsyncFileWriter.get() && fileHandle.is_open()) {
+        asyncFileWriter = std::make_unique<NEO::AsyncFileWriter>(fileHandle, NEO::AsyncFileWriter::defaultBufferSize);
+    }
 }
 
 void AubFileStream::close() {
+    asyncFileWriter.reset();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (asyncFileWriter) {
+        asyncFileWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (asyncFileWriter) {
+        asyncFileWriter->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
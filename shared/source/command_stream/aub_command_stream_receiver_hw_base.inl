@@ -656,6 +656,17 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
 
+    const bool coalescePages = debugManager.flags.AUBDumpCoalescePageWrites.get();
+    const bool skipUnchangedPages = debugManager.flags.AUBDumpSkipUnchangedPages.get();
+    if (coalescePages || skipUnchangedPages) {
+        auto writeChunk = [&](const PageWalkChunk &chunk) {
+            AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, chunk.physAddress, chunk.size, chunk.offset, chunk.entryBits,
+                                                  aubHelperHw);
+        };
+        this->walkPagesForUpload(*ppgtt, gpuAddress, cpuAddress, size, memoryBank, entryBits, coalescePages, skipUnchangedPages, writeChunk);
+        return;
+    }
+
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
@@ -776,10 +787,16 @@ SubmissionStatus AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const R
             DEBUG_BREAK_IF(!((gfxAllocation->getUnderlyingBufferSize() == 0) ||
                              !this->isAubWritable(*gfxAllocation)));
         }
+        if (debugManager.flags.AUBDumpSkipUnchangedPages.get()) {
+            this->invalidateUploadedPagesWritableByGpu(*ppgtt, *gfxAllocation, this->getMemoryBank(gfxAllocation));
+        }
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
     }
 
     dumpAubNonWritable = false;
+    if (debugManager.flags.AUBDumpSkipUnchangedPages.get()) {
+        this->printUploadStatistics("AUB");
+    }
     return SubmissionStatus::success;
 }
 
@@ -8,7 +8,10 @@
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/helpers/hardware_context_controller.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/dirty_page_tracker.h"
 #include "shared/source/memory_manager/memory_banks.h"
+#include "shared/source/memory_manager/page_table.h"
 
 #include "aub_mapper_common.h"
 #include "aubstream/hardware_context.h"
@@ -32,6 +35,46 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     void freeEngineInfo(AddressMapper &gttRemap);
     MOCKABLE_VIRTUAL uint32_t getDeviceIndex() const;
 
+    // Walks pages of memory being uploaded to simulator and passes chunks to be written to chunkWriter.
+    // Pages not changed since last upload are skipped when skipUnchangedPages is set,
+    // physically contiguous pages are passed as single chunk when coalescePages is set.
+    template <typename PageTableT, typename ChunkWriterT>
+    void walkPagesForUpload(PageTableT &ppgtt, uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits,
+                            bool coalescePages, bool skipUnchangedPages, ChunkWriterT &chunkWriter) {
+        PageWalkChunkCoalescer<ChunkWriterT> coalescer(chunkWriter);
+
+        auto visitPage = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+            if (skipUnchangedPages && !dirtyPageTracker.checkAndUpdate(physAddress, ptrOffset(cpuAddress, offset), size, entryBits)) {
+                coalescer.flush();
+                return;
+            }
+            coalescer(physAddress, size, offset, entryBits);
+            if (!coalescePages) {
+                coalescer.flush();
+            }
+        };
+
+        ppgtt.pageWalkWithVisitor(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, visitPage, memoryBank);
+        coalescer.flush();
+    }
+    // Resident allocations can be written by GPU in simulator, so their uploaded pages must not be skipped
+    // on next upload even if CPU restores content which was uploaded last.
+    template <typename PageTableT>
+    void invalidateUploadedPagesWritableByGpu(PageTableT &ppgtt, const GraphicsAllocation &gfxAllocation, uint32_t memoryBank) {
+        uint64_t gpuAddress = 0;
+        size_t size = 0;
+        if (dirtyPageTracker.getTrackedPagesCount() == 0 || !getGpuWritableRange(gfxAllocation, gpuAddress, size)) {
+            return;
+        }
+
+        auto invalidatePage = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+            dirtyPageTracker.invalidateContent(physAddress);
+        };
+        ppgtt.pageWalkWithVisitor(static_cast<uintptr_t>(gpuAddress), size, 0, PageTableEntry::nonValidBits, invalidatePage, memoryBank);
+    }
+    bool getGpuWritableRange(const GraphicsAllocation &gfxAllocation, uint64_t &gpuAddress, size_t &size) const;
+    void printUploadStatistics(const char *csrName);
+
   public:
     using CommandStreamReceiverHw<GfxFamily>::peekExecutionEnvironment;
     using CommandStreamReceiverHw<GfxFamily>::writeMemory;
@@ -91,5 +134,6 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     } engineInfo = {};
 
     AubMemDump::AubStream *stream;
+    DirtyPageTracker dirtyPageTracker;
 };
 } // namespace NEO
@@ -125,6 +125,24 @@ template <typename GfxFamily>
 uint32_t CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getDeviceIndex() const {
     return osContext->getDeviceBitfield().any() ? static_cast<uint32_t>(Math::log2(static_cast<uint32_t>(osContext->getDeviceBitfield().to_ulong()))) : 0u;
 }
+template <typename GfxFamily>
+bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getGpuWritableRange(const GraphicsAllocation &gfxAllocation, uint64_t &gpuAddress, size_t &size) const {
+    if (AubHelper::isGpuReadOnlyAllocationType(gfxAllocation.getAllocationType())) {
+        return false;
+    }
+    gpuAddress = peekExecutionEnvironment().rootDeviceEnvironments[gfxAllocation.getRootDeviceIndex()]->getGmmHelper()->decanonize(gfxAllocation.getGpuAddress());
+    size = gfxAllocation.getUnderlyingBufferSize();
+    return size != 0;
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::printUploadStatistics(const char *csrName) {
+    auto statistics = dirtyPageTracker.resetStatistics();
+    PRINT_DEBUG_STRING(debugManager.flags.PrintSkippedUnchangedPages.get(), stdout,
+                       "%s residency upload: %llu bytes written, %llu bytes of unchanged pages skipped\n",
+                       csrName, static_cast<unsigned long long>(statistics.writtenBytes), static_cast<unsigned long long>(statistics.skippedBytes));
+}
+
 template <typename GfxFamily>
 CommandStreamReceiverSimulatedCommonHw<GfxFamily>::CommandStreamReceiverSimulatedCommonHw(ExecutionEnvironment &executionEnvironment,
                                                                                           uint32_t rootDeviceIndex,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@ class TbxStream : public AubMemDump::AubStream {
     void writeMMIOImpl(uint32_t offset, uint32_t value) override;
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override;
     void readMemory(uint64_t physAddress, void *memory, size_t size);
+    void flush();
 };
 
 struct TbxCommandStreamReceiver {
@@ -391,6 +391,9 @@ void TbxCommandStreamReceiverHw<GfxFamily>::submitBatchBufferTbx(uint64_t batchB
 
         this->submitLRCA(contextDescriptor);
     }
+
+    // writes batched by TBX sockets must reach the server to start execution
+    tbxStream.flush();
 }
 
 template <typename GfxFamily>
@@ -420,6 +423,15 @@ void TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
 
+    if (debugManager.flags.TbxSkipUnchangedPages.get()) {
+        auto writeChunk = [&](const PageWalkChunk &chunk) {
+            AUB::reserveAddressGGTTAndWriteMmeory(tbxStream, static_cast<uintptr_t>(gpuAddress), cpuAddress, chunk.physAddress, chunk.size, chunk.offset, chunk.entryBits,
+                                                  aubHelperHw);
+        };
+        this->walkPagesForUpload(*ppgtt, gpuAddress, cpuAddress, size, memoryBank, entryBits, false, true, writeChunk);
+        return;
+    }
+
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
         AUB::reserveAddressGGTTAndWriteMmeory(tbxStream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
@@ -536,10 +548,16 @@ SubmissionStatus TbxCommandStreamReceiverHw<GfxFamily>::processResidency(const R
             DEBUG_BREAK_IF(!((gfxAllocation->getUnderlyingBufferSize() == 0) ||
                              !this->isTbxWritable(*gfxAllocation)));
         }
+        if (debugManager.flags.TbxSkipUnchangedPages.get()) {
+            this->invalidateUploadedPagesWritableByGpu(*ppgtt, *gfxAllocation, this->getMemoryBank(gfxAllocation));
+        }
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
     }
 
     dumpTbxNonWritable = false;
+    if (debugManager.flags.TbxSkipUnchangedPages.get()) {
+        this->printUploadStatistics("TBX");
+    }
     return SubmissionStatus::success;
 }
 
@@ -561,6 +579,10 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocationTbx(GraphicsAlloca
         PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
             DEBUG_BREAK_IF(offset > size);
             tbxStream.readMemory(physAddress, ptrOffset(cpuAddress, offset), size);
+            if (debugManager.flags.TbxSkipUnchangedPages.get()) {
+                // CPU copy matches server memory again, don't upload it back unless it is modified
+                this->dirtyPageTracker.updateContent(physAddress, ptrOffset(cpuAddress, offset), size);
+            }
         };
         ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, 0, walker, this->getMemoryBank(&gfxAllocation));
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,4 +72,8 @@ void TbxStream::readMemory(uint64_t physAddress, void *memory, size_t size) {
     socket->readMemory(physAddress, memory, size);
 }
 
+void TbxStream::flush() {
+    socket->flush();
+}
+
 } // namespace NEO
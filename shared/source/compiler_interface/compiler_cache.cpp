@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
 #include "shared/source/helpers/file_io.h"
@@ -19,6 +20,7 @@
 #include "config.h"
 #include "os_inc.h"
 
+#include <chrono>
 #include <cstring>
 #include <iomanip>
 #include <mutex>
@@ -28,10 +30,10 @@
 namespace NEO {
 std::mutex CompilerCache::cacheAccessMtx;
 
-const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
-                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
-                                                   const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
-                                                   const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
+std::string CompilerCache::getCachedFileHash(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
+                                             const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                             const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
+                                             const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
     Hash hash;
 
     hash.update("----", 4);
@@ -65,10 +67,18 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
            << std::setw(sizeof(res) * 2)
            << std::hex
            << res;
+    return stream.str();
+}
+
+const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
+                                                   const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
+    auto fileHash = getCachedFileHash(hwInfo, input, options, internalOptions, specIds, specValues, igcRevision, igcLibSize, igcLibMTime);
 
     if (debugManager.flags.BinaryCacheTrace.get()) {
-        std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
-        std::string inputFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".input";
+        std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + fileHash + ".trace";
+        std::string inputFilePath = config.cacheDir + PATH_SEPARATOR + fileHash + ".input";
         std::lock_guard<std::mutex> lock(cacheAccessMtx);
         auto fp = NEO::IoFunctions::fopenPtr(traceFilePath.c_str(), "w");
         if (fp) {
@@ -129,10 +139,53 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
         }
     }
 
-    return stream.str();
+    return fileHash;
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+void CompilerCache::compressBinaryIfEnabled(const char *&pBinary, size_t &binarySize, std::vector<uint8_t> &storage) const {
+    if ((false == config.compressionEnabled) || (nullptr == pBinary) || (0U == binarySize)) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    storage = CompressedBinary::compress(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(pBinary), binarySize));
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "[Cache] Compressed binary %zu -> %zu bytes (ratio %.2f) in %lld us\n",
+                       binarySize, storage.size(), static_cast<double>(binarySize) / storage.size(), static_cast<long long>(elapsed.count()));
+
+    pBinary = reinterpret_cast<const char *>(storage.data());
+    binarySize = storage.size();
+}
+
+std::unique_ptr<char[]> CompilerCache::decompressCachedBinary(std::unique_ptr<char[]> cachedBinary, size_t &cachedBinarySize) {
+    ArrayRef<const uint8_t> container(reinterpret_cast<const uint8_t *>(cachedBinary.get()), cachedBinarySize);
+    if ((nullptr == cachedBinary) || (false == CompressedBinary::isCompressed(container))) {
+        return cachedBinary;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t decompressedSize = 0U;
+    std::unique_ptr<char[]> decompressed;
+    if (CompressedBinary::getDecompressedSize(container, decompressedSize)) {
+        decompressed.reset(new char[decompressedSize]);
+        if (false == CompressedBinary::decompress(container, ArrayRef<uint8_t>(reinterpret_cast<uint8_t *>(decompressed.get()), decompressedSize))) {
+            decompressed.reset();
+        }
+    }
+    if (nullptr == decompressed) {
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "[Cache failure]: Decompressing cached binary failed!\n");
+        cachedBinarySize = 0U;
+        return nullptr;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "[Cache] Decompressed binary %zu -> %zu bytes in %lld us\n",
+                       cachedBinarySize, decompressedSize, static_cast<long long>(elapsed.count()));
+    cachedBinarySize = decompressedSize;
+    return decompressed;
+}
+
 } // namespace NEO
@@ -15,6 +15,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct HardwareInfo;
@@ -24,6 +25,7 @@ struct CompilerCacheConfig {
     std::string cacheFileExtension;
     std::string cacheDir;
     size_t cacheSize = 0;
+    bool compressionEnabled = false;
 };
 
 class CompilerCache {
@@ -39,6 +41,11 @@ class CompilerCache {
         return config;
     }
 
+    // hash of all build inputs, shared by file names of this cache and keys of in-memory cache so they can't drift apart
+    static std::string getCachedFileHash(const HardwareInfo &hwInfo, ArrayRef<const char> input,
+                                         ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                         ArrayRef<const char> specIds, ArrayRef<const char> specValues,
+                                         ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime);
     const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                         ArrayRef<const char> options, ArrayRef<const char> internalOptions,
                                         ArrayRef<const char> specIds, ArrayRef<const char> specValues,
@@ -52,6 +59,10 @@ class CompilerCache {
     MOCKABLE_VIRTUAL bool renameTempFileBinaryToProperName(const std::string &oldName, const std::string &kernelFileHash);
     MOCKABLE_VIRTUAL bool createUniqueTempFileAndWriteData(char *tmpFilePathTemplate, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL void lockConfigFileAndReadSize(const std::string &configFilePath, UnifiedHandle &fd, size_t &directorySize);
+    // when compression is enabled, replaces binary with compressed container kept in storage
+    void compressBinaryIfEnabled(const char *&pBinary, size_t &binarySize, std::vector<uint8_t> &storage) const;
+    // entries are decompressed regardless of current config, so that cache may contain both kinds of files
+    static std::unique_ptr<char[]> decompressCachedBinary(std::unique_ptr<char[]> cachedBinary, size_t &cachedBinarySize);
 
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
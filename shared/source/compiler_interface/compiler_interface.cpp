@@ -12,6 +12,7 @@
 #include "shared/source/compiler_interface/compiler_interface.inl"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/igc_platform_helper.h"
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
@@ -28,6 +29,7 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 #include "ocl_igc_interface/platform_helper.h"
 
+#include <algorithm>
 #include <fstream>
 
 namespace NEO {
@@ -63,6 +65,41 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         return TranslationOutput::ErrorCode::compilerNotAvailable;
     }
 
+    if (inMemoryCache != nullptr && input.allowCaching && input.gtPinInput == nullptr) {
+        auto cacheKey = getInMemoryCacheKey(device, input);
+        return inMemoryCache->getOrBuild(cacheKey, output, [&](TranslationOutput &buildOutput) {
+            return buildImpl(device, input, buildOutput);
+        });
+    }
+
+    return buildImpl(device, input, output);
+}
+
+std::string CompilerInterface::getInMemoryCacheKey(const NEO::Device &device, const TranslationInput &input) const {
+    std::vector<std::pair<uint32_t, uint64_t>> specConstants(input.specializedValues.begin(), input.specializedValues.end());
+    std::sort(specConstants.begin(), specConstants.end());
+
+    // same layout as spec constant buffers passed to IGC and hashed by on-disk cache
+    std::vector<uint32_t> specIds;
+    std::vector<uint64_t> specValues;
+    for (const auto &specConst : specConstants) {
+        specIds.push_back(specConst.first);
+        specValues.push_back(specConst.second);
+    }
+
+    auto fileHash = CompilerCache::getCachedFileHash(device.getHardwareInfo(), input.src, input.apiOptions, input.internalOptions,
+                                                     ArrayRef<const char>::fromAny(specIds.data(), specIds.size()),
+                                                     ArrayRef<const char>::fromAny(specValues.data(), specValues.size()),
+                                                     igcRevision, igcLibSize, igcLibMTime);
+
+    // single entry holds whole build output, so translation path is part of the key
+    return fileHash + "_" + std::to_string(input.srcType) + "_" + std::to_string(input.preferredIntermediateType) + "_" + std::to_string(input.outType);
+}
+
+TranslationOutput::ErrorCode CompilerInterface::buildImpl(
+    const NEO::Device &device,
+    const TranslationInput &input,
+    TranslationOutput &output) {
     IGC::CodeType::CodeType_t srcCodeType = input.srcType;
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::undefined;
 
@@ -407,10 +444,24 @@ bool CompilerInterface::initialize(std::unique_ptr<CompilerCache> &&cache, bool
 
     this->cache.swap(cache);
 
+    if (debugManager.flags.InMemoryCompilerCacheSize.get() > 0) {
+        auto &processInMemoryCache = InMemoryCompilerCache::getProcessInstance();
+        processInMemoryCache.setMaxSize(static_cast<size_t>(debugManager.flags.InMemoryCompilerCacheSize.get()));
+        this->inMemoryCache = &processInMemoryCache;
+    }
+
     return this->cache && igcAvailable && (fclAvailable || (false == requireFcl)) && compilerVersionCorrect;
 }
 
 IGC::FclOclDeviceCtxTagOCL *CompilerInterface::getFclDeviceCtx(const Device &device) {
+    {
+        std::shared_lock<std::shared_mutex> readLock(deviceContextsMtx);
+        auto it = fclDeviceContexts.find(&device);
+        if (it != fclDeviceContexts.end()) {
+            return it->second.get();
+        }
+    }
+
     auto ulock = this->lock();
     auto it = fclDeviceContexts.find(&device);
     if (it != fclDeviceContexts.end()) {
@@ -437,12 +488,21 @@ IGC::FclOclDeviceCtxTagOCL *CompilerInterface::getFclDeviceCtx(const Device &dev
         const auto &hwInfo = device.getHardwareInfo();
         populateIgcPlatform(*igcPlatform, hwInfo);
     }
+    std::unique_lock<std::shared_mutex> writeLock(deviceContextsMtx);
     fclDeviceContexts[&device] = std::move(newDeviceCtx);
 
     return fclDeviceContexts[&device].get();
 }
 
 IGC::IgcOclDeviceCtxTagOCL *CompilerInterface::getIgcDeviceCtx(const Device &device) {
+    {
+        std::shared_lock<std::shared_mutex> readLock(deviceContextsMtx);
+        auto it = igcDeviceContexts.find(&device);
+        if (it != igcDeviceContexts.end()) {
+            return it->second.get();
+        }
+    }
+
     auto ulock = this->lock();
     auto it = igcDeviceContexts.find(&device);
     if (it != igcDeviceContexts.end()) {
@@ -482,6 +542,7 @@ IGC::IgcOclDeviceCtxTagOCL *CompilerInterface::getIgcDeviceCtx(const Device &dev
     igcFtrWa->SetFtrWddm2Svm(device.getHardwareInfo().featureTable.flags.ftrWddm2Svm);
     igcFtrWa->SetFtrPooledEuEnabled(device.getHardwareInfo().featureTable.flags.ftrPooledEuEnabled);
 
+    std::unique_lock<std::shared_mutex> writeLock(deviceContextsMtx);
     igcDeviceContexts[&device] = std::move(newDeviceCtx);
     return igcDeviceContexts[&device].get();
 }
@@ -15,6 +15,8 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
 #include <map>
+#include <shared_mutex>
+#include <string>
 #include <unordered_map>
 
 namespace NEO {
@@ -22,6 +24,7 @@ enum class SipKernelType : std::uint32_t;
 class OsLibrary;
 class CompilerCache;
 class Device;
+class InMemoryCompilerCache;
 struct TargetDevice;
 
 using specConstValuesMap = std::unordered_map<uint32_t, uint64_t>;
@@ -134,6 +137,8 @@ class CompilerInterface {
 
   protected:
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> &&cache, bool requireFcl);
+    TranslationOutput::ErrorCode buildImpl(const NEO::Device &device, const TranslationInput &input, TranslationOutput &output);
+    std::string getInMemoryCacheKey(const NEO::Device &device, const TranslationInput &input) const;
     MOCKABLE_VIRTUAL bool loadFcl();
     MOCKABLE_VIRTUAL bool loadIgc();
 
@@ -150,10 +155,14 @@ class CompilerInterface {
         return std::unique_lock<SpinLock>{spinlock};
     }
     std::unique_ptr<CompilerCache> cache;
+    InMemoryCompilerCache *inMemoryCache = nullptr;
 
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using fclDevCtxUptr = CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL>;
 
+    // device contexts are only added, lookups of already created contexts don't take global spinlock
+    std::shared_mutex deviceContextsMtx;
+
     std::unique_ptr<OsLibrary> igcLib;
     CIF::RAII::UPtr_t<CIF::CIFMain> igcMain;
     std::map<const Device *, igcDevCtxUptr> igcDeviceContexts;
@@ -21,6 +21,7 @@ namespace NEO {
 const std::string neoCachePersistent = "NEO_CACHE_PERSISTENT";
 const std::string neoCacheMaxSize = "NEO_CACHE_MAX_SIZE";
 const std::string neoCacheDir = "NEO_CACHE_DIR";
+const std::string neoCacheCompression = "NEO_CACHE_COMPRESSION";
 
 const int64_t neoCacheMaxSizeDefault = static_cast<int64_t>(MemoryConstants::gigaByte);
 
@@ -53,6 +54,8 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
             ret.cacheSize = std::numeric_limits<size_t>::max();
         }
 
+        ret.compressionEnabled = envReader.getSetting(neoCacheCompression.c_str(), false);
+
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stdout, "NEO_CACHE_PERSISTENT is enabled. Cache is located in: %s\n\n",
                            ret.cacheDir.c_str());
 
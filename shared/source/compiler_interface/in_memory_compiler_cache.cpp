@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
+
+namespace NEO {
+
+InMemoryCompilerCache &InMemoryCompilerCache::getProcessInstance() {
+    static InMemoryCompilerCache processInstance(0u);
+    return processInstance;
+}
+
+void InMemoryCompilerCache::copyTranslationOutput(const TranslationOutput &src, TranslationOutput &dst) {
+    auto copyMemAndSize = [](const TranslationOutput::MemAndSize &src, TranslationOutput::MemAndSize &dst) {
+        dst.mem = makeCopy(src.mem.get(), src.size);
+        dst.size = src.size;
+    };
+
+    dst.intermediateCodeType = src.intermediateCodeType;
+    copyMemAndSize(src.intermediateRepresentation, dst.intermediateRepresentation);
+    copyMemAndSize(src.deviceBinary, dst.deviceBinary);
+    copyMemAndSize(src.debugData, dst.debugData);
+    dst.frontendCompilerLog = src.frontendCompilerLog;
+    dst.backendCompilerLog = src.backendCompilerLog;
+}
+
+TranslationOutput::ErrorCode InMemoryCompilerCache::getOrBuild(const std::string &key, TranslationOutput &output, const BuildFunctionT &buildFunction) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    auto cacheEntry = entries.find(key);
+    if (cacheEntry != entries.end()) {
+        statistics.hits++;
+        lruList.splice(lruList.begin(), lruList, cacheEntry->second.lruPosition);
+        auto cachedBuild = cacheEntry->second.build;
+        lock.unlock();
+
+        copyTranslationOutput(cachedBuild->output, output);
+        return cachedBuild->errorCode;
+    }
+
+    auto inFlightEntry = inFlightBuilds.find(key);
+    if (inFlightEntry != inFlightBuilds.end()) {
+        statistics.inFlightWaits++;
+        auto inFlightBuild = inFlightEntry->second;
+        inFlightBuild->completed.wait(lock, [&inFlightBuild] { return inFlightBuild->result != nullptr; });
+        auto cachedBuild = inFlightBuild->result;
+        lock.unlock();
+
+        copyTranslationOutput(cachedBuild->output, output);
+        return cachedBuild->errorCode;
+    }
+
+    statistics.misses++;
+    auto inFlightBuild = std::make_shared<InFlightBuild>();
+    inFlightBuilds.emplace(key, inFlightBuild);
+    lock.unlock();
+
+    auto newBuild = std::make_shared<CachedBuild>();
+    {
+        // waiters are released on every exit path, build that did not finish is reported with its default error code
+        struct InFlightBuildCompletion {
+            ~InFlightBuildCompletion() { cache.completeInFlightBuild(key, inFlightBuild, build); }
+            InMemoryCompilerCache &cache;
+            const std::string &key;
+            InFlightBuild &inFlightBuild;
+            const std::shared_ptr<CachedBuild> &build;
+        } inFlightBuildCompletion{*this, key, *inFlightBuild, newBuild};
+
+        newBuild->errorCode = buildFunction(newBuild->output);
+        newBuild->size = newBuild->output.intermediateRepresentation.size + newBuild->output.deviceBinary.size + newBuild->output.debugData.size +
+                         newBuild->output.frontendCompilerLog.size() + newBuild->output.backendCompilerLog.size();
+    }
+
+    copyTranslationOutput(newBuild->output, output);
+    return newBuild->errorCode;
+}
+
+void InMemoryCompilerCache::completeInFlightBuild(const std::string &key, InFlightBuild &inFlightBuild, const std::shared_ptr<const CachedBuild> &build) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        inFlightBuilds.erase(key);
+        if (build->errorCode == TranslationOutput::ErrorCode::success) {
+            insert(key, build);
+        }
+        inFlightBuild.result = build;
+    }
+    inFlightBuild.completed.notify_all();
+}
+
+InMemoryCompilerCacheStatistics InMemoryCompilerCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+void InMemoryCompilerCache::setMaxSize(size_t newMaxSize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    maxSize = newMaxSize;
+    while (statistics.usedSize > maxSize) {
+        evictLeastRecentlyUsed();
+    }
+}
+
+size_t InMemoryCompilerCache::getMaxSize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return maxSize;
+}
+
+void InMemoryCompilerCache::insert(const std::string &key, const std::shared_ptr<const CachedBuild> &build) {
+    if (build->size > maxSize) {
+        return;
+    }
+
+    while (statistics.usedSize + build->size > maxSize) {
+        evictLeastRecentlyUsed();
+    }
+
+    lruList.push_front(key);
+    entries[key] = {build, lruList.begin()};
+    statistics.usedSize += build->size;
+    statistics.entries = entries.size();
+}
+
+void InMemoryCompilerCache::evictLeastRecentlyUsed() {
+    UNRECOVERABLE_IF(lruList.empty());
+
+    auto evictedEntry = entries.find(lruList.back());
+    statistics.usedSize -= evictedEntry->second.build->size;
+    statistics.evictions++;
+    entries.erase(evictedEntry);
+    lruList.pop_back();
+    statistics.entries = entries.size();
+}
+
+} // namespace NEO
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+struct InMemoryCompilerCacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t inFlightWaits = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t usedSize = 0;
+};
+
+// Size bounded LRU of build results keyed by hash of build inputs.
+// Concurrent builds of the same key are deduplicated - only first caller builds, others wait for its result.
+class InMemoryCompilerCache : public NonCopyableOrMovableClass {
+  public:
+    using BuildFunctionT = std::function<TranslationOutput::ErrorCode(TranslationOutput &)>;
+
+    InMemoryCompilerCache(size_t maxSize) : maxSize(maxSize) {}
+    virtual ~InMemoryCompilerCache() = default;
+
+    static InMemoryCompilerCache &getProcessInstance();
+    static void copyTranslationOutput(const TranslationOutput &src, TranslationOutput &dst);
+
+    TranslationOutput::ErrorCode getOrBuild(const std::string &key, TranslationOutput &output, const BuildFunctionT &buildFunction);
+
+    InMemoryCompilerCacheStatistics getStatistics() const;
+    void setMaxSize(size_t newMaxSize);
+    size_t getMaxSize() const;
+
+  protected:
+    struct CachedBuild {
+        TranslationOutput::ErrorCode errorCode = TranslationOutput::ErrorCode::unknownError;
+        TranslationOutput output;
+        size_t size = 0;
+    };
+
+    struct InFlightBuild {
+        std::condition_variable completed;
+        std::shared_ptr<const CachedBuild> result;
+    };
+
+    struct CacheEntry {
+        std::shared_ptr<const CachedBuild> build;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    void completeInFlightBuild(const std::string &key, InFlightBuild &inFlightBuild, const std::shared_ptr<const CachedBuild> &build);
+    void insert(const std::string &key, const std::shared_ptr<const CachedBuild> &build);
+    void evictLeastRecentlyUsed();
+
+    mutable std::mutex mtx;
+    std::list<std::string> lruList;
+    std::unordered_map<std::string, CacheEntry> entries;
+    std::unordered_map<std::string, std::shared_ptr<InFlightBuild>> inFlightBuilds;
+    InMemoryCompilerCacheStatistics statistics;
+    size_t maxSize;
+};
+
+} // namespace NEO
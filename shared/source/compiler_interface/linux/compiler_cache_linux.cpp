@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -217,6 +217,9 @@ class HandleGuard {
 };
 
 bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    std::vector<uint8_t> compressedStorage;
+    compressBinaryIfEnabled(pBinary, binarySize, compressedStorage);
+
     if (pBinary == nullptr || binarySize == 0 || binarySize > config.cacheSize) {
         return false;
     }
@@ -280,6 +283,7 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
 
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    auto cachedBinary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    return decompressCachedBinary(std::move(cachedBinary), cachedBinarySize);
 }
 } // namespace NEO
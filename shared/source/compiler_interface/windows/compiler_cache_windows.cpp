@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -252,6 +252,9 @@ void writeDirSizeToConfigFile(void *hConfigFile, size_t directorySize) {
 }
 
 bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    std::vector<uint8_t> compressedStorage;
+    compressBinaryIfEnabled(pBinary, binarySize, compressedStorage);
+
     if (pBinary == nullptr || binarySize == 0 || binarySize > config.cacheSize) {
         return false;
     }
@@ -317,6 +320,7 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    auto cachedBinary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    return decompressCachedBinary(std::move(cachedBinary), cachedBinarySize);
 }
 } // namespace NEO
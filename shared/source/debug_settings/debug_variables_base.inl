@@ -30,6 +30,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ClDeviceGlobalMemSizeAvailablePercent, -1, "Perc
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB, 5 - NULL AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(int32_t, HBMSizePerTileInGigabytes, 0, "Size of HBM memory in GigaBytes per tile.")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxBatchedWritesBufferSize, -1, "-1: default (disabled), >0: size in KB of buffer collecting TBX write messages (MMIO, GTT and memory writes) which are sent to TBX server together when buffer is full or before any read")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
 DECLARE_DEBUG_VARIABLE(bool, AddPatchInfoCommentsForAUBDump, false, "Dump comments containing allocations and patching information")
@@ -37,6 +38,12 @@ DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aubstream for aub dumping"
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumping buffers and images on clEnqueueReadBuffer/Image only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force dumping allocations on clEnqueueSVMMemcpy only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpCoalescePageWrites, false, "Dump physically contiguous pages of allocation to AUB with single page table reservation and memory write instead of one per page")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpSkipUnchangedPages, false, "Skip dumping pages to AUB when their content and page table entry did not change since they were last dumped, pages of allocations writable by GPU are dumped again after each submission they were resident in")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpAsyncFileWriter, false, "Write AUB file from background thread, stream data is accumulated in large buffers")
+DECLARE_DEBUG_VARIABLE(bool, TbxSkipUnchangedPages, false, "Upload to TBX server only pages whose content or page table entry changed since they were last uploaded or downloaded, pages of allocations writable by GPU are uploaded again after each submission they were resident in")
+DECLARE_DEBUG_VARIABLE(bool, PrintTbxTransportStatistics, false, "Print number of messages, bytes, send calls and round trips exchanged with TBX server and message rate when TBX connection is closed")
+DECLARE_DEBUG_VARIABLE(bool, PrintSkippedUnchangedPages, false, "Print number of bytes uploaded and skipped as unchanged in each AUB/TBX residency upload, requires AUBDumpSkipUnchangedPages or TbxSkipUnchangedPages")
 DECLARE_DEBUG_VARIABLE(bool, GenerateAubFilePerProcessId, false, "Generate aub file with process id")
 DECLARE_DEBUG_VARIABLE(bool, SetBufferHostMemoryAlwaysAubWritable, false, "Make buffer host memory allocation always uploaded to AUB/TBX")
 
@@ -50,6 +57,7 @@ DECLARE_DEBUG_VARIABLE(bool, FlushAllCaches, false, "Pipe controls between enque
 DECLARE_DEBUG_VARIABLE(bool, DoNotFlushCaches, false, "Clear all possible cache flush flags from pipe controls between enqueue flush")
 DECLARE_DEBUG_VARIABLE(bool, MakeEachEnqueueBlocking, false, "Equivalent of finish after each enqueue")
 DECLARE_DEBUG_VARIABLE(bool, DisableResourceRecycling, false, "Disable resource recycling optimization")
+DECLARE_DEBUG_VARIABLE(int32_t, ReusableAllocationsIdleTimeToTrim, -1, "Time in milliseconds after which completed allocations stored for reuse are released when memory budget is exhausted. -1: default (1000 ms), >=0: idle time")
 DECLARE_DEBUG_VARIABLE(bool, TrackParentEvents, false, "Events track their parents")
 DECLARE_DEBUG_VARIABLE(bool, RebuildPrecompiledKernels, false, "Forces driver to recompile precompiled kernels from sources; applies to builtin and user kernels")
 DECLARE_DEBUG_VARIABLE(bool, DisableKernelRecompilation, false, "Disable kernel recompilation")
@@ -80,6 +88,7 @@ DECLARE_DEBUG_VARIABLE(bool, DisableForceToStateless, false, "Do not force state
 DECLARE_DEBUG_VARIABLE(bool, ForceTheoreticalMaxWorkGroupCount, false, "Do not apply any limitation to max cooperative/concurrent work-group count queries")
 DECLARE_DEBUG_VARIABLE(bool, DontDisableZebinIfVmeUsed, false, "When enabled, driver will not add -cl-intel-disable-zebin internal option when vme is used")
 DECLARE_DEBUG_VARIABLE(bool, AppendMemoryPrefetchForKmdMigratedSharedAllocations, true, "Allow prefetching shared memory to the device associated with the specified command list")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLearningPrefetchForKmdMigratedSharedAllocations, -1, "Overrides learning prefetch setting of all contexts, works with KMD migration only. -1: default (per context setting), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(bool, ForceMemoryPrefetchForKmdMigratedSharedAllocations, false, "Force prefetch of shared memory in command queue execute command lists")
 DECLARE_DEBUG_VARIABLE(bool, ClKhrExternalMemoryExtension, true, "Enable cl_khr_external_memory extension")
 DECLARE_DEBUG_VARIABLE(bool, WaitForMemoryRelease, false, "Wait for memory release when out of memory")
@@ -142,6 +151,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteRegisterData, 0, "register dat
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmAllocationSize, -1, "-1: default, >=0: program value for shared local memory size")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerLogBitmask, 0, "0: logs disabled, 1 - INFO, 2 - ERROR, 1<<10 - Dump elf, see DebugVariables::DEBUGGER_LOG_BITMASK")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerForceSbaTrackingMode, -1, "-1: default, 0: per context address spaces, 1: single address space")
+DECLARE_DEBUG_VARIABLE(int32_t, DebuggerStateSaveAreaSnapshot, -1, "-1: default (disabled), 0: disabled, 1: read whole state save area of context once and serve register reads of stopped threads from this copy until threads are resumed")
+DECLARE_DEBUG_VARIABLE(int32_t, DebuggerParallelTileEventProcessing, -1, "-1: default (disabled), 0: disabled, 1: generate events and resume stopped threads of tile sessions concurrently when more than one tile has pending events")
 DECLARE_DEBUG_VARIABLE(int32_t, DebugApiUsed, 0, "0: default L0 Debug API not used, 1: L0 Debug API used")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideCsrAllocationSize, -1, "-1: default, >0: use value for size of CSR allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, CFEComputeOverdispatchDisable, -1, "Set Compute Overdispatch Disable field in CFE_STATE, -1: do not set.")
@@ -269,6 +280,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, WaitForUserFenceOnEventHostSynchronize, -1, "-1:
 DECLARE_DEBUG_VARIABLE(int32_t, DisableSystemPointerKernelArgument, -1, "-1: default, 0: Disabled, 1: using a system pointer for kernel argument returns an error.")
 DECLARE_DEBUG_VARIABLE(int32_t, ProgramUserInterruptOnResolvedDependency, -1, "-1: default, 0: Disabled, 1: On signaling append completion (if possible) - for example in-order counter update")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderRegularCmdListPatching, -1, "-1: default, 0: Disabled, 1: If set, patch counter value on execute call")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderBatchedPatching, -1, "-1: default, 0: Disabled, 1: Patch counter values of regular command list through per command type batches built once after append")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderRelaxedOrderingForEventsChaining, -1, "-1: default, 0: Disabled, 1: If set, send 2 immediate flushes to avoid stalling RelaxedOrdering Scheduler.")
 DECLARE_DEBUG_VARIABLE(int32_t, InOrderAtomicSignallingEnabled, -1, "-1: default, 0: disabled, 1: Use atomic GPU operations in increment the counter. Otherwise use non-atomic commands like SDI.")
 DECLARE_DEBUG_VARIABLE(int32_t, InOrderDuplicatedCounterStorageEnabled, -1, "-1: default, 0: disabled, 1: Allocate additional host storage for signalling")
@@ -305,6 +317,11 @@ DECLARE_DEBUG_VARIABLE(bool, LogAllocationType, false, "Logs allocation type to
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationStdout, false, "Log allocations to stdout instead of file")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
 DECLARE_DEBUG_VARIABLE(bool, LogWaitingForCompletion, false, "Logs waiting for completion")
+DECLARE_DEBUG_VARIABLE(int32_t, BufferedLogWriter, -1, "-1: default (disabled), 0: disabled, 1: log file lines are kept in per-thread buffers and written by background thread through persistent file handle, 2: same as 1 with compact binary records (timestamp, thread id, length, payload)")
+DECLARE_DEBUG_VARIABLE(int64_t, BufferedLogWriterMaxFileSize, -1, "-1: default (no limit), >0: size in bytes after which buffered log file is rotated to <name>.1")
+DECLARE_DEBUG_VARIABLE(int32_t, ApiFlightRecorder, -1, "-1: default (disabled), 0: disabled, >0: record every OpenCL and Level Zero core API entry and exit into per-thread binary ring buffers keeping given number of records per thread, dumped at exit")
+DECLARE_DEBUG_VARIABLE(std::string, ApiFlightRecorderDumpFile, std::string("unk"), "File name for API flight recorder dump, unk: api_flight_recorder.bin in current directory")
+DECLARE_DEBUG_VARIABLE(int32_t, ApiFlightRecorderDumpSignal, -1, "-1: default (disabled), >0: Linux only, signal number requesting API flight recorder dump, previously installed handler of that signal is still called")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
@@ -332,6 +349,10 @@ DECLARE_DEBUG_VARIABLE(bool, LogGdiCallsToFile, false, "Log GDI calls to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintGmmCompressionParams, false, "Print Gmm compression resource params")
 DECLARE_DEBUG_VARIABLE(bool, PrintCpuFlags, false, "Print CPU Flags and properties upon detection")
 DECLARE_DEBUG_VARIABLE(bool, PrintL0MetricLogs, false, "Print Logs from L0 Metrics")
+DECLARE_DEBUG_VARIABLE(std::string, MetricStreamerExportFile, std::string("unk"), "Path prefix of files metric streamer data is drained to by background thread, file segments are named PREFIX_PID_STREAMER_SEGMENT.bin. Export takes over streamer data, zetMetricStreamerReadData returns only data not drained yet. Streamer is not exported when file cannot be created; unk: default - export disabled")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricStreamerExportSegmentSize, -1, "Size of single metric streamer export file segment in KB, -1: default - 65536")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricStreamerExportSegmentCount, -1, "Number of metric streamer export file segments reused in round robin, -1: default - 2")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricStreamerExportPeriod, -1, "Period of draining metric streamer to export file in microseconds, -1: default - 1000")
 
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
@@ -382,7 +403,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default (enabled, 1MB), 0: disabled, >=1: enabled, size in MB")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationPool, -1, "-1: default (enabled, 1MB), 0: disabled, >=1: enabled, size in MB")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrStagingRing, -1, "-1: default (disabled), 0: disabled, 1: enabled. Buffer reads and writes using non-USM host pointers are copied through persistent host USM staging ring instead of creating userptr allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, HostPtrStagingRingChunkSize, -1, "-1: default (256KB), >0: size in KB of staging ring chunk, larger transfers are split into per-chunk copies")
+DECLARE_DEBUG_VARIABLE(int32_t, HostPtrStagingRingChunkCount, -1, "-1: default (8), >0: number of staging ring chunks, chunk is reused when copy using it completes, transfers up to size of whole ring are staged")
 DECLARE_DEBUG_VARIABLE(int32_t, UseLocalPreferredForCacheableBuffers, -1, "Use localPreferred for cacheable buffers")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncEventsHandlerUseTaskCountHeaps, -1, "-1: default (disabled), 0: disabled, 1: enabled. Async events handler keeps submitted events in per CSR min-heaps ordered by task count and checks only the lowest outstanding task count of each CSR")
+DECLARE_DEBUG_VARIABLE(int64_t, InMemoryCompilerCacheSize, -1, "-1: default (disabled), >0: size in bytes of process wide in-memory cache of build results shared by all compiler interfaces")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncProgramBuildWorkers, -1, "-1: default (disabled), 0: disabled, >0: clBuildProgram called with callback builds asynchronously on given number of worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelProgramBuildForRootDevices, -1, "-1: default (disabled), 0: disabled, 1: enabled. Program build compiles binaries for different root devices of multi root device context on separate threads")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanTelemetrySamplingPeriod, -1, "Period in microseconds of background sampling of frequently read sysman PMT telemetry, getters return last sampled value with its sampling timestamp. -1: default (disabled, every read goes to file), >0: sampling period")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -423,6 +452,7 @@ DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmSharedMigrationChunkSize, -1, "Granularity of CPU/GPU migration of shared allocations handled by UMD page fault manager, aligned to page size. -1: default (whole allocation), >0: size of migrated chunk in bytes")
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv extension")
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
@@ -514,6 +544,12 @@ DECLARE_DEBUG_VARIABLE(int32_t, SignalAllEventPackets, -1, "All packets of event
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBcsSwControlWa, -1, "Enable BCS WA via BCSSWCONTROL MMIO. -1: default, 0: disabled, 1: if src in system mem, 2: if dst in system mem, 3: if src and dst in system mem, 4: always")
 DECLARE_DEBUG_VARIABLE(bool, EnableHostAllocationMemPolicy, false, "Enables Memory Policy for host allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideHostAllocationMemPolicyMode, -1, "Override Memory Policy mode for host allocation -1: default (use the system configuration), 0: MPOL_DEFAULT, 1: MPOL_PREFERRED, 2: MPOL_BIND, 3: MPOL_INTERLEAVED, 4: MPOL_LOCAL, 5: MPOL_PREFERRED_MANY")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostAllocationNumaPlacement, -1, "-1: default (enabled), 0: disabled, 1: enabled. Places driver allocated host memory on NUMA node closest to device or on node requested by allocation")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideHostAllocationNumaNode, -1, "-1: default (node requested by allocation, otherwise node closest to device), >=0: NUMA node used for host allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostAllocationNumaPageMigration, -1, "-1: default (disabled), 0: disabled, 1: enabled. When enabled, pages of host allocation faulted before NUMA policy is applied are migrated to selected node")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostAllocationHugePages, -1, "-1: default (disabled), 0: disabled, 1: transparent huge pages (madvise), 2: hugetlbfs 2MB pages with fallback to transparent huge pages. Backs driver allocated host memory above threshold with huge pages, such allocations use userptr instead of BO mmap")
+DECLARE_DEBUG_VARIABLE(int32_t, HostAllocationHugePagesThreshold, -1, "Minimal size in KB of host allocation backed with huge pages when EnableHostAllocationHugePages is set, -1: default (2048)")
+DECLARE_DEBUG_VARIABLE(bool, PrintHostAllocationHugePagesStatistics, false, "Print number and size of host allocations backed with hugetlbfs and transparent huge pages and number of fallbacks to regular pages when memory manager is destroyed")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableFtrTile64Optimization, 0, "Control feature Tile64 Optimization flag passed to gmmlib. -1: pass as-is, 0: disable flag(default due to NEO-10623), 1: enable flag");
 
 /* IMPLICIT SCALING */
@@ -540,6 +576,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableEventsReadyQueue, -1, "Experimentally unblock OpenCL events waiting on a completed event through an explicit per thread ready queue instead of recursive calls. Events are unblocked and callbacks run in the same order as with recursive calls. -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
 
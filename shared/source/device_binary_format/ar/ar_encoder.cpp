@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 
+#include "shared/source/device_binary_format/binary_writer.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -23,41 +25,74 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
         return nullptr;
     }
 
-    auto alignedFileSize = fileData.size() + (fileData.size() & 1U);
+    ArrayRef<const uint8_t> entryData = fileData;
+    if (compressFileData && (false == fileData.empty())) {
+        auto compressed = CompressedBinary::compress(fileData);
+        copiedData.push_back(std::make_unique<uint8_t[]>(compressed.size()));
+        memcpy_s(copiedData.rbegin()->get(), compressed.size(), compressed.data(), compressed.size());
+        entryData = ArrayRef<const uint8_t>(copiedData.rbegin()->get(), compressed.size());
+    } else if (copyFileData && (false == fileData.empty())) {
+        copiedData.push_back(std::make_unique<uint8_t[]>(fileData.size()));
+        memcpy_s(copiedData.rbegin()->get(), fileData.size(), fileData.begin(), fileData.size());
+        entryData = ArrayRef<const uint8_t>(copiedData.rbegin()->get(), fileData.size());
+    }
+
+    auto alignedFileSize = entryData.size() + (entryData.size() & 1U);
     ArFileEntryHeader header = {};
 
-    if (padTo8Bytes && (0 != ((fileEntries.size() + sizeof(ArFileEntryHeader)) % 8))) {
+    if (padTo8Bytes && (0 != ((fileEntriesSize + sizeof(ArFileEntryHeader)) % 8))) {
         ArFileEntryHeader paddingHeader = {};
         auto paddingName = "pad_" + std::to_string(paddingEntry++);
         UNRECOVERABLE_IF(paddingName.length() > sizeof(paddingHeader.identifier));
         memcpy_s(paddingHeader.identifier, sizeof(paddingHeader.identifier), paddingName.c_str(), paddingName.size());
         paddingHeader.identifier[paddingName.size()] = SpecialFileNames::fileNameTerminator;
-        size_t paddingSize = 8U - ((fileEntries.size() + 2 * sizeof(ArFileEntryHeader)) % 8);
+        size_t paddingSize = 8U - ((fileEntriesSize + 2 * sizeof(ArFileEntryHeader)) % 8);
         auto padSizeString = std::to_string(paddingSize);
         memcpy_s(paddingHeader.fileSizeInBytes, sizeof(paddingHeader.fileSizeInBytes), padSizeString.c_str(), padSizeString.size());
-        this->fileEntries.reserve(this->fileEntries.size() + sizeof(paddingHeader) + paddingSize + sizeof(header) + alignedFileSize);
-        this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&paddingHeader), reinterpret_cast<uint8_t *>(&paddingHeader + 1));
-        this->fileEntries.resize(this->fileEntries.size() + paddingSize, ' ');
+        headers.push_back(paddingHeader);
+        fileEntries.push_back({&*headers.rbegin(), {}, paddingSize, ' '});
+        fileEntriesSize += sizeof(paddingHeader) + paddingSize;
     }
 
     memcpy_s(header.identifier, sizeof(header.identifier), fileName.begin(), fileName.size());
     header.identifier[fileName.size()] = SpecialFileNames::fileNameTerminator;
-    auto sizeString = std::to_string(fileData.size());
+    auto sizeString = std::to_string(entryData.size());
     UNRECOVERABLE_IF(sizeString.length() > sizeof(header.fileSizeInBytes));
     memcpy_s(header.fileSizeInBytes, sizeof(header.fileSizeInBytes), sizeString.c_str(), sizeString.size());
-    this->fileEntries.reserve(this->fileEntries.size() + sizeof(header) + alignedFileSize);
-    auto newFileHeaderOffset = this->fileEntries.size();
-    this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
-    this->fileEntries.insert(this->fileEntries.end(), fileData.begin(), fileData.end());
-    this->fileEntries.resize(this->fileEntries.size() + alignedFileSize - fileData.size(), 0U); // implicit 2-byte alignment
-    return reinterpret_cast<ArFileEntryHeader *>(this->fileEntries.data() + newFileHeaderOffset);
+    headers.push_back(header);
+
+    fileEntries.push_back({&*headers.rbegin(), entryData, alignedFileSize - entryData.size(), 0U}); // implicit 2-byte alignment
+    fileEntriesSize += sizeof(header) + alignedFileSize;
+    return &*headers.rbegin();
+}
+
+size_t ArEncoder::getEncodedSize() const {
+    return arMagic.size() + fileEntriesSize;
+}
+
+bool ArEncoder::encode(BinaryWriter &writer) const {
+    bool success = writer.write(ArrayRef<const uint8_t>::fromAny(arMagic.begin(), arMagic.size()));
+    for (const auto &fileEntry : fileEntries) {
+        success = success && writer.write(ArrayRef<const uint8_t>::fromAny(fileEntry.header, 1U));
+        success = success && writer.write(fileEntry.fileData);
+        if (fileEntry.paddingValue == 0U) {
+            success = success && writer.writeZeros(fileEntry.paddingSize);
+        } else {
+            std::vector<uint8_t> padding(fileEntry.paddingSize, fileEntry.paddingValue);
+            success = success && writer.write(ArrayRef<const uint8_t>(padding));
+        }
+    }
+    return success;
+}
+
+bool ArEncoder::encode(ArrayRef<uint8_t> outBuffer) const {
+    BufferBinaryWriter writer(outBuffer);
+    return encode(writer);
 }
 
 std::vector<uint8_t> ArEncoder::encode() const {
-    std::vector<uint8_t> ret;
-    ret.reserve(arMagic.size() + 1);
-    ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
-    ret.insert(ret.end(), this->fileEntries.begin(), this->fileEntries.end());
+    std::vector<uint8_t> ret(getEncodedSize());
+    encode(ArrayRef<uint8_t>(ret));
     return ret;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,19 +12,49 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
+#include <deque>
+#include <memory>
 #include <vector>
 
 namespace NEO {
+class BinaryWriter;
+
 namespace Ar {
 
 struct ArEncoder {
     ArEncoder(bool padTo8Bytes = false) : padTo8Bytes(padTo8Bytes) {}
     ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
     std::vector<uint8_t> encode() const;
+    bool encode(ArrayRef<uint8_t> outBuffer) const;
+    bool encode(BinaryWriter &writer) const;
+    size_t getEncodedSize() const;
+
+    // When disabled, data passed to appendFileEntry is only referenced (not copied)
+    // and has to remain valid until encoding is done.
+    void setCopyFileData(bool copy) {
+        copyFileData = copy;
+    }
+
+    // When enabled, each appended file is stored as CompressedBinary container
+    void setCompressFileData(bool compress) {
+        compressFileData = compress;
+    }
 
   protected:
-    std::vector<uint8_t> fileEntries;
+    struct FileEntry {
+        ArFileEntryHeader *header = nullptr;
+        ArrayRef<const uint8_t> fileData;
+        size_t paddingSize = 0U;
+        uint8_t paddingValue = 0U;
+    };
+
+    std::deque<ArFileEntryHeader> headers;
+    std::vector<FileEntry> fileEntries;
+    std::vector<std::unique_ptr<uint8_t[]>> copiedData;
+    size_t fileEntriesSize = 0U;
     bool padTo8Bytes = false;
+    bool copyFileData = true;
+    bool compressFileData = false;
     uint32_t paddingEntry = 0U;
 };
 
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/binary_writer.h"
+
+#include "shared/source/helpers/string.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+bool BinaryWriter::writeZeros(size_t size) {
+    static constexpr uint8_t zeros[64] = {};
+    while (size > 0U) {
+        auto chunkSize = std::min(size, sizeof(zeros));
+        if (false == write(ArrayRef<const uint8_t>(zeros, chunkSize))) {
+            return false;
+        }
+        size -= chunkSize;
+    }
+    return true;
+}
+
+bool BufferBinaryWriter::write(ArrayRef<const uint8_t> data) {
+    if (data.size() > outBuffer.size() - writtenSize) {
+        return false;
+    }
+    if (false == data.empty()) {
+        memcpy_s(outBuffer.begin() + writtenSize, outBuffer.size() - writtenSize, data.begin(), data.size());
+    }
+    writtenSize += data.size();
+    return true;
+}
+
+bool FileBinaryWriter::write(ArrayRef<const uint8_t> data) {
+    if (data.empty()) {
+        return true;
+    }
+    auto written = fwrite(data.begin(), sizeof(uint8_t), data.size(), file);
+    writtenSize += written;
+    return written == data.size();
+}
+
+} // namespace NEO
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace NEO {
+
+// Destination of encoded binaries - encoders emit output as sequence of chunks
+// so that section data doesn't need to be gathered in intermediate buffers.
+class BinaryWriter : NonCopyableOrMovableClass {
+  public:
+    virtual ~BinaryWriter() = default;
+
+    virtual bool write(ArrayRef<const uint8_t> data) = 0;
+    bool writeZeros(size_t size);
+
+    size_t getWrittenSize() const {
+        return writtenSize;
+    }
+
+  protected:
+    size_t writtenSize = 0U;
+};
+
+// Writes to caller provided memory, e.g. preallocated buffer or mapped file region.
+class BufferBinaryWriter : public BinaryWriter {
+  public:
+    BufferBinaryWriter(ArrayRef<uint8_t> outBuffer) : outBuffer(outBuffer) {}
+
+    bool write(ArrayRef<const uint8_t> data) override;
+
+  protected:
+    ArrayRef<uint8_t> outBuffer;
+};
+
+class FileBinaryWriter : public BinaryWriter {
+  public:
+    FileBinaryWriter(FILE *file) : file(file) {}
+
+    bool write(ArrayRef<const uint8_t> data) override;
+
+  protected:
+    FILE *file = nullptr;
+};
+
+} // namespace NEO
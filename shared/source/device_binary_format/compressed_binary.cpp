@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/compressed_binary.h"
+
+#include "shared/source/helpers/string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace NEO {
+namespace CompressedBinary {
+
+namespace {
+// Payload is a sequence of: token, [literal length extension], literals, 16-bit match offset, [match length extension].
+// High nibble of token holds literal length, low nibble holds match length - minMatch, value 15 in either nibble
+// means that length continues in following bytes (each 255 adds to length, first byte < 255 ends it).
+// Last sequence contains only literals.
+constexpr size_t minMatch = 4U;
+constexpr size_t maxOffset = 0xffffU;
+constexpr uint32_t hashLog = 16U;
+constexpr size_t lastLiteralsSize = 5U;
+
+inline uint32_t read32(const uint8_t *ptr) {
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+inline uint32_t hashPosition(const uint8_t *ptr) {
+    return (read32(ptr) * 2654435761U) >> (32U - hashLog);
+}
+
+void writeLength(std::vector<uint8_t> &out, size_t length) {
+    while (length >= 255U) {
+        out.push_back(255U);
+        length -= 255U;
+    }
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+void writeSequence(std::vector<uint8_t> &out, const uint8_t *literals, size_t literalsLength, size_t offset, size_t matchLength) {
+    auto token = static_cast<uint8_t>(std::min<size_t>(literalsLength, 15U) << 4);
+    if (matchLength > 0U) {
+        token |= static_cast<uint8_t>(std::min<size_t>(matchLength - minMatch, 15U));
+    }
+    out.push_back(token);
+    if (literalsLength >= 15U) {
+        writeLength(out, literalsLength - 15U);
+    }
+    out.insert(out.end(), literals, literals + literalsLength);
+    if (matchLength > 0U) {
+        out.push_back(static_cast<uint8_t>(offset & 0xffU));
+        out.push_back(static_cast<uint8_t>(offset >> 8));
+        if (matchLength - minMatch >= 15U) {
+            writeLength(out, matchLength - minMatch - 15U);
+        }
+    }
+}
+
+bool readLength(const uint8_t *&in, const uint8_t *inEnd, size_t &length) {
+    uint8_t value = 255U;
+    while (value == 255U) {
+        if (in >= inEnd) {
+            return false;
+        }
+        value = *in++;
+        length += value;
+    }
+    return true;
+}
+} // namespace
+
+bool isCompressed(ArrayRef<const uint8_t> binary) {
+    return (binary.size() >= sizeof(Header)) && (0 == memcmp(binary.begin(), magic.data(), magic.size()));
+}
+
+std::vector<uint8_t> compress(ArrayRef<const uint8_t> data) {
+    std::vector<uint8_t> out(sizeof(Header));
+    out.reserve(sizeof(Header) + data.size() / 2 + 16U);
+
+    const uint8_t *src = data.begin();
+    const size_t srcSize = data.size();
+    size_t anchor = 0U;
+
+    if (srcSize > minMatch + lastLiteralsSize) {
+        auto hashTable = std::make_unique<uint32_t[]>(1U << hashLog);
+        const size_t matchLimit = srcSize - lastLiteralsSize;
+        size_t pos = 0U;
+        while (pos + minMatch <= matchLimit) {
+            auto hash = hashPosition(src + pos);
+            size_t candidate = hashTable[hash];
+            hashTable[hash] = static_cast<uint32_t>(pos);
+            if ((candidate >= pos) || (pos - candidate > maxOffset) || (read32(src + candidate) != read32(src + pos))) {
+                pos++;
+                continue;
+            }
+
+            size_t matchLength = minMatch;
+            while ((pos + matchLength < matchLimit) && (src[candidate + matchLength] == src[pos + matchLength])) {
+                matchLength++;
+            }
+            writeSequence(out, src + anchor, pos - anchor, pos - candidate, matchLength);
+            pos += matchLength;
+            anchor = pos;
+        }
+    }
+    writeSequence(out, src + anchor, srcSize - anchor, 0U, 0U);
+
+    Header header = {};
+    memcpy_s(header.magic, sizeof(header.magic), magic.data(), magic.size());
+    header.version = currentVersion;
+    header.codec = Codec::lz;
+    header.uncompressedSize = srcSize;
+    header.compressedSize = out.size() - sizeof(Header);
+    memcpy_s(out.data(), out.size(), &header, sizeof(header));
+    return out;
+}
+
+bool getDecompressedSize(ArrayRef<const uint8_t> container, size_t &outDecompressedSize) {
+    if (false == isCompressed(container)) {
+        return false;
+    }
+    Header header;
+    memcpy_s(&header, sizeof(header), container.begin(), sizeof(header));
+    if ((header.version > currentVersion) || (header.codec != Codec::lz) ||
+        (header.compressedSize != container.size() - sizeof(Header))) {
+        return false;
+    }
+    // size comes from file, never trust it to allocate more than payload can decode to
+    if (header.uncompressedSize > header.compressedSize * lzMaxExpansionRatio) {
+        return false;
+    }
+    outDecompressedSize = static_cast<size_t>(header.uncompressedSize);
+    return true;
+}
+
+bool decompress(ArrayRef<const uint8_t> container, ArrayRef<uint8_t> outBuffer) {
+    size_t uncompressedSize = 0U;
+    if ((false == getDecompressedSize(container, uncompressedSize)) || (outBuffer.size() < uncompressedSize)) {
+        return false;
+    }
+    if (uncompressedSize == 0U) {
+        // empty input is encoded as a single literals-only token with no literals
+        return (container.size() == sizeof(Header) + 1U) && (container[sizeof(Header)] == 0U);
+    }
+
+    const uint8_t *in = container.begin() + sizeof(Header);
+    const uint8_t *inEnd = container.end();
+    uint8_t *dst = outBuffer.begin();
+    size_t written = 0U;
+
+    while (in < inEnd) {
+        auto token = *in++;
+        size_t literalsLength = token >> 4;
+        if ((literalsLength == 15U) && (false == readLength(in, inEnd, literalsLength))) {
+            return false;
+        }
+        if ((literalsLength > static_cast<size_t>(inEnd - in)) || (literalsLength > uncompressedSize - written)) {
+            return false;
+        }
+        memcpy(dst + written, in, literalsLength);
+        in += literalsLength;
+        written += literalsLength;
+
+        if (in == inEnd) {
+            break; // last sequence has no match
+        }
+        if (inEnd - in < 2) {
+            return false;
+        }
+        size_t offset = in[0] | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+        size_t matchLength = token & 0xfU;
+        if ((matchLength == 15U) && (false == readLength(in, inEnd, matchLength))) {
+            return false;
+        }
+        matchLength += minMatch;
+        if ((offset == 0U) || (offset > written) || (matchLength > uncompressedSize - written)) {
+            return false;
+        }
+        // byte by byte copy - matches may overlap with data being produced
+        for (size_t i = 0; i < matchLength; i++) {
+            dst[written + i] = dst[written - offset + i];
+        }
+        written += matchLength;
+    }
+    return written == uncompressedSize;
+}
+
+} // namespace CompressedBinary
+} // namespace NEO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+namespace CompressedBinary {
+
+inline constexpr ConstStringRef magic = "NEOZ";
+
+enum class Codec : uint16_t {
+    lz = 1, // LZ77 with 64KB window, byte oriented - favours decompression speed over ratio
+};
+
+inline constexpr uint16_t currentVersion = 1U;
+
+// Each match sequence produces at most 255 bytes per encoded byte, literals are never expanded
+inline constexpr uint64_t lzMaxExpansionRatio = 255U;
+
+#pragma pack(push, 1)
+struct Header {
+    char magic[4];
+    uint16_t version;
+    Codec codec;
+    uint32_t reserved;
+    uint64_t uncompressedSize;
+    uint64_t compressedSize;
+};
+#pragma pack(pop)
+static_assert(sizeof(Header) == 28, "");
+
+bool isCompressed(ArrayRef<const uint8_t> binary);
+
+// Returns container with header followed by compressed payload
+std::vector<uint8_t> compress(ArrayRef<const uint8_t> data);
+
+// Returns false if container is not valid, was created by unsupported version/codec
+// or declares decompressed size not reachable from its payload size
+bool getDecompressedSize(ArrayRef<const uint8_t> container, size_t &outDecompressedSize);
+
+// Decodes directly into outBuffer which needs to be at least decompressed size bytes long
+bool decompress(ArrayRef<const uint8_t> container, ArrayRef<uint8_t> outBuffer);
+
+} // namespace CompressedBinary
+} // namespace NEO
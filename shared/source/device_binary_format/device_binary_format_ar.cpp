@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/helpers/product_config_helper.h"
 #include "shared/source/helpers/string.h"
@@ -20,6 +21,38 @@ void searchForBinary(Ar::Ar &archiveData, const ConstStringRef filter, Ar::ArFil
     }
 }
 
+std::shared_ptr<const std::vector<uint8_t>> decompressArFileEntry(const Ar::ArFileEntryHeaderAndData &file) {
+    size_t decompressedSize = 0U;
+    if (false == CompressedBinary::getDecompressedSize(file.fileData, decompressedSize)) {
+        return nullptr;
+    }
+    auto decompressed = std::make_shared<std::vector<uint8_t>>(decompressedSize);
+    if (false == CompressedBinary::decompress(file.fileData, ArrayRef<uint8_t>(*decompressed))) {
+        return nullptr;
+    }
+    return decompressed;
+}
+
+SingleDeviceBinary unpackArFileEntry(const Ar::ArFileEntryHeaderAndData &file, const ConstStringRef requestedProductAbbreviation, const TargetDevice &requestedTargetDevice,
+                                     std::string &outErrReason, std::string &outWarning) {
+    if (false == CompressedBinary::isCompressed(file.fileData)) {
+        auto unpacked = unpackSingleDeviceBinary(file.fileData, requestedProductAbbreviation, requestedTargetDevice, outErrReason, outWarning);
+        unpacked.packedTargetDeviceBinary = file.fileData;
+        return unpacked;
+    }
+
+    auto decompressed = decompressArFileEntry(file);
+    if (nullptr == decompressed) {
+        outErrReason.append("Invalid compressed AR file entry : " + file.fileName.str() + "\n");
+        return {};
+    }
+    ArrayRef<const uint8_t> decompressedBinary(decompressed->data(), decompressed->size());
+    auto unpacked = unpackSingleDeviceBinary(decompressedBinary, requestedProductAbbreviation, requestedTargetDevice, outErrReason, outWarning);
+    unpacked.packedTargetDeviceBinary = decompressedBinary;
+    unpacked.decompressedData.push_back(std::move(decompressed));
+    return unpacked;
+}
+
 template <>
 bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::archive>(const ArrayRef<const uint8_t> binary) {
     return NEO::Ar::isAr(binary);
@@ -60,22 +93,23 @@ SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(co
         if (nullptr == matchedFile) {
             continue;
         }
-        auto unpacked = unpackSingleDeviceBinary(matchedFile->fileData, requestedProductAbbreviation, requestedTargetDevice, unpackErrors, unpackWarnings);
+        auto unpacked = unpackArFileEntry(*matchedFile, requestedProductAbbreviation, requestedTargetDevice, unpackErrors, unpackWarnings);
         if (false == unpacked.deviceBinary.empty()) {
             if ((matchedFile != matchedPointerSizeAndPlatformAndStepping) && (matchedFile != matchedPointerSizeAndMajorMinorRevision)) {
                 outWarning = "Couldn't find perfectly matched binary in AR, using best usable";
             }
             if (unpacked.intermediateRepresentation.empty() && matchedGenericIr) {
-                auto unpackedGenericIr = unpackSingleDeviceBinary(matchedGenericIr->fileData, requestedProductAbbreviation, requestedTargetDevice, unpackErrors, unpackWarnings);
+                auto unpackedGenericIr = unpackArFileEntry(*matchedGenericIr, requestedProductAbbreviation, requestedTargetDevice, unpackErrors, unpackWarnings);
                 if (!unpackedGenericIr.intermediateRepresentation.empty()) {
                     unpacked.intermediateRepresentation = unpackedGenericIr.intermediateRepresentation;
+                    unpacked.decompressedData.insert(unpacked.decompressedData.end(), unpackedGenericIr.decompressedData.begin(), unpackedGenericIr.decompressedData.end());
                 }
             }
-            unpacked.packedTargetDeviceBinary = ArrayRef<const uint8_t>(matchedFile->fileData.begin(), matchedFile->fileData.size());
             return unpacked;
         }
         if (binaryForRecompilation.intermediateRepresentation.empty() && (false == unpacked.intermediateRepresentation.empty())) {
             binaryForRecompilation = unpacked;
+            binaryForRecompilation.packedTargetDeviceBinary = {};
         }
     }
 
@@ -121,6 +121,7 @@ template <>
 std::vector<uint8_t> packDeviceBinary<NEO::DeviceBinaryFormat::oclElf>(const SingleDeviceBinary &binary, std::string &outErrReason, std::string &outWarning) {
     using namespace NEO::Elf;
     NEO::Elf::ElfEncoder<EI_CLASS_64> elfEncoder;
+    elfEncoder.setCopySectionData(false);
     elfEncoder.getElfFileHeader().type = ET_OPENCL_EXECUTABLE;
     if (binary.buildOptions.empty() == false) {
         elfEncoder.appendSection(SHT_OPENCL_OPTIONS, SectionNamesOpenCl::buildOptions,
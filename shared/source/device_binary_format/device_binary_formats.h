@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <igfxfmid.h>
+#include <memory>
 #include <vector>
 
 namespace NEO {
@@ -77,6 +78,7 @@ struct SingleDeviceBinary {
     ArrayRef<const uint8_t> debugData;
     ArrayRef<const uint8_t> intermediateRepresentation;
     ArrayRef<const uint8_t> packedTargetDeviceBinary;
+    std::vector<std::shared_ptr<const std::vector<uint8_t>>> decompressedData; // backing storage for binaries unpacked from compressed containers
     ConstStringRef buildOptions;
     TargetDevice targetDevice;
     GeneratorType generator = GeneratorType::igc;
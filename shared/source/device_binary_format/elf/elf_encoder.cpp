@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,9 @@
 
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 
+#include "shared/source/device_binary_format/binary_writer.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/string.h"
 
 #include <algorithm>
 
@@ -33,12 +35,9 @@ void ElfEncoder<numBits>::appendSection(const ElfSectionHeader<numBits> &section
     sectionHeaders.push_back(sectionHeader);
     if ((SHT_NOBITS != sectionHeader.type) && (false == sectionData.empty())) {
         auto sectionDataAlignment = std::min<uint64_t>(defaultDataAlignment, 8U);
-        auto alignedOffset = alignUp(this->data.size(), static_cast<size_t>(sectionDataAlignment));
+        auto alignedOffset = alignUp(this->dataSize, static_cast<size_t>(sectionDataAlignment));
         auto alignedSize = alignUp(sectionData.size(), static_cast<size_t>(sectionDataAlignment));
-        this->data.reserve(alignedOffset + alignedSize);
-        this->data.resize(alignedOffset, 0U);
-        this->data.insert(this->data.end(), sectionData.begin(), sectionData.end());
-        this->data.resize(alignedOffset + alignedSize, 0U);
+        appendData(alignedOffset, alignedSize, sectionData);
         sectionHeaders.rbegin()->offset = static_cast<decltype(sectionHeaders.rbegin()->offset)>(alignedOffset);
         sectionHeaders.rbegin()->size = static_cast<decltype(sectionHeaders.rbegin()->size)>(sectionData.size());
     }
@@ -50,17 +49,26 @@ void ElfEncoder<numBits>::appendSegment(const ElfProgramHeader<numBits> &program
     programHeaders.push_back(programHeader);
     if (false == segmentData.empty()) {
         UNRECOVERABLE_IF(programHeader.align == 0);
-        auto alignedOffset = alignUp(this->data.size(), static_cast<size_t>(programHeader.align));
+        auto alignedOffset = alignUp(this->dataSize, static_cast<size_t>(programHeader.align));
         auto alignedSize = alignUp(segmentData.size(), static_cast<size_t>(programHeader.align));
-        this->data.reserve(alignedOffset + alignedSize);
-        this->data.resize(alignedOffset, 0U);
-        this->data.insert(this->data.end(), segmentData.begin(), segmentData.end());
-        this->data.resize(alignedOffset + alignedSize, 0U);
+        appendData(alignedOffset, alignedSize, segmentData);
         programHeaders.rbegin()->offset = static_cast<decltype(programHeaders.rbegin()->offset)>(alignedOffset);
         programHeaders.rbegin()->fileSz = static_cast<decltype(programHeaders.rbegin()->fileSz)>(segmentData.size());
     }
 }
 
+template <ElfIdentifierClass numBits>
+void ElfEncoder<numBits>::appendData(size_t alignedOffset, size_t alignedSize, const ArrayRef<const uint8_t> sectionData) {
+    ArrayRef<const uint8_t> chunkData = sectionData;
+    if (copySectionData) {
+        copiedData.push_back(std::make_unique<uint8_t[]>(sectionData.size()));
+        memcpy_s(copiedData.rbegin()->get(), sectionData.size(), sectionData.begin(), sectionData.size());
+        chunkData = ArrayRef<const uint8_t>(copiedData.rbegin()->get(), sectionData.size());
+    }
+    dataChunks.push_back({alignedOffset, chunkData});
+    this->dataSize = alignedOffset + alignedSize;
+}
+
 template <ElfIdentifierClass numBits>
 uint32_t ElfEncoder<numBits>::getSectionHeaderIndex(const ElfSectionHeader<numBits> &sectionHeader) {
     UNRECOVERABLE_IF(&sectionHeader < sectionHeaders.begin());
@@ -121,21 +129,20 @@ uint32_t ElfEncoder<numBits>::appendSectionName(ConstStringRef str) {
 }
 
 template <ElfIdentifierClass numBits>
-std::vector<uint8_t> ElfEncoder<numBits>::encode() const {
+typename ElfEncoder<numBits>::EncodedLayout ElfEncoder<numBits>::encodeHeaders(std::vector<uint8_t> &headers) const {
     ElfFileHeader<numBits> elfFileHeader = this->elfFileHeader;
     StackVec<ElfProgramHeader<numBits>, 32> programHeaders = this->programHeaders;
     StackVec<ElfSectionHeader<numBits>, 32> sectionHeaders = this->sectionHeaders;
+    EncodedLayout layout;
 
     if (addUndefSectionHeader && (1U == sectionHeaders.size())) {
         sectionHeaders.clear();
     }
 
     ElfSectionHeader<numBits> sectionHeaderNamesSection;
-    size_t alignedSectionNamesDataSize = 0U;
-    size_t dataPaddingBeforeSectionNames = 0U;
     if ((false == sectionHeaders.empty()) && addHeaderSectionNamesSection) {
-        auto alignedDataSize = alignUp(data.size(), static_cast<size_t>(defaultDataAlignment));
-        dataPaddingBeforeSectionNames = alignedDataSize - data.size();
+        auto alignedDataSize = alignUp(dataSize, static_cast<size_t>(defaultDataAlignment));
+        layout.dataPaddingBeforeSectionNames = alignedDataSize - dataSize;
         sectionHeaderNamesSection.type = SHT_STRTAB;
         sectionHeaderNamesSection.name = shStrTabNameOffset;
         sectionHeaderNamesSection.offset = static_cast<decltype(sectionHeaderNamesSection.offset)>(alignedDataSize);
@@ -143,7 +150,7 @@ std::vector<uint8_t> ElfEncoder<numBits>::encode() const {
         sectionHeaderNamesSection.addralign = static_cast<decltype(sectionHeaderNamesSection.addralign)>(defaultDataAlignment);
         elfFileHeader.shStrNdx = static_cast<decltype(elfFileHeader.shStrNdx)>(sectionHeaders.size());
         sectionHeaders.push_back(sectionHeaderNamesSection);
-        alignedSectionNamesDataSize = alignUp(strSecBuilder.data().size(), static_cast<size_t>(sectionHeaderNamesSection.addralign));
+        layout.alignedSectionNamesDataSize = alignUp(strSecBuilder.data().size(), static_cast<size_t>(sectionHeaderNamesSection.addralign));
     }
 
     elfFileHeader.phNum = static_cast<decltype(elfFileHeader.phNum)>(programHeaders.size());
@@ -159,13 +166,12 @@ std::vector<uint8_t> ElfEncoder<numBits>::encode() const {
         elfFileHeader.shOff = static_cast<decltype(elfFileHeader.shOff)>(sectionHeadersOffset);
     }
 
-    auto dataOffset = alignUp(sectionHeadersOffset + elfFileHeader.shEntSize * elfFileHeader.shNum, static_cast<size_t>(maxDataAlignmentNeeded));
-    auto stringTabOffset = dataOffset + data.size();
+    layout.dataOffset = alignUp(sectionHeadersOffset + elfFileHeader.shEntSize * elfFileHeader.shNum, static_cast<size_t>(maxDataAlignmentNeeded));
+    layout.totalSize = layout.dataOffset + dataSize + layout.dataPaddingBeforeSectionNames + layout.alignedSectionNamesDataSize;
 
-    std::vector<uint8_t> ret;
-    ret.reserve(stringTabOffset + alignedSectionNamesDataSize);
-    ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&elfFileHeader), reinterpret_cast<uint8_t *>(&elfFileHeader + 1));
-    ret.resize(programHeadersOffset, 0U);
+    headers.reserve(layout.dataOffset);
+    headers.insert(headers.end(), reinterpret_cast<uint8_t *>(&elfFileHeader), reinterpret_cast<uint8_t *>(&elfFileHeader + 1));
+    headers.resize(programHeadersOffset, 0U);
 
     for (auto &progSecLookup : programSectionLookupTable) {
         programHeaders[progSecLookup.programId].offset = sectionHeaders[progSecLookup.sectionId].offset;
@@ -175,28 +181,61 @@ std::vector<uint8_t> ElfEncoder<numBits>::encode() const {
     std::sort(programHeaders.begin(), programHeaders.end(), [](auto &p1, auto &p2) { return p1.vAddr < p2.vAddr; });
     for (auto &programHeader : programHeaders) {
         if (0 != programHeader.fileSz) {
-            programHeader.offset = static_cast<decltype(programHeader.offset)>(programHeader.offset + dataOffset);
+            programHeader.offset = static_cast<decltype(programHeader.offset)>(programHeader.offset + layout.dataOffset);
         }
-        ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&programHeader), reinterpret_cast<uint8_t *>(&programHeader + 1));
-        ret.resize(ret.size() + elfFileHeader.phEntSize - sizeof(programHeader), 0U);
+        headers.insert(headers.end(), reinterpret_cast<uint8_t *>(&programHeader), reinterpret_cast<uint8_t *>(&programHeader + 1));
+        headers.resize(headers.size() + elfFileHeader.phEntSize - sizeof(programHeader), 0U);
     }
 
     for (auto &sectionHeader : sectionHeaders) {
         if ((SHT_NOBITS != sectionHeader.type) && (0 != sectionHeader.size)) {
-            sectionHeader.offset = static_cast<decltype(sectionHeader.offset)>(sectionHeader.offset + dataOffset);
+            sectionHeader.offset = static_cast<decltype(sectionHeader.offset)>(sectionHeader.offset + layout.dataOffset);
         }
-        ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&sectionHeader), reinterpret_cast<uint8_t *>(&sectionHeader + 1));
-        ret.resize(ret.size() + elfFileHeader.shEntSize - sizeof(sectionHeader), 0U);
+        headers.insert(headers.end(), reinterpret_cast<uint8_t *>(&sectionHeader), reinterpret_cast<uint8_t *>(&sectionHeader + 1));
+        headers.resize(headers.size() + elfFileHeader.shEntSize - sizeof(sectionHeader), 0U);
     }
 
-    ret.resize(dataOffset, 0U);
-    ret.insert(ret.end(), data.begin(), data.end());
-    ret.resize(ret.size() + dataPaddingBeforeSectionNames, 0U);
-    if (alignedSectionNamesDataSize > 0U) {
+    headers.resize(layout.dataOffset, 0U);
+    return layout;
+}
+
+template <ElfIdentifierClass numBits>
+size_t ElfEncoder<numBits>::getEncodedSize() const {
+    std::vector<uint8_t> headers;
+    return encodeHeaders(headers).totalSize;
+}
+
+template <ElfIdentifierClass numBits>
+bool ElfEncoder<numBits>::encode(BinaryWriter &writer) const {
+    std::vector<uint8_t> headers;
+    auto layout = encodeHeaders(headers);
+
+    bool success = writer.write(ArrayRef<const uint8_t>(headers));
+    size_t writtenDataSize = 0U;
+    for (const auto &chunk : dataChunks) {
+        success = success && writer.writeZeros(chunk.offset - writtenDataSize);
+        success = success && writer.write(chunk.data);
+        writtenDataSize = chunk.offset + chunk.data.size();
+    }
+    success = success && writer.writeZeros(dataSize - writtenDataSize + layout.dataPaddingBeforeSectionNames);
+    if (layout.alignedSectionNamesDataSize > 0U) {
         auto sectionNames = strSecBuilder.data();
-        ret.insert(ret.end(), sectionNames.begin(), sectionNames.end());
+        success = success && writer.write(sectionNames);
+        success = success && writer.writeZeros(layout.alignedSectionNamesDataSize - sectionNames.size());
     }
-    ret.resize(ret.size() + alignedSectionNamesDataSize - static_cast<size_t>(sectionHeaderNamesSection.size), 0U);
+    return success;
+}
+
+template <ElfIdentifierClass numBits>
+bool ElfEncoder<numBits>::encode(ArrayRef<uint8_t> outBuffer) const {
+    BufferBinaryWriter writer(outBuffer);
+    return encode(writer);
+}
+
+template <ElfIdentifierClass numBits>
+std::vector<uint8_t> ElfEncoder<numBits>::encode() const {
+    std::vector<uint8_t> ret(getEncodedSize());
+    encode(ArrayRef<uint8_t>(ret));
     return ret;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,10 +11,13 @@
 #include "shared/source/utilities/const_stringref.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <memory>
 #include <queue>
 #include <string>
+#include <vector>
 
 namespace NEO {
+class BinaryWriter;
 
 namespace Elf {
 
@@ -76,20 +79,47 @@ struct ElfEncoder {
     uint32_t appendSectionName(ConstStringRef str);
 
     std::vector<uint8_t> encode() const;
+    bool encode(ArrayRef<uint8_t> outBuffer) const;
+    bool encode(BinaryWriter &writer) const;
+    size_t getEncodedSize() const;
+
+    // When disabled, data passed to appendSection/appendSegment is only referenced (not copied)
+    // and has to remain valid until encoding is done.
+    void setCopySectionData(bool copy) {
+        copySectionData = copy;
+    }
 
     ElfFileHeader<numBits> &getElfFileHeader() {
         return elfFileHeader;
     }
 
   protected:
+    struct DataChunk {
+        size_t offset;
+        ArrayRef<const uint8_t> data;
+    };
+
+    struct EncodedLayout {
+        size_t dataOffset = 0U;
+        size_t dataPaddingBeforeSectionNames = 0U;
+        size_t alignedSectionNamesDataSize = 0U;
+        size_t totalSize = 0U;
+    };
+
+    void appendData(size_t alignedOffset, size_t alignedSize, const ArrayRef<const uint8_t> sectionData);
+    EncodedLayout encodeHeaders(std::vector<uint8_t> &headers) const;
+
     bool addUndefSectionHeader = false;
+    bool copySectionData = true;
     bool addHeaderSectionNamesSection = false;
     typename ElfSectionHeaderTypes<numBits>::AddrAlign defaultDataAlignment = 8U;
     uint64_t maxDataAlignmentNeeded = 1U;
     ElfFileHeader<numBits> elfFileHeader;
     StackVec<ElfProgramHeader<numBits>, 32> programHeaders;
     StackVec<ElfSectionHeader<numBits>, 32> sectionHeaders;
-    std::vector<uint8_t> data;
+    StackVec<DataChunk, 32> dataChunks;
+    std::vector<std::unique_ptr<uint8_t[]>> copiedData;
+    size_t dataSize = 0U;
     StringSectionBuilder strSecBuilder;
     struct ProgramSectionID {
         size_t programId;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,7 @@ std::vector<uint8_t> createDebugZebin(ArrayRef<const uint8_t> zebinBin, const Se
 
 void DebugZebinCreator::createDebugZebin() {
     ElfEncoder<EI_CLASS_64> elfEncoder(false, false, 8);
+    elfEncoder.setCopySectionData(false);
     auto &header = elfEncoder.getElfFileHeader();
     header.machine = zebin.elfFileHeader->machine;
     header.flags = zebin.elfFileHeader->flags;
@@ -33,6 +33,23 @@ size_t writeDataToFile(
     return nsize;
 }
 
+size_t writeDataToFile(
+    const char *filename,
+    const std::function<size_t(FILE *)> &writeData) {
+    FILE *fp = nullptr;
+    size_t nsize = 0;
+
+    DEBUG_BREAK_IF(nullptr == filename);
+
+    fopen_s(&fp, filename, "wb");
+    if (fp) {
+        nsize = writeData(fp);
+        fclose(fp);
+    }
+
+    return nsize;
+}
+
 bool fileExists(const std::string &fileName) {
     FILE *pFile = nullptr;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <cstdint>
+#include <cstdio>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -20,6 +22,11 @@ size_t writeDataToFile(
     const void *pData,
     size_t dataSize);
 
+// writeData receives opened file and returns number of bytes written
+size_t writeDataToFile(
+    const char *filename,
+    const std::function<size_t(FILE *)> &writeData);
+
 bool fileExists(const std::string &fileName);
 bool fileExistsHasSize(const std::string &fileName);
 void dumpFileIncrement(const char *data, size_t dataSize, const std::string &filename, const std::string &extension);
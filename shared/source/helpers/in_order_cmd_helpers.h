@@ -224,4 +224,106 @@ struct PatchCmd {
 template <typename GfxFamily>
 using InOrderPatchCommandsContainer = std::vector<NEO::InOrderPatchCommandHelpers::PatchCmd<GfxFamily>>;
 
+namespace InOrderPatchCommandHelpers {
+
+// Structure-of-arrays copy of patch container entries, grouped by command type.
+// Entries depending only on implicit counter are patched in tight per-type loops without dispatching on each entry.
+// External dependencies, walkers and skipped entries stay in container and are patched or ignored one by one.
+template <typename GfxFamily>
+class BatchedPatchCmds {
+  public:
+    void build(const InOrderPatchCommandsContainer<GfxFamily> &patchCmds) {
+        clear();
+
+        for (size_t i = 0; i < patchCmds.size(); i++) {
+            auto &cmd = patchCmds[i];
+            if (cmd.skipPatching) {
+                continue;
+            }
+            if (cmd.isExternalDependency()) {
+                externalDependencyIndices.push_back(i);
+                continue;
+            }
+
+            switch (cmd.patchCmdType) {
+            case PatchCmdType::sdi:
+                sdiCmds.push_back(reinterpret_cast<typename GfxFamily::MI_STORE_DATA_IMM *>(cmd.cmd1));
+                sdiBaseCounterValues.push_back(cmd.baseCounterValue);
+                break;
+            case PatchCmdType::semaphore:
+                semaphoreCmds.push_back(reinterpret_cast<typename GfxFamily::MI_SEMAPHORE_WAIT *>(cmd.cmd1));
+                semaphoreBaseCounterValues.push_back(cmd.baseCounterValue);
+                break;
+            case PatchCmdType::lri64b:
+                lriLowCmds.push_back(reinterpret_cast<typename GfxFamily::MI_LOAD_REGISTER_IMM *>(cmd.cmd1));
+                lriHighCmds.push_back(reinterpret_cast<typename GfxFamily::MI_LOAD_REGISTER_IMM *>(cmd.cmd2));
+                lriBaseCounterValues.push_back(cmd.baseCounterValue);
+                break;
+            default:
+                implicitDependencyIndices.push_back(i);
+                break;
+            }
+        }
+
+        valid = true;
+    }
+
+    void patch(InOrderPatchCommandsContainer<GfxFamily> &patchCmds, uint64_t implicitAppendCounter, bool patchImplicitDependencies) {
+        UNRECOVERABLE_IF(!valid);
+
+        if (patchImplicitDependencies) {
+            for (size_t i = 0; i < sdiCmds.size(); i++) {
+                const uint64_t counterValue = sdiBaseCounterValues[i] + implicitAppendCounter;
+                sdiCmds[i]->setDataDword0(getLowPart(counterValue));
+                sdiCmds[i]->setDataDword1(getHighPart(counterValue));
+            }
+            for (size_t i = 0; i < semaphoreCmds.size(); i++) {
+                semaphoreCmds[i]->setSemaphoreDataDword(static_cast<uint32_t>(semaphoreBaseCounterValues[i] + implicitAppendCounter));
+            }
+            for (size_t i = 0; i < lriLowCmds.size(); i++) {
+                const uint64_t counterValue = lriBaseCounterValues[i] + implicitAppendCounter;
+                lriLowCmds[i]->setDataDword(getLowPart(counterValue));
+                lriHighCmds[i]->setDataDword(getHighPart(counterValue));
+            }
+            for (auto index : implicitDependencyIndices) {
+                patchCmds[index].patch(implicitAppendCounter);
+            }
+        }
+
+        for (auto index : externalDependencyIndices) {
+            patchCmds[index].patch(implicitAppendCounter);
+        }
+    }
+
+    void invalidate() { valid = false; }
+    bool isValid() const { return valid; }
+
+    void clear() {
+        sdiCmds.clear();
+        sdiBaseCounterValues.clear();
+        semaphoreCmds.clear();
+        semaphoreBaseCounterValues.clear();
+        lriLowCmds.clear();
+        lriHighCmds.clear();
+        lriBaseCounterValues.clear();
+        implicitDependencyIndices.clear();
+        externalDependencyIndices.clear();
+        valid = false;
+    }
+
+  protected:
+    std::vector<typename GfxFamily::MI_STORE_DATA_IMM *> sdiCmds;
+    std::vector<uint64_t> sdiBaseCounterValues;
+    std::vector<typename GfxFamily::MI_SEMAPHORE_WAIT *> semaphoreCmds;
+    std::vector<uint64_t> semaphoreBaseCounterValues;
+    std::vector<typename GfxFamily::MI_LOAD_REGISTER_IMM *> lriLowCmds;
+    std::vector<typename GfxFamily::MI_LOAD_REGISTER_IMM *> lriHighCmds;
+    std::vector<uint64_t> lriBaseCounterValues;
+    std::vector<size_t> implicitDependencyIndices;
+    std::vector<size_t> externalDependencyIndices;
+    bool valid = false;
+};
+
+} // namespace InOrderPatchCommandHelpers
+
 } // namespace NEO
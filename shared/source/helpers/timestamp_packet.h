@@ -17,8 +17,10 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet_constants.h"
 #include "shared/source/helpers/timestamp_packet_container.h"
+#include "shared/source/helpers/timestamp_packet_readout.h"
 #include "shared/source/utilities/tag_allocator.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace NEO {
@@ -37,6 +39,8 @@ class TimestampPackets : public TagTypeBase {
 
     static constexpr size_t getSinglePacketSize() { return sizeof(Packet); }
 
+    static constexpr uint32_t getTimestampSize() { return sizeof(TSize); }
+
     void initialize() {
         for (auto &packet : packets) {
             packet.contextStart = TimestampPacketConstants::initValue;
@@ -63,6 +67,17 @@ class TimestampPackets : public TagTypeBase {
     void const *getContextEndAddress(uint32_t packetIndex) const { return static_cast<void const *>(&packets[packetIndex].contextEnd); }
     void const *getContextStartAddress(uint32_t packetIndex) const { return static_cast<void const *>(&packets[packetIndex].contextStart); }
 
+    uint32_t readPackets(TimestampPacketValues *output, uint32_t packetsToRead) const {
+        packetsToRead = std::min(packetsToRead, packetCount);
+        for (uint32_t i = 0; i < packetsToRead; i++) {
+            output[i].contextStart = static_cast<uint64_t>(packets[i].contextStart);
+            output[i].globalStart = static_cast<uint64_t>(packets[i].globalStart);
+            output[i].contextEnd = static_cast<uint64_t>(packets[i].contextEnd);
+            output[i].globalEnd = static_cast<uint64_t>(packets[i].globalEnd);
+        }
+        return packetsToRead;
+    }
+
   protected:
     struct alignas(1) Packet {
         TSize contextStart = TimestampPacketConstants::initValue;
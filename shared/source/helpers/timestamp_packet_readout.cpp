@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/timestamp_packet_readout.h"
+
+#include "shared/source/utilities/tag_allocator.h"
+
+#include <algorithm>
+
+namespace NEO {
+namespace TimestampPacketReadout {
+
+size_t readNodes(const TagNodeBase *const *nodes, size_t nodesCount, std::vector<TimestampPacketValues> &output) {
+    size_t totalPackets = 0;
+    for (size_t i = 0; i < nodesCount; i++) {
+        totalPackets += nodes[i]->getPacketsUsed();
+    }
+
+    auto initialSize = output.size();
+    output.resize(initialSize + totalPackets);
+
+    auto outputPosition = output.data() + initialSize;
+    for (size_t i = 0; i < nodesCount; i++) {
+        outputPosition += nodes[i]->readTimestampPackets(outputPosition, nodes[i]->getPacketsUsed());
+    }
+
+    auto packetsRead = static_cast<size_t>(outputPosition - (output.data() + initialSize));
+    output.resize(initialSize + packetsRead);
+    return packetsRead;
+}
+
+void updateGlobalBoundaryValues(const TimestampPacketValues *values, size_t valuesCount, uint64_t &globalStart, uint64_t &globalEnd) {
+    auto start = globalStart;
+    auto end = globalEnd;
+    for (size_t i = 0; i < valuesCount; i++) {
+        start = std::min(start, values[i].globalStart);
+        end = std::max(end, values[i].globalEnd);
+    }
+    globalStart = start;
+    globalEnd = end;
+}
+
+void convertTicksToNanoseconds(const uint64_t *ticks, uint64_t *nanoseconds, size_t count, double resolution) {
+    // plain loop without dependencies between iterations, so it is auto-vectorized by the compiler
+    for (size_t i = 0; i < count; i++) {
+        nanoseconds[i] = static_cast<uint64_t>(static_cast<double>(ticks[i]) * resolution);
+    }
+}
+
+} // namespace TimestampPacketReadout
+} // namespace NEO
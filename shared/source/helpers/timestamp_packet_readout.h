@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/ptr_math.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+class TagNodeBase;
+
+struct TimestampPacketValues {
+    uint64_t contextStart = 0;
+    uint64_t globalStart = 0;
+    uint64_t contextEnd = 0;
+    uint64_t globalEnd = 0;
+};
+
+// Read-only view over packets placed in tag memory. Nothing is copied, values are read on access.
+struct TimestampPacketsView {
+    const void *cpuBase = nullptr;
+    size_t packetSize = 0;
+    uint32_t timestampSize = 0;
+    uint32_t packetsUsed = 0;
+
+    bool isValid() const { return cpuBase != nullptr; }
+
+    uint64_t getContextStartValue(uint32_t packetIndex) const { return readValue(packetIndex, 0); }
+    uint64_t getGlobalStartValue(uint32_t packetIndex) const { return readValue(packetIndex, 1); }
+    uint64_t getContextEndValue(uint32_t packetIndex) const { return readValue(packetIndex, 2); }
+    uint64_t getGlobalEndValue(uint32_t packetIndex) const { return readValue(packetIndex, 3); }
+
+  protected:
+    uint64_t readValue(uint32_t packetIndex, uint32_t fieldIndex) const {
+        auto fieldAddress = ptrOffset(cpuBase, packetIndex * packetSize + fieldIndex * timestampSize);
+        if (timestampSize == sizeof(uint64_t)) {
+            return *reinterpret_cast<const uint64_t *>(fieldAddress);
+        }
+        return static_cast<uint64_t>(*reinterpret_cast<const uint32_t *>(fieldAddress));
+    }
+};
+
+namespace TimestampPacketReadout {
+size_t readNodes(const TagNodeBase *const *nodes, size_t nodesCount, std::vector<TimestampPacketValues> &output);
+
+// Same as readNodes, for contiguous packet sets kept outside of tag allocator (e.g. L0 kernel event completion data)
+template <typename PacketSetT>
+size_t readPacketSets(const PacketSetT *packetSets, size_t packetSetsCount, std::vector<TimestampPacketValues> &output) {
+    size_t totalPackets = 0;
+    for (size_t i = 0; i < packetSetsCount; i++) {
+        totalPackets += packetSets[i].getPacketsUsed();
+    }
+
+    auto initialSize = output.size();
+    output.resize(initialSize + totalPackets);
+
+    auto outputPosition = output.data() + initialSize;
+    for (size_t i = 0; i < packetSetsCount; i++) {
+        outputPosition += packetSets[i].readPackets(outputPosition, packetSets[i].getPacketsUsed());
+    }
+
+    auto packetsRead = static_cast<size_t>(outputPosition - (output.data() + initialSize));
+    output.resize(initialSize + packetsRead);
+    return packetsRead;
+}
+
+void updateGlobalBoundaryValues(const TimestampPacketValues *values, size_t valuesCount, uint64_t &globalStart, uint64_t &globalEnd);
+void convertTicksToNanoseconds(const uint64_t *ticks, uint64_t *nanoseconds, size_t count, double resolution);
+} // namespace TimestampPacketReadout
+
+} // namespace NEO
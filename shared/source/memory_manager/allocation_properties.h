@@ -50,6 +50,7 @@ struct AllocationProperties {
     bool forceKMDAllocation = false;
     bool makeGPUVaDifferentThanCPUPtr = false;
     uint32_t cacheRegion = 0;
+    int32_t numaNode = -1;
     bool makeDeviceBufferLockable = false;
 
     AllocationProperties(uint32_t rootDeviceIndex, size_t size,
@@ -131,5 +132,6 @@ struct AllocationData {
     bool makeGPUVaDifferentThanCPUPtr = false;
     bool useMmapObject = true;
     uint32_t cacheRegion = 0;
+    int32_t numaNode = -1;
 };
 } // namespace NEO
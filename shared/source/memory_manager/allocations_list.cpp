@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,12 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace {
 struct ReusableAllocationRequirements {
     const void *requiredPtr;
@@ -24,6 +28,22 @@ struct ReusableAllocationRequirements {
     bool forceSystemMemoryFlag;
 };
 
+struct IdleAllocationsRequirements {
+    std::vector<NEO::GraphicsAllocation *> allocations;
+    std::chrono::steady_clock::time_point now;
+    std::chrono::nanoseconds maxIdleTime;
+    TaskCountType completedTaskCount;
+    uint32_t contextId;
+};
+
+struct CompletedAllocationsRequirements {
+    std::vector<NEO::GraphicsAllocation *> allocations;
+    TaskCountType waitTaskCount;
+    uint32_t contextId;
+};
+
+constexpr uint32_t bucketKeySizeClassBits = 7u;
+
 bool checkTagAddressReady(ReusableAllocationRequirements *requirements, NEO::GraphicsAllocation *gfxAllocation) {
     auto tagAddress = requirements->csrTagAddress;
     auto taskCount = gfxAllocation->getTaskCount(requirements->contextId);
@@ -63,13 +83,18 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
 
 GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *, void *data) {
     ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
-    auto *curr = head;
-    while (curr != nullptr) {
-        if ((req->allocationType == curr->getAllocationType()) &&
-            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
-            (curr->storageInfo.systemMemoryForced == req->forceSystemMemoryFlag)) {
+    const auto keyPrefix = getBucketKey(req->allocationType, req->forceSystemMemoryFlag, 0u) >> bucketKeySizeClassBits;
+
+    // buckets of larger size classes follow the requested one, candidates in bucket are in list order
+    for (auto bucket = reuseBuckets.lower_bound(getBucketKey(req->allocationType, req->forceSystemMemoryFlag, req->requiredMinimalSize));
+         bucket != reuseBuckets.end() && (bucket->first >> bucketKeySizeClassBits) == keyPrefix; ++bucket) {
+        for (auto &candidate : bucket->second) {
+            auto curr = candidate.allocation;
+            if (curr->getUnderlyingBufferSize() < req->requiredMinimalSize) {
+                continue;
+            }
             if (req->csrTagAddress == nullptr) {
-                return removeOneImpl(curr, nullptr);
+                return removeOneIndexedImpl(curr, nullptr);
             }
             if ((this->allocationUsage == TEMPORARY_ALLOCATION || checkTagAddressReady(req, curr)) &&
                 (req->requiredPtr == nullptr || req->requiredPtr == curr->getUnderlyingBuffer())) {
@@ -77,10 +102,195 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
                     // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
                     curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
                 }
-                return removeOneImpl(curr, nullptr);
+                return removeOneIndexedImpl(curr, nullptr);
+            }
+        }
+    }
+    return nullptr;
+}
+
+size_t AllocationsList::freeIdleAllocations(CommandStreamReceiver &commandStreamReceiver, std::chrono::nanoseconds maxIdleTime) {
+    IdleAllocationsRequirements req;
+    req.now = std::chrono::steady_clock::now();
+    req.maxIdleTime = maxIdleTime;
+    // allocation is complete only when every active partition has passed its task count
+    auto tagAddress = commandStreamReceiver.getTagAddress();
+    req.completedTaskCount = static_cast<TaskCountType>(*tagAddress);
+    for (uint32_t partition = 1; partition < commandStreamReceiver.getActivePartitions(); partition++) {
+        tagAddress = ptrOffset(tagAddress, commandStreamReceiver.getImmWritePostSyncWriteOffset());
+        req.completedTaskCount = std::min(req.completedTaskCount, static_cast<TaskCountType>(*tagAddress));
+    }
+    req.contextId = commandStreamReceiver.getOsContext().getContextId();
+    processLocked<AllocationsList, &AllocationsList::detachIdleAllocationsImpl>(nullptr, static_cast<void *>(&req));
+
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    for (auto allocation : req.allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+    return req.allocations.size();
+}
+
+GraphicsAllocation *AllocationsList::detachIdleAllocationsImpl(GraphicsAllocation *, void *data) {
+    IdleAllocationsRequirements *req = static_cast<IdleAllocationsRequirements *>(data);
+    for (auto &bucket : reuseBuckets) {
+        for (auto &candidate : bucket.second) {
+            if (req->now - candidate.storeTime >= req->maxIdleTime &&
+                candidate.allocation->hostPtrTaskCountAssignment == 0 &&
+                candidate.allocation->getTaskCount(req->contextId) <= req->completedTaskCount) {
+                req->allocations.push_back(candidate.allocation);
             }
         }
-        curr = curr->next;
+    }
+    for (auto allocation : req->allocations) {
+        removeOneIndexedImpl(allocation, nullptr);
+    }
+    return nullptr;
+}
+
+std::vector<GraphicsAllocation *> AllocationsList::detachCompletedAllocations(TaskCountType waitTaskCount, uint32_t contextId) {
+    CompletedAllocationsRequirements req;
+    req.waitTaskCount = waitTaskCount;
+    req.contextId = contextId;
+    processLocked<AllocationsList, &AllocationsList::detachCompletedAllocationsImpl>(nullptr, static_cast<void *>(&req));
+    return req.allocations;
+}
+
+GraphicsAllocation *AllocationsList::detachCompletedAllocationsImpl(GraphicsAllocation *, void *data) {
+    CompletedAllocationsRequirements *req = static_cast<CompletedAllocationsRequirements *>(data);
+    // allocations left on the list keep their position and store time
+    for (auto curr = head; curr != nullptr; curr = curr->next) {
+        if (curr->hostPtrTaskCountAssignment == 0 && curr->getTaskCount(req->contextId) <= req->waitTaskCount) {
+            req->allocations.push_back(curr);
+        }
+    }
+    for (auto allocation : req->allocations) {
+        removeOneIndexedImpl(allocation, nullptr);
+    }
+    return nullptr;
+}
+
+uint64_t AllocationsList::getBucketKey(AllocationType allocationType, bool systemMemoryForced, size_t size) {
+    uint64_t sizeClass = (size == 0u) ? 0u : Math::log2(static_cast<uint64_t>(size));
+    return (static_cast<uint64_t>(allocationType) << (bucketKeySizeClassBits + 1)) |
+           (static_cast<uint64_t>(systemMemoryForced) << bucketKeySizeClassBits) |
+           sizeClass;
+}
+
+uint64_t AllocationsList::getBucketKey(const GraphicsAllocation &allocation) {
+    return getBucketKey(allocation.getAllocationType(), allocation.storageInfo.systemMemoryForced, allocation.getUnderlyingBufferSize());
+}
+
+void AllocationsList::addToBucket(GraphicsAllocation &allocation, bool front) {
+    auto &bucket = reuseBuckets[getBucketKey(allocation)];
+    ReuseCandidate candidate{&allocation, std::chrono::steady_clock::now()};
+    if (front) {
+        bucket.push_front(candidate);
+    } else {
+        bucket.push_back(candidate);
+    }
+}
+
+void AllocationsList::removeFromBucket(GraphicsAllocation &allocation) {
+    auto isSameAllocation = [&allocation](const ReuseCandidate &candidate) { return candidate.allocation == &allocation; };
+
+    auto bucket = reuseBuckets.find(getBucketKey(allocation));
+    if (bucket == reuseBuckets.end() || std::find_if(bucket->second.begin(), bucket->second.end(), isSameAllocation) == bucket->second.end()) {
+        // allocation properties changed after it was put on the list
+        bucket = std::find_if(reuseBuckets.begin(), reuseBuckets.end(), [&isSameAllocation](const auto &entry) {
+            return std::find_if(entry.second.begin(), entry.second.end(), isSameAllocation) != entry.second.end();
+        });
+        if (bucket == reuseBuckets.end()) {
+            return;
+        }
+    }
+
+    auto &candidates = bucket->second;
+    candidates.erase(std::find_if(candidates.begin(), candidates.end(), isSameAllocation));
+    if (candidates.empty()) {
+        reuseBuckets.erase(bucket);
+    }
+}
+
+void AllocationsList::removeChainFromBuckets(GraphicsAllocation *chain) {
+    while (chain != nullptr) {
+        removeFromBucket(*chain);
+        chain = chain->next;
+    }
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushFrontOneIndexedImpl>(&node);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneIndexedImpl>(&node);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &node) {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeOneIndexedImpl>(&node));
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeFrontOneIndexedImpl>(nullptr));
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    return processLocked<AllocationsList, &AllocationsList::detachSequenceIndexedImpl>(&first, &last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesIndexedImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &nodes) {
+    processLocked<AllocationsList, &AllocationsList::spliceIndexedImpl>(&nodes);
+}
+
+void AllocationsList::deleteAll() {
+    GraphicsAllocation *nodes = detachNodes();
+    nodes->deleteThisAndAllNext();
+}
+
+GraphicsAllocation *AllocationsList::pushFrontOneIndexedImpl(GraphicsAllocation *node, void *) {
+    pushFrontOneImpl(node, nullptr);
+    addToBucket(*node, true);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::pushTailOneIndexedImpl(GraphicsAllocation *node, void *) {
+    pushTailOneImpl(node, nullptr);
+    addToBucket(*node, false);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::removeOneIndexedImpl(GraphicsAllocation *node, void *) {
+    removeFromBucket(*node);
+    return removeOneImpl(node, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFrontOneIndexedImpl(GraphicsAllocation *, void *) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    return removeOneIndexedImpl(head, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachSequenceIndexedImpl(GraphicsAllocation *node, void *data) {
+    auto sequence = detachSequenceImpl(node, data);
+    removeChainFromBuckets(sequence);
+    return sequence;
+}
+
+GraphicsAllocation *AllocationsList::detachNodesIndexedImpl(GraphicsAllocation *, void *) {
+    reuseBuckets.clear();
+    return detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceIndexedImpl(GraphicsAllocation *node, void *) {
+    spliceImpl(node, nullptr);
+    // spliced nodes come from another list and become reuse candidates of this one now
+    for (auto curr = node; curr != nullptr; curr = curr->next) {
+        addToBucket(*curr, false);
     }
     return nullptr;
 }
@@ -94,5 +304,6 @@ void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
     }
     head = nullptr;
     tail = nullptr;
+    reuseBuckets.clear();
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,11 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <chrono>
+#include <deque>
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -23,10 +27,45 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, bool forceSystemMemoryFlag, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     void freeAllGraphicsAllocations(Device *neoDevice);
+    size_t freeIdleAllocations(CommandStreamReceiver &commandStreamReceiver, std::chrono::nanoseconds maxIdleTime);
+    std::vector<GraphicsAllocation *> detachCompletedAllocations(TaskCountType waitTaskCount, uint32_t contextId);
+
+    // list modifications are shadowed to keep reuse buckets in sync with list content
+    void pushFrontOne(GraphicsAllocation &node);
+    void pushTailOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &nodes);
+    void deleteAll();
+
+  protected:
+    struct ReuseCandidate {
+        GraphicsAllocation *allocation;
+        std::chrono::steady_clock::time_point storeTime;
+    };
+    using ReuseBucket = std::deque<ReuseCandidate>;
+
+    static uint64_t getBucketKey(AllocationType allocationType, bool systemMemoryForced, size_t size);
+    static uint64_t getBucketKey(const GraphicsAllocation &allocation);
+    void addToBucket(GraphicsAllocation &allocation, bool front);
+    void removeFromBucket(GraphicsAllocation &allocation);
+    void removeChainFromBuckets(GraphicsAllocation *chain);
 
-  private:
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachIdleAllocationsImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachCompletedAllocationsImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushFrontOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *pushTailOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeFrontOneIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachSequenceIndexedImpl(GraphicsAllocation *node, void *data);
+    GraphicsAllocation *detachNodesIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceIndexedImpl(GraphicsAllocation *node, void *);
 
+    // allocations bucketed by type, memory pool and size class, each bucket keeps list order
+    std::map<uint64_t, ReuseBucket> reuseBuckets;
     const AllocationUsage allocationUsage{REUSABLE_ALLOCATION};
 };
 } // namespace NEO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/dirty_page_tracker.h"
+
+#include "shared/source/helpers/hash.h"
+
+namespace NEO {
+
+bool DirtyPageTracker::checkAndUpdate(uint64_t physAddress, const void *cpuAddress, size_t size, uint64_t entryBits) {
+    auto contentHash = hashContent(cpuAddress, size);
+
+    auto [trackedPage, isNewPage] = pageStates.try_emplace(physAddress);
+    auto &pageState = trackedPage->second;
+    if (!isNewPage && pageState.contentValid && pageState.contentHash == contentHash && pageState.entryBits == entryBits) {
+        statistics.skippedBytes += size;
+        return false;
+    }
+
+    pageState.contentHash = contentHash;
+    pageState.entryBits = entryBits;
+    pageState.contentValid = true;
+    statistics.writtenBytes += size;
+    return true;
+}
+
+void DirtyPageTracker::updateContent(uint64_t physAddress, const void *cpuAddress, size_t size) {
+    auto trackedPage = pageStates.find(physAddress);
+    if (trackedPage != pageStates.end()) {
+        trackedPage->second.contentHash = hashContent(cpuAddress, size);
+        trackedPage->second.contentValid = true;
+    }
+}
+
+void DirtyPageTracker::invalidateContent(uint64_t physAddress) {
+    auto trackedPage = pageStates.find(physAddress);
+    if (trackedPage != pageStates.end()) {
+        trackedPage->second.contentValid = false;
+    }
+}
+
+DirtyPageTracker::Statistics DirtyPageTracker::resetStatistics() {
+    auto currentStatistics = statistics;
+    statistics = {};
+    return currentStatistics;
+}
+
+uint64_t DirtyPageTracker::hashContent(const void *cpuAddress, size_t size) {
+    Hash contentHash;
+    contentHash.update(reinterpret_cast<const char *>(cpuAddress), size);
+    contentHash.update(reinterpret_cast<const char *>(&size), sizeof(size));
+    return contentHash.finish();
+}
+
+} // namespace NEO
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace NEO {
+
+// Tracks content of pages uploaded to simulator (AUB file or TBX server) by physical address.
+// Pages whose content and page table entry bits did not change since last upload don't need to be sent again.
+class DirtyPageTracker : NonCopyableOrMovableClass {
+  public:
+    struct Statistics {
+        uint64_t writtenBytes = 0;
+        uint64_t skippedBytes = 0;
+    };
+
+    // returns true when page differs from its last uploaded state, new state is recorded as uploaded
+    bool checkAndUpdate(uint64_t physAddress, const void *cpuAddress, size_t size, uint64_t entryBits);
+    // refreshes content of uploaded page which is known to match simulator memory again, e.g. after reading it back
+    void updateContent(uint64_t physAddress, const void *cpuAddress, size_t size);
+    // marks simulator content of page as unknown, e.g. when GPU could write it, so next upload is not skipped
+    void invalidateContent(uint64_t physAddress);
+    void clear() { pageStates.clear(); }
+
+    size_t getTrackedPagesCount() const { return pageStates.size(); }
+    const Statistics &getStatistics() const { return statistics; }
+    Statistics resetStatistics();
+
+  protected:
+    struct PageState {
+        uint64_t contentHash = 0;
+        uint64_t entryBits = 0;
+        bool contentValid = true;
+    };
+
+    static uint64_t hashContent(const void *cpuAddress, size_t size);
+
+    std::unordered_map<uint64_t, PageState> pageStates;
+    Statistics statistics;
+};
+
+} // namespace NEO
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/host_ptr_staging_ring.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+namespace NEO {
+
+bool HostPtrStagingRing::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t chunkSize, uint32_t chunkCount) {
+    this->ring = svmMemoryManager->createHostUnifiedMemoryAllocation(chunkSize * chunkCount, memoryProperties);
+    if (nullptr == this->ring) {
+        return false;
+    }
+    this->svmMemoryManager = svmMemoryManager;
+    this->chunkSize = chunkSize;
+    this->chunks.assign(chunkCount, ChunkState{});
+    this->nextChunk = 0u;
+    return true;
+}
+
+bool HostPtrStagingRing::isInitialized() const {
+    return this->ring;
+}
+
+void HostPtrStagingRing::cleanup() {
+    if (isInitialized()) {
+        // blocking free waits for copies still reading from or writing to chunks
+        this->svmMemoryManager->freeSVMAlloc(this->ring, true);
+        this->svmMemoryManager = nullptr;
+        this->ring = nullptr;
+        this->chunkSize = 0u;
+        this->chunks.clear();
+    }
+}
+
+bool HostPtrStagingRing::canBeStaged(size_t size) const {
+    return isInitialized() && size > 0u && size <= this->chunkSize * this->chunks.size();
+}
+
+bool HostPtrStagingRing::isChunkReady(const ChunkState &chunkState) const {
+    if (chunkState.acquired) {
+        return false;
+    }
+    return chunkState.csr == nullptr || chunkState.csr->testTaskCountReady(chunkState.csr->getTagAddress(), chunkState.taskCount);
+}
+
+bool HostPtrStagingRing::acquireChunk(size_t size, Chunk &chunk) {
+    if (size > this->chunkSize) {
+        return false;
+    }
+    Chunks acquiredChunks;
+    if (!acquireChunks(size, acquiredChunks)) {
+        return false;
+    }
+    chunk = acquiredChunks[0];
+    return true;
+}
+
+bool HostPtrStagingRing::acquireChunks(size_t size, Chunks &acquiredChunks) {
+    if (!canBeStaged(size)) {
+        return false;
+    }
+    const auto requiredChunks = static_cast<uint32_t>(Math::divideAndRoundUp(size, this->chunkSize));
+    std::lock_guard<std::mutex> lock(mtx);
+    const auto chunkCount = static_cast<uint32_t>(this->chunks.size());
+    // chunks are handed out in submission order, so oldest pending copy is checked first
+    for (uint32_t i = 0u; i < chunkCount && acquiredChunks.size() < requiredChunks; i++) {
+        const auto index = (this->nextChunk + i) % chunkCount;
+        auto &chunkState = this->chunks[index];
+        if (isChunkReady(chunkState)) {
+            chunkState = {};
+            chunkState.acquired = true;
+            acquiredChunks.push_back({ptrOffset(this->ring, index * this->chunkSize), index});
+        }
+    }
+    if (acquiredChunks.size() < requiredChunks) {
+        // transfer is staged whole or not at all
+        for (auto &chunk : acquiredChunks) {
+            this->chunks[chunk.index].acquired = false;
+        }
+        acquiredChunks.clear();
+        return false;
+    }
+    this->nextChunk = (acquiredChunks[acquiredChunks.size() - 1].index + 1) % chunkCount;
+    return true;
+}
+
+void HostPtrStagingRing::releaseChunk(const Chunk &chunk, CommandStreamReceiver *csr, TaskCountType taskCount) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &chunkState = this->chunks[chunk.index];
+    chunkState.csr = csr;
+    chunkState.taskCount = taskCount;
+    chunkState.acquired = false;
+}
+
+GraphicsAllocation *HostPtrStagingRing::getAllocation(uint32_t rootDeviceIndex) const {
+    auto svmData = this->svmMemoryManager->getSVMAlloc(this->ring);
+    return svmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
+}
+
+} // namespace NEO
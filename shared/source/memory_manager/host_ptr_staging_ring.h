@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class GraphicsAllocation;
+
+// Persistent host USM allocation split into chunks, used to stage transfers from/to non-USM host pointers
+// instead of creating userptr allocation per transfer. Transfer larger than chunk is split into per-chunk copies.
+// Chunk becomes available again when copy using it completes.
+class HostPtrStagingRing {
+  public:
+    using UnifiedMemoryProperties = SVMAllocsManager::UnifiedMemoryProperties;
+    struct Chunk {
+        void *ptr = nullptr;
+        uint32_t index = 0u;
+    };
+    using Chunks = StackVec<Chunk, 8>;
+
+    HostPtrStagingRing() = default;
+    bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t chunkSize, uint32_t chunkCount);
+    bool isInitialized() const;
+    void cleanup();
+    bool canBeStaged(size_t size) const;
+    bool acquireChunk(size_t size, Chunk &chunk);
+    bool acquireChunks(size_t size, Chunks &acquiredChunks);
+    void releaseChunk(const Chunk &chunk, CommandStreamReceiver *csr, TaskCountType taskCount);
+    GraphicsAllocation *getAllocation(uint32_t rootDeviceIndex) const;
+    size_t getChunkSize() const { return chunkSize; }
+    uint32_t getChunkCount() const { return static_cast<uint32_t>(chunks.size()); }
+
+    static constexpr size_t defaultChunkSize = 256 * MemoryConstants::kiloByte;
+    static constexpr uint32_t defaultChunkCount = 8u;
+
+  protected:
+    struct ChunkState {
+        CommandStreamReceiver *csr = nullptr;
+        TaskCountType taskCount = 0u;
+        bool acquired = false;
+    };
+    bool isChunkReady(const ChunkState &chunkState) const;
+
+    void *ring = nullptr;
+    SVMAllocsManager *svmMemoryManager = nullptr;
+    size_t chunkSize = 0u;
+    std::vector<ChunkState> chunks;
+    uint32_t nextChunk = 0u;
+    std::mutex mtx;
+};
+
+} // namespace NEO
@@ -36,6 +36,10 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
     auto &allocationsList = allocationLists[allocationUsage];
     gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
     allocationsList.pushTailOne(*gfxAllocation.release());
+
+    if (allocationUsage == REUSABLE_ALLOCATION && commandStreamReceiver.getMemoryManager()->isMemoryBudgetExhausted()) {
+        freeIdleReusableAllocations();
+    }
 }
 
 void InternalAllocationStorage::cleanAllocationList(TaskCountType waitTaskCount, uint32_t allocationUsage) {
@@ -55,21 +59,9 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
     auto memoryManager = commandStreamReceiver.getMemoryManager();
     auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
 
-    GraphicsAllocation *curr = allocationsList.detachNodes();
-
-    IDList<GraphicsAllocation, false, true> allocationsLeft;
-    while (curr != nullptr) {
-        auto *next = curr->next;
-        if (curr->hostPtrTaskCountAssignment == 0 && curr->getTaskCount(commandStreamReceiver.getOsContext().getContextId()) <= waitTaskCount) {
-            memoryManager->freeGraphicsMemory(curr);
-        } else {
-            allocationsLeft.pushTailOne(*curr);
-        }
-        curr = next;
-    }
-
-    if (allocationsLeft.peekIsEmpty() == false) {
-        allocationsList.splice(*allocationsLeft.detachNodes());
+    // allocations still in use stay on the list, so their idle time keeps counting
+    for (auto allocation : allocationsList.detachCompletedAllocations(waitTaskCount, commandStreamReceiver.getOsContext().getContextId())) {
+        memoryManager->freeGraphicsMemory(allocation);
     }
 }
 
@@ -83,6 +75,14 @@ std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainTemporaryAl
     return allocation;
 }
 
+size_t InternalAllocationStorage::freeIdleReusableAllocations() {
+    std::chrono::milliseconds maxIdleTime{1000};
+    if (debugManager.flags.ReusableAllocationsIdleTimeToTrim.get() != -1) {
+        maxIdleTime = std::chrono::milliseconds(debugManager.flags.ReusableAllocationsIdleTimeToTrim.get());
+    }
+    return allocationLists[REUSABLE_ALLOCATION].freeIdleAllocations(commandStreamReceiver, maxIdleTime);
+}
+
 DeviceBitfield InternalAllocationStorage::getDeviceBitfield() const {
     return commandStreamReceiver.getOsContext().getDeviceBitfield();
 }
@@ -571,6 +571,7 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
     allocationData.osContext = properties.osContext;
     allocationData.rootDeviceIndex = properties.rootDeviceIndex;
     allocationData.useMmapObject = properties.useMmapObject;
+    allocationData.numaNode = properties.numaNode;
 
     helper.setExtraAllocationData(allocationData, properties, rootDeviceEnvironment);
     allocationData.flags.useSystemMemory |= properties.flags.forceSystemMemory;
@@ -193,6 +193,7 @@ class MemoryManager {
 
     virtual bool hasPageFaultsEnabled(const Device &neoDevice) { return false; }
     virtual bool isKmdMigrationAvailable(uint32_t rootDeviceIndex) { return false; }
+    virtual bool isHostNumaNodeSelectionSupported(uint32_t rootDeviceIndex) { return false; }
 
     virtual AlignedMallocRestrictions *getAlignedMallocRestrictions() {
         return nullptr;
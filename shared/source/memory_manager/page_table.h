@@ -1,16 +1,18 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/aub_mem_dump/page_table_entry_bits.h"
 #include "shared/source/memory_manager/physical_address_allocator.h"
 
 #include <array>
 #include <cinttypes>
 #include <functional>
+#include <type_traits>
 
 namespace NEO {
 
@@ -32,6 +34,10 @@ class PageTable {
     virtual uintptr_t map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank);
     virtual void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank);
 
+    // Same walk as pageWalk, but visitor is called directly instead of through std::function for every page
+    template <typename PageVisitorT>
+    void pageWalkWithVisitor(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageVisitorT &visitor, uint32_t memoryBank);
+
     static const size_t pageSize = 1 << 12;
     static size_t getBits() {
         return T::getBits() + bits;
@@ -53,6 +59,9 @@ class PTE : public PageTable<void, 0u> {
     uintptr_t map(uintptr_t vm, size_t size, uint64_t entryBits, uint32_t memoryBank) override;
     void pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) override;
 
+    template <typename PageVisitorT>
+    void pageWalkWithVisitor(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageVisitorT &visitor, uint32_t memoryBank);
+
     static const uint32_t level = 0;
     static const uint32_t bits = 9;
 };
@@ -80,4 +89,105 @@ class PDPE : public PageTable<class PDE, 2, 2> {
     PDPE(PhysicalAddressAllocator *physicalAddressAllocator) : PageTable<class PDE, 2, 2>(physicalAddressAllocator) {
     }
 };
+
+template <class T, uint32_t level, uint32_t bits>
+template <typename PageVisitorT>
+inline void PageTable<T, level, bits>::pageWalkWithVisitor(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageVisitorT &visitor, uint32_t memoryBank) {
+    if constexpr (!std::is_void_v<T>) {
+        const size_t shift = T::getBits() + 12;
+        const uintptr_t mask = static_cast<uintptr_t>(maxNBitValue(bits));
+        size_t indexStart = (vm >> shift) & mask;
+        size_t indexEnd = ((vm + size - 1) >> shift) & mask;
+        uintptr_t vmMask = (uintptr_t(-1) >> (sizeof(void *) * 8 - shift - bits));
+        auto maskedVm = vm & vmMask;
+
+        for (size_t index = indexStart; index <= indexEnd; index++) {
+            uintptr_t vmStart = (uintptr_t(1) << shift) * index;
+            vmStart = std::max(vmStart, maskedVm);
+            uintptr_t vmEnd = (uintptr_t(1) << shift) * (index + 1) - 1;
+            vmEnd = std::min(vmEnd, maskedVm + size - 1);
+
+            if (entries[index] == nullptr) {
+                entries[index] = new T(allocator);
+            }
+            entries[index]->pageWalkWithVisitor(vmStart, vmEnd - vmStart + 1, offset, entryBits, visitor, memoryBank);
+
+            offset += (vmEnd - vmStart + 1);
+        }
+    }
+}
+
+template <typename PageVisitorT>
+inline void PTE::pageWalkWithVisitor(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageVisitorT &visitor, uint32_t memoryBank) {
+    const size_t shift = 12;
+    const auto mask = static_cast<uint32_t>(maxNBitValue(bits));
+    size_t indexStart = (vm >> shift) & mask;
+    size_t indexEnd = ((vm + size - 1) >> shift) & mask;
+    uint64_t res = -1;
+    uintptr_t rem = vm & (pageSize - 1);
+    bool updateEntryBits = entryBits != PageTableEntry::nonValidBits;
+    uint64_t newEntryBits = entryBits & MemoryConstants::pageMask;
+    newEntryBits |= 0x1;
+
+    for (size_t index = indexStart; index <= indexEnd; index++) {
+        if (entries[index] == 0x0) {
+            uint64_t tmp = allocator->reserve4kPage(memoryBank);
+            entries[index] = reinterpret_cast<void *>(tmp | newEntryBits);
+        } else if (updateEntryBits) {
+            entries[index] = reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask) | newEntryBits);
+        }
+        res = reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::page4kEntryMask;
+
+        size_t lSize = std::min(pageSize - rem, size);
+        visitor((res & ~0x1) + rem, lSize, offset, reinterpret_cast<uintptr_t>(entries[index]) & MemoryConstants::pageMask);
+
+        size -= lSize;
+        offset += lSize;
+        rem = 0;
+    }
+}
+
+struct PageWalkChunk {
+    uint64_t physAddress = 0;
+    size_t size = 0;
+    size_t offset = 0;
+    uint64_t entryBits = 0;
+};
+
+// Page visitor merging consecutive pages which are contiguous in both GPU VA and physical memory and share entry bits,
+// so consumers (e.g. AUB dump) can issue a single write per chunk instead of one write per 4KB page
+template <typename ChunkVisitorT>
+class PageWalkChunkCoalescer {
+  public:
+    static constexpr size_t maxChunkSize = 64 * MemoryConstants::megaByte;
+
+    PageWalkChunkCoalescer(ChunkVisitorT &chunkVisitor) : chunkVisitor(chunkVisitor) {}
+
+    void operator()(uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (pendingChunk.size != 0 &&
+            pendingChunk.physAddress + pendingChunk.size == physAddress &&
+            pendingChunk.offset + pendingChunk.size == offset &&
+            pendingChunk.entryBits == entryBits &&
+            pendingChunk.size + size <= maxChunkSize) {
+            pendingChunk.size += size;
+            return;
+        }
+        flush();
+        pendingChunk.physAddress = physAddress;
+        pendingChunk.size = size;
+        pendingChunk.offset = offset;
+        pendingChunk.entryBits = entryBits;
+    }
+
+    void flush() {
+        if (pendingChunk.size != 0) {
+            chunkVisitor(pendingChunk);
+            pendingChunk.size = 0;
+        }
+    }
+
+  protected:
+    ChunkVisitorT &chunkVisitor;
+    PageWalkChunk pendingChunk;
+};
 } // namespace NEO
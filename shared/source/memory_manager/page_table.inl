@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,25 +47,6 @@ inline uintptr_t PageTable<T, level, bits>::map(uintptr_t vm, size_t size, uint6
 
 template <class T, uint32_t level, uint32_t bits>
 inline void PageTable<T, level, bits>::pageWalk(uintptr_t vm, size_t size, size_t offset, uint64_t entryBits, PageWalker &pageWalker, uint32_t memoryBank) {
-    const size_t shift = T::getBits() + 12;
-    const uintptr_t mask = static_cast<uintptr_t>(maxNBitValue(bits));
-    size_t indexStart = (vm >> shift) & mask;
-    size_t indexEnd = ((vm + size - 1) >> shift) & mask;
-    uintptr_t vmMask = (uintptr_t(-1) >> (sizeof(void *) * 8 - shift - bits));
-    auto maskedVm = vm & vmMask;
-
-    for (size_t index = indexStart; index <= indexEnd; index++) {
-        uintptr_t vmStart = (uintptr_t(1) << shift) * index;
-        vmStart = std::max(vmStart, maskedVm);
-        uintptr_t vmEnd = (uintptr_t(1) << shift) * (index + 1) - 1;
-        vmEnd = std::min(vmEnd, maskedVm + size - 1);
-
-        if (entries[index] == nullptr) {
-            entries[index] = new T(allocator);
-        }
-        entries[index]->pageWalk(vmStart, vmEnd - vmStart + 1, offset, entryBits, pageWalker, memoryBank);
-
-        offset += (vmEnd - vmStart + 1);
-    }
+    pageWalkWithVisitor(vm, size, offset, entryBits, pageWalker, memoryBank);
 }
 } // namespace NEO
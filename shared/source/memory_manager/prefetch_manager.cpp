@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,54 @@ void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAlloc
 void PrefetchManager::removeAllocations(PrefetchContext &context) {
     std::unique_lock<SpinLock> lock{context.lock};
     context.allocations.clear();
+    context.learnedAllocations.clear();
+}
+
+void PrefetchManager::learnKernelAccesses(PrefetchContext &context, const void *kernelId, const std::vector<const void *> &accessedAllocations) {
+    std::unique_lock<SpinLock> historyLock{this->historyLock};
+    std::unique_lock<SpinLock> lock{context.lock};
+
+    if (context.lastKernelId != nullptr) {
+        auto previousKernel = kernelAccessHistory.find(context.lastKernelId);
+        if (previousKernel != kernelAccessHistory.end()) {
+            previousKernel->second.nextKernelId = kernelId;
+        }
+    }
+    context.lastKernelId = kernelId;
+
+    auto &history = kernelAccessHistory[kernelId];
+    history.allocations.clear();
+    for (auto &ptr : accessedAllocations) {
+        if (!history.allocations.insert(ptr).second) {
+            continue;
+        }
+        if (context.learnedAllocations.insert(ptr).second) {
+            context.allocations.push_back(ptr);
+            context.statistics.misses++;
+        } else {
+            context.statistics.hits++;
+        }
+    }
+
+    // allocations used by kernel which followed this one last time are migrated ahead of its launch
+    auto nextKernel = kernelAccessHistory.find(history.nextKernelId);
+    if (nextKernel != kernelAccessHistory.end()) {
+        for (auto &ptr : nextKernel->second.allocations) {
+            if (context.learnedAllocations.insert(ptr).second) {
+                context.allocations.push_back(ptr);
+            }
+        }
+    }
+}
+
+void PrefetchManager::removeKernelAccesses(const void *kernelId) {
+    std::unique_lock<SpinLock> historyLock{this->historyLock};
+    kernelAccessHistory.erase(kernelId);
+    for (auto &kernelAccesses : kernelAccessHistory) {
+        if (kernelAccesses.second.nextKernelId == kernelId) {
+            kernelAccesses.second.nextKernelId = nullptr;
+        }
+    }
 }
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,10 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
@@ -20,9 +23,18 @@ class CommandStreamReceiver;
 class Device;
 class SVMAllocsManager;
 
+struct PrefetchStatistics {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+};
+
 struct PrefetchContext {
     std::vector<const void *> allocations;
+    std::unordered_set<const void *> learnedAllocations;
+    const void *lastKernelId = nullptr;
     SpinLock lock;
+    bool accessPatternLearningEnabled = false;
+    PrefetchStatistics statistics;
 };
 
 class PrefetchManager : public NonCopyableOrMovableClass {
@@ -36,6 +48,19 @@ class PrefetchManager : public NonCopyableOrMovableClass {
     MOCKABLE_VIRTUAL void migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr);
 
     MOCKABLE_VIRTUAL void removeAllocations(PrefetchContext &context);
+
+    MOCKABLE_VIRTUAL void learnKernelAccesses(PrefetchContext &context, const void *kernelId, const std::vector<const void *> &accessedAllocations);
+
+    MOCKABLE_VIRTUAL void removeKernelAccesses(const void *kernelId);
+
+  protected:
+    struct KernelAccesses {
+        std::unordered_set<const void *> allocations;
+        const void *nextKernelId = nullptr;
+    };
+
+    std::unordered_map<const void *, KernelAccesses> kernelAccessHistory;
+    SpinLock historyLock;
 };
 
 } // namespace NEO
@@ -62,7 +62,8 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
         UNRECOVERABLE_IF(!svmAllocData);
         if (svmAllocData->device == unifiedMemoryProperties.device &&
             svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
+            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags &&
+            svmAllocData->allocationFlagsProperty.numaNode == unifiedMemoryProperties.allocationFlags.numaNode) {
             totalSize -= allocationIter->allocationSize;
             allocations.erase(allocationIter);
             return allocationPtr;
@@ -220,6 +221,7 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     unifiedMemoryProperties.flags.isUSMHostAllocation = true;
     unifiedMemoryProperties.flags.isUSMDeviceAllocation = false;
     unifiedMemoryProperties.cacheRegion = MemoryPropertiesHelper::getCacheRegion(memoryProperties.allocationFlags);
+    unifiedMemoryProperties.numaNode = memoryProperties.allocationFlags.numaNode;
 
     if (this->usmHostAllocationsCacheEnabled) {
         void *allocationFromCache = this->usmHostAllocationsCache.get(size, memoryProperties, this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@ struct MemoryProperties {
     const Device *pDevice = nullptr;
     std::vector<Device *> associatedDevices;
     uint32_t memCacheClos = 0;
+    int32_t numaNode = -1;
     union {
         MemoryFlags flags;
         uint32_t allFlags = 0;
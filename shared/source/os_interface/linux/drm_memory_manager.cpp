@@ -44,10 +44,20 @@
 #include "shared/source/os_interface/linux/sys_calls.h"
 #include "shared/source/os_interface/os_interface.h"
 
+#include <climits>
 #include <cstring>
 #include <iostream>
+#include <linux/mempolicy.h>
 #include <memory>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
 
 namespace NEO {
 
@@ -110,6 +120,12 @@ void DrmMemoryManager::initialize(GemCloseWorkerMode mode) {
         }
         localMemAllocs.emplace_back();
         disableGemCloseWorker &= getDrm(rootDeviceIndex).isVmBindAvailable();
+
+        int32_t numaNode = -1;
+        if (debugManager.flags.EnableHostAllocationNumaPlacement.get() != 0) {
+            getDrm(rootDeviceIndex).getDeviceNumaNode(numaNode);
+        }
+        deviceNumaNodes.push_back(numaNode);
     }
 
     if (disableGemCloseWorker) {
@@ -165,6 +181,7 @@ void DrmMemoryManager::createDeviceSpecificMemResources(uint32_t rootDeviceIndex
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    printHugePagesStatistics();
     for (auto &memoryForPinBB : memoryForPinBBs) {
         if (memoryForPinBB) {
             MemoryManager::alignedFreeWrapper(memoryForPinBB);
@@ -277,6 +294,15 @@ bool DrmMemoryManager::isKmdMigrationAvailable(uint32_t rootDeviceIndex) {
     return drm.hasKmdMigrationSupport();
 }
 
+bool DrmMemoryManager::isHostNumaNodeSelectionSupported(uint32_t rootDeviceIndex) {
+    if (debugManager.flags.EnableHostAllocationNumaPlacement.get() == 0) {
+        return false;
+    }
+    // pages of BO mmap allocations are allocated by kernel driver, node can be passed only with GEM create memory policy
+    auto &drm = this->getDrm(rootDeviceIndex);
+    return drm.getMemoryInfo() == nullptr || drm.getIoctlHelper()->isGemCreateMemPolicyExtSupported();
+}
+
 bool DrmMemoryManager::setMemAdvise(GraphicsAllocation *gfxAllocation, MemAdviseFlags flags, uint32_t rootDeviceIndex) {
     auto drmAllocation = static_cast<DrmAllocation *>(gfxAllocation);
 
@@ -405,28 +431,48 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignmentImpl(const A
 }
 
 DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSVMSize, uint64_t gpuAddress) {
-    auto res = alignedMallocWrapper(size, alignment);
+    void *mappedPtr = nullptr;
+    size_t mappedSize = 0;
+    auto res = allocateHugePagesHostMemory(size, alignment, mappedPtr, mappedSize);
+    if (!res) {
+        res = alignedMallocWrapper(size, alignment);
+    }
     if (!res) {
         return nullptr;
     }
+    applyHostNumaPolicy(allocationData, res, size, true);
 
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), size, allocationData.rootDeviceIndex));
     if (!bo) {
-        alignedFreeWrapper(res);
+        if (mappedPtr) {
+            this->munmapFunction(mappedPtr, mappedSize);
+        } else {
+            alignedFreeWrapper(res);
+        }
         return nullptr;
     }
 
-    zeroCpuMemoryIfRequested(allocationData, res, size);
+    // anonymous mappings are zeroed by kernel on first touch
+    if (!mappedPtr) {
+        zeroCpuMemoryIfRequested(allocationData, res, size);
+    }
     obtainGpuAddress(allocationData, bo.get(), gpuAddress);
     emitPinningRequest(bo.get(), allocationData);
 
     auto gmmHelper = getGmmHelper(allocationData.rootDeviceIndex);
     auto canonizedGpuAddress = gmmHelper->canonize(bo->peekAddress());
     auto allocation = std::make_unique<DrmAllocation>(allocationData.rootDeviceIndex, 1u /*num gmms*/, allocationData.type, bo.get(), res, canonizedGpuAddress, size, MemoryPool::system4KBPages);
-    allocation->setDriverAllocatedCpuPtr(res);
+    if (mappedPtr) {
+        allocation->registerMemoryToUnmap(mappedPtr, mappedSize, this->munmapFunction);
+    } else {
+        allocation->setDriverAllocatedCpuPtr(res);
+    }
     allocation->setReservedAddressRange(reinterpret_cast<void *>(gpuAddress), alignedSVMSize);
     if (!allocation->setCacheRegion(&this->getDrm(allocationData.rootDeviceIndex), static_cast<CacheRegion>(allocationData.cacheRegion))) {
-        alignedFreeWrapper(res);
+        // huge pages mapping is released together with allocation
+        if (!mappedPtr) {
+            alignedFreeWrapper(res);
+        }
         return nullptr;
     }
 
@@ -442,6 +488,108 @@ void DrmMemoryManager::obtainGpuAddress(const AllocationData &allocationData, Bu
     }
 }
 
+bool DrmMemoryManager::isHugePagesHostAllocation(size_t size) const {
+    if (debugManager.flags.EnableHostAllocationHugePages.get() <= 0) {
+        return false;
+    }
+    size_t threshold = MemoryConstants::pageSize2M;
+    if (debugManager.flags.HostAllocationHugePagesThreshold.get() != -1) {
+        threshold = static_cast<size_t>(debugManager.flags.HostAllocationHugePagesThreshold.get()) * MemoryConstants::kiloByte;
+    }
+    return size >= threshold;
+}
+
+void *DrmMemoryManager::allocateHugePagesHostMemory(size_t size, size_t alignment, void *&mappedPtr, size_t &mappedSize) {
+    if (!isHugePagesHostAllocation(size)) {
+        return nullptr;
+    }
+
+    const auto mode = debugManager.flags.EnableHostAllocationHugePages.get();
+    const auto alignedSize = alignUp(size, MemoryConstants::pageSize2M);
+    if (mode == 2 && alignment <= MemoryConstants::pageSize2M) {
+        // hugetlbfs mapping is aligned to huge page size and its pages are reserved at mmap time,
+        // size is requested explicitly so that default huge page size of the system does not matter
+        auto ptr = this->mmapFunction(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            mappedPtr = ptr;
+            mappedSize = alignedSize;
+            hugePagesStatistics.hugetlbAllocations++;
+            hugePagesStatistics.hugetlbBytes += alignedSize;
+            return ptr;
+        }
+        [[maybe_unused]] int err = errno;
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "mmap(MAP_HUGETLB) of %zu bytes failed. errno=%d(%s), falling back to transparent huge pages\n", alignedSize, err, strerror(err));
+        hugePagesStatistics.hugetlbFallbacks++;
+    }
+
+    // start of range is aligned to huge page, unused head and tail of mapping are never touched so they are not backed by memory
+    const auto hugePageAlignment = std::max(alignment, MemoryConstants::pageSize2M);
+    const auto totalSize = alignedSize + hugePageAlignment;
+    auto basePtr = this->mmapFunction(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (basePtr == MAP_FAILED) {
+        hugePagesStatistics.regularPagesFallbacks++;
+        return nullptr;
+    }
+    auto ptr = alignUp(basePtr, hugePageAlignment);
+    if (SysCalls::madvise(ptr, alignedSize, MADV_HUGEPAGE) != 0) {
+        [[maybe_unused]] int err = errno;
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "madvise(MADV_HUGEPAGE) of %zu bytes failed. errno=%d(%s), falling back to regular pages\n", alignedSize, err, strerror(err));
+        this->munmapFunction(basePtr, totalSize);
+        hugePagesStatistics.regularPagesFallbacks++;
+        return nullptr;
+    }
+    mappedPtr = basePtr;
+    mappedSize = totalSize;
+    hugePagesStatistics.transparentAllocations++;
+    hugePagesStatistics.transparentBytes += alignedSize;
+    return ptr;
+}
+
+void DrmMemoryManager::printHugePagesStatistics() const {
+    PRINT_DEBUG_STRING(debugManager.flags.PrintHostAllocationHugePagesStatistics.get(), stdout,
+                       "Host allocations with huge pages: hugetlbfs %llu (%llu bytes, %llu fallbacks), transparent %llu (%llu bytes), regular pages fallbacks %llu\n",
+                       static_cast<unsigned long long>(hugePagesStatistics.hugetlbAllocations.load()), static_cast<unsigned long long>(hugePagesStatistics.hugetlbBytes.load()),
+                       static_cast<unsigned long long>(hugePagesStatistics.hugetlbFallbacks.load()), static_cast<unsigned long long>(hugePagesStatistics.transparentAllocations.load()),
+                       static_cast<unsigned long long>(hugePagesStatistics.transparentBytes.load()), static_cast<unsigned long long>(hugePagesStatistics.regularPagesFallbacks.load()));
+}
+
+void DrmMemoryManager::applyHostNumaPolicy(const AllocationData &allocationData, void *cpuPtr, size_t size, bool useDeviceNumaNode) {
+    if (debugManager.flags.EnableHostAllocationNumaPlacement.get() == 0) {
+        return;
+    }
+
+    auto numaNode = allocationData.numaNode;
+    if (debugManager.flags.OverrideHostAllocationNumaNode.get() != -1) {
+        numaNode = debugManager.flags.OverrideHostAllocationNumaNode.get();
+    }
+    if (numaNode < 0 && useDeviceNumaNode && allocationData.rootDeviceIndex < deviceNumaNodes.size()) {
+        numaNode = deviceNumaNodes[allocationData.rootDeviceIndex];
+    }
+    if (numaNode < 0) {
+        return;
+    }
+
+    constexpr size_t bitsPerMaskEntry = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> nodeMask(numaNode / bitsPerMaskEntry + 1, 0);
+    nodeMask[numaNode / bitsPerMaskEntry] = 1ul << (numaNode % bitsPerMaskEntry);
+
+    unsigned int flags = 0;
+    if (debugManager.flags.EnableHostAllocationNumaPageMigration.get() == 1) {
+        flags |= MPOL_MF_MOVE;
+    }
+
+    auto alignedCpuPtr = alignDown(cpuPtr, MemoryConstants::pageSize);
+    auto alignedSize = alignUp(ptrDiff(cpuPtr, alignedCpuPtr) + size, MemoryConstants::pageSize);
+
+    // preferred node is a hint, kernel falls back to other nodes when selected node is out of memory
+    // maxNode has to exceed highest node in mask by one, kernel ignores last bit
+    auto ret = SysCalls::mbind(alignedCpuPtr, alignedSize, MPOL_PREFERRED, nodeMask.data(), nodeMask.size() * bitsPerMaskEntry + 1, flags);
+    if (ret != 0) {
+        [[maybe_unused]] int err = errno;
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "mbind(NUMA node %d) failed with %ld. errno=%d(%s)\n", numaNode, ret, err, strerror(err));
+    }
+}
+
 GraphicsAllocation *DrmMemoryManager::allocateUSMHostGraphicsMemory(const AllocationData &allocationData) {
     const size_t minAlignment = getUserptrAlignment();
     // When size == 0 allocate allocationAlignment
@@ -451,6 +599,9 @@ GraphicsAllocation *DrmMemoryManager::allocateUSMHostGraphicsMemory(const Alloca
     void *bufferPtr = const_cast<void *>(allocationData.hostPtr);
     DEBUG_BREAK_IF(nullptr == bufferPtr);
 
+    // host memory is not owned by driver, it is placed only on explicitly requested node
+    applyHostNumaPolicy(allocationData, bufferPtr, cSize, false);
+
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(bufferPtr),
                                                                          cSize,
                                                                          allocationData.rootDeviceIndex));
@@ -1924,7 +2075,7 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
 }
 
 BufferObject *DrmMemoryManager::createBufferObjectInMemoryRegion(uint32_t rootDeviceIndex, Gmm *gmm, AllocationType allocationType, uint64_t gpuAddress,
-                                                                 size_t size, uint32_t memoryBanks, size_t maxOsContextCount, int32_t pairHandle, bool isSystemMemoryPool, bool isUsmHostAllocation) {
+                                                                 size_t size, uint32_t memoryBanks, size_t maxOsContextCount, int32_t pairHandle, bool isSystemMemoryPool, bool isUsmHostAllocation, int32_t numaNode) {
     auto drm = &getDrm(rootDeviceIndex);
     auto memoryInfo = drm->getMemoryInfo();
     if (!memoryInfo) {
@@ -1937,7 +2088,10 @@ BufferObject *DrmMemoryManager::createBufferObjectInMemoryRegion(uint32_t rootDe
     auto patIndex = drm->getPatIndex(gmm, allocationType, CacheRegion::defaultRegion, CachePolicy::writeBack, false, isSystemMemoryPool);
 
     auto banks = std::bitset<4>(memoryBanks);
-    if (banks.count() > 1) {
+    if (numaNode >= 0) {
+        UNRECOVERABLE_IF(banks.any());
+        ret = memoryInfo->createGemExtWithNumaNode(size, handle, patIndex, numaNode);
+    } else if (banks.count() > 1) {
         ret = memoryInfo->createGemExtWithMultipleRegions(memoryBanks, size, handle, patIndex, isUsmHostAllocation);
     } else {
         ret = memoryInfo->createGemExtWithSingleRegion(memoryBanks, size, handle, patIndex, pairHandle, isUsmHostAllocation);
@@ -2089,7 +2243,7 @@ bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation,
         auto gmm = allocation->getGmm(handleId);
         auto boSize = alignUp(gmm->gmmResourceInfo->getSizeAllocation(), MemoryConstants::pageSize64k);
         bos[handleId] = createBufferObjectInMemoryRegion(allocation->getRootDeviceIndex(), gmm, allocation->getAllocationType(), boAddress, boSize, memoryBanks, maxOsContextCount, pairHandle,
-                                                         !allocation->isAllocatedInLocalMemoryPool(), allocation->isUsmHostAllocation());
+                                                         !allocation->isAllocatedInLocalMemoryPool(), allocation->isUsmHostAllocation(), -1);
         if (nullptr == bos[handleId]) {
             return false;
         }
@@ -2233,6 +2387,10 @@ void DrmMemoryManager::waitOnCompletionFence(GraphicsAllocation *allocation) {
 DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress) {
     auto &drm = this->getDrm(allocationData.rootDeviceIndex);
     bool useBooMmap = drm.getMemoryInfo() && allocationData.useMmapObject;
+    // pages of BO mmap are allocated by kernel driver, huge pages can back only userptr memory mapped by the driver
+    if (isHugePagesHostAllocation(size)) {
+        useBooMmap = false;
+    }
 
     if (debugManager.flags.EnableBOMmapCreate.get() != -1) {
         useBooMmap = debugManager.flags.EnableBOMmapCreate.get();
@@ -2241,6 +2399,23 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &
     if (useBooMmap) {
         const auto memoryPool = MemoryPool::system4KBPages;
 
+        auto numaNode = allocationData.numaNode;
+        if (debugManager.flags.OverrideHostAllocationNumaNode.get() != -1) {
+            numaNode = debugManager.flags.OverrideHostAllocationNumaNode.get();
+        }
+        if (numaNode >= 0 && !isHostNumaNodeSelectionSupported(allocationData.rootDeviceIndex)) {
+            if (allocationData.numaNode >= 0) {
+                return nullptr;
+            }
+            numaNode = -1;
+        }
+        // same default as for userptr host memory, pages are preferably placed on node local to the device
+        const bool numaNodeRequested = numaNode >= 0;
+        if (!numaNodeRequested && allocationData.rootDeviceIndex < deviceNumaNodes.size() &&
+            drm.getMemoryInfo() && drm.getIoctlHelper()->isGemCreateMemPolicyExtSupported()) {
+            numaNode = deviceNumaNodes[allocationData.rootDeviceIndex];
+        }
+
         auto totalSizeToAlloc = alignedSize + alignment;
         uint64_t preferredAddress = 0;
         auto gfxPartition = getGfxPartition(allocationData.rootDeviceIndex);
@@ -2263,7 +2438,12 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &
         auto gmm = makeGmmIfSingleHandle(allocationData, alignedSize);
         std::unique_ptr<BufferObject, BufferObject::Deleter> bo(this->createBufferObjectInMemoryRegion(allocationData.rootDeviceIndex, gmm.get(), allocationData.type,
                                                                                                        reinterpret_cast<uintptr_t>(cpuPointer), alignedSize, 0u, maxOsContextCount, -1,
-                                                                                                       MemoryPoolHelper::isSystemMemoryPool(memoryPool), allocationData.flags.isUSMHostAllocation));
+                                                                                                       MemoryPoolHelper::isSystemMemoryPool(memoryPool), allocationData.flags.isUSMHostAllocation, numaNode));
+        if (!bo && !numaNodeRequested && numaNode >= 0) {
+            bo.reset(this->createBufferObjectInMemoryRegion(allocationData.rootDeviceIndex, gmm.get(), allocationData.type,
+                                                            reinterpret_cast<uintptr_t>(cpuPointer), alignedSize, 0u, maxOsContextCount, -1,
+                                                            MemoryPoolHelper::isSystemMemoryPool(memoryPool), allocationData.flags.isUSMHostAllocation, -1));
+        }
 
         if (!bo) {
             releaseGpuRange(reinterpret_cast<void *>(preferredAddress), totalSizeToAlloc, allocationData.rootDeviceIndex);
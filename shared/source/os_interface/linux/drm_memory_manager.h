@@ -9,6 +9,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 
+#include <atomic>
 #include <limits>
 #include <map>
 #include <sys/mman.h>
@@ -73,10 +74,11 @@ class DrmMemoryManager : public MemoryManager {
     size_t selectAlignmentAndHeap(size_t size, HeapIndex *heap) override;
     void freeGpuAddress(AddressRange addressRange, uint32_t rootDeviceIndex) override;
     MOCKABLE_VIRTUAL BufferObject *createBufferObjectInMemoryRegion(uint32_t rootDeviceIndex, Gmm *gmm, AllocationType allocationType, uint64_t gpuAddress, size_t size,
-                                                                    uint32_t memoryBanks, size_t maxOsContextCount, int32_t pairHandle, bool isSystemMemoryPool, bool isUsmHostAllocation);
+                                                                    uint32_t memoryBanks, size_t maxOsContextCount, int32_t pairHandle, bool isSystemMemoryPool, bool isUsmHostAllocation, int32_t numaNode);
 
     bool hasPageFaultsEnabled(const Device &neoDevice) override;
     bool isKmdMigrationAvailable(uint32_t rootDeviceIndex) override;
+    bool isHostNumaNodeSelectionSupported(uint32_t rootDeviceIndex) override;
 
     bool setMemAdvise(GraphicsAllocation *gfxAllocation, MemAdviseFlags flags, uint32_t rootDeviceIndex) override;
     bool setMemPrefetch(GraphicsAllocation *gfxAllocation, SubDeviceIdsVec &subDeviceIds, uint32_t rootDeviceIndex) override;
@@ -126,6 +128,10 @@ class DrmMemoryManager : public MemoryManager {
     DrmAllocation *createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress);
     DrmAllocation *createMultiHostAllocation(const AllocationData &allocationData);
     void obtainGpuAddress(const AllocationData &allocationData, BufferObject *bo, uint64_t gpuAddress);
+    void applyHostNumaPolicy(const AllocationData &allocationData, void *cpuPtr, size_t size, bool useDeviceNumaNode);
+    bool isHugePagesHostAllocation(size_t size) const;
+    void *allocateHugePagesHostMemory(size_t size, size_t alignment, void *&mappedPtr, size_t &mappedSize);
+    void printHugePagesStatistics() const;
     GraphicsAllocation *allocateUSMHostGraphicsMemory(const AllocationData &allocationData) override;
     GraphicsAllocation *allocateGraphicsMemoryWithHostPtr(const AllocationData &allocationData) override;
     GraphicsAllocation *allocateGraphicsMemory64kb(const AllocationData &allocationData) override;
@@ -162,6 +168,15 @@ class DrmMemoryManager : public MemoryManager {
 
     std::vector<BufferObject *> pinBBs;
     std::vector<void *> memoryForPinBBs;
+    std::vector<int32_t> deviceNumaNodes;
+    struct HugePagesStatistics {
+        std::atomic<uint64_t> hugetlbAllocations{0};
+        std::atomic<uint64_t> hugetlbBytes{0};
+        std::atomic<uint64_t> hugetlbFallbacks{0};
+        std::atomic<uint64_t> transparentAllocations{0};
+        std::atomic<uint64_t> transparentBytes{0};
+        std::atomic<uint64_t> regularPagesFallbacks{0};
+    } hugePagesStatistics;
     size_t pinThreshold = 8 * 1024 * 1024;
     bool forcePinEnabled = false;
     const bool validateHostPtrMemory;
@@ -892,6 +892,23 @@ bool Drm::getDeviceMemoryPhysicalSizeInBytes(uint32_t tileId, uint64_t &physical
     return true;
 }
 
+bool Drm::getDeviceNumaNode(int32_t &numaNode) {
+    std::string readString(16, '\0');
+    errno = 0;
+    if (readSysFsAsString("/device/numa_node", readString) == false) {
+        return false;
+    }
+
+    char *endPtr = nullptr;
+    auto retNumaNode = static_cast<int32_t>(std::strtol(readString.data(), &endPtr, 10));
+    // numa_node is -1 when platform does not report device locality
+    if ((endPtr == readString.data()) || (errno != 0) || (retNumaNode < 0)) {
+        return false;
+    }
+    numaNode = retNumaNode;
+    return true;
+}
+
 bool Drm::useVMBindImmediate() const {
     bool useBindImmediate = isDirectSubmissionActive() || hasPageFaultSupport() || ioctlHelper->isImmediateVmBindRequired();
 
@@ -193,6 +193,7 @@ class IoctlHelper {
     virtual void notifyLastCommandQueueDestroyed(uint32_t handle) { return; }
     virtual int getEuDebugSysFsEnable() { return false; }
     virtual bool isVmBindPatIndexExtSupported() { return false; }
+    virtual bool isGemCreateMemPolicyExtSupported() { return false; }
 
     virtual bool validPageFault(uint16_t flags) { return false; }
     virtual uint32_t getStatusForResetStats(bool banned) { return 0u; }
@@ -395,6 +396,7 @@ class IoctlHelperPrelim20 : public IoctlHelperI915 {
     void notifyLastCommandQueueDestroyed(uint32_t handle) override;
     int getEuDebugSysFsEnable() override;
     bool isVmBindPatIndexExtSupported() override { return true; }
+    bool isGemCreateMemPolicyExtSupported() override { return true; }
 
     bool validPageFault(uint16_t flags) override;
     uint32_t getStatusForResetStats(bool banned) override;
@@ -16,7 +16,9 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/numa_library.h"
 
+#include <climits>
 #include <iostream>
+#include <linux/mempolicy.h>
 
 namespace NEO {
 
@@ -184,4 +186,14 @@ int MemoryInfo::createGemExtWithMultipleRegions(uint32_t memoryBanks, size_t all
     return ret;
 }
 
+int MemoryInfo::createGemExtWithNumaNode(size_t allocSize, uint32_t &handle, uint64_t patIndex, int32_t numaNode) {
+    // mask size is passed as exclusive maximum of node ids, so it has to exceed selected node
+    constexpr size_t bitsPerMaskEntry = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> nodeMask(numaNode + 1, 0);
+    nodeMask[numaNode / bitsPerMaskEntry] = 1ul << (numaNode % bitsPerMaskEntry);
+
+    MemRegionsVec region = {systemMemoryRegion.region};
+    return this->drm.getIoctlHelper()->createGemExt(region, allocSize, handle, patIndex, std::nullopt, -1, false, 0, MPOL_PREFERRED, nodeMask);
+}
+
 } // namespace NEO
@@ -41,6 +41,7 @@ class MemoryInfo {
     MOCKABLE_VIRTUAL int createGemExtWithSingleRegion(uint32_t memoryBanks, size_t allocSize, uint32_t &handle, uint64_t patIndex, int32_t pairHandle, bool isUSMHostAllocation);
     MOCKABLE_VIRTUAL int createGemExtWithMultipleRegions(uint32_t memoryBanks, size_t allocSize, uint32_t &handle, uint64_t patIndex, bool isUSMHostAllocation);
     MOCKABLE_VIRTUAL int createGemExtWithMultipleRegions(uint32_t memoryBanks, size_t allocSize, uint32_t &handle, uint64_t patIndex, int32_t pairHandle, bool isChunked, uint32_t numOfChunks, bool isUSMHostAllocation);
+    MOCKABLE_VIRTUAL int createGemExtWithNumaNode(size_t allocSize, uint32_t &handle, uint64_t patIndex, int32_t numaNode);
     void populateTileToLocalMemoryRegionIndexMap();
 
     const RegionContainer &getLocalMemoryRegions() const { return localMemoryRegions; }
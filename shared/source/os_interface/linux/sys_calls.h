@@ -53,6 +53,9 @@ DIR *opendir(const char *name);
 struct dirent *readdir(DIR *dir);
 int closedir(DIR *dir);
 off_t lseek(int fd, off_t offset, int whence) noexcept;
+int ftruncate(int fd, off_t length);
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodeMask, unsigned long maxNode, unsigned int flags);
+int madvise(void *addr, size_t size, int advice);
 long sysconf(int name);
 } // namespace SysCalls
 } // namespace NEO
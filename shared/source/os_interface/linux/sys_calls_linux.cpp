@@ -18,6 +18,7 @@
 #include <sys/file.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -196,5 +197,17 @@ off_t lseek(int fd, off_t offset, int whence) noexcept {
 long sysconf(int name) {
     return ::sysconf(name);
 }
+
+int ftruncate(int fd, off_t length) {
+    return ::ftruncate(fd, length);
+}
+
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodeMask, unsigned long maxNode, unsigned int flags) {
+    return ::syscall(SYS_mbind, addr, len, mode, nodeMask, maxNode, flags);
+}
+
+int madvise(void *addr, size_t size, int advice) {
+    return ::madvise(addr, size, advice);
+}
 } // namespace SysCalls
 } // namespace NEO
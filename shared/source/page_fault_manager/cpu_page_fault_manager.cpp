@@ -8,8 +8,10 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
 
@@ -20,8 +22,14 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::cpu : AllocationDomain::none;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    pageFaultData.chunkSize = getMigrationChunkSize(size);
+    if (pageFaultData.chunkSize != 0u) {
+        pageFaultData.cpuChunks.resize(alignUp(size, pageFaultData.chunkSize) / pageFaultData.chunkSize, domain == AllocationDomain::cpu);
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -36,6 +44,10 @@ void PageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (pageFaultData.chunkSize != 0u) {
+                // chunks which were not touched by CPU are still protected
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -71,7 +83,9 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
 }
 
 inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
-    if (pageFaultData.domain == AllocationDomain::cpu) {
+    if (pageFaultData.chunkSize != 0u) {
+        migrateChunksToGpuDomain(ptr, pageFaultData);
+    } else if (pageFaultData.domain == AllocationDomain::cpu) {
         this->setCpuAllocEvictable(false, ptr, pageFaultData.unifiedMemoryManager);
 
         std::chrono::steady_clock::time_point start;
@@ -84,6 +98,8 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
         this->transferToGpu(ptr, pageFaultData.cmdQ);
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        pageFaultData.statistics.transfersToGpu++;
+        pageFaultData.statistics.bytesTransferredToGpu += pageFaultData.size;
 
         if (debugManager.flags.PrintUmdSharedMigration.get()) {
             printf("UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
@@ -94,18 +110,133 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
     pageFaultData.domain = AllocationDomain::gpu;
 }
 
+void PageFaultManager::migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    if (pageFaultData.domain == AllocationDomain::cpu) {
+        this->setCpuAllocEvictable(false, ptr, pageFaultData.unifiedMemoryManager);
+
+        if (this->checkFaultHandlerFromPageFaultManager() == false) {
+            this->registerFaultHandler();
+        }
+
+        auto &cpuChunks = pageFaultData.cpuChunks;
+        for (size_t firstChunk = 0; firstChunk < cpuChunks.size(); firstChunk++) {
+            if (cpuChunks[firstChunk] == false) {
+                continue;
+            }
+            auto lastChunk = firstChunk;
+            while (lastChunk + 1 < cpuChunks.size() && cpuChunks[lastChunk + 1]) {
+                cpuChunks[lastChunk] = false;
+                lastChunk++;
+            }
+            cpuChunks[lastChunk] = false;
+
+            auto rangeOffset = firstChunk * pageFaultData.chunkSize;
+            auto rangePtr = ptrOffset(ptr, rangeOffset);
+            auto rangeSize = std::min((lastChunk + 1) * pageFaultData.chunkSize, pageFaultData.size) - rangeOffset;
+
+            auto start = std::chrono::steady_clock::now();
+            this->transferChunkToGpu(ptr, rangePtr, rangeSize, pageFaultData.cmdQ);
+            auto end = std::chrono::steady_clock::now();
+            long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            pageFaultData.statistics.transfersToGpu++;
+            pageFaultData.statistics.bytesTransferredToGpu += rangeSize;
+
+            if (debugManager.flags.PrintUmdSharedMigration.get()) {
+                printf("UMD transferred shared allocation chunk 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(rangePtr), rangeSize, elapsedTime / 1e3);
+            }
+
+            this->protectCPUMemoryAccess(rangePtr, rangeSize);
+            firstChunk = lastChunk;
+        }
+    }
+    pageFaultData.domain = AllocationDomain::gpu;
+}
+
+void PageFaultManager::handleChunkFault(void *allocPtr, PageFaultData &pageFaultData, size_t chunkIndex) {
+    auto chunkOffset = chunkIndex * pageFaultData.chunkSize;
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+    auto chunkSize = std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+    if ((pageFaultData.domain == AllocationDomain::gpu) && this->isCpuMigrationBlocked(allocPtr, pageFaultData)) {
+        // chunk is accessed in place and allocation stays in gpu domain, same as when migrating whole allocation
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+        return;
+    }
+    // allocation which was never in gpu domain has no gpu content to be transferred
+    const bool transferRequired = (pageFaultData.domain != AllocationDomain::none) && (pageFaultData.cpuChunks[chunkIndex] == false);
+    const bool unprotectBeforeTransfer = (this->gpuDomainHandler == &PageFaultManager::unprotectAndTransferMemory);
+
+    if (unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    }
+    if (transferRequired) {
+        auto start = std::chrono::steady_clock::now();
+        this->transferToCpu(chunkPtr, chunkSize, pageFaultData.cmdQ);
+        auto end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        pageFaultData.statistics.transfersToCpu++;
+        pageFaultData.statistics.bytesTransferredToCpu += chunkSize;
+
+        if (debugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation chunk 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(chunkPtr), chunkSize, elapsedTime / 1e3);
+        }
+    }
+    if (!unprotectBeforeTransfer) {
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    }
+    pageFaultData.cpuChunks[chunkIndex] = true;
+
+    if (pageFaultData.domain != AllocationDomain::cpu) {
+        if (pageFaultData.domain == AllocationDomain::gpu) {
+            pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
+        }
+        pageFaultData.domain = AllocationDomain::cpu;
+        if (!unprotectBeforeTransfer) {
+            this->setCpuAllocEvictable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+            this->allowCPUMemoryEviction(allocPtr, pageFaultData);
+        }
+    }
+}
+
+size_t PageFaultManager::getMigrationChunkSize(size_t allocationSize) const {
+    auto chunkSize = debugManager.flags.UsmSharedMigrationChunkSize.get();
+    if (chunkSize <= 0 || !isChunkedMigrationSupported()) {
+        return 0u;
+    }
+    auto alignedChunkSize = alignUp(static_cast<size_t>(chunkSize), MemoryConstants::pageSize);
+    return (allocationSize > alignedChunkSize) ? alignedChunkSize : 0u;
+}
+
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
-        }
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return false;
+    }
+    --alloc;
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (ptr >= ptrOffset(allocPtr, pageFaultData.size)) {
+        return false;
+    }
+
+    pageFaultData.statistics.cpuFaults++;
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.chunkSize != 0u) {
+        handleChunkFault(allocPtr, pageFaultData, ptrDiff(ptr, allocPtr) / pageFaultData.chunkSize);
+    } else {
+        gpuDomainHandler(this, allocPtr, pageFaultData);
+    }
+    return true;
+}
+
+bool PageFaultManager::getAllocationStatistics(void *ptr, PageFaultStatistics &outStatistics) {
+    std::unique_lock<SpinLock> lock{mtx};
+    auto alloc = this->memoryData.find(ptr);
+    if (alloc == this->memoryData.end()) {
+        return false;
     }
-    return false;
+    outStatistics = alloc->second.statistics;
+    return true;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
@@ -133,6 +264,8 @@ inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData
         this->transferToCpu(ptr, pageFaultData.size, pageFaultData.cmdQ);
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        pageFaultData.statistics.transfersToCpu++;
+        pageFaultData.statistics.bytesTransferredToCpu += pageFaultData.size;
 
         if (debugManager.flags.PrintUmdSharedMigration.get()) {
             printf("UMD transferred shared allocation 0x%llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,10 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <cstdint>
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -38,11 +40,22 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         gpu,
     };
 
+    struct PageFaultStatistics {
+        uint64_t cpuFaults = 0u;
+        uint64_t transfersToCpu = 0u;
+        uint64_t transfersToGpu = 0u;
+        uint64_t bytesTransferredToCpu = 0u;
+        uint64_t bytesTransferredToGpu = 0u;
+    };
+
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t chunkSize = 0u;       // 0 - allocation is migrated as a whole
+        std::vector<bool> cpuChunks; // chunks accessible by CPU, valid when chunkSize != 0
+        PageFaultStatistics statistics;
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -52,6 +65,9 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL bool isCpuMigrationBlocked(void *allocPtr, PageFaultData &pageFaultData);
+
+    bool getAllocationStatistics(void *ptr, PageFaultStatistics &outStatistics);
 
   protected:
     virtual bool checkFaultHandlerFromPageFaultManager() = 0;
@@ -61,6 +77,8 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferChunkToGpu(void *allocPtr, void *chunkPtr, size_t chunkSize, void *cmdQ);
+    bool isChunkedMigrationSupported() const;
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData);
@@ -70,10 +88,13 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void handleChunkFault(void *allocPtr, PageFaultData &pageFaultData, size_t chunkIndex);
+    size_t getMigrationChunkSize(size_t allocationSize) const;
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    std::map<void *, PageFaultData> memoryData; // ordered by address to find faulting allocation without full scan
     SpinLock mtx;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@ class TbxSockets {
     virtual bool readMMIO(uint32_t offset, uint32_t *value) = 0;
     virtual bool writeMMIO(uint32_t offset, uint32_t value) = 0;
 
+    virtual bool flush() = 0;
+
     static TbxSockets *create();
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -18,6 +20,8 @@ typedef int socklen_t;
 #else
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -36,6 +40,8 @@ TbxSocketsImp::TbxSocketsImp(std::ostream &err)
 
 void TbxSocketsImp::close() {
     if (0 != socket) {
+        sendPendingWrites();
+        printTransportStatistics();
 #ifdef WIN32
         ::shutdown(socket, 0x02 /*SD_BOTH*/);
 
@@ -79,6 +85,16 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
             break;
         }
 
+        if (debugManager.flags.TbxBatchedWritesBufferSize.get() > 0) {
+            writeBatchingBufferSize = static_cast<size_t>(debugManager.flags.TbxBatchedWritesBufferSize.get()) * MemoryConstants::kiloByte;
+            pendingWrites.reserve(writeBatchingBufferSize);
+
+            // writes are coalesced here, reads have to reach the server without waiting for more data
+            int noDelay = 1;
+            ::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&noDelay), sizeof(noDelay));
+        }
+        connectionStartTime = std::chrono::steady_clock::now();
+
         HasMsg cmd;
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msgType = HAS_CONTROL_REQ_TYPE;
@@ -132,6 +148,11 @@ bool TbxSocketsImp::connectToServer(const std::string &hostNameOrIp, uint16_t po
 bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
     bool success;
     do {
+        success = sendPendingWrites();
+        if (!success) {
+            break;
+        }
+
         HasMsg cmd;
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msgType = HAS_MMIO_REQ_TYPE;
@@ -148,6 +169,8 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         if (!success) {
             break;
         }
+        statistics.messages++;
+        statistics.roundTrips++;
 
         HasMsg resp;
         success = getResponseData((char *)(&resp), sizeof(HasHdr) + sizeof(HasMmioRes));
@@ -181,7 +204,8 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmioReq.write = 1;
     cmd.u.mmioReq.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+    statistics.messages++;
+    return queueWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -200,10 +224,17 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
+        success = sendPendingWrites();
+        if (!success) {
+            break;
+        }
+
         success = sendWriteData(&cmd, sizeof(HasHdr) + sizeof(HasReadDataReq));
         if (!success) {
             break;
         }
+        statistics.messages++;
+        statistics.roundTrips++;
 
         HasMsg resp;
         success = getResponseData(&resp, sizeof(HasHdr) + sizeof(HasReadDataRes));
@@ -240,14 +271,16 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
     cmd.u.writeReq.cachelineDisable = cmd.u.writeReq.frontdoor;
     cmd.u.writeReq.memoryType = type;
 
+    statistics.messages++;
+
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
+        success = queueWriteData(&cmd, sizeof(HasHdr) + sizeof(HasWriteDataReq));
         if (!success) {
             break;
         }
 
-        success = sendWriteData(data, size);
+        success = queueWriteData(data, size);
         if (!success) {
             cerrStream << "Problem sending write data?" << std::endl;
             break;
@@ -269,7 +302,51 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64Req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64Req.dataH = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+    statistics.messages++;
+    return queueWriteData(&cmd, sizeof(HasHdr) + cmd.hdr.size);
+}
+
+bool TbxSocketsImp::flush() {
+    return sendPendingWrites();
+}
+
+bool TbxSocketsImp::queueWriteData(const void *buffer, size_t sizeInBytes) {
+    if (writeBatchingBufferSize == 0) {
+        return sendWriteData(buffer, sizeInBytes);
+    }
+
+    if (pendingWrites.size() + sizeInBytes > writeBatchingBufferSize) {
+        if (!sendPendingWrites()) {
+            return false;
+        }
+        if (sizeInBytes >= writeBatchingBufferSize) {
+            return sendWriteData(buffer, sizeInBytes);
+        }
+    }
+
+    auto data = reinterpret_cast<const char *>(buffer);
+    pendingWrites.insert(pendingWrites.end(), data, data + sizeInBytes);
+    return true;
+}
+
+bool TbxSocketsImp::sendPendingWrites() {
+    if (pendingWrites.empty()) {
+        return true;
+    }
+    auto success = sendWriteData(pendingWrites.data(), pendingWrites.size());
+    pendingWrites.clear();
+    return success;
+}
+
+void TbxSocketsImp::printTransportStatistics() {
+    if (!debugManager.flags.PrintTbxTransportStatistics.get()) {
+        return;
+    }
+    auto elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - connectionStartTime).count();
+    auto messagesPerSecond = elapsedSeconds > 0 ? static_cast<double>(statistics.messages) / elapsedSeconds : 0.0;
+    PRINT_DEBUG_STRING(debugManager.flags.PrintTbxTransportStatistics.get(), stdout, "TBX transport: %llu messages, %llu bytes in %llu send calls, %llu round trips, %.0f messages/s\n",
+                       static_cast<unsigned long long>(statistics.messages), static_cast<unsigned long long>(statistics.bytesSent),
+                       static_cast<unsigned long long>(statistics.sendCalls), static_cast<unsigned long long>(statistics.roundTrips), messagesPerSecond);
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -284,7 +361,9 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
         }
 
         totalSent += bytesSent;
+        statistics.sendCalls++;
     } while (totalSent < sizeInBytes);
+    statistics.bytesSent += totalSent;
 
     return true;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,10 @@
 
 #include "os_socket.h"
 
+#include <chrono>
 #include <cstdint>
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -31,18 +33,39 @@ class TbxSocketsImp : public TbxSockets {
     bool readMMIO(uint32_t offset, uint32_t *data) override;
     bool writeMMIO(uint32_t offset, uint32_t data) override;
 
+    bool flush() override;
+
+    struct TransportStatistics {
+        uint64_t messages = 0;
+        uint64_t bytesSent = 0;
+        uint64_t sendCalls = 0;
+        uint64_t roundTrips = 0;
+    };
+    const TransportStatistics &getTransportStatistics() const { return statistics; }
+
   protected:
     std::ostream &cerrStream;
     SOCKET socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
-    bool sendWriteData(const void *buffer, size_t sizeInBytes);
-    bool getResponseData(void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool getResponseData(void *buffer, size_t sizeInBytes);
+
+    // write messages need no response, they are collected and sent together before the next read
+    bool queueWriteData(const void *buffer, size_t sizeInBytes);
+    bool sendPendingWrites();
+    void printTransportStatistics();
 
     inline uint32_t getNextTransID() { return transID++; }
 
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    std::vector<char> pendingWrites;
+    size_t writeBatchingBufferSize = 0;
+
+    TransportStatistics statistics;
+    std::chrono::steady_clock::time_point connectionStartTime;
 };
 } // namespace NEO
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_flight_recorder.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> recordersCounter{0};
+
+// threads may exit after static destruction, so registry of live recorders is never destroyed
+std::mutex &getLiveRecordersMutex() {
+    static auto *mutex = new std::mutex;
+    return *mutex;
+}
+
+std::unordered_map<uint64_t, ApiFlightRecorder *> &getLiveRecorders() {
+    static auto *liveRecorders = new std::unordered_map<uint64_t, ApiFlightRecorder *>;
+    return *liveRecorders;
+}
+} // namespace
+
+thread_local ApiFlightRecorder::ThreadRecordsCache ApiFlightRecorder::threadRecordsCache;
+
+ApiFlightRecorder::ThreadRecordsCache::~ThreadRecordsCache() {
+    if (recorderId != 0) {
+        releaseThreadRecords(recorderId, threadRecords);
+    }
+}
+
+ApiFlightRecorder::ApiFlightRecorder(uint32_t recordsPerThread, std::string dumpFileName)
+    : recordsPerThread(std::max(recordsPerThread, 1u)), dumpFileName(std::move(dumpFileName)), recorderId(++recordersCounter) {
+    startTimestamp = CpuIntrinsics::rdtsc();
+    startTimeNs = getTimeNs();
+
+    std::lock_guard<std::mutex> lock(getLiveRecordersMutex());
+    getLiveRecorders()[recorderId] = this;
+}
+
+ApiFlightRecorder::~ApiFlightRecorder() {
+    stopDumpThread();
+
+    std::lock_guard<std::mutex> lock(getLiveRecordersMutex());
+    getLiveRecorders().erase(recorderId);
+}
+
+ApiFlightRecorder *ApiFlightRecorder::getInstance() {
+    static std::unique_ptr<ApiFlightRecorder, void (*)(ApiFlightRecorder *)> instance = []() {
+        auto recordsPerThread = debugManager.flags.ApiFlightRecorder.get();
+        if (recordsPerThread <= 0) {
+            return std::unique_ptr<ApiFlightRecorder, void (*)(ApiFlightRecorder *)>(nullptr, nullptr);
+        }
+        auto dumpFileName = debugManager.flags.ApiFlightRecorderDumpFile.get();
+        if (dumpFileName == "unk") {
+            dumpFileName = defaultDumpFileName;
+        }
+        auto recorder = new ApiFlightRecorder(static_cast<uint32_t>(recordsPerThread), dumpFileName);
+        auto dumpSignal = debugManager.flags.ApiFlightRecorderDumpSignal.get();
+        if (dumpSignal > 0 && installDumpSignalHandler(recorder, dumpSignal)) {
+            recorder->startDumpThread();
+        }
+        return std::unique_ptr<ApiFlightRecorder, void (*)(ApiFlightRecorder *)>(recorder, [](ApiFlightRecorder *recorder) {
+            restoreDumpSignalHandler();
+            recorder->stopDumpThread();
+            recorder->dump();
+            delete recorder;
+        });
+    }();
+    return instance.get();
+}
+
+ApiFlightRecorder::ThreadRecords &ApiFlightRecorder::getThreadRecords() {
+    if (threadRecordsCache.recorderId == recorderId) {
+        return *threadRecordsCache.threadRecords;
+    }
+
+    if (threadRecordsCache.recorderId != 0) {
+        releaseThreadRecords(threadRecordsCache.recorderId, threadRecordsCache.threadRecords);
+    }
+
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    ThreadRecords *records = nullptr;
+    if (!freeThreadRecords.empty()) {
+        // records of exited thread are kept and overwritten as the ring wraps
+        records = freeThreadRecords.back();
+        freeThreadRecords.pop_back();
+        records->threadIndex = threadsCount++;
+        records->callsCount = 0;
+    } else {
+        threadRecords.push_back(std::make_unique<ThreadRecords>(recordsPerThread, threadsCount++));
+        records = threadRecords.back().get();
+    }
+    threadRecordsCache.recorderId = recorderId;
+    threadRecordsCache.threadRecords = records;
+    return *records;
+}
+
+void ApiFlightRecorder::releaseThreadRecords(uint64_t recorderId, ThreadRecords *threadRecords) {
+    std::lock_guard<std::mutex> lock(getLiveRecordersMutex());
+    auto recorder = getLiveRecorders().find(recorderId);
+    if (recorder == getLiveRecorders().end()) {
+        return;
+    }
+    std::lock_guard<std::mutex> threadsLock(recorder->second->threadsMutex);
+    recorder->second->freeThreadRecords.push_back(threadRecords);
+}
+
+std::vector<ApiFlightRecord> ApiFlightRecorder::getRecords() {
+    std::vector<ApiFlightRecord> records;
+
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    for (auto &thread : threadRecords) {
+        auto written = thread->writtenCount.load(std::memory_order_acquire);
+        auto first = written > thread->slotsCount ? written - thread->slotsCount : 0u;
+
+        for (auto index = first; index < written; index++) {
+            // owning thread keeps recording, skip slots overwritten before or while copying
+            auto &slot = thread->slots[index % thread->slotsCount];
+            auto expectedSequence = 2 * index + 2;
+            if (slot.sequence.load(std::memory_order_acquire) != expectedSequence) {
+                continue;
+            }
+            auto record = slot.record;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != expectedSequence) {
+                continue;
+            }
+            records.push_back(record);
+        }
+    }
+
+    std::stable_sort(records.begin(), records.end(), [](const ApiFlightRecord &lhs, const ApiFlightRecord &rhs) {
+        return lhs.timestamp < rhs.timestamp;
+    });
+    return records;
+}
+
+bool ApiFlightRecorder::dump(const std::string &fileName) {
+    std::lock_guard<std::mutex> lock(dumpMutex);
+    auto records = getRecords();
+
+    ApiFlightRecorderDumpHeader header;
+    header.startTimestamp = startTimestamp;
+    header.startTimeNs = startTimeNs;
+    header.endTimestamp = CpuIntrinsics::rdtsc();
+    header.endTimeNs = getTimeNs();
+
+    std::vector<const char *> names;
+    std::unordered_map<const char *, uint32_t> nameIndices;
+    std::vector<ApiFlightRecorderDumpRecord> dumpRecords;
+    dumpRecords.reserve(records.size());
+    for (auto &record : records) {
+        auto name = record.functionName ? record.functionName : "";
+        auto nameIt = nameIndices.find(name);
+        if (nameIt == nameIndices.end()) {
+            nameIt = nameIndices.emplace(name, static_cast<uint32_t>(names.size())).first;
+            names.push_back(name);
+        }
+
+        ApiFlightRecorderDumpRecord dumpRecord;
+        dumpRecord.timestamp = record.timestamp;
+        dumpRecord.correlationId = record.correlationId;
+        std::copy_n(record.values, ApiFlightRecord::maxArguments, dumpRecord.values);
+        dumpRecord.nameIndex = nameIt->second;
+        dumpRecord.threadIndex = record.threadIndex;
+        dumpRecord.phase = static_cast<uint8_t>(record.phase);
+        dumpRecord.valuesCount = record.valuesCount;
+        dumpRecords.push_back(dumpRecord);
+    }
+    header.namesCount = static_cast<uint32_t>(names.size());
+    header.recordsCount = static_cast<uint32_t>(dumpRecords.size());
+
+    std::ofstream outFile(fileName, std::ios::binary | std::ios::trunc);
+    if (!outFile.is_open()) {
+        return false;
+    }
+    outFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (auto &name : names) {
+        auto length = static_cast<uint32_t>(strlen(name));
+        outFile.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        outFile.write(name, length);
+    }
+    outFile.write(reinterpret_cast<const char *>(dumpRecords.data()), dumpRecords.size() * sizeof(ApiFlightRecorderDumpRecord));
+    return outFile.good();
+}
+
+void ApiFlightRecorder::handleDumpRequest() {
+    if (dumpRequested.exchange(false)) {
+        dump();
+    }
+}
+
+void ApiFlightRecorder::startDumpThread() {
+    std::lock_guard<std::mutex> lock(dumpThreadMutex);
+    if (dumpThread) {
+        return;
+    }
+    dumpThreadActive = true;
+    dumpThread = Thread::create(dumpThreadFunc, this);
+}
+
+void ApiFlightRecorder::stopDumpThread() {
+    std::unique_ptr<Thread> threadToJoin;
+    {
+        std::lock_guard<std::mutex> lock(dumpThreadMutex);
+        dumpThreadActive = false;
+        threadToJoin = std::move(dumpThread);
+    }
+    dumpThreadCondition.notify_all();
+    if (threadToJoin) {
+        threadToJoin->join();
+    }
+}
+
+void *ApiFlightRecorder::dumpThreadFunc(void *self) {
+    auto recorder = reinterpret_cast<ApiFlightRecorder *>(self);
+    std::unique_lock<std::mutex> lock(recorder->dumpThreadMutex);
+    while (recorder->dumpThreadActive) {
+        // signal handler can only set the flag, so requests are polled
+        recorder->dumpThreadCondition.wait_for(lock, std::chrono::milliseconds(dumpRequestPollIntervalMs));
+        lock.unlock();
+        recorder->handleDumpRequest();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+uint64_t ApiFlightRecorder::getTimeNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace NEO
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace NEO {
+
+struct ApiFlightRecord {
+    static constexpr uint32_t maxArguments = 6;
+
+    enum class Phase : uint8_t {
+        enter = 0,
+        exit = 1
+    };
+
+    uint64_t timestamp = 0;
+    uint64_t correlationId = 0;
+    const char *functionName = nullptr;
+    uint64_t values[maxArguments] = {};
+    uint32_t threadIndex = 0;
+    Phase phase = Phase::enter;
+    uint8_t valuesCount = 0;
+};
+
+// Dump file layout, all fields little endian:
+// ApiFlightRecorderDumpHeader, namesCount x {uint32_t length, char name[length]}, recordsCount x ApiFlightRecorderDumpRecord
+struct ApiFlightRecorderDumpHeader {
+    static constexpr uint32_t magic = 0x52464150; // "PAFR"
+    static constexpr uint32_t currentVersion = 1;
+
+    uint32_t magicValue = magic;
+    uint32_t version = currentVersion;
+    uint64_t startTimestamp = 0;
+    uint64_t startTimeNs = 0;
+    uint64_t endTimestamp = 0;
+    uint64_t endTimeNs = 0;
+    uint32_t namesCount = 0;
+    uint32_t recordsCount = 0;
+};
+
+struct ApiFlightRecorderDumpRecord {
+    uint64_t timestamp = 0;
+    uint64_t correlationId = 0;
+    uint64_t values[ApiFlightRecord::maxArguments] = {};
+    uint32_t nameIndex = 0;
+    uint32_t threadIndex = 0;
+    uint8_t phase = 0;
+    uint8_t valuesCount = 0;
+    uint8_t reserved[6] = {};
+};
+static_assert(sizeof(ApiFlightRecorderDumpRecord) == 80, "dump record layout is consumed by offline converter");
+
+// Always-on flight recorder of API calls.
+// Every thread owns a ring of fixed size records, so recording a call is a few stores without locks or allocations.
+// Oldest records are overwritten, the rings are dumped at exit or by dump thread when dump is requested (e.g. from signal handler).
+class ApiFlightRecorder : NonCopyableOrMovableClass {
+  public:
+    static constexpr const char *defaultDumpFileName = "api_flight_recorder.bin";
+    static constexpr uint32_t dumpRequestPollIntervalMs = 100;
+
+    ApiFlightRecorder(uint32_t recordsPerThread, std::string dumpFileName);
+    MOCKABLE_VIRTUAL ~ApiFlightRecorder();
+
+    static ApiFlightRecorder *getInstance();
+
+    template <typename T>
+    static uint64_t toRecordValue(const T &value) {
+        if constexpr (std::is_pointer_v<T>) {
+            return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+        } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+            return static_cast<uint64_t>(value);
+        } else {
+            return 0u;
+        }
+    }
+
+    template <typename... ValuesT>
+    uint64_t recordEnter(const char *functionName, const ValuesT &...values) {
+        auto &threadRecords = getThreadRecords();
+        auto correlationId = (static_cast<uint64_t>(threadRecords.threadIndex) << 40) | ++threadRecords.callsCount;
+
+        uint64_t recordValues[] = {toRecordValue(values)..., 0u};
+        record(threadRecords, functionName, correlationId, ApiFlightRecord::Phase::enter, recordValues, static_cast<uint32_t>(sizeof...(ValuesT)));
+        return correlationId;
+    }
+
+    void recordExit(const char *functionName, uint64_t correlationId, uint64_t returnValue) {
+        record(getThreadRecords(), functionName, correlationId, ApiFlightRecord::Phase::exit, &returnValue, 1u);
+    }
+
+    void requestDump() { dumpRequested.store(true, std::memory_order_relaxed); }
+    bool dump(const std::string &fileName);
+    bool dump() { return dump(dumpFileName); }
+    std::vector<ApiFlightRecord> getRecords();
+
+    void startDumpThread();
+    void stopDumpThread();
+
+    uint32_t getRecordsPerThread() const { return recordsPerThread; }
+    const std::string &getDumpFileName() const { return dumpFileName; }
+
+    static bool installDumpSignalHandler(ApiFlightRecorder *recorder, int signalNumber);
+    static void restoreDumpSignalHandler();
+
+  protected:
+    // sequence is odd while slot is written and 2 * (record index + 1) once record is complete
+    struct RecordSlot {
+        std::atomic<uint64_t> sequence{0};
+        ApiFlightRecord record;
+    };
+
+    struct ThreadRecords : NonCopyableOrMovableClass {
+        ThreadRecords(uint32_t recordsCount, uint32_t threadIndex) : slots(std::make_unique<RecordSlot[]>(recordsCount)), slotsCount(recordsCount), threadIndex(threadIndex) {}
+
+        std::unique_ptr<RecordSlot[]> slots;
+        const uint64_t slotsCount;
+        std::atomic<uint64_t> writtenCount{0};
+        uint64_t callsCount = 0;
+        uint32_t threadIndex;
+    };
+
+    // returns ring of exiting thread to free list of its recorder, if the recorder still exists
+    struct ThreadRecordsCache {
+        ~ThreadRecordsCache();
+
+        uint64_t recorderId = 0;
+        ThreadRecords *threadRecords = nullptr;
+    };
+
+    void record(ThreadRecords &threadRecords, const char *functionName, uint64_t correlationId, ApiFlightRecord::Phase phase, const uint64_t *values, uint32_t valuesCount) {
+        auto written = threadRecords.writtenCount.load(std::memory_order_relaxed);
+        auto &slot = threadRecords.slots[written % threadRecords.slotsCount];
+        slot.sequence.store(2 * written + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto &record = slot.record;
+        record.timestamp = CpuIntrinsics::rdtsc();
+        record.correlationId = correlationId;
+        record.functionName = functionName;
+        record.threadIndex = threadRecords.threadIndex;
+        record.phase = phase;
+        record.valuesCount = static_cast<uint8_t>(std::min(valuesCount, ApiFlightRecord::maxArguments));
+        std::copy_n(values, record.valuesCount, record.values);
+
+        slot.sequence.store(2 * written + 2, std::memory_order_release);
+        threadRecords.writtenCount.store(written + 1, std::memory_order_release);
+    }
+
+    ThreadRecords &getThreadRecords();
+    static void releaseThreadRecords(uint64_t recorderId, ThreadRecords *threadRecords);
+    void handleDumpRequest();
+    static void *dumpThreadFunc(void *self);
+    static uint64_t getTimeNs();
+
+    const uint32_t recordsPerThread;
+    const std::string dumpFileName;
+    const uint64_t recorderId;
+    uint64_t startTimestamp = 0;
+    uint64_t startTimeNs = 0;
+
+    std::mutex threadsMutex;
+    std::vector<std::unique_ptr<ThreadRecords>> threadRecords;
+    std::vector<ThreadRecords *> freeThreadRecords;
+    uint32_t threadsCount = 0;
+
+    static thread_local ThreadRecordsCache threadRecordsCache;
+
+    std::mutex dumpMutex;
+    std::atomic<bool> dumpRequested{false};
+
+    std::unique_ptr<Thread> dumpThread;
+    std::mutex dumpThreadMutex;
+    std::condition_variable dumpThreadCondition;
+    bool dumpThreadActive = false;
+};
+
+// Records one API call, exit is recorded on explicit exit() or when leaving the scope
+class ApiFlightRecorderCall : NonCopyableOrMovableClass {
+  public:
+    explicit ApiFlightRecorderCall(const char *functionName) : functionName(functionName), recorder(ApiFlightRecorder::getInstance()) {}
+    ~ApiFlightRecorderCall() {
+        if (correlationId != 0) {
+            recorder->recordExit(functionName, correlationId, 0u);
+        }
+    }
+
+    template <typename... ArgumentPtrsT>
+    void enter(ArgumentPtrsT... argumentPtrs) {
+        if (recorder) {
+            correlationId = recorder->recordEnter(functionName, *argumentPtrs...);
+        }
+    }
+
+    template <typename ReturnValuePtrT>
+    void exit(ReturnValuePtrT returnValuePtr) {
+        if (correlationId != 0) {
+            recorder->recordExit(functionName, correlationId, ApiFlightRecorder::toRecordValue(*returnValuePtr));
+            correlationId = 0;
+        }
+    }
+
+    template <typename ReturnValueT>
+    ReturnValueT exitWith(ReturnValueT returnValue) {
+        exit(&returnValue);
+        return returnValue;
+    }
+
+  protected:
+    const char *functionName;
+    ApiFlightRecorder *recorder;
+    uint64_t correlationId = 0;
+};
+
+} // namespace NEO
+
+// Records API call of enclosing function, arguments are passed by pointers and returned value by API_FLIGHT_RECORDER_EXIT
+#define API_FLIGHT_RECORDER_ENTER(...)                          \
+    NEO::ApiFlightRecorderCall apiFlightRecorderCall(__func__); \
+    apiFlightRecorderCall.enter(__VA_ARGS__)
+
+#define API_FLIGHT_RECORDER_EXIT(returnValue) apiFlightRecorderCall.exitWith(returnValue)
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/async_file_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+AsyncFileWriter::AsyncFileWriter(std::ostream &outStream, size_t bufferSize)
+    : outStream(outStream), bufferSize(std::max(bufferSize, static_cast<size_t>(1u))) {
+    currentBuffer.reserve(this->bufferSize);
+    writerThread = Thread::create(writeLoop, reinterpret_cast<void *>(this));
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        writerActive = false;
+    }
+    queueCondition.notify_one();
+    writerThread->join();
+}
+
+void AsyncFileWriter::write(const char *data, size_t size) {
+    if (!currentBuffer.empty() && currentBuffer.size() + size > bufferSize) {
+        submitCurrentBuffer();
+    }
+    currentBuffer.insert(currentBuffer.end(), data, data + size);
+    if (currentBuffer.size() >= bufferSize) {
+        submitCurrentBuffer();
+    }
+}
+
+void AsyncFileWriter::flush() {
+    if (!currentBuffer.empty()) {
+        submitCurrentBuffer();
+    }
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        drainCondition.wait(lock, [this] { return queuedBuffers.empty() && !writingBuffer; });
+    }
+    outStream.flush();
+}
+
+void AsyncFileWriter::submitCurrentBuffer() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    // limit memory held by pending data when producer is faster than storage
+    drainCondition.wait(lock, [this] { return queuedBuffers.size() < maxQueuedBuffers; });
+
+    queuedBuffers.push_back(std::move(currentBuffer));
+    submittedBuffersCount++;
+    if (freeBuffers.empty()) {
+        currentBuffer = std::vector<char>();
+        currentBuffer.reserve(bufferSize);
+    } else {
+        currentBuffer = std::move(freeBuffers.back());
+        freeBuffers.pop_back();
+    }
+    lock.unlock();
+    queueCondition.notify_one();
+}
+
+void *AsyncFileWriter::writeLoop(void *arg) {
+    auto writer = reinterpret_cast<AsyncFileWriter *>(arg);
+
+    std::unique_lock<std::mutex> lock(writer->queueMutex);
+    while (true) {
+        writer->queueCondition.wait(lock, [writer] { return !writer->queuedBuffers.empty() || !writer->writerActive; });
+        if (writer->queuedBuffers.empty()) {
+            break;
+        }
+
+        auto buffer = std::move(writer->queuedBuffers.front());
+        writer->queuedBuffers.pop_front();
+        writer->writingBuffer = true;
+        lock.unlock();
+
+        writer->outStream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+
+        lock.lock();
+        writer->writingBuffer = false;
+        if (buffer.capacity() <= writer->bufferSize) {
+            writer->freeBuffers.push_back(std::move(buffer));
+        }
+        writer->drainCondition.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Accumulates writes in large buffers which are written to output stream by background thread.
+// write() is not synchronized, callers have to serialize it the same way as writes to the stream itself.
+class AsyncFileWriter : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultBufferSize = 4 * MemoryConstants::megaByte;
+    static constexpr size_t maxQueuedBuffers = 4;
+
+    AsyncFileWriter(std::ostream &outStream, size_t bufferSize);
+    MOCKABLE_VIRTUAL ~AsyncFileWriter();
+
+    void write(const char *data, size_t size);
+    // waits until all data written so far is in output stream and flushes it
+    void flush();
+
+    size_t getBufferSize() const { return bufferSize; }
+    uint64_t getSubmittedBuffersCount() const { return submittedBuffersCount; }
+
+  protected:
+    static void *writeLoop(void *arg);
+    void submitCurrentBuffer();
+
+    std::ostream &outStream;
+    const size_t bufferSize;
+    std::vector<char> currentBuffer;
+    uint64_t submittedBuffersCount = 0;
+
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::condition_variable drainCondition;
+    std::deque<std::vector<char>> queuedBuffers;
+    std::vector<std::vector<char>> freeBuffers;
+    bool writingBuffer = false;
+    bool writerActive = true;
+    std::unique_ptr<Thread> writerThread;
+};
+
+} // namespace NEO
@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/buffered_log_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> writersCounter{0};
+
+std::mutex activeWritersMutex;
+std::unordered_map<uint64_t, BufferedLogWriter *> activeWriters;
+
+struct ThreadBufferCache {
+    // buffers of exiting thread are released from writers that are still alive
+    ~ThreadBufferCache() {
+        BufferedLogWriter::releaseThreadBuffersOfWriters(registeredWriterIds);
+    }
+
+    uint64_t writerId = 0;
+    void *buffer = nullptr;
+    std::vector<uint64_t> registeredWriterIds;
+};
+thread_local ThreadBufferCache threadBufferCache;
+} // namespace
+
+bool BufferedLogWriter::ThreadBuffer::push(const BufferedLogRecordHeader &header, const char *payload) {
+    auto recordSize = sizeof(BufferedLogRecordHeader) + header.length;
+    auto currentTail = tail.load(std::memory_order_relaxed);
+    auto currentHead = head.load(std::memory_order_acquire);
+    if (storage.size() - (currentTail - currentHead) < recordSize) {
+        return false;
+    }
+
+    copyIn(currentTail, &header, sizeof(BufferedLogRecordHeader));
+    copyIn(currentTail + sizeof(BufferedLogRecordHeader), payload, header.length);
+    tail.store(currentTail + recordSize, std::memory_order_release);
+    return true;
+}
+
+void BufferedLogWriter::ThreadBuffer::popAll(std::vector<PendingRecord> &records, std::vector<char> &payloads) {
+    auto currentHead = head.load(std::memory_order_relaxed);
+    auto currentTail = tail.load(std::memory_order_acquire);
+
+    while (currentHead < currentTail) {
+        PendingRecord record;
+        copyOut(currentHead, &record.header, sizeof(BufferedLogRecordHeader));
+        record.payloadOffset = payloads.size();
+        payloads.resize(payloads.size() + record.header.length);
+        copyOut(currentHead + sizeof(BufferedLogRecordHeader), payloads.data() + record.payloadOffset, record.header.length);
+        records.push_back(record);
+        currentHead += sizeof(BufferedLogRecordHeader) + record.header.length;
+    }
+    head.store(currentHead, std::memory_order_release);
+}
+
+void BufferedLogWriter::ThreadBuffer::copyIn(size_t position, const void *src, size_t size) {
+    auto offset = position % storage.size();
+    auto firstChunk = std::min(size, storage.size() - offset);
+    memcpy(storage.data() + offset, src, firstChunk);
+    memcpy(storage.data(), reinterpret_cast<const char *>(src) + firstChunk, size - firstChunk);
+}
+
+void BufferedLogWriter::ThreadBuffer::copyOut(size_t position, void *dst, size_t size) const {
+    auto offset = position % storage.size();
+    auto firstChunk = std::min(size, storage.size() - offset);
+    memcpy(dst, storage.data() + offset, firstChunk);
+    memcpy(reinterpret_cast<char *>(dst) + firstChunk, storage.data(), size - firstChunk);
+}
+
+BufferedLogWriter::BufferedLogWriter(const std::string &filename, BufferedLogFormat format, size_t maxFileSize, size_t threadBufferSize)
+    : filename(filename), format(format), maxFileSize(maxFileSize), threadBufferSize(std::max(threadBufferSize, sizeof(BufferedLogRecordHeader))), writerId(++writersCounter) {
+    openFile(std::ios::app);
+    flusherThread = Thread::create(flushLoop, reinterpret_cast<void *>(this));
+
+    std::lock_guard<std::mutex> lock(activeWritersMutex);
+    activeWriters[writerId] = this;
+}
+
+BufferedLogWriter::~BufferedLogWriter() {
+    {
+        std::lock_guard<std::mutex> lock(activeWritersMutex);
+        activeWriters.erase(writerId);
+    }
+    stop();
+    outFile.close();
+}
+
+void BufferedLogWriter::stopAll() {
+    std::lock_guard<std::mutex> lock(activeWritersMutex);
+    for (auto &activeWriter : activeWriters) {
+        activeWriter.second->stop();
+    }
+}
+
+void BufferedLogWriter::stop() {
+    std::unique_ptr<Thread> threadToJoin;
+    {
+        std::lock_guard<std::mutex> lock(flusherMutex);
+        flusherActive = false;
+        threadToJoin = std::move(flusherThread);
+    }
+    if (threadToJoin) {
+        flusherCondition.notify_one();
+        threadToJoin->join();
+    }
+    flusherStopped = true;
+    flush();
+}
+
+BufferedLogWriter *BufferedLogWriter::findActiveWriter(uint64_t writerId) {
+    auto activeWriter = activeWriters.find(writerId);
+    return activeWriter != activeWriters.end() ? activeWriter->second : nullptr;
+}
+
+void BufferedLogWriter::releaseThreadBuffersOfWriters(const std::vector<uint64_t> &writerIds) {
+    std::lock_guard<std::mutex> lock(activeWritersMutex);
+    for (auto writerId : writerIds) {
+        if (auto writer = findActiveWriter(writerId)) {
+            writer->releaseThreadBuffer(std::this_thread::get_id());
+        }
+    }
+}
+
+void BufferedLogWriter::write(const char *str, size_t length) {
+    BufferedLogRecordHeader header;
+    header.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    header.threadId = static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    header.length = static_cast<uint32_t>(length);
+
+    if (flusherStopped) {
+        flush();
+        writeDirect(header, str);
+        return;
+    }
+
+    auto threadBuffer = getThreadBuffer();
+    if (threadBuffer->push(header, str)) {
+        if (threadBuffer->getUsedSize() * 2 > threadBuffer->getCapacity()) {
+            flusherCondition.notify_one();
+        }
+        return;
+    }
+
+    // buffer is full or record does not fit at all, drain buffers to keep ordering and retry
+    flush();
+    if (!threadBuffer->push(header, str)) {
+        writeDirect(header, str);
+    }
+}
+
+void BufferedLogWriter::flush() {
+    // buffers are released only under flush lock, so collected pointers stay valid while draining
+    std::lock_guard<std::mutex> flushLock(flushMutex);
+    pendingRecords.clear();
+    pendingPayloads.clear();
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto &threadBuffer : threadBuffers) {
+            threadBuffer.second->popAll(pendingRecords, pendingPayloads);
+        }
+    }
+    writePendingRecords();
+}
+
+size_t BufferedLogWriter::getThreadBuffersCount() {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    return threadBuffers.size();
+}
+
+void BufferedLogWriter::releaseThreadBuffer(std::thread::id threadId) {
+    std::lock_guard<std::mutex> flushLock(flushMutex);
+    std::unique_ptr<ThreadBuffer> releasedBuffer;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        auto threadBuffer = threadBuffers.find(threadId);
+        if (threadBuffer == threadBuffers.end()) {
+            return;
+        }
+        releasedBuffer = std::move(threadBuffer->second);
+        threadBuffers.erase(threadBuffer);
+    }
+
+    pendingRecords.clear();
+    pendingPayloads.clear();
+    releasedBuffer->popAll(pendingRecords, pendingPayloads);
+    writePendingRecords();
+}
+
+void BufferedLogWriter::writePendingRecords() {
+    if (pendingRecords.empty()) {
+        return;
+    }
+
+    std::stable_sort(pendingRecords.begin(), pendingRecords.end(), [](const PendingRecord &lhs, const PendingRecord &rhs) {
+        return lhs.header.timestampNs < rhs.header.timestampNs;
+    });
+    for (auto &record : pendingRecords) {
+        writeRecord(record.header, pendingPayloads.data() + record.payloadOffset);
+    }
+    outFile.flush();
+}
+
+BufferedLogWriter::ThreadBuffer *BufferedLogWriter::getThreadBuffer() {
+    if (threadBufferCache.writerId == writerId) {
+        return reinterpret_cast<ThreadBuffer *>(threadBufferCache.buffer);
+    }
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    auto &threadBuffer = threadBuffers[std::this_thread::get_id()];
+    if (!threadBuffer) {
+        threadBuffer = std::make_unique<ThreadBuffer>(threadBufferSize);
+        threadBufferCache.registeredWriterIds.push_back(writerId);
+    }
+    threadBufferCache.writerId = writerId;
+    threadBufferCache.buffer = threadBuffer.get();
+    return threadBuffer.get();
+}
+
+void BufferedLogWriter::writeDirect(const BufferedLogRecordHeader &header, const char *payload) {
+    std::lock_guard<std::mutex> lock(flushMutex);
+    writeRecord(header, payload);
+    outFile.flush();
+}
+
+void BufferedLogWriter::writeRecord(const BufferedLogRecordHeader &header, const char *payload) {
+    auto recordSize = static_cast<size_t>(header.length);
+    if (format == BufferedLogFormat::binary) {
+        recordSize += sizeof(BufferedLogRecordHeader);
+    }
+    rotateIfNeeded(recordSize);
+
+    if (format == BufferedLogFormat::binary) {
+        outFile.write(reinterpret_cast<const char *>(&header), sizeof(BufferedLogRecordHeader));
+    }
+    outFile.write(payload, header.length);
+    currentFileSize += recordSize;
+}
+
+void BufferedLogWriter::openFile(std::ios_base::openmode mode) {
+    outFile.open(filename, mode | std::ios::binary);
+    outFile.seekp(0, std::ios::end);
+    currentFileSize = outFile.is_open() ? static_cast<size_t>(outFile.tellp()) : 0u;
+
+    if (format == BufferedLogFormat::binary && currentFileSize == 0) {
+        BufferedLogFileHeader fileHeader;
+        outFile.write(reinterpret_cast<const char *>(&fileHeader), sizeof(BufferedLogFileHeader));
+        currentFileSize += sizeof(BufferedLogFileHeader);
+    }
+}
+
+void BufferedLogWriter::rotateIfNeeded(size_t bytesToWrite) {
+    if (maxFileSize == 0 || currentFileSize == 0 || currentFileSize + bytesToWrite <= maxFileSize) {
+        return;
+    }
+
+    outFile.close();
+    auto rotatedFileName = getRotatedFileName(filename);
+    std::remove(rotatedFileName.c_str());
+    std::rename(filename.c_str(), rotatedFileName.c_str());
+    openFile(std::ios::trunc);
+    rotationsCount++;
+}
+
+void *BufferedLogWriter::flushLoop(void *arg) {
+    auto self = reinterpret_cast<BufferedLogWriter *>(arg);
+
+    std::unique_lock<std::mutex> lock(self->flusherMutex);
+    while (self->flusherActive) {
+        self->flusherCondition.wait_for(lock, flushInterval);
+        lock.unlock();
+        self->flush();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+enum class BufferedLogFormat : int32_t {
+    text = 1,
+    binary = 2
+};
+
+struct BufferedLogFileHeader {
+    static constexpr uint32_t magic = 0x474f4c4e; // "NLOG"
+    static constexpr uint32_t currentVersion = 1;
+
+    uint32_t magicValue = magic;
+    uint32_t version = currentVersion;
+};
+
+struct BufferedLogRecordHeader {
+    uint64_t timestampNs = 0;
+    uint64_t threadId = 0;
+    uint32_t length = 0;
+    uint32_t reserved = 0;
+};
+static_assert(sizeof(BufferedLogRecordHeader) == 24, "binary log record header layout must stay stable");
+
+// Log file writer with per-thread single producer / single consumer ring buffers.
+// Producers never take a lock on the hot path, records are drained by a background thread
+// (or by the producer itself when its buffer is full), sorted by timestamp and written through a persistent file handle.
+// Background thread has to be stopped with stop() or stopAll() before static destruction, after that records are written synchronously.
+class BufferedLogWriter : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultThreadBufferSize = 64 * MemoryConstants::kiloByte;
+    static constexpr std::chrono::milliseconds flushInterval{50};
+
+    BufferedLogWriter(const std::string &filename, BufferedLogFormat format, size_t maxFileSize, size_t threadBufferSize);
+    MOCKABLE_VIRTUAL ~BufferedLogWriter();
+
+    static void stopAll();
+    static void releaseThreadBuffersOfWriters(const std::vector<uint64_t> &writerIds);
+    void stop();
+    bool isStopped() const { return flusherStopped; }
+
+    void write(const char *str, size_t length);
+    void flush();
+    size_t getThreadBuffersCount();
+
+    const std::string &getFileName() const { return filename; }
+    BufferedLogFormat getFormat() const { return format; }
+    size_t getCurrentFileSize() const { return currentFileSize; }
+    uint32_t getRotationsCount() const { return rotationsCount; }
+
+    static std::string getRotatedFileName(const std::string &filename) { return filename + ".1"; }
+
+  protected:
+    struct PendingRecord {
+        BufferedLogRecordHeader header;
+        size_t payloadOffset;
+    };
+
+    class ThreadBuffer : NonCopyableOrMovableClass {
+      public:
+        explicit ThreadBuffer(size_t size) : storage(size) {}
+
+        bool push(const BufferedLogRecordHeader &header, const char *payload);
+        void popAll(std::vector<PendingRecord> &records, std::vector<char> &payloads);
+        size_t getUsedSize() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); }
+        size_t getCapacity() const { return storage.size(); }
+
+      protected:
+        void copyIn(size_t position, const void *src, size_t size);
+        void copyOut(size_t position, void *dst, size_t size) const;
+
+        std::vector<char> storage;
+        std::atomic<size_t> head{0};
+        std::atomic<size_t> tail{0};
+    };
+
+    static BufferedLogWriter *findActiveWriter(uint64_t writerId);
+
+    ThreadBuffer *getThreadBuffer();
+    void releaseThreadBuffer(std::thread::id threadId);
+    void writePendingRecords();
+    void writeDirect(const BufferedLogRecordHeader &header, const char *payload);
+    void writeRecord(const BufferedLogRecordHeader &header, const char *payload);
+    void openFile(std::ios_base::openmode mode);
+    void rotateIfNeeded(size_t bytesToWrite);
+    static void *flushLoop(void *arg);
+
+    const std::string filename;
+    const BufferedLogFormat format;
+    const size_t maxFileSize;
+    const size_t threadBufferSize;
+    const uint64_t writerId;
+
+    std::mutex buffersMutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadBuffer>> threadBuffers;
+
+    std::mutex flushMutex;
+    std::ofstream outFile;
+    size_t currentFileSize = 0;
+    uint32_t rotationsCount = 0;
+    std::vector<PendingRecord> pendingRecords;
+    std::vector<char> pendingPayloads;
+
+    std::mutex flusherMutex;
+    std::condition_variable flusherCondition;
+    bool flusherActive = true;
+    std::atomic<bool> flusherStopped{false};
+    std::unique_ptr<Thread> flusherThread;
+};
+
+} // namespace NEO
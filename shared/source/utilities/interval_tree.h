@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace NEO {
+
+// Set of half-open [start, end) intervals kept in a randomized balanced search tree (treap) ordered by start.
+// Every node tracks the maximal end in its subtree, which allows overlap and containment queries in O(log n).
+// Intervals may overlap each other and may share the same start.
+template <typename DataType>
+class IntervalTree : public NonCopyableClass {
+  public:
+    IntervalTree() = default;
+    IntervalTree(IntervalTree &&) = default;
+    IntervalTree &operator=(IntervalTree &&) = default;
+
+    void insert(uintptr_t start, uintptr_t end, const DataType &data) {
+        auto node = std::make_unique<Node>(start, std::max(start, end), nextPriority(), data);
+        insertNode(root, std::move(node));
+        count++;
+    }
+
+    bool remove(uintptr_t start) {
+        if (removeNode(root, start)) {
+            count--;
+            return true;
+        }
+        return false;
+    }
+
+    DataType *findByStart(uintptr_t start) const {
+        auto node = root.get();
+        while (node) {
+            if (start == node->start) {
+                return &node->data;
+            }
+            node = (start < node->start) ? node->left.get() : node->right.get();
+        }
+        return nullptr;
+    }
+
+    DataType *findOverlapping(uintptr_t start, uintptr_t end) const {
+        auto node = findOverlappingNode(root.get(), start, end);
+        return node ? &node->data : nullptr;
+    }
+
+    DataType *findContaining(uintptr_t start, uintptr_t end) const {
+        auto node = findContainingNode(root.get(), start, end);
+        return node ? &node->data : nullptr;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    void clear() {
+        root.reset();
+        count = 0;
+    }
+
+  protected:
+    struct Node {
+        Node(uintptr_t start, uintptr_t end, uint32_t priority, const DataType &data)
+            : start(start), end(end), maxEnd(end), priority(priority), data(data) {}
+
+        uintptr_t start;
+        uintptr_t end;
+        uintptr_t maxEnd;
+        uint32_t priority;
+        DataType data;
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+    };
+    using NodePtr = std::unique_ptr<Node>;
+
+    uint32_t nextPriority() {
+        prioritySeed ^= prioritySeed << 13;
+        prioritySeed ^= prioritySeed >> 17;
+        prioritySeed ^= prioritySeed << 5;
+        return prioritySeed;
+    }
+
+    static void updateMaxEnd(Node &node) {
+        node.maxEnd = node.end;
+        if (node.left) {
+            node.maxEnd = std::max(node.maxEnd, node.left->maxEnd);
+        }
+        if (node.right) {
+            node.maxEnd = std::max(node.maxEnd, node.right->maxEnd);
+        }
+    }
+
+    static void rotateRight(NodePtr &node) {
+        auto pivot = std::move(node->left);
+        node->left = std::move(pivot->right);
+        updateMaxEnd(*node);
+        pivot->right = std::move(node);
+        updateMaxEnd(*pivot);
+        node = std::move(pivot);
+    }
+
+    static void rotateLeft(NodePtr &node) {
+        auto pivot = std::move(node->right);
+        node->right = std::move(pivot->left);
+        updateMaxEnd(*node);
+        pivot->left = std::move(node);
+        updateMaxEnd(*pivot);
+        node = std::move(pivot);
+    }
+
+    static void insertNode(NodePtr &node, NodePtr &&newNode) {
+        if (!node) {
+            node = std::move(newNode);
+            return;
+        }
+        if (newNode->start < node->start) {
+            insertNode(node->left, std::move(newNode));
+            if (node->left->priority > node->priority) {
+                rotateRight(node);
+                return;
+            }
+        } else {
+            insertNode(node->right, std::move(newNode));
+            if (node->right->priority > node->priority) {
+                rotateLeft(node);
+                return;
+            }
+        }
+        updateMaxEnd(*node);
+    }
+
+    static NodePtr mergeSubtrees(NodePtr left, NodePtr right) {
+        if (!left) {
+            return right;
+        }
+        if (!right) {
+            return left;
+        }
+        if (left->priority > right->priority) {
+            left->right = mergeSubtrees(std::move(left->right), std::move(right));
+            updateMaxEnd(*left);
+            return left;
+        }
+        right->left = mergeSubtrees(std::move(left), std::move(right->left));
+        updateMaxEnd(*right);
+        return right;
+    }
+
+    static bool removeNode(NodePtr &node, uintptr_t start) {
+        if (!node) {
+            return false;
+        }
+        bool removed = false;
+        if (start == node->start) {
+            node = mergeSubtrees(std::move(node->left), std::move(node->right));
+            return true;
+        } else if (start < node->start) {
+            removed = removeNode(node->left, start);
+        } else {
+            removed = removeNode(node->right, start);
+        }
+        if (removed) {
+            updateMaxEnd(*node);
+        }
+        return removed;
+    }
+
+    static Node *findOverlappingNode(Node *node, uintptr_t start, uintptr_t end) {
+        while (node && node->maxEnd > start) {
+            if (node->left && node->left->maxEnd > start) {
+                if (auto found = findOverlappingNode(node->left.get(), start, end)) {
+                    return found;
+                }
+            }
+            if (node->start >= end) {
+                return nullptr;
+            }
+            if (node->end > start) {
+                return node;
+            }
+            node = node->right.get();
+        }
+        return nullptr;
+    }
+
+    static Node *findContainingNode(Node *node, uintptr_t start, uintptr_t end) {
+        while (node && node->maxEnd >= end) {
+            if (node->left && node->left->maxEnd >= end) {
+                if (auto found = findContainingNode(node->left.get(), start, end)) {
+                    return found;
+                }
+            }
+            if (node->start > start) {
+                return nullptr;
+            }
+            if (node->end >= end) {
+                return node;
+            }
+            node = node->right.get();
+        }
+        return nullptr;
+    }
+
+    NodePtr root;
+    size_t count = 0;
+    uint32_t prioritySeed = 0x9e3779b9u;
+};
+
+} // namespace NEO
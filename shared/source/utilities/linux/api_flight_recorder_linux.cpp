@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_flight_recorder.h"
+
+#include <signal.h>
+
+namespace NEO {
+
+namespace {
+std::atomic<ApiFlightRecorder *> signaledRecorder{nullptr};
+int dumpSignalNumber = 0;
+struct sigaction previousDumpSignalAction = {};
+
+void dumpSignalHandler(int signalNumber, siginfo_t *info, void *context) {
+    // only flag the request, dump is written by recorder's dump thread outside of signal context
+    auto recorder = signaledRecorder.load();
+    if (recorder) {
+        recorder->requestDump();
+    }
+
+    // handler installed by application before the recorder keeps working
+    if (previousDumpSignalAction.sa_flags & SA_SIGINFO) {
+        if (previousDumpSignalAction.sa_sigaction) {
+            previousDumpSignalAction.sa_sigaction(signalNumber, info, context);
+        }
+    } else if (previousDumpSignalAction.sa_handler != SIG_DFL && previousDumpSignalAction.sa_handler != SIG_IGN) {
+        previousDumpSignalAction.sa_handler(signalNumber);
+    }
+}
+} // namespace
+
+bool ApiFlightRecorder::installDumpSignalHandler(ApiFlightRecorder *recorder, int signalNumber) {
+    if (dumpSignalNumber != 0) {
+        return false;
+    }
+
+    struct sigaction dumpSignalAction = {};
+    dumpSignalAction.sa_sigaction = dumpSignalHandler;
+    dumpSignalAction.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&dumpSignalAction.sa_mask);
+
+    signaledRecorder.store(recorder);
+    if (sigaction(signalNumber, &dumpSignalAction, &previousDumpSignalAction) != 0) {
+        signaledRecorder.store(nullptr);
+        return false;
+    }
+    dumpSignalNumber = signalNumber;
+    return true;
+}
+
+void ApiFlightRecorder::restoreDumpSignalHandler() {
+    if (dumpSignalNumber != 0) {
+        sigaction(dumpSignalNumber, &previousDumpSignalAction, nullptr);
+        dumpSignalNumber = 0;
+    }
+    signaledRecorder.store(nullptr);
+}
+
+} // namespace NEO
@@ -34,6 +34,14 @@ FileLogger<debugLevel>::FileLogger(std::string filename, const DebugVariables &f
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
     logAllocationType = flags.LogAllocationType.get();
     logAllocationStdout = flags.LogAllocationStdout.get();
+
+    if (enabled()) {
+        auto bufferedLogWriterMode = flags.BufferedLogWriter.get();
+        if (bufferedLogWriterMode == static_cast<int32_t>(BufferedLogFormat::text) || bufferedLogWriterMode == static_cast<int32_t>(BufferedLogFormat::binary)) {
+            bufferedLogMaxFileSize = flags.BufferedLogWriterMaxFileSize.get() > 0 ? static_cast<size_t>(flags.BufferedLogWriterMaxFileSize.get()) : 0u;
+            bufferedLogWriter = std::make_unique<BufferedLogWriter>(logFileName, static_cast<BufferedLogFormat>(bufferedLogWriterMode), bufferedLogMaxFileSize, BufferedLogWriter::defaultThreadBufferSize);
+        }
+    }
 }
 
 template <DebugFunctionalityLevel debugLevel>
@@ -41,6 +49,11 @@ FileLogger<debugLevel>::~FileLogger() = default;
 
 template <DebugFunctionalityLevel debugLevel>
 void FileLogger<debugLevel>::writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode) {
+    if (bufferedLogWriter && (mode & std::ios::app) && filename == bufferedLogWriter->getFileName()) {
+        bufferedLogWriter->write(str, length);
+        return;
+    }
+
     std::lock_guard theLock(mutex);
     std::ofstream outFile(filename, mode);
     if (outFile.is_open()) {
@@ -7,7 +7,9 @@
 
 #pragma once
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/buffered_log_writer.h"
 
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <thread>
@@ -135,8 +137,13 @@ class FileLogger {
 
     void setLogFileName(std::string filename) {
         logFileName = std::move(filename);
+        if (bufferedLogWriter) {
+            bufferedLogWriter = std::make_unique<BufferedLogWriter>(logFileName, bufferedLogWriter->getFormat(), bufferedLogMaxFileSize, BufferedLogWriter::defaultThreadBufferSize);
+        }
     }
 
+    BufferedLogWriter *getBufferedLogWriter() const { return bufferedLogWriter.get(); }
+
     bool peekLogApiCalls() { return logApiCalls; }
 
   protected:
@@ -147,6 +154,8 @@ class FileLogger {
     bool logAllocationMemoryPool = false;
     bool logAllocationType = false;
     bool logAllocationStdout = false;
+    size_t bufferedLogMaxFileSize = 0;
+    std::unique_ptr<BufferedLogWriter> bufferedLogWriter;
 
     // Required for variadic template with 0 args passed
     void printInputs(std::stringstream &ss) {}
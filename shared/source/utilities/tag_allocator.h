@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/timestamp_packet_readout.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/utilities/idlist.h"
 
@@ -72,6 +73,9 @@ class TagNodeBase : public NonCopyableOrMovableClass {
 
     virtual void const *getContextEndAddress(uint32_t packetIndex) const = 0;
 
+    virtual uint32_t readTimestampPackets(TimestampPacketValues *output, uint32_t packetsToRead) const = 0;
+    virtual TimestampPacketsView getTimestampPacketsView() const = 0;
+
     virtual uint64_t &getGlobalEndRef() const = 0;
     virtual uint64_t &getContextCompleteRef() const = 0;
 
@@ -128,6 +132,9 @@ class TagNode : public TagNodeBase, public IDNode<TagNode<TagType>> {
 
     void const *getContextEndAddress(uint32_t packetIndex) const override;
 
+    uint32_t readTimestampPackets(TimestampPacketValues *output, uint32_t packetsToRead) const override;
+    TimestampPacketsView getTimestampPacketsView() const override;
+
     uint64_t &getGlobalEndRef() const override;
     uint64_t &getContextCompleteRef() const override;
 
@@ -10,6 +10,8 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 
+#include <algorithm>
+
 namespace NEO {
 template <typename TagType>
 TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDeviceIndices, MemoryManager *memMngr, size_t tagCount, size_t tagAlignment,
@@ -224,6 +226,38 @@ void const *TagNode<TagType>::getContextEndAddress([[maybe_unused]] uint32_t pac
     }
 }
 
+template <typename TagType>
+uint32_t TagNode<TagType>::readTimestampPackets([[maybe_unused]] TimestampPacketValues *output, [[maybe_unused]] uint32_t packetsToRead) const {
+    if constexpr (TagType::getTagNodeType() == TagNodeType::timestampPacket) {
+        return tagForCpuAccess->readPackets(output, std::min(packetsToRead, packetsUsed));
+    } else if constexpr (TagType::getTagNodeType() == TagNodeType::hwTimeStamps) {
+        if (packetsToRead == 0) {
+            return 0;
+        }
+        output->contextStart = tagForCpuAccess->getContextStartValue(0);
+        output->globalStart = tagForCpuAccess->getGlobalStartValue(0);
+        output->contextEnd = tagForCpuAccess->getContextEndValue(0);
+        output->globalEnd = tagForCpuAccess->getGlobalEndValue(0);
+        return 1;
+    } else {
+        UNRECOVERABLE_IF(true);
+    }
+}
+
+template <typename TagType>
+TimestampPacketsView TagNode<TagType>::getTimestampPacketsView() const {
+    if constexpr (TagType::getTagNodeType() == TagNodeType::timestampPacket) {
+        TimestampPacketsView view;
+        view.cpuBase = tagForCpuAccess;
+        view.packetSize = TagType::getSinglePacketSize();
+        view.timestampSize = TagType::getTimestampSize();
+        view.packetsUsed = packetsUsed;
+        return view;
+    } else {
+        UNRECOVERABLE_IF(true);
+    }
+}
+
 template <typename TagType>
 uint64_t &TagNode<TagType>::getContextCompleteRef() const {
     if constexpr (TagType::getTagNodeType() == TagNodeType::hwTimeStamps) {
@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_flight_recorder.h"
+
+namespace NEO {
+
+bool ApiFlightRecorder::installDumpSignalHandler(ApiFlightRecorder *recorder, int signalNumber) {
+    // no user signals on Windows, recorder is dumped at exit only
+    return false;
+}
+
+void ApiFlightRecorder::restoreDumpSignalHandler() {
+}
+
+} // namespace NEO
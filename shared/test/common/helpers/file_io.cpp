@@ -31,6 +31,24 @@ size_t writeDataToFile(
     return dataSize;
 }
 
+size_t writeDataToFile(
+    const char *filename,
+    const std::function<size_t(FILE *)> &writeData) {
+
+    DEBUG_BREAK_IF(nullptr == filename);
+
+    size_t nsize = 0;
+    FILE *fp = tmpfile();
+    if (fp) {
+        nsize = writeData(fp);
+        fclose(fp);
+    }
+
+    NEO::virtualFileList.insert(filename);
+
+    return nsize;
+}
+
 bool fileExists(const std::string &fileName) {
     FILE *pFile = nullptr;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,8 @@ using namespace NEO;
 
 class MockPrefetchManager : public PrefetchManager {
   public:
+    using PrefetchManager::kernelAccessHistory;
+
     void migrateAllocationsToGpu(PrefetchContext &prefetchContext, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr) override {
         PrefetchManager::migrateAllocationsToGpu(prefetchContext, unifiedMemoryManager, device, csr);
         migrateAllocationsToGpuCalled = true;
@@ -24,6 +26,12 @@ class MockPrefetchManager : public PrefetchManager {
         removeAllocationsCalled = true;
     }
 
+    void removeKernelAccesses(const void *kernelId) override {
+        PrefetchManager::removeKernelAccesses(kernelId);
+        removeKernelAccessesCalled++;
+    }
+
     bool migrateAllocationsToGpuCalled = false;
     bool removeAllocationsCalled = false;
+    uint32_t removeKernelAccessesCalled = 0u;
 };
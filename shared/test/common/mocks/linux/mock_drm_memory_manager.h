@@ -40,6 +40,7 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::allocateGraphicsMemoryForNonSvmHostPtr;
     using DrmMemoryManager::allocateGraphicsMemoryWithAlignment;
     using DrmMemoryManager::allocateGraphicsMemoryWithHostPtr;
+    using DrmMemoryManager::allocateUSMHostGraphicsMemory;
     using DrmMemoryManager::allocateMemoryByKMD;
     using DrmMemoryManager::allocatePhysicalDeviceMemory;
     using DrmMemoryManager::allocatePhysicalLocalDeviceMemory;
@@ -51,6 +52,7 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::createGraphicsAllocation;
     using DrmMemoryManager::createMultiHostAllocation;
     using DrmMemoryManager::createSharedUnifiedMemoryAllocation;
+    using DrmMemoryManager::deviceNumaNodes;
     using DrmMemoryManager::eraseSharedBoHandleWrapper;
     using DrmMemoryManager::eraseSharedBufferObject;
     using DrmMemoryManager::getBOTypeFromPatIndex;
@@ -60,6 +62,7 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::getUserptrAlignment;
     using DrmMemoryManager::gfxPartitions;
     using DrmMemoryManager::handleFenceCompletion;
+    using DrmMemoryManager::hugePagesStatistics;
     using DrmMemoryManager::lockBufferObject;
     using DrmMemoryManager::lockResourceImpl;
     using DrmMemoryManager::mapPhysicalToVirtualMemory;
@@ -68,6 +71,7 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::munmapFunction;
     using DrmMemoryManager::pinBBs;
     using DrmMemoryManager::pinThreshold;
+    using DrmMemoryManager::printHugePagesStatistics;
     using DrmMemoryManager::pushSharedBufferObject;
     using DrmMemoryManager::registerAllocationInOs;
     using DrmMemoryManager::registerSharedBoHandleAllocation;
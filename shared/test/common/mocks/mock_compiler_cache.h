@@ -12,7 +12,9 @@
 namespace NEO {
 class CompilerCacheMock : public CompilerCache {
   public:
+    using CompilerCache::compressBinaryIfEnabled;
     using CompilerCache::config;
+    using CompilerCache::decompressCachedBinary;
 
     CompilerCacheMock() : CompilerCache(CompilerCacheConfig{}) {
     }
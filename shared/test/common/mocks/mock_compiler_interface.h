@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,7 +25,12 @@ class MockCompilerInterface : public CompilerInterface {
     using CompilerInterface::checkIcbeVersionOnce;
     using CompilerInterface::fclBaseTranslationCtx;
     using CompilerInterface::fclDeviceContexts;
+    using CompilerInterface::getInMemoryCacheKey;
+    using CompilerInterface::igcLibMTime;
+    using CompilerInterface::igcLibSize;
+    using CompilerInterface::igcRevision;
     using CompilerInterface::initialize;
+    using CompilerInterface::inMemoryCache;
     using CompilerInterface::isCompilerAvailable;
     using CompilerInterface::isFclAvailable;
     using CompilerInterface::isIgcAvailable;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,7 +16,9 @@ using namespace NEO;
 
 class MockPageFaultManager : public PageFaultManager {
   public:
+    using PageFaultManager::getMigrationChunkSize;
     using PageFaultManager::gpuDomainHandler;
+    using PageFaultManager::handleChunkFault;
     using PageFaultManager::memoryData;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
@@ -51,6 +53,11 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferChunkToGpu(void *allocPtr, void *chunkPtr, size_t chunkSize, void *cmdQ) override {
+        transferChunkToGpuCalled++;
+        transferChunkToGpuAddress = chunkPtr;
+        transferChunkToGpuSize = chunkSize;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -70,6 +77,9 @@ class MockPageFaultManager : public PageFaultManager {
     void baseGpuTransfer(void *ptr, void *cmdQ) {
         PageFaultManager::transferToGpu(ptr, cmdQ);
     }
+    void baseChunkGpuTransfer(void *allocPtr, void *chunkPtr, size_t chunkSize, void *cmdQ) {
+        PageFaultManager::transferChunkToGpu(allocPtr, chunkPtr, chunkSize, cmdQ);
+    }
     void baseCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager) {
         PageFaultManager::setCpuAllocEvictable(evictable, ptr, unifiedMemoryManager);
     }
@@ -102,15 +112,18 @@ class MockPageFaultManager : public PageFaultManager {
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferChunkToGpuCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
     int setCpuAllocEvictableCalled = 0;
     int allowCPUMemoryEvictionCalled = 0;
     int allowCPUMemoryEvictionImplCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
+    void *transferChunkToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferChunkToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
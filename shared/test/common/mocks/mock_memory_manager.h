@@ -165,6 +165,14 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
     bool hasPageFaultsEnabled(const Device &neoDevice) override;
     bool isKmdMigrationAvailable(uint32_t rootDeviceIndex) override;
 
+    bool isHostNumaNodeSelectionSupported(uint32_t rootDeviceIndex) override {
+        return hostNumaNodeSelectionSupported;
+    }
+
+    bool isMemoryBudgetExhausted() const override {
+        return memoryBudgetExhausted;
+    }
+
     struct CopyMemoryToAllocationBanksParams {
         GraphicsAllocation *graphicsAllocation = nullptr;
         size_t destinationOffset = 0u;
@@ -235,6 +243,7 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
     osHandle capturedSharedHandle = 0u;
     osHandle invalidSharedHandle = -1;
     bool allocationCreated = false;
+    bool memoryBudgetExhausted = false;
     bool allocation64kbPageCreated = false;
     bool allocationInDevicePoolCreated = false;
     bool failInDevicePool = false;
@@ -250,6 +259,7 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
     bool failLockResource = false;
     bool failSetMemAdvise = false;
     bool setMemPrefetchCalled = false;
+    bool hostNumaNodeSelectionSupported = false;
     bool cpuCopyRequired = false;
     bool forceCompressed = false;
     bool forceFailureInPrimaryAllocation = false;
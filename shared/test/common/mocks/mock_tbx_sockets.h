@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,12 @@ class MockTbxSockets : public TbxSockets {
     bool readMMIO(uint32_t offset, uint32_t *data) override { return true; };
     bool writeMMIO(uint32_t offset, uint32_t data) override { return true; };
 
+    bool flush() override {
+        flushCalled++;
+        return true;
+    };
+
     uint32_t typeCapturedFromWriteMemory = 0;
+    uint32_t flushCalled = 0;
 };
 } // namespace NEO
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace NEO {
+
+// In-process stand-in for TBX server, consumes HAS protocol byte stream and answers reads
+class TbxLoopbackServer {
+  public:
+    void receive(const void *buffer, size_t sizeInBytes) {
+        auto data = reinterpret_cast<const char *>(buffer);
+        inBuffer.insert(inBuffer.end(), data, data + sizeInBytes);
+        while (processMessage()) {
+        }
+    }
+
+    bool respond(void *buffer, size_t sizeInBytes) {
+        if (outBuffer.size() < sizeInBytes) {
+            return false;
+        }
+        std::copy_n(outBuffer.begin(), sizeInBytes, reinterpret_cast<char *>(buffer));
+        outBuffer.erase(outBuffer.begin(), outBuffer.begin() + sizeInBytes);
+        return true;
+    }
+
+    std::map<uint64_t, uint8_t> memory;
+    std::map<uint32_t, uint32_t> mmio;
+    std::map<uint32_t, uint64_t> gtt;
+    uint32_t messagesReceived = 0;
+
+  protected:
+    bool processMessage() {
+        HasMsg msg;
+        if (inBuffer.size() < sizeof(HasHdr)) {
+            return false;
+        }
+        memcpy(&msg.hdr, inBuffer.data(), sizeof(HasHdr));
+        auto messageSize = sizeof(HasHdr) + msg.hdr.size;
+        if (inBuffer.size() < messageSize) {
+            return false;
+        }
+        memcpy(&msg, inBuffer.data(), messageSize);
+
+        if (msg.hdr.msgType == HAS_WRITE_DATA_REQ_TYPE) {
+            messageSize += msg.u.writeReq.size;
+            if (inBuffer.size() < messageSize) {
+                return false;
+            }
+            auto address = (static_cast<uint64_t>(msg.u.writeReq.addressH) << 32) | msg.u.writeReq.address;
+            for (uint32_t i = 0; i < msg.u.writeReq.size; i++) {
+                memory[address + i] = static_cast<uint8_t>(inBuffer[sizeof(HasHdr) + msg.hdr.size + i]);
+            }
+        } else if (msg.hdr.msgType == HAS_READ_DATA_REQ_TYPE) {
+            auto address = (static_cast<uint64_t>(msg.u.readReq.addressH) << 32) | msg.u.readReq.address;
+            HasMsg resp;
+            memset(&resp, 0, sizeof(resp));
+            resp.hdr.msgType = HAS_READ_DATA_RES_TYPE;
+            resp.hdr.transID = msg.hdr.transID;
+            resp.hdr.size = sizeof(HasReadDataRes);
+            resp.u.readRes.address = msg.u.readReq.address;
+            resp.u.readRes.addressH = msg.u.readReq.addressH;
+            resp.u.readRes.size = msg.u.readReq.size;
+            queueResponse(&resp, sizeof(HasHdr) + sizeof(HasReadDataRes));
+            for (uint32_t i = 0; i < msg.u.readReq.size; i++) {
+                outBuffer.push_back(static_cast<char>(memory[address + i]));
+            }
+        } else if (msg.hdr.msgType == HAS_MMIO_REQ_TYPE) {
+            if (msg.u.mmioReq.write) {
+                mmio[msg.u.mmioReq.offset] = msg.u.mmioReq.data;
+            } else {
+                HasMsg resp;
+                memset(&resp, 0, sizeof(resp));
+                resp.hdr.msgType = HAS_MMIO_RES_TYPE;
+                resp.hdr.transID = msg.hdr.transID;
+                resp.hdr.size = sizeof(HasMmioRes);
+                resp.u.mmioRes.data = mmio[msg.u.mmioReq.offset];
+                queueResponse(&resp, sizeof(HasHdr) + sizeof(HasMmioRes));
+            }
+        } else if (msg.hdr.msgType == HAS_GTT_REQ_TYPE) {
+            gtt[msg.u.gtt64Req.offset] = (static_cast<uint64_t>(msg.u.gtt64Req.dataH) << 32) | msg.u.gtt64Req.data;
+        }
+
+        inBuffer.erase(inBuffer.begin(), inBuffer.begin() + messageSize);
+        messagesReceived++;
+        return true;
+    }
+
+    void queueResponse(const void *data, size_t size) {
+        auto bytes = reinterpret_cast<const char *>(data);
+        outBuffer.insert(outBuffer.end(), bytes, bytes + size);
+    }
+
+    std::vector<char> inBuffer;
+    std::deque<char> outBuffer;
+};
+
+class MockTbxSocketsImp : public TbxSocketsImp {
+  public:
+    using TbxSocketsImp::pendingWrites;
+    using TbxSocketsImp::writeBatchingBufferSize;
+
+    bool sendWriteData(const void *buffer, size_t sizeInBytes) override {
+        sendWriteDataCalled++;
+        server.receive(buffer, sizeInBytes);
+        return true;
+    }
+
+    bool getResponseData(void *buffer, size_t sizeInBytes) override {
+        return server.respond(buffer, sizeInBytes);
+    }
+
+    TbxLoopbackServer server;
+    uint32_t sendWriteDataCalled = 0;
+};
+} // namespace NEO
@@ -105,10 +105,23 @@ struct MockedMemoryInfo : public NEO::MemoryInfo {
         return 0;
     }
 
+    int createGemExtWithNumaNode(size_t allocSize, uint32_t &handle, uint64_t patIndex, int32_t numaNode) override {
+        createGemExtWithNumaNodeCalled++;
+        if (failOnCreateGemExtWithNumaNode) {
+            return -1;
+        }
+        handle = 1u;
+        numaNodePassed = numaNode;
+        return 0;
+    }
+
     uint32_t banks = 0;
     int32_t pairHandlePassed = -1;
+    int32_t numaNodePassed = -1;
+    uint32_t createGemExtWithNumaNodeCalled = 0;
     bool isChunkedUsed = false;
     bool failOnCreateGemExtWithMultipleRegions = false;
+    bool failOnCreateGemExtWithNumaNode = false;
 };
 
 class DrmMemoryManagerFixtureWithoutQuietIoctlExpectation {
@@ -108,6 +108,12 @@ int (*sysCallsGetDevicePath)(int deviceFd, char *buf, size_t &bufSize) = nullptr
 off_t lseekReturn = 4096u;
 std::atomic<int> lseekCalledCount(0);
 long sysconfReturn = 1ull << 30;
+int ftruncateCalled = 0;
+int (*sysCallsFtruncate)(int fd, off_t length) = nullptr;
+int mbindCalled = 0;
+long (*sysCallsMbind)(void *addr, unsigned long len, int mode, const unsigned long *nodeMask, unsigned long maxNode, unsigned int flags) = nullptr;
+int madviseCalled = 0;
+int (*sysCallsMadvise)(void *addr, size_t size, int advice) = nullptr;
 
 int mkdir(const std::string &path) {
     if (sysCallsMkdir != nullptr) {
@@ -479,5 +485,29 @@ long sysconf(int name) {
     return sysconfReturn;
 }
 
+int ftruncate(int fd, off_t length) {
+    ftruncateCalled++;
+    if (sysCallsFtruncate != nullptr) {
+        return sysCallsFtruncate(fd, length);
+    }
+    return 0;
+}
+
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodeMask, unsigned long maxNode, unsigned int flags) {
+    mbindCalled++;
+    if (sysCallsMbind != nullptr) {
+        return sysCallsMbind(addr, len, mode, nodeMask, maxNode, flags);
+    }
+    return 0;
+}
+
+int madvise(void *addr, size_t size, int advice) {
+    madviseCalled++;
+    if (sysCallsMadvise != nullptr) {
+        return sysCallsMadvise(addr, size, advice);
+    }
+    return 0;
+}
+
 } // namespace SysCalls
 } // namespace NEO
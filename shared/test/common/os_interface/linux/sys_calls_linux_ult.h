@@ -85,5 +85,14 @@ extern off_t lseekReturn;
 extern std::atomic<int> lseekCalledCount;
 
 extern long sysconfReturn;
+
+extern int ftruncateCalled;
+extern int (*sysCallsFtruncate)(int fd, off_t length);
+
+extern int mbindCalled;
+extern long (*sysCallsMbind)(void *addr, unsigned long len, int mode, const unsigned long *nodeMask, unsigned long maxNode, unsigned int flags);
+
+extern int madviseCalled;
+extern int (*sysCallsMadvise)(void *addr, size_t size, int advice);
 } // namespace SysCalls
 } // namespace NEO
@@ -128,6 +128,28 @@ TEST(AubHelper, givenAllocationTypeWhenAskingIfOneTimeWritableThenReturnCorrectR
     }
 }
 
+TEST(AubHelper, givenAllocationTypeWhenAskingIfGpuReadOnlyThenOnlyCodeAndCpuWrittenStateTypesAreReadOnly) {
+    for (uint32_t i = 0; i < static_cast<uint32_t>(AllocationType::count); i++) {
+        auto allocType = static_cast<AllocationType>(i);
+
+        bool isGpuReadOnly = AubHelper::isGpuReadOnlyAllocationType(allocType);
+
+        switch (allocType) {
+        case AllocationType::commandBuffer:
+        case AllocationType::constantSurface:
+        case AllocationType::internalHeap:
+        case AllocationType::kernelIsa:
+        case AllocationType::kernelIsaInternal:
+        case AllocationType::linearStream:
+            EXPECT_TRUE(isGpuReadOnly);
+            break;
+        default:
+            EXPECT_FALSE(isGpuReadOnly);
+            break;
+        }
+    }
+}
+
 TEST(AubHelper, givenSetBufferHostMemoryAlwaysAubWritableWhenAskingIfBufferHostMemoryAllocationIsOneTimeAubWritableThenReturnCorrectResult) {
     DebugManagerStateRestore stateRestore;
 
@@ -284,6 +284,94 @@ HWTEST_F(CommandEncoderTests, givenInOrderExecInfoWhenPatchingThenSetCorrectValu
     EXPECT_ANY_THROW(patchCmd.patch(1));
 }
 
+HWTEST_F(CommandEncoderTests, givenBatchedPatchCmdsWhenPatchingThenSetSameValuesAsPatchingEachCommand) {
+    using MI_STORE_DATA_IMM = typename FamilyType::MI_STORE_DATA_IMM;
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using MI_LOAD_REGISTER_IMM = typename FamilyType::MI_LOAD_REGISTER_IMM;
+    using PatchCmdType = InOrderPatchCommandHelpers::PatchCmdType;
+
+    MockDevice mockDevice;
+
+    MockExecutionEnvironment mockExecutionEnvironment{};
+    MockMemoryManager memoryManager(mockExecutionEnvironment);
+
+    MockTagAllocator<DeviceAllocNodeType<true>> tagAllocator(0, mockDevice.getMemoryManager());
+    auto node = tagAllocator.getTag();
+
+    auto externalInOrderExecInfo = std::make_shared<InOrderExecInfo>(node, nullptr, memoryManager, 1, 0, true, false);
+    externalInOrderExecInfo->addCounterValue(2);
+    externalInOrderExecInfo->addRegularCmdListSubmissionCounter(3);
+
+    constexpr size_t cmdsCount = 4;
+
+    struct Cmds {
+        MI_STORE_DATA_IMM sdi[cmdsCount];
+        MI_SEMAPHORE_WAIT semaphore[cmdsCount];
+        MI_SEMAPHORE_WAIT externalSemaphore;
+        MI_SEMAPHORE_WAIT skippedSemaphore;
+        MI_LOAD_REGISTER_IMM lriLow[cmdsCount];
+        MI_LOAD_REGISTER_IMM lriHigh[cmdsCount];
+    };
+
+    auto initCmds = [](Cmds &cmds) {
+        for (size_t i = 0; i < cmdsCount; i++) {
+            cmds.sdi[i] = FamilyType::cmdInitStoreDataImm;
+            cmds.semaphore[i] = FamilyType::cmdInitMiSemaphoreWait;
+            cmds.lriLow[i] = FamilyType::cmdInitLoadRegisterImm;
+            cmds.lriHigh[i] = FamilyType::cmdInitLoadRegisterImm;
+        }
+        cmds.externalSemaphore = FamilyType::cmdInitMiSemaphoreWait;
+        cmds.skippedSemaphore = FamilyType::cmdInitMiSemaphoreWait;
+        cmds.skippedSemaphore.setSemaphoreDataDword(7);
+    };
+
+    auto createContainer = [&](Cmds &cmds, InOrderPatchCommandsContainer<FamilyType> &container) {
+        for (size_t i = 0; i < cmdsCount; i++) {
+            container.emplace_back(nullptr, &cmds.sdi[i], nullptr, i + 1, PatchCmdType::sdi, false, false);
+            container.emplace_back(nullptr, &cmds.semaphore[i], nullptr, i + 1, PatchCmdType::semaphore, false, false);
+            container.emplace_back(nullptr, &cmds.lriLow[i], &cmds.lriHigh[i], i + 1, PatchCmdType::lri64b, false, false);
+        }
+        container.emplace_back(&externalInOrderExecInfo, &cmds.externalSemaphore, nullptr, 1, PatchCmdType::semaphore, false, false);
+        container.emplace_back(nullptr, &cmds.skippedSemaphore, nullptr, 1, PatchCmdType::semaphore, false, false);
+        container.back().setSkipPatching(true);
+    };
+
+    Cmds referenceCmds;
+    Cmds batchedCmds;
+    initCmds(referenceCmds);
+    initCmds(batchedCmds);
+
+    InOrderPatchCommandsContainer<FamilyType> referenceContainer;
+    InOrderPatchCommandsContainer<FamilyType> batchedContainer;
+    createContainer(referenceCmds, referenceContainer);
+    createContainer(batchedCmds, batchedContainer);
+
+    InOrderPatchCommandHelpers::BatchedPatchCmds<FamilyType> batchedPatchCmds;
+    EXPECT_FALSE(batchedPatchCmds.isValid());
+    batchedPatchCmds.build(batchedContainer);
+    EXPECT_TRUE(batchedPatchCmds.isValid());
+
+    const uint64_t appendCounterValue = static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 5;
+    for (auto patchImplicitDependencies : {false, true}) {
+        for (auto &cmd : referenceContainer) {
+            if (cmd.isExternalDependency() || patchImplicitDependencies) {
+                cmd.patch(appendCounterValue);
+            }
+        }
+        batchedPatchCmds.patch(batchedContainer, appendCounterValue, patchImplicitDependencies);
+
+        EXPECT_EQ(0, memcmp(&referenceCmds, &batchedCmds, sizeof(Cmds)));
+    }
+
+    EXPECT_EQ(7u, batchedCmds.skippedSemaphore.getSemaphoreDataDword());
+    EXPECT_EQ(getLowPart(cmdsCount + appendCounterValue), batchedCmds.sdi[cmdsCount - 1].getDataDword0());
+    EXPECT_EQ(getHighPart(cmdsCount + appendCounterValue), batchedCmds.lriHigh[cmdsCount - 1].getDataDword());
+
+    batchedPatchCmds.invalidate();
+    EXPECT_FALSE(batchedPatchCmds.isValid());
+    EXPECT_ANY_THROW(batchedPatchCmds.patch(batchedContainer, appendCounterValue, true));
+}
+
 HWTEST_F(CommandEncoderTests, givenInOrderExecInfoWhenPatchingWalkerThenSetCorrectValues) {
     MockDevice mockDevice;
 
@@ -840,6 +840,136 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenWriteMe
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
 
+struct MockAubFileStreamCountingMemoryWrites : public AubMemDump::AubFileStream {
+    void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        memoryWrites.push_back({physAddress, size});
+    }
+    void writeMemoryWriteHeader(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        memoryWriteHeadersCount++;
+    }
+    void writePTE(uint64_t physAddress, uint64_t entry, uint32_t addressSpace) override {}
+
+    std::vector<std::pair<uint64_t, size_t>> memoryWrites;
+    uint32_t memoryWriteHeadersCount = 0;
+};
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAubDumpCoalescePageWritesWhenWritingPhysicallyContiguousMemoryThenSingleMemoryWriteIsDumped) {
+    DebugManagerStateRestore stateRestore;
+    pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    aubCsr->initializeEngine();
+    auto stream = std::make_unique<MockAubFileStreamCountingMemoryWrites>();
+    aubCsr->stream = stream.get();
+
+    constexpr size_t pagesCount = 4;
+    auto memory = alignedMalloc(pagesCount * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    memset(memory, 0xab, pagesCount * MemoryConstants::pageSize);
+
+    aubCsr->writeMemory(0x100000, memory, pagesCount * MemoryConstants::pageSize, MemoryBanks::mainBank, 0);
+    EXPECT_EQ(pagesCount, stream->memoryWrites.size());
+    auto perPageHeadersCount = stream->memoryWriteHeadersCount;
+
+    debugManager.flags.AUBDumpCoalescePageWrites.set(true);
+    stream->memoryWrites.clear();
+    stream->memoryWriteHeadersCount = 0;
+    aubCsr->writeMemory(0x200000, memory, pagesCount * MemoryConstants::pageSize, MemoryBanks::mainBank, 0);
+
+    ASSERT_EQ(1u, stream->memoryWrites.size());
+    EXPECT_EQ(pagesCount * MemoryConstants::pageSize, stream->memoryWrites[0].second);
+    EXPECT_LT(stream->memoryWriteHeadersCount, perPageHeadersCount);
+
+    alignedFree(memory);
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAubDumpSkipUnchangedPagesWhenWritingSameMemoryAgainThenOnlyChangedPagesAreDumped) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+    pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    aubCsr->initializeEngine();
+    auto stream = std::make_unique<MockAubFileStreamCountingMemoryWrites>();
+    aubCsr->stream = stream.get();
+
+    constexpr size_t pagesCount = 4;
+    auto memory = alignedMalloc(pagesCount * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    memset(memory, 0xab, pagesCount * MemoryConstants::pageSize);
+
+    aubCsr->writeMemory(0x100000, memory, pagesCount * MemoryConstants::pageSize, MemoryBanks::mainBank, 0);
+    EXPECT_EQ(pagesCount, stream->memoryWrites.size());
+
+    stream->memoryWrites.clear();
+    aubCsr->writeMemory(0x100000, memory, pagesCount * MemoryConstants::pageSize, MemoryBanks::mainBank, 0);
+    EXPECT_EQ(0u, stream->memoryWrites.size());
+
+    reinterpret_cast<uint8_t *>(memory)[2 * MemoryConstants::pageSize + 1] = 0xcd;
+    aubCsr->writeMemory(0x100000, memory, pagesCount * MemoryConstants::pageSize, MemoryBanks::mainBank, 0);
+    ASSERT_EQ(1u, stream->memoryWrites.size());
+    EXPECT_EQ(MemoryConstants::pageSize, stream->memoryWrites[0].second);
+
+    stream->memoryWrites.clear();
+    aubCsr->writeMemory(0x100000, memory, pagesCount * MemoryConstants::pageSize, MemoryBanks::mainBank, 1ull << PageTableEntry::writableBit);
+    EXPECT_EQ(pagesCount, stream->memoryWrites.size());
+
+    alignedFree(memory);
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAubDumpSkipUnchangedPagesWhenAllocationWasResidentInSubmissionThenPagesWritableByGpuAreDumpedAgainEvenIfCpuContentIsUnchanged) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+    pDevice->executionEnvironment->rootDeviceEnvironments[0]->aubCenter.reset(new AubCenter());
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->setupContext(*pDevice->getDefaultEngine().osContext);
+    aubCsr->initializeEngine();
+    auto stream = std::make_unique<MockAubFileStreamCountingMemoryWrites>();
+    aubCsr->stream = stream.get();
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto buffer = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, AllocationType::buffer, pDevice->getDeviceBitfield()});
+    auto isa = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, AllocationType::kernelIsa, pDevice->getDeviceBitfield()});
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_NE(nullptr, isa);
+
+    ResidencyContainer allocationsForResidency = {buffer, isa};
+    aubCsr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(2u, stream->memoryWrites.size());
+
+    // GPU could have written buffer in simulator, CPU content which was dumped last must be dumped again
+    stream->memoryWrites.clear();
+    aubCsr->setAubWritable(true, *buffer);
+    aubCsr->setAubWritable(true, *isa);
+    aubCsr->processResidency(allocationsForResidency, 0u);
+    ASSERT_EQ(1u, stream->memoryWrites.size());
+    EXPECT_EQ(MemoryConstants::pageSize, stream->memoryWrites[0].second);
+
+    memoryManager->freeGraphicsMemory(buffer);
+    memoryManager->freeGraphicsMemory(isa);
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenPrintSkippedUnchangedPagesWhenProcessingResidencyThenUploadStatisticsArePrintedAndReset) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+    debugManager.flags.PrintSkippedUnchangedPages.set(true);
+
+    auto aubCsr = std::make_unique<MockAubCsr<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    aubCsr->dirtyPageTracker.resetStatistics();
+    std::vector<uint8_t> page(MemoryConstants::pageSize, 0u);
+    aubCsr->dirtyPageTracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1);
+    aubCsr->dirtyPageTracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1);
+
+    testing::internal::CaptureStdout();
+    ResidencyContainer allocationsForResidency;
+    aubCsr->processResidency(allocationsForResidency, 0u);
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ("AUB residency upload: 4096 bytes written, 4096 bytes of unchanged pages skipped\n", output);
+    EXPECT_EQ(0u, aubCsr->dirtyPageTracker.getStatistics().writtenBytes);
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, whenAubCommandStreamReceiverIsCreatedThenPPGTTAndGGTTCreatedHavePhysicalAddressAllocatorSet) {
     auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
     ASSERT_NE(nullptr, aubCsr->ppgtt.get());
@@ -31,7 +31,9 @@
 #include "gtest/gtest.h"
 #include "sys_calls.h"
 
+#include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <memory>
 
 using namespace NEO;
@@ -998,3 +1000,27 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithAubManagerWhenInit
 
     EXPECT_EQ(expectedAddedComments, mockAubManager->receivedComments);
 }
+
+TEST(AubFileStreamAsyncWriterTests, givenAubDumpAsyncFileWriterWhenWritingToAubFileStreamThenDataIsWrittenToFileByBackgroundWriter) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.AUBDumpAsyncFileWriter.set(true);
+
+    std::string fileName = "aub_async_file_writer_test.aub";
+    AubMemDump::AubFileStream aubFile;
+    aubFile.open(fileName.c_str());
+    ASSERT_TRUE(aubFile.isOpen());
+    ASSERT_NE(nullptr, aubFile.asyncFileWriter);
+
+    aubFile.write("aub", 3);
+    aubFile.write("data", 4);
+    aubFile.flush();
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ("aubdata", content);
+    file.close();
+
+    aubFile.close();
+    EXPECT_EQ(nullptr, aubFile.asyncFileWriter);
+    std::remove(fileName.c_str());
+}
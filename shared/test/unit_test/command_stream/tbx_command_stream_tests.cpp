@@ -177,6 +177,68 @@ HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCa
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
 
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedPagesWhenWritingUnchangedMemoryAgainThenPagesAreSkippedAndReportedInStatistics) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.TbxSkipUnchangedPages.set(true);
+
+    TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
+    tbxCsr->initializeEngine();
+    tbxCsr->dirtyPageTracker.resetStatistics();
+
+    constexpr size_t size = 2 * MemoryConstants::pageSize;
+    auto memory = alignedMalloc(size, MemoryConstants::pageSize);
+    memset(memory, 0xab, size);
+
+    tbxCsr->writeMemory(0x100000, memory, size, MemoryBanks::mainBank, 0);
+    EXPECT_EQ(size, tbxCsr->dirtyPageTracker.getStatistics().writtenBytes);
+    EXPECT_EQ(0u, tbxCsr->dirtyPageTracker.getStatistics().skippedBytes);
+
+    tbxCsr->writeMemory(0x100000, memory, size, MemoryBanks::mainBank, 0);
+    EXPECT_EQ(size, tbxCsr->dirtyPageTracker.getStatistics().writtenBytes);
+    EXPECT_EQ(size, tbxCsr->dirtyPageTracker.getStatistics().skippedBytes);
+
+    reinterpret_cast<uint8_t *>(memory)[MemoryConstants::pageSize] = 0xcd;
+    tbxCsr->writeMemory(0x100000, memory, size, MemoryBanks::mainBank, 0);
+    auto statistics = tbxCsr->dirtyPageTracker.resetStatistics();
+    EXPECT_EQ(size + MemoryConstants::pageSize, statistics.writtenBytes);
+    EXPECT_EQ(size + MemoryConstants::pageSize, statistics.skippedBytes);
+
+    alignedFree(memory);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedPagesWhenAllocationWasResidentInSubmissionThenPagesWritableByGpuAreUploadedAgainEvenIfCpuContentIsUnchanged) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.TbxSkipUnchangedPages.set(true);
+
+    TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
+    tbxCsr->aubManager = nullptr;
+    tbxCsr->hardwareContextController.reset(nullptr);
+    tbxCsr->initializeEngine();
+    MemoryManager *memoryManager = tbxCsr->getMemoryManager();
+
+    auto buffer = memoryManager->allocateGraphicsMemoryWithProperties({tbxCsr->getRootDeviceIndex(), MemoryConstants::pageSize, AllocationType::buffer, pDevice->getDeviceBitfield()});
+    auto isa = memoryManager->allocateGraphicsMemoryWithProperties({tbxCsr->getRootDeviceIndex(), MemoryConstants::pageSize, AllocationType::kernelIsa, pDevice->getDeviceBitfield()});
+    ASSERT_NE(nullptr, buffer);
+    ASSERT_NE(nullptr, isa);
+
+    ResidencyContainer allocationsForResidency = {buffer, isa};
+    tbxCsr->processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(0u, tbxCsr->dirtyPageTracker.getStatistics().writtenBytes);
+
+    tbxCsr->setTbxWritable(true, *buffer);
+    EXPECT_TRUE(tbxCsr->writeMemory(*buffer));
+    EXPECT_EQ(MemoryConstants::pageSize, tbxCsr->dirtyPageTracker.getStatistics().writtenBytes);
+    EXPECT_EQ(0u, tbxCsr->dirtyPageTracker.getStatistics().skippedBytes);
+
+    tbxCsr->setTbxWritable(true, *isa);
+    EXPECT_TRUE(tbxCsr->writeMemory(*isa));
+    EXPECT_EQ(MemoryConstants::pageSize, tbxCsr->dirtyPageTracker.getStatistics().writtenBytes);
+    EXPECT_EQ(MemoryConstants::pageSize, tbxCsr->dirtyPageTracker.getStatistics().skippedBytes);
+
+    memoryManager->freeGraphicsMemory(buffer);
+    memoryManager->freeGraphicsMemory(isa);
+}
+
 HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCalledWithGraphicsAllocationThatIsOnlyOneTimeWriteableThenGraphicsAllocationIsUpdated) {
     TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
     tbxCsr->initializeEngine();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,3 +37,12 @@ TEST(TbxStreamTests, givenTbxStreamWhenWriteMemoryIsCalledThenMemTypeIsSetCorrec
     mockTbxStream->writePTE(0, 0, addressSpace);
     EXPECT_EQ(MemType::system, mockTbxSocket->typeCapturedFromWriteMemory);
 }
+
+TEST(TbxStreamTests, givenTbxStreamWhenFlushIsCalledThenSocketIsFlushed) {
+    MockTbxStream tbxStream;
+    MockTbxSockets *mockTbxSocket = new MockTbxSockets();
+    tbxStream.socket = mockTbxSocket;
+
+    tbxStream.flush();
+    EXPECT_EQ(1u, mockTbxSocket->flushCalled);
+}
@@ -9,6 +9,7 @@
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
@@ -337,6 +338,85 @@ TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     EXPECT_FALSE(ret);
 }
 
+TEST(CompilerCacheTests, GivenCompressionDisabledWhenCompressingBinaryThenBinaryIsNotChanged) {
+    CompilerCacheMock cache;
+    cache.config.compressionEnabled = false;
+
+    const char *binary = "binary binary binary binary";
+    const char *pBinary = binary;
+    size_t binarySize = strlen(binary);
+    std::vector<uint8_t> storage;
+    cache.compressBinaryIfEnabled(pBinary, binarySize, storage);
+
+    EXPECT_EQ(binary, pBinary);
+    EXPECT_EQ(strlen(binary), binarySize);
+    EXPECT_TRUE(storage.empty());
+}
+
+TEST(CompilerCacheTests, GivenCompressionEnabledWhenCompressingBinaryThenCompressedContainerIsUsedAndCanBeDecompressed) {
+    CompilerCacheMock cache;
+    cache.config.compressionEnabled = true;
+
+    const std::string binary(4096, 'x');
+    const char *pBinary = binary.c_str();
+    size_t binarySize = binary.size();
+    std::vector<uint8_t> storage;
+    cache.compressBinaryIfEnabled(pBinary, binarySize, storage);
+
+    EXPECT_EQ(reinterpret_cast<const char *>(storage.data()), pBinary);
+    EXPECT_EQ(storage.size(), binarySize);
+    EXPECT_LT(binarySize, binary.size());
+    EXPECT_TRUE(CompressedBinary::isCompressed(storage));
+
+    size_t cachedBinarySize = binarySize;
+    auto cachedBinary = std::make_unique<char[]>(cachedBinarySize);
+    memcpy(cachedBinary.get(), pBinary, cachedBinarySize);
+    auto decompressed = CompilerCacheMock::decompressCachedBinary(std::move(cachedBinary), cachedBinarySize);
+    ASSERT_NE(nullptr, decompressed);
+    EXPECT_EQ(binary, std::string(decompressed.get(), cachedBinarySize));
+}
+
+TEST(CompilerCacheTests, GivenNotCompressedCachedBinaryWhenDecompressingThenSameBinaryIsReturned) {
+    const char binary[] = "not compressed";
+    size_t cachedBinarySize = sizeof(binary);
+    auto cachedBinary = std::make_unique<char[]>(cachedBinarySize);
+    memcpy(cachedBinary.get(), binary, cachedBinarySize);
+    auto cachedBinaryPtr = cachedBinary.get();
+
+    auto result = CompilerCacheMock::decompressCachedBinary(std::move(cachedBinary), cachedBinarySize);
+    EXPECT_EQ(cachedBinaryPtr, result.get());
+    EXPECT_EQ(sizeof(binary), cachedBinarySize);
+
+    cachedBinarySize = 0U;
+    EXPECT_EQ(nullptr, CompilerCacheMock::decompressCachedBinary(nullptr, cachedBinarySize));
+}
+
+TEST(CompilerCacheTests, GivenCorruptedCompressedCachedBinaryWhenDecompressingThenNullIsReturned) {
+    auto container = CompressedBinary::compress(ArrayRef<const uint8_t>::fromAny("data data data data", 19));
+    reinterpret_cast<CompressedBinary::Header *>(container.data())->uncompressedSize += 1;
+
+    size_t cachedBinarySize = container.size();
+    auto cachedBinary = std::make_unique<char[]>(cachedBinarySize);
+    memcpy(cachedBinary.get(), container.data(), cachedBinarySize);
+
+    auto result = CompilerCacheMock::decompressCachedBinary(std::move(cachedBinary), cachedBinarySize);
+    EXPECT_EQ(nullptr, result);
+    EXPECT_EQ(0U, cachedBinarySize);
+}
+
+TEST(CompilerCacheTests, GivenCompressedCachedBinaryWithHugeDecompressedSizeWhenDecompressingThenItIsTreatedAsCacheMiss) {
+    auto container = CompressedBinary::compress(ArrayRef<const uint8_t>::fromAny("data data data data", 19));
+    reinterpret_cast<CompressedBinary::Header *>(container.data())->uncompressedSize = 0x100000000ull;
+
+    size_t cachedBinarySize = container.size();
+    auto cachedBinary = std::make_unique<char[]>(cachedBinarySize);
+    memcpy(cachedBinary.get(), container.data(), cachedBinarySize);
+
+    auto result = CompilerCacheMock::decompressCachedBinary(std::move(cachedBinary), cachedBinarySize);
+    EXPECT_EQ(nullptr, result);
+    EXPECT_EQ(0U, cachedBinarySize);
+}
+
 TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenNullIsReturned) {
     CompilerCache cache(CompilerCacheConfig{});
     size_t size;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,10 @@
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/compiler_interface.inl"
 #include "shared/source/compiler_interface/compiler_options.h"
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
 #include "shared/source/compiler_interface/oclc_extensions.h"
 #include "shared/source/helpers/compiler_product_helper.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/os_inc_base.h"
@@ -222,6 +224,100 @@ TEST_F(CompilerInterfaceTest, GivenOptionsWhenCompilingToIsaThenSuccessIsReturne
     gEnvironment->igcPopDebugVars();
 }
 
+TEST_F(CompilerInterfaceTest, givenInMemoryCacheWhenBuildingSameInputTwiceThenSecondBuildIsServedFromInMemoryCache) {
+    InMemoryCompilerCache inMemoryCache(MemoryConstants::megaByte);
+    pCompilerInterface->inMemoryCache = &inMemoryCache;
+
+    TranslationOutput firstOutput;
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, firstOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+
+    TranslationOutput secondOutput;
+    err = pCompilerInterface->build(*pDevice, inputArgs, secondOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+
+    auto statistics = inMemoryCache.getStatistics();
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.entries);
+
+    ASSERT_EQ(firstOutput.deviceBinary.size, secondOutput.deviceBinary.size);
+    EXPECT_NE(firstOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get());
+    EXPECT_EQ(0, memcmp(firstOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get(), firstOutput.deviceBinary.size));
+    EXPECT_EQ(firstOutput.intermediateCodeType, secondOutput.intermediateCodeType);
+
+    pCompilerInterface->inMemoryCache = nullptr;
+}
+
+TEST_F(CompilerInterfaceTest, givenInMemoryCacheWhenBuildFailsThenResultIsNotCached) {
+    InMemoryCompilerCache inMemoryCache(MemoryConstants::megaByte);
+    pCompilerInterface->inMemoryCache = &inMemoryCache;
+
+    pCompilerInterface->failCreateIgcTranslationCtx = true;
+    TranslationOutput translationOutput;
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::unknownError, err);
+    pCompilerInterface->failCreateIgcTranslationCtx = false;
+
+    err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+
+    auto statistics = inMemoryCache.getStatistics();
+    EXPECT_EQ(2u, statistics.misses);
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(1u, statistics.entries);
+
+    pCompilerInterface->inMemoryCache = nullptr;
+}
+
+TEST_F(CompilerInterfaceTest, givenInputsDifferingInSpecConstantsWhenGettingInMemoryCacheKeyThenKeysDiffer) {
+    auto key = pCompilerInterface->getInMemoryCacheKey(*pDevice, inputArgs);
+    EXPECT_EQ(key, pCompilerInterface->getInMemoryCacheKey(*pDevice, inputArgs));
+
+    inputArgs.specializedValues[1] = 2;
+    auto keyWithSpecConstant = pCompilerInterface->getInMemoryCacheKey(*pDevice, inputArgs);
+    EXPECT_NE(key, keyWithSpecConstant);
+
+    inputArgs.specializedValues[1] = 3;
+    EXPECT_NE(keyWithSpecConstant, pCompilerInterface->getInMemoryCacheKey(*pDevice, inputArgs));
+}
+
+TEST_F(CompilerInterfaceTest, givenInputWithoutSpecConstantsWhenGettingInMemoryCacheKeyThenItIsBasedOnCachedFileHash) {
+    inputArgs.specializedValues.clear();
+    auto fileHash = CompilerCache::getCachedFileHash(pDevice->getHardwareInfo(), inputArgs.src, inputArgs.apiOptions, inputArgs.internalOptions,
+                                                     ArrayRef<const char>(), ArrayRef<const char>(),
+                                                     pCompilerInterface->igcRevision, pCompilerInterface->igcLibSize, pCompilerInterface->igcLibMTime);
+
+    auto key = pCompilerInterface->getInMemoryCacheKey(*pDevice, inputArgs);
+    EXPECT_EQ(0u, key.find(fileHash + "_"));
+
+    inputArgs.outType = IGC::CodeType::llvmBc;
+    EXPECT_NE(key, pCompilerInterface->getInMemoryCacheKey(*pDevice, inputArgs));
+}
+
+TEST(CompilerInterface, givenInMemoryCompilerCacheSizeDebugFlagWhenInitializingThenProcessWideInMemoryCacheIsUsed) {
+    DebugManagerStateRestore restorer;
+
+    MockCompilerInterface compilerInterfaceWithoutInMemoryCache;
+    compilerInterfaceWithoutInMemoryCache.initialize(std::make_unique<CompilerCache>(CompilerCacheConfig{}), true);
+    EXPECT_EQ(nullptr, compilerInterfaceWithoutInMemoryCache.inMemoryCache);
+
+    debugManager.flags.InMemoryCompilerCacheSize.set(MemoryConstants::megaByte);
+    MockCompilerInterface compilerInterface1;
+    MockCompilerInterface compilerInterface2;
+    compilerInterface1.initialize(std::make_unique<CompilerCache>(CompilerCacheConfig{}), true);
+    compilerInterface2.initialize(std::make_unique<CompilerCache>(CompilerCacheConfig{}), true);
+    EXPECT_NE(nullptr, compilerInterface1.inMemoryCache);
+    EXPECT_EQ(compilerInterface1.inMemoryCache, compilerInterface2.inMemoryCache);
+    EXPECT_EQ(MemoryConstants::megaByte, compilerInterface1.inMemoryCache->getMaxSize());
+
+    debugManager.flags.InMemoryCompilerCacheSize.set(2 * MemoryConstants::megaByte);
+    MockCompilerInterface compilerInterface3;
+    compilerInterface3.initialize(std::make_unique<CompilerCache>(CompilerCacheConfig{}), true);
+    EXPECT_EQ(compilerInterface1.inMemoryCache, compilerInterface3.inMemoryCache);
+    EXPECT_EQ(2 * MemoryConstants::megaByte, compilerInterface3.inMemoryCache->getMaxSize());
+}
+
 TEST_F(CompilerInterfaceTest, WhenCompilingToIrThenSuccessIsReturned) {
     MockCompilerDebugVars fclDebugVars;
     retrieveBinaryKernelFilename(fclDebugVars.fileName, "CopyBuffer_simd32_", ".bc");
@@ -809,7 +905,7 @@ TEST_F(CompilerInterfaceTest, GivenSimultaneousRequestForNewFclTranslationContex
     ret = this->pCompilerInterface->createFclTranslationCtx(*device, IGC::CodeType::spirV, IGC::CodeType::oclGenBin);
     EXPECT_NE(nullptr, ret.get());
     ASSERT_EQ(1U, this->pCompilerInterface->getFclDeviceContexts().size());
-    EXPECT_TRUE(wasLockedListenerData.wasLocked);
+    EXPECT_FALSE(wasLockedListenerData.wasLocked);
 }
 
 TEST_F(CompilerInterfaceTest, GivenRequestForNewTranslationCtxWhenFclMainIsNotAvailableThenReturnNullptr) {
@@ -874,7 +970,7 @@ TEST_F(CompilerInterfaceTest, GivenSimultaneousRequestForNewIgcTranslationContex
     ret = this->pCompilerInterface->createIgcTranslationCtx(*device, IGC::CodeType::spirV, IGC::CodeType::oclGenBin);
     EXPECT_NE(nullptr, ret.get());
     ASSERT_EQ(1U, this->pCompilerInterface->getIgcDeviceContexts().size());
-    EXPECT_TRUE(wasLockedListenerData.wasLocked);
+    EXPECT_FALSE(wasLockedListenerData.wasLocked);
 }
 
 TEST_F(CompilerInterfaceTest, GivenRequestForNewIgcTranslationCtxWhenCouldNotPopulatePlatformInfoThenReturnNullptr) {
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
+#include "shared/source/helpers/string.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+InMemoryCompilerCache::BuildFunctionT createBuildFunction(const std::string &binary, uint32_t &buildsCount,
+                                                          TranslationOutput::ErrorCode errorCode = TranslationOutput::ErrorCode::success) {
+    return [&binary, &buildsCount, errorCode](TranslationOutput &output) {
+        buildsCount++;
+        output.deviceBinary.mem = makeCopy(binary.c_str(), binary.size());
+        output.deviceBinary.size = binary.size();
+        output.backendCompilerLog = "log";
+        return errorCode;
+    };
+}
+} // namespace
+
+TEST(InMemoryCompilerCacheTest, givenEmptyCacheWhenBuildingThenBuildIsCalledAndResultIsCached) {
+    InMemoryCompilerCache cache(1024);
+    std::string binary = "binary";
+    uint32_t buildsCount = 0;
+
+    TranslationOutput output;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, cache.getOrBuild("key", output, createBuildFunction(binary, buildsCount)));
+    EXPECT_EQ(1u, buildsCount);
+    ASSERT_EQ(binary.size(), output.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(binary.c_str(), output.deviceBinary.mem.get(), binary.size()));
+    EXPECT_STREQ("log", output.backendCompilerLog.c_str());
+
+    TranslationOutput cachedOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, cache.getOrBuild("key", cachedOutput, createBuildFunction(binary, buildsCount)));
+    EXPECT_EQ(1u, buildsCount);
+    ASSERT_EQ(binary.size(), cachedOutput.deviceBinary.size);
+    EXPECT_NE(output.deviceBinary.mem.get(), cachedOutput.deviceBinary.mem.get());
+    EXPECT_EQ(0, memcmp(binary.c_str(), cachedOutput.deviceBinary.mem.get(), binary.size()));
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(0u, statistics.evictions);
+    EXPECT_EQ(1u, statistics.entries);
+    EXPECT_EQ(binary.size() + 3u, statistics.usedSize);
+}
+
+TEST(InMemoryCompilerCacheTest, givenFailedBuildWhenBuildingAgainThenBuildIsRepeated) {
+    InMemoryCompilerCache cache(1024);
+    std::string binary = "binary";
+    uint32_t buildsCount = 0;
+
+    TranslationOutput output;
+    EXPECT_EQ(TranslationOutput::ErrorCode::buildFailure, cache.getOrBuild("key", output, createBuildFunction(binary, buildsCount, TranslationOutput::ErrorCode::buildFailure)));
+    EXPECT_STREQ("log", output.backendCompilerLog.c_str());
+    EXPECT_EQ(0u, cache.getStatistics().entries);
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, cache.getOrBuild("key", output, createBuildFunction(binary, buildsCount)));
+    EXPECT_EQ(2u, buildsCount);
+    EXPECT_EQ(2u, cache.getStatistics().misses);
+}
+
+TEST(InMemoryCompilerCacheTest, givenCacheSizeExceededWhenInsertingThenLeastRecentlyUsedEntriesAreEvicted) {
+    std::string binary(100, 'x');
+    const size_t entrySize = binary.size() + 3u;
+    InMemoryCompilerCache cache(3 * entrySize);
+    uint32_t buildsCount = 0;
+
+    TranslationOutput output;
+    cache.getOrBuild("key0", output, createBuildFunction(binary, buildsCount));
+    cache.getOrBuild("key1", output, createBuildFunction(binary, buildsCount));
+    cache.getOrBuild("key2", output, createBuildFunction(binary, buildsCount));
+    EXPECT_EQ(3u, cache.getStatistics().entries);
+
+    cache.getOrBuild("key0", output, createBuildFunction(binary, buildsCount));
+    EXPECT_EQ(3u, buildsCount);
+
+    cache.getOrBuild("key3", output, createBuildFunction(binary, buildsCount));
+    EXPECT_EQ(4u, buildsCount);
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_EQ(3u, statistics.entries);
+    EXPECT_EQ(3 * entrySize, statistics.usedSize);
+
+    cache.getOrBuild("key0", output, createBuildFunction(binary, buildsCount));
+    cache.getOrBuild("key2", output, createBuildFunction(binary, buildsCount));
+    cache.getOrBuild("key3", output, createBuildFunction(binary, buildsCount));
+    EXPECT_EQ(4u, buildsCount);
+
+    cache.getOrBuild("key1", output, createBuildFunction(binary, buildsCount));
+    EXPECT_EQ(5u, buildsCount);
+}
+
+TEST(InMemoryCompilerCacheTest, givenBuildResultLargerThanCacheWhenBuildingThenResultIsReturnedButNotCached) {
+    std::string binary(100, 'x');
+    InMemoryCompilerCache cache(binary.size());
+    uint32_t buildsCount = 0;
+
+    TranslationOutput output;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, cache.getOrBuild("key", output, createBuildFunction(binary, buildsCount)));
+    EXPECT_EQ(binary.size(), output.deviceBinary.size);
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(0u, statistics.entries);
+    EXPECT_EQ(0u, statistics.usedSize);
+    EXPECT_EQ(0u, statistics.evictions);
+}
+
+TEST(InMemoryCompilerCacheTest, givenConcurrentBuildsOfSameKeyWhenBuildingThenOnlyOneBuildIsPerformed) {
+    InMemoryCompilerCache cache(1024);
+    constexpr uint32_t threadsCount = 8;
+    std::string binary = "binary";
+    std::atomic<uint32_t> buildsCount = 0;
+
+    auto buildFunction = [&](TranslationOutput &output) {
+        buildsCount++;
+        while (cache.getStatistics().inFlightWaits < threadsCount - 1) {
+            std::this_thread::yield();
+        }
+        output.deviceBinary.mem = makeCopy(binary.c_str(), binary.size());
+        output.deviceBinary.size = binary.size();
+        return TranslationOutput::ErrorCode::success;
+    };
+
+    std::vector<TranslationOutput> outputs(threadsCount);
+    std::vector<TranslationOutput::ErrorCode> errorCodes(threadsCount, TranslationOutput::ErrorCode::unknownError);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back([&, i] {
+            errorCodes[i] = cache.getOrBuild("key", outputs[i], buildFunction);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1u, buildsCount);
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        EXPECT_EQ(TranslationOutput::ErrorCode::success, errorCodes[i]);
+        ASSERT_EQ(binary.size(), outputs[i].deviceBinary.size);
+        EXPECT_EQ(0, memcmp(binary.c_str(), outputs[i].deviceBinary.mem.get(), binary.size()));
+    }
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(threadsCount - 1, statistics.inFlightWaits);
+    EXPECT_EQ(0u, statistics.hits);
+}
+
+TEST(InMemoryCompilerCacheTest, givenBuildFunctionThrowingWhenOtherThreadWaitsForSameKeyThenWaiterIsReleasedWithErrorAndKeyCanBeBuiltAgain) {
+    InMemoryCompilerCache cache(1024);
+    std::string binary = "binary";
+    uint32_t buildsCount = 0;
+
+    auto throwingBuildFunction = [&](TranslationOutput &output) -> TranslationOutput::ErrorCode {
+        while (cache.getStatistics().inFlightWaits < 1) {
+            std::this_thread::yield();
+        }
+        throw std::runtime_error("build aborted");
+    };
+
+    bool exceptionCaught = false;
+    std::thread builder([&] {
+        TranslationOutput output;
+        try {
+            cache.getOrBuild("key", output, throwingBuildFunction);
+        } catch (const std::runtime_error &) {
+            exceptionCaught = true;
+        }
+    });
+    while (cache.getStatistics().misses < 1) {
+        std::this_thread::yield();
+    }
+
+    TranslationOutput waiterOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::unknownError, cache.getOrBuild("key", waiterOutput, createBuildFunction(binary, buildsCount)));
+    builder.join();
+
+    EXPECT_TRUE(exceptionCaught);
+    EXPECT_EQ(0u, buildsCount);
+    EXPECT_EQ(0u, cache.getStatistics().entries);
+
+    TranslationOutput output;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, cache.getOrBuild("key", output, createBuildFunction(binary, buildsCount)));
+    EXPECT_EQ(1u, buildsCount);
+}
+
+TEST(InMemoryCompilerCacheTest, givenCacheWithEntriesWhenMaxSizeIsReducedThenLeastRecentlyUsedEntriesAreEvicted) {
+    std::string binary(100, 'x');
+    const size_t entrySize = binary.size() + 3u;
+    InMemoryCompilerCache cache(3 * entrySize);
+    uint32_t buildsCount = 0;
+
+    TranslationOutput output;
+    cache.getOrBuild("key0", output, createBuildFunction(binary, buildsCount));
+    cache.getOrBuild("key1", output, createBuildFunction(binary, buildsCount));
+    cache.getOrBuild("key2", output, createBuildFunction(binary, buildsCount));
+
+    cache.setMaxSize(entrySize);
+    EXPECT_EQ(entrySize, cache.getMaxSize());
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(2u, statistics.evictions);
+    EXPECT_EQ(1u, statistics.entries);
+
+    cache.getOrBuild("key2", output, createBuildFunction(binary, buildsCount));
+    EXPECT_EQ(3u, buildsCount);
+
+    cache.setMaxSize(2 * entrySize);
+    cache.getOrBuild("key0", output, createBuildFunction(binary, buildsCount));
+    EXPECT_EQ(4u, buildsCount);
+    EXPECT_EQ(2u, cache.getStatistics().entries);
+}
+
+TEST(InMemoryCompilerCacheTest, givenProcessInstanceWhenMaxSizeIsSetThenLastSetSizeIsUsed) {
+    auto &processInstance = InMemoryCompilerCache::getProcessInstance();
+    auto initialMaxSize = processInstance.getMaxSize();
+
+    processInstance.setMaxSize(1024);
+    EXPECT_EQ(&processInstance, &InMemoryCompilerCache::getProcessInstance());
+    EXPECT_EQ(1024u, InMemoryCompilerCache::getProcessInstance().getMaxSize());
+    processInstance.setMaxSize(2048);
+    EXPECT_EQ(2048u, InMemoryCompilerCache::getProcessInstance().getMaxSize());
+
+    processInstance.setMaxSize(initialMaxSize);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
@@ -456,8 +457,10 @@ class CompilerCacheEvictionTestsMockLinux : public CompilerCache {
 
     bool createUniqueTempFileAndWriteData(char *tmpFilePathTemplate, const char *pBinary, size_t binarySize) override {
         createUniqueTempFileAndWriteDataCalled++;
+        writtenData.assign(pBinary, binarySize);
         return createUniqueTempFileAndWriteDataResult;
     }
+    std::string writtenData;
     size_t createUniqueTempFileAndWriteDataCalled = 0u;
     bool createUniqueTempFileAndWriteDataResult = true;
 
@@ -521,6 +524,28 @@ TEST(CompilerCacheTests, GivenCacheDirectoryFilledToTheLimitWhenNewBinaryFitsAft
     EXPECT_EQ(expectedDirectorySize, PWriteCallsCountedAndDirSizeWritten::dirSize);
 }
 
+TEST(CompilerCacheTests, GivenCompressionEnabledWhenCachingBinaryThenCompressedBinaryIsWrittenAndAccountedInDirectorySize) {
+    CompilerCacheConfig config = {true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte};
+    config.compressionEnabled = true;
+    CompilerCacheEvictionTestsMockLinux cache(config);
+
+    cache.lockConfigFileAndReadSizeFd = 1;
+    cache.lockConfigFileAndReadSizeDirSize = 0;
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsStat)> statBackup(&NEO::SysCalls::sysCallsStat, [](const std::string &filePath, struct stat *statbuf) -> int { return -1; });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPwrite)> pWriteBackup(&NEO::SysCalls::sysCallsPwrite, PWriteCallsCountedAndDirSizeWritten::mockPwrite);
+    VariableBackup<decltype(PWriteCallsCountedAndDirSizeWritten::pWriteCalled)> pWriteCalledBackup(&PWriteCallsCountedAndDirSizeWritten::pWriteCalled, 0);
+    VariableBackup<decltype(PWriteCallsCountedAndDirSizeWritten::dirSize)> dirSizeBackup(&PWriteCallsCountedAndDirSizeWritten::dirSize, 0);
+
+    const std::string binary(8192, 'b');
+    EXPECT_TRUE(cache.cacheBinary("7e3291364d8df42", binary.c_str(), binary.size()));
+
+    EXPECT_EQ(1u, cache.createUniqueTempFileAndWriteDataCalled);
+    EXPECT_TRUE(CompressedBinary::isCompressed(ArrayRef<const uint8_t>::fromAny(cache.writtenData.data(), cache.writtenData.size())));
+    EXPECT_LT(cache.writtenData.size(), binary.size());
+    EXPECT_EQ(cache.writtenData.size(), PWriteCallsCountedAndDirSizeWritten::dirSize);
+}
+
 TEST(CompilerCacheTests, GivenCacheBinaryWhenBinaryDoesntFitAfterEvictionThenWriteToConfigAndReturnFalse) {
     const size_t cacheSize = 10;
     CompilerCacheEvictionTestsMockLinux cache({true, ".cl_cache", "/home/cl_cache/", cacheSize});
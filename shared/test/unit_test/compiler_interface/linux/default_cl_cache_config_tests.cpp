@@ -45,6 +45,22 @@ TEST(ClCacheDefaultConfigLinuxTest, GivenAllEnvVarWhenProperlySetThenProperConfi
     EXPECT_EQ(cacheConfig.cacheFileExtension, ApiSpecificConfig::compilerCacheFileExtension().c_str());
     EXPECT_EQ(cacheConfig.cacheSize, 22u);
     EXPECT_EQ(cacheConfig.cacheDir, "ult/directory/");
+    EXPECT_FALSE(cacheConfig.compressionEnabled);
+}
+
+TEST(ClCacheDefaultConfigLinuxTest, GivenCacheCompressionEnvVarSetWhenGetCompilerCacheConfigThenCompressionIsEnabled) {
+    std::unordered_map<std::string, std::string> mockableEnvs;
+    mockableEnvs["NEO_CACHE_PERSISTENT"] = "1";
+    mockableEnvs["NEO_CACHE_DIR"] = "ult/directory/";
+    mockableEnvs["NEO_CACHE_COMPRESSION"] = "1";
+
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&NEO::IoFunctions::mockableEnvValues, &mockableEnvs);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPathExists)> pathExistsBackup(&NEO::SysCalls::sysCallsPathExists, AllVariablesCorrectlySet::pathExistsMock);
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_TRUE(cacheConfig.compressionEnabled);
 }
 
 namespace NonExistingPathIsSet {
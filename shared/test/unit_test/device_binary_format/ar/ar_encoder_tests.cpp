@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/device_binary_format/binary_writer.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/test/common/test_macros/test.h"
@@ -147,3 +149,72 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenFileDataReferencedInsteadOfCopiedWhenEncodingThenOutputIsIdenticalToCopyingEncoder) {
+    const uint8_t data0[4] = "123";
+    const uint8_t data1[7] = "456789";
+    ArEncoder copyingEncoder(true);
+    ArEncoder referencingEncoder(true);
+    referencingEncoder.setCopyFileData(false);
+
+    for (auto encoder : {&copyingEncoder, &referencingEncoder}) {
+        encoder->appendFileEntry("a", data0);
+        encoder->appendFileEntry("b", data1);
+    }
+
+    auto arData = copyingEncoder.encode();
+    EXPECT_EQ(arData.size(), copyingEncoder.getEncodedSize());
+    EXPECT_EQ(arData, referencingEncoder.encode());
+}
+
+TEST(ArEncoder, GivenOutputBufferWhenEncodingThenArIsWrittenOnlyIfBufferIsLargeEnough) {
+    const uint8_t data[5] = "1234";
+    ArEncoder encoder;
+    encoder.appendFileEntry("a", data);
+    auto expected = encoder.encode();
+
+    std::vector<uint8_t> buffer(encoder.getEncodedSize() - 1);
+    EXPECT_FALSE(encoder.encode(ArrayRef<uint8_t>(buffer)));
+
+    buffer.resize(encoder.getEncodedSize());
+    EXPECT_TRUE(encoder.encode(ArrayRef<uint8_t>(buffer)));
+    EXPECT_EQ(expected, buffer);
+}
+
+TEST(ArEncoder, GivenHeaderModifiedAfterAppendingFileEntryWhenEncodingThenModifiedHeaderIsUsed) {
+    const uint8_t data[5] = "1234";
+    ArEncoder encoder;
+    auto header = encoder.appendFileEntry("a", data);
+    for (int i = 0; i < 16; ++i) {
+        encoder.appendFileEntry("b", data);
+    }
+    ASSERT_NE(nullptr, header);
+    header->identifier[0] = 'c';
+
+    auto arData = encoder.encode();
+    auto encodedHeader = reinterpret_cast<ArFileEntryHeader *>(arData.data() + arMagic.size());
+    EXPECT_EQ('c', encodedHeader->identifier[0]);
+}
+
+TEST(ArEncoder, GivenCompressionEnabledWhenAppendingFileEntryThenCompressedContainerIsStoredAndSizeIsUpdated) {
+    std::vector<uint8_t> data(1000, 0x5a);
+    ArEncoder encoder;
+    encoder.setCompressFileData(true);
+    auto header = encoder.appendFileEntry("a", data);
+    ASSERT_NE(nullptr, header);
+    data.assign(data.size(), 0U);
+
+    auto arData = encoder.encode();
+    EXPECT_EQ(encoder.getEncodedSize(), arData.size());
+
+    auto fileSize = std::stoul(std::string(header->fileSizeInBytes, sizeof(header->fileSizeInBytes)));
+    EXPECT_LT(fileSize, data.size());
+    ArrayRef<const uint8_t> fileData(arData.data() + arMagic.size() + sizeof(ArFileEntryHeader), fileSize);
+    ASSERT_TRUE(CompressedBinary::isCompressed(fileData));
+
+    size_t decompressedSize = 0U;
+    ASSERT_TRUE(CompressedBinary::getDecompressedSize(fileData, decompressedSize));
+    std::vector<uint8_t> decompressed(decompressedSize);
+    EXPECT_TRUE(CompressedBinary::decompress(fileData, decompressed));
+    EXPECT_EQ(std::vector<uint8_t>(1000, 0x5a), decompressed);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/binary_writer.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace NEO;
+
+TEST(BufferBinaryWriterTest, GivenDataFittingIntoBufferWhenWritingThenDataIsCopiedSequentially) {
+    std::vector<uint8_t> buffer(8, 0xffU);
+    BufferBinaryWriter writer{ArrayRef<uint8_t>(buffer)};
+    const uint8_t data[3] = {1, 2, 3};
+
+    EXPECT_TRUE(writer.write(ArrayRef<const uint8_t>(data)));
+    EXPECT_TRUE(writer.writeZeros(2));
+    EXPECT_TRUE(writer.write(ArrayRef<const uint8_t>(data)));
+    EXPECT_EQ(8U, writer.getWrittenSize());
+
+    const std::vector<uint8_t> expected = {1, 2, 3, 0, 0, 1, 2, 3};
+    EXPECT_EQ(expected, buffer);
+}
+
+TEST(BufferBinaryWriterTest, GivenDataExceedingBufferWhenWritingThenFailIsReturnedAndBufferIsNotOverrun) {
+    std::vector<uint8_t> storage(8, 0xffU);
+    BufferBinaryWriter writer(ArrayRef<uint8_t>(storage.data(), 4));
+    const uint8_t data[3] = {1, 2, 3};
+
+    EXPECT_TRUE(writer.write(ArrayRef<const uint8_t>(data)));
+    EXPECT_FALSE(writer.write(ArrayRef<const uint8_t>(data)));
+    EXPECT_FALSE(writer.writeZeros(2));
+    EXPECT_EQ(3U, writer.getWrittenSize());
+    EXPECT_EQ(0xffU, storage[3]);
+}
+
+TEST(BinaryWriterTest, GivenZerosLargerThanInternalChunkWhenWritingThenAllZerosAreWritten) {
+    std::vector<uint8_t> buffer(1000, 0xffU);
+    BufferBinaryWriter writer{ArrayRef<uint8_t>(buffer)};
+
+    EXPECT_TRUE(writer.writeZeros(buffer.size()));
+    EXPECT_EQ(buffer.size(), writer.getWrittenSize());
+    EXPECT_EQ(std::vector<uint8_t>(buffer.size(), 0U), buffer);
+}
+
+TEST(FileBinaryWriterTest, GivenOpenedFileWhenWritingThenDataIsStoredInFile) {
+    FILE *file = tmpfile();
+    ASSERT_NE(nullptr, file);
+    const uint8_t data[4] = {4, 5, 6, 7};
+    {
+        FileBinaryWriter writer(file);
+        EXPECT_TRUE(writer.write(ArrayRef<const uint8_t>(data)));
+        EXPECT_TRUE(writer.writeZeros(3));
+        EXPECT_EQ(7U, writer.getWrittenSize());
+    }
+
+    std::vector<uint8_t> readData(8, 0xffU);
+    rewind(file);
+    EXPECT_EQ(7U, fread(readData.data(), 1, readData.size(), file));
+    fclose(file);
+
+    const std::vector<uint8_t> expected = {4, 5, 6, 7, 0, 0, 0, 0xffU};
+    EXPECT_EQ(expected, readData);
+}
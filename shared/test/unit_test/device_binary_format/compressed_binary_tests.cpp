@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/compressed_binary.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createCompressibleData(size_t size) {
+    std::vector<uint8_t> data(size);
+    uint32_t seed = 17U;
+    for (size_t i = 0; i < size; i++) {
+        if ((i / 256) % 2 == 0) {
+            data[i] = static_cast<uint8_t>(i % 13);
+        } else {
+            seed = seed * 1103515245U + 12345U;
+            data[i] = static_cast<uint8_t>(seed >> 16);
+        }
+    }
+    return data;
+}
+} // namespace
+
+TEST(CompressedBinaryTests, givenDataWhenCompressingThenContainerHasValidHeaderAndIsSmallerThanInput) {
+    auto data = createCompressibleData(64 * 1024);
+    auto container = CompressedBinary::compress(data);
+
+    ASSERT_TRUE(CompressedBinary::isCompressed(container));
+    EXPECT_LT(container.size(), data.size());
+
+    CompressedBinary::Header header;
+    memcpy(&header, container.data(), sizeof(header));
+    EXPECT_EQ(CompressedBinary::currentVersion, header.version);
+    EXPECT_EQ(CompressedBinary::Codec::lz, header.codec);
+    EXPECT_EQ(data.size(), header.uncompressedSize);
+    EXPECT_EQ(container.size() - sizeof(CompressedBinary::Header), header.compressedSize);
+    size_t decompressedSize = 0U;
+    EXPECT_TRUE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+    EXPECT_EQ(data.size(), decompressedSize);
+}
+
+TEST(CompressedBinaryTests, givenCompressedDataWhenDecompressingThenOriginalDataIsRestored) {
+    for (auto size : {1U, 4U, 12U, 13U, 300U, 4096U, 70000U, 300000U}) {
+        auto data = createCompressibleData(size);
+        auto container = CompressedBinary::compress(data);
+        size_t decompressedSize = 0U;
+        ASSERT_TRUE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+        ASSERT_EQ(size, decompressedSize);
+
+        std::vector<uint8_t> decompressed(size);
+        EXPECT_TRUE(CompressedBinary::decompress(container, decompressed));
+        EXPECT_EQ(data, decompressed) << size;
+    }
+}
+
+TEST(CompressedBinaryTests, givenEmptyDataWhenCompressingThenEmptyPayloadIsRestoredAfterDecompression) {
+    std::vector<uint8_t> data;
+    auto container = CompressedBinary::compress(data);
+    ASSERT_TRUE(CompressedBinary::isCompressed(container));
+
+    size_t decompressedSize = 1U;
+    ASSERT_TRUE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+    EXPECT_EQ(0U, decompressedSize);
+
+    std::vector<uint8_t> decompressed;
+    EXPECT_TRUE(CompressedBinary::decompress(container, decompressed));
+    EXPECT_TRUE(decompressed.empty());
+
+    auto corrupted = container;
+    corrupted.back() = 0x10;
+    EXPECT_FALSE(CompressedBinary::decompress(corrupted, decompressed));
+}
+
+TEST(CompressedBinaryTests, givenIncompressibleDataWhenCompressingThenDataIsRestoredAfterDecompression) {
+    std::vector<uint8_t> data(10000);
+    uint32_t seed = 1U;
+    for (auto &byte : data) {
+        seed = seed * 1103515245U + 12345U;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+    auto container = CompressedBinary::compress(data);
+
+    std::vector<uint8_t> decompressed(data.size());
+    EXPECT_TRUE(CompressedBinary::decompress(container, decompressed));
+    EXPECT_EQ(data, decompressed);
+}
+
+TEST(CompressedBinaryTests, givenNotCompressedDataThenItIsNotRecognizedAsContainer) {
+    std::vector<uint8_t> elfLike = {0x7f, 'E', 'L', 'F', 0, 0, 0, 0};
+    EXPECT_FALSE(CompressedBinary::isCompressed(elfLike));
+    EXPECT_FALSE(CompressedBinary::isCompressed(ArrayRef<const uint8_t>{}));
+    size_t decompressedSize = 0U;
+    EXPECT_FALSE(CompressedBinary::getDecompressedSize(elfLike, decompressedSize));
+
+    std::vector<uint8_t> magicOnly = {'N', 'E', 'O', 'Z'};
+    EXPECT_FALSE(CompressedBinary::isCompressed(magicOnly));
+}
+
+TEST(CompressedBinaryTests, givenContainerFromNewerVersionOrUnknownCodecThenItIsRejected) {
+    auto data = createCompressibleData(1000);
+    auto container = CompressedBinary::compress(data);
+    auto header = reinterpret_cast<CompressedBinary::Header *>(container.data());
+    std::vector<uint8_t> decompressed(data.size());
+    size_t decompressedSize = 0U;
+
+    header->version = CompressedBinary::currentVersion + 1;
+    EXPECT_FALSE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+    EXPECT_FALSE(CompressedBinary::decompress(container, decompressed));
+
+    header->version = CompressedBinary::currentVersion;
+    header->codec = static_cast<CompressedBinary::Codec>(0xff);
+    EXPECT_FALSE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+    EXPECT_FALSE(CompressedBinary::decompress(container, decompressed));
+}
+
+TEST(CompressedBinaryTests, givenTruncatedOrCorruptedContainerWhenDecompressingThenFailureIsReturned) {
+    auto data = createCompressibleData(5000);
+    auto container = CompressedBinary::compress(data);
+    std::vector<uint8_t> decompressed(data.size());
+
+    auto truncated = container;
+    truncated.resize(truncated.size() - 10);
+    size_t decompressedSize = 0U;
+    EXPECT_FALSE(CompressedBinary::getDecompressedSize(truncated, decompressedSize));
+    EXPECT_FALSE(CompressedBinary::decompress(truncated, decompressed));
+
+    auto corrupted = container;
+    reinterpret_cast<CompressedBinary::Header *>(corrupted.data())->uncompressedSize = data.size() + 100;
+    std::vector<uint8_t> largerOutput(data.size() + 100);
+    EXPECT_FALSE(CompressedBinary::decompress(corrupted, largerOutput));
+
+    corrupted = container;
+    for (size_t i = sizeof(CompressedBinary::Header); i < corrupted.size(); i += 7) {
+        corrupted[i] = 0xff;
+    }
+    CompressedBinary::decompress(corrupted, decompressed);
+}
+
+TEST(CompressedBinaryTests, givenDecompressedSizeAboveMaxExpansionOfPayloadThenContainerIsRejected) {
+    auto data = createCompressibleData(1000);
+    auto container = CompressedBinary::compress(data);
+    auto header = reinterpret_cast<CompressedBinary::Header *>(container.data());
+    size_t decompressedSize = 0U;
+
+    header->uncompressedSize = header->compressedSize * CompressedBinary::lzMaxExpansionRatio;
+    EXPECT_TRUE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+    EXPECT_EQ(header->uncompressedSize, decompressedSize);
+
+    header->uncompressedSize += 1;
+    EXPECT_FALSE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+
+    header->uncompressedSize = 0xffffffffffffull;
+    EXPECT_FALSE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+}
+
+TEST(CompressedBinaryTests, givenLongRunOfRepeatedBytesWhenCompressingThenPayloadStaysWithinMaxExpansionRatio) {
+    std::vector<uint8_t> data(1024 * 1024, 0xab);
+    auto container = CompressedBinary::compress(data);
+    size_t decompressedSize = 0U;
+    EXPECT_TRUE(CompressedBinary::getDecompressedSize(container, decompressedSize));
+
+    std::vector<uint8_t> decompressed(decompressedSize);
+    EXPECT_TRUE(CompressedBinary::decompress(container, decompressed));
+    EXPECT_EQ(data, decompressed);
+}
+
+TEST(CompressedBinaryTests, givenTooSmallOutputBufferWhenDecompressingThenFailureIsReturned) {
+    auto data = createCompressibleData(1000);
+    auto container = CompressedBinary::compress(data);
+
+    std::vector<uint8_t> decompressed(data.size() - 1);
+    EXPECT_FALSE(CompressedBinary::decompress(container, decompressed));
+}
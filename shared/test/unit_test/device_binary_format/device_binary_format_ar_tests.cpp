@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/device_binary_format/ar/ar.h"
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/device_binary_format/compressed_binary.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
@@ -613,3 +614,77 @@ TEST(UnpackSingleDeviceBinaryAr, WhenCouldNotFindBinaryWithRightPointerSizeThenU
     EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
     EXPECT_STREQ("Couldn't find matching binary in AR archive", unpackErrors.c_str());
 }
+
+TEST(UnpackSingleDeviceBinaryAr, GivenCompressedEntriesWhenUnpackingThenDecompressedBinaryAndGenericIrAreUsed) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredStepping = std::to_string(programTokens.header->SteppingId);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    NEO::Ar::ArEncoder encoder{true};
+    encoder.setCompressFileData(true);
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct + "." + requiredStepping, programTokens.storage));
+
+    NEO::Elf::ElfEncoder<NEO::Elf::EI_CLASS_64> elfEncoderIr;
+    elfEncoderIr.getElfFileHeader().type = NEO::Elf::ET_OPENCL_OBJECTS;
+    const std::string customSprivContent{"\x07\x23\x02\x03This is a custom file, with SPIR-V magic!"};
+    elfEncoderIr.appendSection(NEO::Elf::SHT_OPENCL_SPIRV, NEO::Elf::SectionNamesOpenCl::spirvObject, ArrayRef<const uint8_t>::fromAny(customSprivContent.data(), customSprivContent.size()));
+    const auto elfIrData = elfEncoderIr.encode();
+    ASSERT_TRUE(encoder.appendFileEntry("generic_ir", ArrayRef<const uint8_t>(elfIrData)));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = NEO::Ar::decodeAr(arData, decodeErrors, decodeWarnings);
+    for (const auto &file : ar.files) {
+        if (false == file.fileName.startsWith("pad_")) {
+            EXPECT_TRUE(NEO::CompressedBinary::isCompressed(file.fileData)) << file.fileName.str();
+        }
+    }
+
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+
+    ASSERT_EQ(programTokens.storage.size(), unpacked.packedTargetDeviceBinary.size());
+    EXPECT_EQ(0, memcmp(programTokens.storage.data(), unpacked.packedTargetDeviceBinary.begin(), programTokens.storage.size()));
+    EXPECT_FALSE(unpacked.deviceBinary.empty());
+
+    ASSERT_EQ(customSprivContent.size(), unpacked.intermediateRepresentation.size());
+    EXPECT_EQ(0, memcmp(customSprivContent.data(), unpacked.intermediateRepresentation.begin(), customSprivContent.size()));
+    EXPECT_EQ(2U, unpacked.decompressedData.size());
+}
+
+TEST(UnpackSingleDeviceBinaryAr, GivenCorruptedCompressedEntryWhenUnpackingThenEntryIsSkipped) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredStepping = std::to_string(programTokens.header->SteppingId);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    auto compressed = NEO::CompressedBinary::compress(programTokens.storage);
+    auto header = reinterpret_cast<NEO::CompressedBinary::Header *>(compressed.data());
+    header->uncompressedSize += 1;
+
+    NEO::Ar::ArEncoder encoder;
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct + "." + requiredStepping, compressed));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpacked.deviceBinary.empty());
+    EXPECT_TRUE(unpacked.decompressedData.empty());
+    EXPECT_STREQ("Couldn't find matching binary in AR archive", unpackErrors.c_str());
+}
@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/device_binary_format/binary_writer.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/range.h"
@@ -500,3 +501,47 @@ TEST(ElfEncoder, WhenGetSectionHeaderIndexIsCalledThenCorrectSectionIdxIsReturne
     auto &sec1 = elfEncoder64.appendSection(SHT_PROGBITS, "", {});
     EXPECT_EQ(1U, elfEncoder64.getSectionHeaderIndex(sec1));
 }
+
+TEST(ElfEncoder, GivenSectionDataReferencedInsteadOfCopiedWhenEncodingThenOutputIsIdenticalToCopyingEncoder) {
+    const uint8_t textData[13] = "kernel_isa_";
+    const uint8_t segmentData[3] = {1, 2, 3};
+    ElfEncoder<EI_CLASS_64> copyingEncoder;
+    ElfEncoder<EI_CLASS_64> referencingEncoder;
+    referencingEncoder.setCopySectionData(false);
+
+    for (auto encoder : {&copyingEncoder, &referencingEncoder}) {
+        encoder->appendSection(SHT_PROGBITS, ".text", textData);
+        encoder->appendSection(SHT_NOBITS, ".bss", {});
+        encoder->appendSegment(PT_LOAD, segmentData);
+        encoder->appendProgramHeaderLoad(1, 0x1000, sizeof(textData));
+    }
+
+    auto elfData = copyingEncoder.encode();
+    EXPECT_EQ(elfData.size(), copyingEncoder.getEncodedSize());
+    EXPECT_EQ(elfData, referencingEncoder.encode());
+}
+
+TEST(ElfEncoder, GivenOutputBufferWhenEncodingThenElfIsWrittenOnlyIfBufferIsLargeEnough) {
+    const uint8_t textData[8] = "abcdefg";
+    ElfEncoder<EI_CLASS_32> elfEncoder;
+    elfEncoder.appendSection(SHT_PROGBITS, ".text", textData);
+    auto expected = elfEncoder.encode();
+
+    std::vector<uint8_t> buffer(elfEncoder.getEncodedSize() - 1);
+    EXPECT_FALSE(elfEncoder.encode(ArrayRef<uint8_t>(buffer)));
+
+    buffer.resize(elfEncoder.getEncodedSize());
+    EXPECT_TRUE(elfEncoder.encode(ArrayRef<uint8_t>(buffer)));
+    EXPECT_EQ(expected, buffer);
+}
+
+TEST(ElfEncoder, GivenWriterWhenEncodingThenEncodedSizeBytesAreWritten) {
+    const uint8_t textData[8] = "abcdefg";
+    ElfEncoder<EI_CLASS_64> elfEncoder;
+    elfEncoder.appendSection(SHT_PROGBITS, ".text", textData);
+
+    std::vector<uint8_t> buffer(elfEncoder.getEncodedSize() + 16);
+    NEO::BufferBinaryWriter writer{ArrayRef<uint8_t>(buffer)};
+    EXPECT_TRUE(elfEncoder.encode(writer));
+    EXPECT_EQ(elfEncoder.getEncodedSize(), writer.getWrittenSize());
+}
@@ -366,3 +366,129 @@ HWTEST_F(TimestampPacketHelperTests, givenEmptyMultiRootSyncContainerWhenProgram
     TimestampPacketHelper::programCsrDependenciesForForMultiRootDeviceSyncContainer<FamilyType>(cmdStream, deps);
     EXPECT_EQ(cmdStream.getUsed(), 0u);
 }
+
+TEST_F(TimestampPacketTests, givenTagNodeWithPacketsUsedWhenReadingTimestampPacketsThenAllUsedPacketsAreReturnedInOneCall) {
+    TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount> tag;
+    MockTagNode mockNode;
+    mockNode.tagForCpuAccess = &tag;
+    mockNode.setPacketsUsed(3);
+
+    for (uint32_t packetId = 0; packetId < 3; packetId++) {
+        uint32_t values[4] = {10 * packetId + 1, 10 * packetId + 2, 10 * packetId + 3, 10 * packetId + 4};
+        tag.assignDataToAllTimestamps(packetId, values);
+    }
+
+    TimestampPacketValues packets[TimestampPacketConstants::preferredPacketCount];
+    EXPECT_EQ(3u, mockNode.readTimestampPackets(packets, TimestampPacketConstants::preferredPacketCount));
+    for (uint32_t packetId = 0; packetId < 3; packetId++) {
+        EXPECT_EQ(mockNode.getContextStartValue(packetId), packets[packetId].contextStart);
+        EXPECT_EQ(mockNode.getGlobalStartValue(packetId), packets[packetId].globalStart);
+        EXPECT_EQ(mockNode.getContextEndValue(packetId), packets[packetId].contextEnd);
+        EXPECT_EQ(mockNode.getGlobalEndValue(packetId), packets[packetId].globalEnd);
+    }
+
+    EXPECT_EQ(2u, mockNode.readTimestampPackets(packets, 2));
+}
+
+TEST_F(TimestampPacketTests, givenTagNodeWhenGettingTimestampPacketsViewThenValuesAreReadDirectlyFromTagMemory) {
+    TimestampPackets<uint64_t, TimestampPacketConstants::preferredPacketCount> tag;
+    TagNode<TimestampPackets<uint64_t, TimestampPacketConstants::preferredPacketCount>> node;
+    node.tagForCpuAccess = &tag;
+    node.setPacketsUsed(2);
+
+    auto view = node.getTimestampPacketsView();
+    EXPECT_TRUE(view.isValid());
+    EXPECT_EQ(static_cast<const void *>(&tag), view.cpuBase);
+    EXPECT_EQ(2u, view.packetsUsed);
+    EXPECT_EQ(sizeof(uint64_t), view.timestampSize);
+    EXPECT_EQ(node.getSinglePacketSize(), view.packetSize);
+
+    uint64_t values[4] = {0x1'0000'0001, 2, 3, 0x4'0000'0004};
+    tag.assignDataToAllTimestamps(1, values);
+
+    EXPECT_EQ(values[0], view.getContextStartValue(1));
+    EXPECT_EQ(values[1], view.getGlobalStartValue(1));
+    EXPECT_EQ(values[2], view.getContextEndValue(1));
+    EXPECT_EQ(values[3], view.getGlobalEndValue(1));
+    EXPECT_EQ(TimestampPacketConstants::initValue, view.getContextEndValue(0));
+}
+
+TEST_F(TimestampPacketTests, givenMultipleTagNodesWhenReadingNodesThenPacketsOfAllNodesAreAppended) {
+    TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount> tags[2];
+    MockTagNode nodes[2];
+    nodes[0].tagForCpuAccess = &tags[0];
+    nodes[0].setPacketsUsed(2);
+    nodes[1].tagForCpuAccess = &tags[1];
+    nodes[1].setPacketsUsed(1);
+
+    uint32_t values[4] = {5, 6, 7, 8};
+    tags[1].assignDataToAllTimestamps(0, values);
+
+    const TagNodeBase *nodePointers[2] = {&nodes[0], &nodes[1]};
+    std::vector<TimestampPacketValues> output(1);
+
+    EXPECT_EQ(3u, TimestampPacketReadout::readNodes(nodePointers, 2, output));
+    ASSERT_EQ(4u, output.size());
+    EXPECT_EQ(TimestampPacketConstants::initValue, output[1].globalEnd);
+    EXPECT_EQ(5u, output[3].contextStart);
+    EXPECT_EQ(6u, output[3].globalStart);
+    EXPECT_EQ(7u, output[3].contextEnd);
+    EXPECT_EQ(8u, output[3].globalEnd);
+}
+
+TEST(TimestampPacketReadoutTests, givenPacketSetsWhenReadingPacketSetsThenUsedPacketsOfAllSetsAreAppendedInOrder) {
+    struct PacketSet : public TimestampPackets<uint64_t, TimestampPacketConstants::preferredPacketCount> {
+        uint32_t getPacketsUsed() const { return packetsUsed; }
+        uint32_t packetsUsed = 1;
+    };
+    PacketSet packetSets[2];
+    packetSets[0].packetsUsed = 2;
+    packetSets[1].packetsUsed = 1;
+
+    uint64_t values[4] = {5, 6, 7, 8};
+    packetSets[0].assignDataToAllTimestamps(1, values);
+    values[0] = 9;
+    packetSets[1].assignDataToAllTimestamps(0, values);
+
+    std::vector<TimestampPacketValues> output;
+    EXPECT_EQ(3u, TimestampPacketReadout::readPacketSets(packetSets, 2, output));
+    ASSERT_EQ(3u, output.size());
+    EXPECT_EQ(TimestampPacketConstants::initValue, output[0].contextStart);
+    EXPECT_EQ(5u, output[1].contextStart);
+    EXPECT_EQ(8u, output[1].globalEnd);
+    EXPECT_EQ(9u, output[2].contextStart);
+    EXPECT_EQ(6u, output[2].globalStart);
+}
+
+TEST(TimestampPacketReadoutTests, givenPacketValuesWhenUpdatingGlobalBoundaryValuesThenMinimalStartAndMaximalEndAreSelected) {
+    TimestampPacketValues packets[3];
+    packets[0].globalStart = 20;
+    packets[0].globalEnd = 30;
+    packets[1].globalStart = 15;
+    packets[1].globalEnd = 25;
+    packets[2].globalStart = 22;
+    packets[2].globalEnd = 40;
+
+    uint64_t globalStart = 18;
+    uint64_t globalEnd = 35;
+    TimestampPacketReadout::updateGlobalBoundaryValues(packets, 3, globalStart, globalEnd);
+
+    EXPECT_EQ(15u, globalStart);
+    EXPECT_EQ(40u, globalEnd);
+}
+
+TEST(TimestampPacketReadoutTests, givenTicksWhenConvertingToNanosecondsThenResolutionIsApplied) {
+    constexpr size_t count = 37;
+    uint64_t ticks[count];
+    uint64_t nanoseconds[count];
+    for (size_t i = 0; i < count; i++) {
+        ticks[i] = i * 1000;
+    }
+
+    const double resolution = 83.333;
+    TimestampPacketReadout::convertTicksToNanoseconds(ticks, nanoseconds, count, resolution);
+
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(static_cast<uint64_t>(ticks[i] * resolution), nanoseconds[i]);
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/dirty_page_tracker.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+TEST(DirtyPageTrackerTests, givenPageNotUploadedBeforeWhenCheckingThenPageIsDirty) {
+    DirtyPageTracker tracker;
+    std::vector<uint8_t> page(MemoryConstants::pageSize, 0u);
+
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+    EXPECT_EQ(1u, tracker.getTrackedPagesCount());
+    EXPECT_EQ(page.size(), tracker.getStatistics().writtenBytes);
+    EXPECT_EQ(0u, tracker.getStatistics().skippedBytes);
+}
+
+TEST(DirtyPageTrackerTests, givenUploadedPageWhenContentOrEntryBitsChangeThenPageIsDirtyOtherwiseItIsSkipped) {
+    DirtyPageTracker tracker;
+    std::vector<uint8_t> page(MemoryConstants::pageSize, 0u);
+
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+    EXPECT_FALSE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+
+    page[100] = 0xff;
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x3));
+    EXPECT_FALSE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x3));
+    EXPECT_TRUE(tracker.checkAndUpdate(0x2000, page.data(), page.size(), 0x3));
+
+    auto statistics = tracker.resetStatistics();
+    EXPECT_EQ(4 * page.size(), statistics.writtenBytes);
+    EXPECT_EQ(2 * page.size(), statistics.skippedBytes);
+    EXPECT_EQ(0u, tracker.getStatistics().writtenBytes);
+    EXPECT_EQ(0u, tracker.getStatistics().skippedBytes);
+}
+
+TEST(DirtyPageTrackerTests, givenUploadedPageWhenContentIsUpdatedAfterReadBackThenNewContentIsNotDirty) {
+    DirtyPageTracker tracker;
+    std::vector<uint8_t> page(MemoryConstants::pageSize, 0u);
+
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+    page[0] = 0xab;
+    tracker.updateContent(0x1000, page.data(), page.size());
+    EXPECT_FALSE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+
+    tracker.updateContent(0x2000, page.data(), page.size());
+    EXPECT_EQ(1u, tracker.getTrackedPagesCount());
+
+    tracker.clear();
+    EXPECT_EQ(0u, tracker.getTrackedPagesCount());
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+}
+
+TEST(DirtyPageTrackerTests, givenUploadedPageWhenContentIsInvalidatedThenUnchangedContentIsDirtyUntilUploadedOrReadBackAgain) {
+    DirtyPageTracker tracker;
+    std::vector<uint8_t> page(MemoryConstants::pageSize, 0u);
+
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+    tracker.invalidateContent(0x1000);
+    EXPECT_TRUE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+    EXPECT_FALSE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+
+    tracker.invalidateContent(0x1000);
+    tracker.updateContent(0x1000, page.data(), page.size());
+    EXPECT_FALSE(tracker.checkAndUpdate(0x1000, page.data(), page.size(), 0x1));
+
+    tracker.invalidateContent(0x2000);
+    EXPECT_EQ(1u, tracker.getTrackedPagesCount());
+}
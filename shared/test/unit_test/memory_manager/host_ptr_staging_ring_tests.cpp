@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/memory_manager/host_ptr_staging_ring.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/mocks/ult_device_factory.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+using HostPtrStagingRingTest = Test<SVMMemoryAllocatorFixture<false>>;
+
+TEST_F(HostPtrStagingRingTest, givenStagingRingWhenInitializedAndCleanedUpThenHostUsmAllocationIsCreatedAndFreed) {
+    HostPtrStagingRing stagingRing;
+    EXPECT_FALSE(stagingRing.isInitialized());
+    EXPECT_FALSE(stagingRing.canBeStaged(1u));
+
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitfields);
+
+    EXPECT_TRUE(stagingRing.initialize(svmManager.get(), unifiedMemoryProperties, MemoryConstants::pageSize64k, 4u));
+    EXPECT_TRUE(stagingRing.isInitialized());
+    EXPECT_EQ(1u, svmManager->getNumAllocs());
+    EXPECT_EQ(MemoryConstants::pageSize64k, stagingRing.getChunkSize());
+    auto allocation = stagingRing.getAllocation(mockRootDeviceIndex);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(4 * MemoryConstants::pageSize64k, allocation->getUnderlyingBufferSize());
+
+    EXPECT_FALSE(stagingRing.canBeStaged(0u));
+    EXPECT_TRUE(stagingRing.canBeStaged(MemoryConstants::pageSize64k));
+    EXPECT_TRUE(stagingRing.canBeStaged(4 * MemoryConstants::pageSize64k));
+    EXPECT_FALSE(stagingRing.canBeStaged(4 * MemoryConstants::pageSize64k + 1));
+
+    stagingRing.cleanup();
+    EXPECT_FALSE(stagingRing.isInitialized());
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST_F(HostPtrStagingRingTest, givenAllocationFailureWhenInitializingStagingRingThenRingIsNotInitialized) {
+    HostPtrStagingRing stagingRing;
+    FailMemoryManager failMemoryManager(executionEnvironment);
+    MockSVMAllocsManager failSvmManager(&failMemoryManager, false);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitfields);
+
+    EXPECT_FALSE(stagingRing.initialize(&failSvmManager, unifiedMemoryProperties, MemoryConstants::pageSize64k, 4u));
+    EXPECT_FALSE(stagingRing.isInitialized());
+    HostPtrStagingRing::Chunk chunk{};
+    EXPECT_FALSE(stagingRing.acquireChunk(1u, chunk));
+}
+
+TEST_F(HostPtrStagingRingTest, givenStagingRingWhenAcquiringChunksThenConsecutiveChunksAreReturnedUntilRingIsExhausted) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitfields);
+    HostPtrStagingRing stagingRing;
+    ASSERT_TRUE(stagingRing.initialize(svmManager.get(), unifiedMemoryProperties, MemoryConstants::pageSize, 3u));
+    auto ringPtr = stagingRing.getAllocation(mockRootDeviceIndex)->getUnderlyingBuffer();
+
+    HostPtrStagingRing::Chunk chunks[3];
+    for (uint32_t i = 0; i < 3u; i++) {
+        ASSERT_TRUE(stagingRing.acquireChunk(MemoryConstants::pageSize, chunks[i]));
+        EXPECT_EQ(i, chunks[i].index);
+        EXPECT_EQ(ptrOffset(ringPtr, i * MemoryConstants::pageSize), chunks[i].ptr);
+    }
+
+    HostPtrStagingRing::Chunk chunk{};
+    EXPECT_FALSE(stagingRing.acquireChunk(MemoryConstants::pageSize, chunk));
+    EXPECT_FALSE(stagingRing.acquireChunk(MemoryConstants::pageSize + 1, chunk));
+
+    stagingRing.releaseChunk(chunks[1], nullptr, 0u);
+    ASSERT_TRUE(stagingRing.acquireChunk(1u, chunk));
+    EXPECT_EQ(1u, chunk.index);
+
+    stagingRing.cleanup();
+}
+
+TEST_F(HostPtrStagingRingTest, givenChunkReleasedWithPendingTaskCountWhenAcquiringChunkThenItIsReusedOnlyAfterTaskCountCompletes) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitfields);
+    HostPtrStagingRing stagingRing;
+    ASSERT_TRUE(stagingRing.initialize(svmManager.get(), unifiedMemoryProperties, MemoryConstants::pageSize, 2u));
+
+    auto &csr = device->getGpgpuCommandStreamReceiver();
+    *csr.getTagAddress() = 10u;
+
+    HostPtrStagingRing::Chunk chunk0{};
+    HostPtrStagingRing::Chunk chunk1{};
+    ASSERT_TRUE(stagingRing.acquireChunk(1u, chunk0));
+    ASSERT_TRUE(stagingRing.acquireChunk(1u, chunk1));
+    stagingRing.releaseChunk(chunk0, &csr, 11u);
+    stagingRing.releaseChunk(chunk1, &csr, 12u);
+
+    HostPtrStagingRing::Chunk chunk{};
+    EXPECT_FALSE(stagingRing.acquireChunk(1u, chunk));
+
+    *csr.getTagAddress() = 11u;
+    ASSERT_TRUE(stagingRing.acquireChunk(1u, chunk));
+    EXPECT_EQ(chunk0.index, chunk.index);
+    EXPECT_FALSE(stagingRing.acquireChunk(1u, chunk));
+
+    *csr.getTagAddress() = 12u;
+    ASSERT_TRUE(stagingRing.acquireChunk(1u, chunk));
+    EXPECT_EQ(chunk1.index, chunk.index);
+
+    stagingRing.cleanup();
+}
+
+TEST_F(HostPtrStagingRingTest, givenTransferLargerThanChunkWhenAcquiringChunksThenAllRequiredChunksAreAcquiredOrNone) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize2M, rootDeviceIndices, deviceBitfields);
+    HostPtrStagingRing stagingRing;
+    ASSERT_TRUE(stagingRing.initialize(svmManager.get(), unifiedMemoryProperties, MemoryConstants::pageSize, 4u));
+    auto ringPtr = stagingRing.getAllocation(mockRootDeviceIndex)->getUnderlyingBuffer();
+
+    HostPtrStagingRing::Chunks chunks;
+    EXPECT_FALSE(stagingRing.acquireChunks(4 * MemoryConstants::pageSize + 1, chunks));
+    EXPECT_EQ(0u, chunks.size());
+
+    ASSERT_TRUE(stagingRing.acquireChunks(2 * MemoryConstants::pageSize + 1, chunks));
+    ASSERT_EQ(3u, chunks.size());
+    for (uint32_t i = 0; i < 3u; i++) {
+        EXPECT_EQ(i, chunks[i].index);
+        EXPECT_EQ(ptrOffset(ringPtr, i * MemoryConstants::pageSize), chunks[i].ptr);
+    }
+
+    HostPtrStagingRing::Chunks moreChunks;
+    EXPECT_FALSE(stagingRing.acquireChunks(2 * MemoryConstants::pageSize, moreChunks));
+    EXPECT_EQ(0u, moreChunks.size());
+
+    HostPtrStagingRing::Chunk chunk{};
+    ASSERT_TRUE(stagingRing.acquireChunk(1u, chunk));
+    EXPECT_EQ(3u, chunk.index);
+
+    for (auto &acquiredChunk : chunks) {
+        stagingRing.releaseChunk(acquiredChunk, nullptr, 0u);
+    }
+    stagingRing.releaseChunk(chunk, nullptr, 0u);
+    ASSERT_TRUE(stagingRing.acquireChunks(2 * MemoryConstants::pageSize, moreChunks));
+    ASSERT_EQ(2u, moreChunks.size());
+    EXPECT_EQ(0u, moreChunks[0].index);
+    EXPECT_EQ(1u, moreChunks[1].index);
+
+    stagingRing.cleanup();
+}
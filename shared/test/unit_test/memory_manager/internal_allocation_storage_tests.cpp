@@ -15,6 +15,9 @@
 #include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/unit_test/utilities/containers_tests_helpers.h"
 
+#include <chrono>
+#include <thread>
+
 struct InternalAllocationStorageTest : public MemoryAllocatorFixture,
                                        public ::testing::Test {
     void SetUp() override {
@@ -343,3 +346,176 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentTypesAndSizesWhenObtainingAllocationThenSmallestFittingCompletedAllocationOfRequestedTypeIsReturned) {
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 5u;
+
+    auto heap = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize64k, AllocationType::internalHeap, mockDeviceBitfield});
+    auto bigBuffer = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 4 * MemoryConstants::pageSize64k, AllocationType::buffer, mockDeviceBitfield});
+    auto busyBuffer = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize64k, AllocationType::buffer, mockDeviceBitfield});
+    auto smallBuffer = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    auto buffer = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize64k, AllocationType::buffer, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(heap), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(bigBuffer), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyBuffer), REUSABLE_ALLOCATION, 10u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallBuffer), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(buffer), REUSABLE_ALLOCATION, 2u);
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize64k, AllocationType::buffer);
+    EXPECT_EQ(buffer, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize64k, AllocationType::buffer);
+    EXPECT_EQ(bigBuffer, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize64k, AllocationType::buffer);
+    EXPECT_EQ(nullptr, reusedAllocation.get());
+
+    reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::buffer);
+    EXPECT_EQ(smallBuffer, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    reusedAllocation = storage->obtainReusableAllocation(1, AllocationType::internalHeap);
+    EXPECT_EQ(heap, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*busyBuffer));
+    storage->cleanAllocationList(10u, REUSABLE_ALLOCATION);
+}
+
+TEST_F(InternalAllocationStorageTest, givenAllocationsListModifiedDirectlyWhenDetachingAllocationThenOnlyAllocationsStillOnListAreReturned) {
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+
+    reusableAllocations.pushFrontOne(*allocation);
+    reusableAllocations.pushFrontOne(*allocation2);
+    EXPECT_EQ(allocation2, reusableAllocations.peekHead());
+
+    auto removedAllocation = reusableAllocations.removeOne(*allocation2);
+    EXPECT_EQ(nullptr, reusableAllocations.detachAllocation(0, nullptr, nullptr, AllocationType::internalHeap).get());
+
+    auto detachedAllocation = reusableAllocations.detachAllocation(0, nullptr, nullptr, AllocationType::buffer);
+    EXPECT_EQ(allocation, detachedAllocation.get());
+    EXPECT_EQ(nullptr, reusableAllocations.detachAllocation(0, nullptr, nullptr, AllocationType::buffer).get());
+
+    reusableAllocations.pushTailOne(*detachedAllocation.release());
+    reusableAllocations.pushTailOne(*removedAllocation.release());
+    auto nodes = reusableAllocations.detachNodes();
+    EXPECT_EQ(nullptr, reusableAllocations.detachAllocation(0, nullptr, nullptr, AllocationType::buffer).get());
+
+    reusableAllocations.splice(*nodes);
+    EXPECT_EQ(allocation, reusableAllocations.detachAllocation(0, nullptr, nullptr, AllocationType::buffer).release());
+    EXPECT_EQ(allocation2, reusableAllocations.removeFrontOne().release());
+    EXPECT_TRUE(reusableAllocations.peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(allocation);
+    memoryManager->freeGraphicsMemory(allocation2);
+}
+
+TEST_F(InternalAllocationStorageTest, givenMemoryBudgetExhaustedWhenStoringReusableAllocationThenCompletedAllocationsIdleLongerThanThresholdAreFreed) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.ReusableAllocationsIdleTimeToTrim.set(0);
+
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 1u;
+
+    auto completedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 2u);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*completedAllocation));
+
+    memoryManager->memoryBudgetExhausted = true;
+    auto newAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(newAllocation), REUSABLE_ALLOCATION, 2u);
+
+    EXPECT_EQ(busyAllocation, csr->getAllocationsForReuse().peekHead());
+    EXPECT_EQ(newAllocation, csr->getAllocationsForReuse().peekTail());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, AllocationType::buffer));
+
+    storage->cleanAllocationList(2u, REUSABLE_ALLOCATION);
+}
+
+TEST_F(InternalAllocationStorageTest, givenMemoryBudgetExhaustedWhenReusableAllocationsWereNotIdleLongEnoughThenTheyAreNotFreed) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.ReusableAllocationsIdleTimeToTrim.set(100000);
+    memoryManager->memoryBudgetExhausted = true;
+
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 1u;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 1u);
+
+    EXPECT_EQ(0u, storage->freeIdleReusableAllocations());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation));
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation2));
+
+    storage->cleanAllocationList(1u, REUSABLE_ALLOCATION);
+}
+
+HWTEST_F(InternalAllocationStorageTest, givenMultipleActivePartitionsWhenFreeingIdleReusableAllocationsThenTaskCountIsCheckedOnAllTiles) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.ReusableAllocationsIdleTimeToTrim.set(0);
+    auto ultCsr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> *>(csr);
+    csr->setActivePartitions(2u);
+    ultCsr->immWritePostSyncWriteOffset = 32;
+
+    auto tagAddress = csr->getTagAddress();
+    *tagAddress = 0xFF;
+    tagAddress = ptrOffset(tagAddress, 32);
+    *tagAddress = 0x0;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+
+    EXPECT_EQ(0u, storage->freeIdleReusableAllocations());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation));
+
+    *tagAddress = 0x1;
+    EXPECT_EQ(1u, storage->freeIdleReusableAllocations());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationWithHostPtrTaskCountAssignedWhenFreeingIdleReusableAllocationsThenItIsNotFreed) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.ReusableAllocationsIdleTimeToTrim.set(0);
+    *csr->getTagAddress() = 1u;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    allocation->hostPtrTaskCountAssignment = 1;
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+
+    EXPECT_EQ(0u, storage->freeIdleReusableAllocations());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation));
+
+    allocation->hostPtrTaskCountAssignment = 0;
+    EXPECT_EQ(1u, storage->freeIdleReusableAllocations());
+}
+
+TEST_F(InternalAllocationStorageTest, givenBusyReusableAllocationWhenCleaningAllocationListThenItKeepsItsPlaceAndStoreTime) {
+    DebugManagerStateRestore stateRestorer;
+    debugManager.flags.ReusableAllocationsIdleTimeToTrim.set(50);
+    *csr->getTagAddress() = 1u;
+
+    auto completedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    auto busyAllocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::buffer, mockDeviceBitfield});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 2u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation2), REUSABLE_ALLOCATION, 2u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    storage->cleanAllocationList(1u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(-1, verifyDListOrder(csr->getAllocationsForReuse().peekHead(), busyAllocation, busyAllocation2));
+
+    *csr->getTagAddress() = 2u;
+    EXPECT_EQ(2u, storage->freeIdleReusableAllocations());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "gtest/gtest.h"
 
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -291,6 +292,78 @@ TEST_F(PageTableTests48, givenEntryBitsWhenPageWalkIsCalledThenEntryBitsArePasse
     EXPECT_EQ(ppgttBits, entryBitsPassed);
 }
 
+TEST_F(PageTableTests48, givenVisitorWhenPageWalkWithVisitorIsCalledThenSamePagesAreVisitedAsInPageWalk) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr + (510 * pageSize) + 0x10;
+    size_t size = 8 * pageSize;
+
+    std::vector<PageWalkChunk> walkerPages;
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        walkerPages.push_back({physAddress, size, offset, entryBits});
+    };
+    pageTable->pageWalk(gpuVa, size, 0, 0, walker, MemoryBanks::mainBank);
+
+    std::vector<PageWalkChunk> visitorPages;
+    auto visitor = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        visitorPages.push_back({physAddress, size, offset, entryBits});
+    };
+    pageTable->pageWalkWithVisitor(gpuVa, size, 0, 0, visitor, MemoryBanks::mainBank);
+
+    ASSERT_EQ(walkerPages.size(), visitorPages.size());
+    for (size_t i = 0; i < walkerPages.size(); i++) {
+        EXPECT_EQ(walkerPages[i].physAddress, visitorPages[i].physAddress);
+        EXPECT_EQ(walkerPages[i].size, visitorPages[i].size);
+        EXPECT_EQ(walkerPages[i].offset, visitorPages[i].offset);
+        EXPECT_EQ(walkerPages[i].entryBits, visitorPages[i].entryBits);
+    }
+}
+
+TEST_F(PageTableTests48, givenPhysicallyContiguousPagesWhenWalkingWithChunkCoalescerThenSingleChunkIsReported) {
+    std::unique_ptr<PPGTTPageTable> pageTable(new PPGTTPageTable(&allocator));
+    uintptr_t gpuVa = refAddr + (510 * pageSize) + 0x10;
+    size_t size = 8 * pageSize;
+
+    std::vector<PageWalkChunk> chunks;
+    auto chunkVisitor = [&](const PageWalkChunk &chunk) {
+        chunks.push_back(chunk);
+    };
+    PageWalkChunkCoalescer<decltype(chunkVisitor)> coalescer(chunkVisitor);
+    pageTable->pageWalkWithVisitor(gpuVa, size, 0, 0, coalescer, MemoryBanks::mainBank);
+    coalescer.flush();
+
+    ASSERT_EQ(1u, chunks.size());
+    EXPECT_EQ(size, chunks[0].size);
+    EXPECT_EQ(0u, chunks[0].offset);
+    EXPECT_EQ(0x10u, chunks[0].physAddress & (pageSize - 1));
+}
+
+TEST_F(PageTableTests48, givenNonContiguousPagesOrDifferentEntryBitsWhenCoalescingThenChunksAreSplit) {
+    std::vector<PageWalkChunk> chunks;
+    auto chunkVisitor = [&](const PageWalkChunk &chunk) {
+        chunks.push_back(chunk);
+    };
+    PageWalkChunkCoalescer<decltype(chunkVisitor)> coalescer(chunkVisitor);
+
+    coalescer(0x10000, pageSize, 0, 0x1);
+    coalescer(0x11000, pageSize, pageSize, 0x1);
+    coalescer(0x20000, pageSize, 2 * pageSize, 0x1);
+    coalescer(0x21000, pageSize, 3 * pageSize, 0x3);
+    coalescer(0x22000, pageSize, 5 * pageSize, 0x3);
+    EXPECT_EQ(3u, chunks.size());
+    coalescer.flush();
+    coalescer.flush();
+
+    ASSERT_EQ(4u, chunks.size());
+    EXPECT_EQ(0x10000u, chunks[0].physAddress);
+    EXPECT_EQ(2 * pageSize, chunks[0].size);
+    EXPECT_EQ(0x20000u, chunks[1].physAddress);
+    EXPECT_EQ(pageSize, chunks[1].size);
+    EXPECT_EQ(0x21000u, chunks[2].physAddress);
+    EXPECT_EQ(0x3u, chunks[2].entryBits);
+    EXPECT_EQ(0x22000u, chunks[3].physAddress);
+    EXPECT_EQ(5 * pageSize, chunks[3].offset);
+}
+
 TEST_F(PageTableTests48, givenTwoPageWalksWhenSecondWalkHasDifferentEntryBitsThenEntryIsUpdated) {
     std::unique_ptr<std::conditional<is64bit, MockPML4, MockPDPE>::type>
         pageTable(std::make_unique<std::conditional<is64bit, MockPML4, MockPDPE>::type>(&allocator));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -86,3 +86,92 @@ TEST(PrefetchManagerTests, givenPrefetchManagerWhenCallingMigrateAllocationsToGp
     EXPECT_TRUE(prefetchManager->migrateAllocationsToGpuCalled);
     EXPECT_FALSE(svmManager->prefetchMemoryCalled);
 }
+
+TEST(PrefetchManagerTests, givenKernelLaunchedForFirstTimeWhenLearningAccessesThenBoundAllocationsArePrefetchedOnceAndAllAccessesAreMisses) {
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+    int kernelId = 0;
+    int allocations[2] = {};
+
+    prefetchManager->learnKernelAccesses(prefetchContext, &kernelId, {&allocations[0], &allocations[1], &allocations[0]});
+
+    ASSERT_EQ(2u, prefetchContext.allocations.size());
+    EXPECT_EQ(&allocations[0], prefetchContext.allocations[0]);
+    EXPECT_EQ(&allocations[1], prefetchContext.allocations[1]);
+    EXPECT_EQ(0u, prefetchContext.statistics.hits);
+    EXPECT_EQ(2u, prefetchContext.statistics.misses);
+    EXPECT_EQ(&kernelId, prefetchContext.lastKernelId);
+}
+
+TEST(PrefetchManagerTests, givenKernelLaunchedAgainWhenLearningAccessesThenAllocationsBoundToCurrentLaunchArePrefetchedAndAlreadyPrefetchedOnesAreCountedAsHits) {
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+    int kernelId = 0;
+    int allocations[3] = {};
+
+    prefetchManager->learnKernelAccesses(prefetchContext, &kernelId, {&allocations[0], &allocations[1]});
+    prefetchManager->learnKernelAccesses(prefetchContext, &kernelId, {&allocations[0], &allocations[2]});
+
+    ASSERT_EQ(3u, prefetchContext.allocations.size());
+    EXPECT_EQ(&allocations[0], prefetchContext.allocations[0]);
+    EXPECT_EQ(&allocations[1], prefetchContext.allocations[1]);
+    EXPECT_EQ(&allocations[2], prefetchContext.allocations[2]);
+    EXPECT_EQ(1u, prefetchContext.statistics.hits);
+    EXPECT_EQ(3u, prefetchContext.statistics.misses);
+
+    auto &history = prefetchManager->kernelAccessHistory[&kernelId];
+    EXPECT_EQ(2u, history.allocations.size());
+    EXPECT_EQ(0u, history.allocations.count(&allocations[1]));
+
+    prefetchManager->removeAllocations(prefetchContext);
+    EXPECT_TRUE(prefetchContext.learnedAllocations.empty());
+    prefetchManager->learnKernelAccesses(prefetchContext, &kernelId, {&allocations[2]});
+
+    ASSERT_EQ(1u, prefetchContext.allocations.size());
+    EXPECT_EQ(&allocations[2], prefetchContext.allocations[0]);
+    EXPECT_EQ(2u, prefetchContext.statistics.hits);
+}
+
+TEST(PrefetchManagerTests, givenKernelSequenceLaunchedBeforeWhenFirstKernelIsLaunchedAgainThenAllocationsOfNextExpectedKernelArePrefetchedAhead) {
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext firstContext;
+    int kernelIds[2] = {};
+    int allocations[3] = {};
+
+    prefetchManager->learnKernelAccesses(firstContext, &kernelIds[0], {&allocations[0]});
+    prefetchManager->learnKernelAccesses(firstContext, &kernelIds[1], {&allocations[1]});
+    EXPECT_EQ(&kernelIds[1], prefetchManager->kernelAccessHistory[&kernelIds[0]].nextKernelId);
+    EXPECT_EQ(nullptr, prefetchManager->kernelAccessHistory[&kernelIds[1]].nextKernelId);
+
+    PrefetchContext secondContext;
+    prefetchManager->learnKernelAccesses(secondContext, &kernelIds[0], {&allocations[2]});
+
+    ASSERT_EQ(2u, secondContext.allocations.size());
+    EXPECT_EQ(&allocations[2], secondContext.allocations[0]);
+    EXPECT_EQ(&allocations[1], secondContext.allocations[1]);
+    EXPECT_EQ(0u, secondContext.statistics.hits);
+    EXPECT_EQ(1u, secondContext.statistics.misses);
+
+    prefetchManager->learnKernelAccesses(secondContext, &kernelIds[1], {&allocations[1]});
+    EXPECT_EQ(2u, secondContext.allocations.size());
+    EXPECT_EQ(1u, secondContext.statistics.hits);
+    EXPECT_EQ(1u, secondContext.statistics.misses);
+}
+
+TEST(PrefetchManagerTests, givenKernelAccessesRemovedWhenPreviousKernelIsLaunchedAgainThenRemovedKernelIsNotPredicted) {
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+    int kernelIds[2] = {};
+    int allocations[2] = {};
+
+    prefetchManager->learnKernelAccesses(prefetchContext, &kernelIds[0], {&allocations[0]});
+    prefetchManager->learnKernelAccesses(prefetchContext, &kernelIds[1], {&allocations[1]});
+    prefetchManager->removeKernelAccesses(&kernelIds[1]);
+    EXPECT_EQ(1u, prefetchManager->kernelAccessHistory.size());
+    EXPECT_EQ(nullptr, prefetchManager->kernelAccessHistory[&kernelIds[0]].nextKernelId);
+
+    prefetchManager->removeAllocations(prefetchContext);
+    prefetchManager->learnKernelAccesses(prefetchContext, &kernelIds[0], {&allocations[0]});
+    ASSERT_EQ(1u, prefetchContext.allocations.size());
+    EXPECT_EQ(&allocations[0], prefetchContext.allocations[0]);
+}
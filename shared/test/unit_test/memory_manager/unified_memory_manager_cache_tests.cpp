@@ -819,12 +819,17 @@ TEST_F(SvmHostAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         allocWriteCombined(defaultAllocSize,
                            rootDeviceIndices,
                            subDeviceBitfields,
-                           rootDevice, "allocWriteCombined");
+                           rootDevice, "allocWriteCombined"),
+        numaNodeRequested(defaultAllocSize,
+                          rootDeviceIndices,
+                          subDeviceBitfields,
+                          rootDevice, "numaNodeRequested");
     writeOnly.unifiedMemoryProperties.allocationFlags.flags.writeOnly = true;
     readOnly.unifiedMemoryProperties.allocationFlags.flags.readOnly = true;
     allocWriteCombined.unifiedMemoryProperties.allocationFlags.allocFlags.allocWriteCombined = true;
+    numaNodeRequested.unifiedMemoryProperties.allocationFlags.numaNode = 1;
 
-    auto testDataset = std::vector<SvmHostAllocationCacheTestDataType>({defaultAlloc, writeOnly, readOnly, allocWriteCombined});
+    auto testDataset = std::vector<SvmHostAllocationCacheTestDataType>({defaultAlloc, writeOnly, readOnly, allocWriteCombined, numaNodeRequested});
     for (auto &allocationDataToVerify : testDataset) {
 
         for (auto &testData : testDataset) {
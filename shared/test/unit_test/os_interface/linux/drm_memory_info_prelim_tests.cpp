@@ -19,6 +19,8 @@
 
 #include "gtest/gtest.h"
 
+#include <linux/mempolicy.h>
+
 using namespace NEO;
 
 TEST(MemoryInfoPrelim, givenMemoryRegionQueryNotSupportedWhenQueryingMemoryInfoThenMemoryInfoIsNotCreated) {
@@ -563,6 +565,31 @@ TEST(MemoryInfo, givenMemoryInfoWithMemoryPolicyEnabledWhenCallingCreateGemExtFo
     WhiteBoxNumaLibrary::osLibrary.reset();
 }
 
+TEST(MemoryInfo, givenNumaNodeWhenCallingCreateGemExtWithNumaNodeThenSystemMemoryIsCreatedWithPreferredNodePolicy) {
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[0].probedSize = 8 * MemoryConstants::gigaByte;
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+    regionInfo[1].probedSize = 16 * MemoryConstants::gigaByte;
+
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = std::make_unique<DrmQueryMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto memoryInfo = std::make_unique<MemoryInfo>(regionInfo, *drm);
+
+    uint32_t handle = 0;
+    auto ret = memoryInfo->createGemExtWithNumaNode(1024, handle, 0, 1);
+    EXPECT_EQ(1u, handle);
+    EXPECT_EQ(0, ret);
+    ASSERT_TRUE(drm->context.receivedCreateGemExt);
+    EXPECT_EQ(1024u, drm->context.receivedCreateGemExt->size);
+    ASSERT_EQ(1u, drm->context.receivedCreateGemExt->memoryRegions.size());
+    EXPECT_EQ(drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, drm->context.receivedCreateGemExt->memoryRegions[0].memoryClass);
+    EXPECT_EQ(static_cast<uint32_t>(MPOL_PREFERRED), drm->context.receivedCreateGemExt->memPolicyExt.mode);
+    ASSERT_EQ(2u, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value().size());
+    EXPECT_EQ(0b10ul, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value()[0]);
+    EXPECT_EQ(0ul, drm->context.receivedCreateGemExt->memPolicyExt.nodeMask.value()[1]);
+}
+
 TEST(MemoryInfo, givenMemoryInfoWithMemoryPolicyEnabledAndOverrideMemoryPolicyModeWhenCallingCreateGemExtForHostAllocationThenIoctlIsCalledWithMemoryPolicy) {
     DebugManagerStateRestore restorer;
     debugManager.flags.EnableHostAllocationMemPolicy.set(1);
@@ -28,6 +28,8 @@
 
 #include "gtest/gtest.h"
 
+#include <linux/mempolicy.h>
+
 TEST_F(DrmMemoryManagerLocalMemoryWithCustomPrelimMockTest, givenDrmMemoryManagerWithLocalMemoryWhenLockResourceIsCalledOnBufferObjectThenReturnPtr) {
     BufferObject bo(0, mock, 3, 1, 1024, 1);
 
@@ -63,7 +65,8 @@ TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenDrmMemoryManagerWithPrelimSup
                                                                                             1,
                                                                                             -1,
                                                                                             false,
-                                                                                            false));
+                                                                                            false,
+                                                                                            -1));
     ASSERT_NE(nullptr, bo);
 
     EXPECT_EQ(1u, mock->ioctlCallsCount);
@@ -1429,6 +1432,91 @@ TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenMemoryInfoWhenAllocateWithAli
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenMemoryInfoAndNumaNodeRequestedWhenAllocateWithAlignmentThenGemCreateExtIsUsedWithPreferredNodePolicy) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBOMmapCreate.set(-1);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, DrmMockHelper::getEngineOrMemoryInstanceValue(0, 0)};
+
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+    mock->queryEngineInfo();
+    EXPECT_TRUE(memoryManager->isHostNumaNodeSelectionSupported(rootDeviceIndex));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.numaNode = 1;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(allocation, nullptr);
+    EXPECT_NE(allocation->getMmapPtr(), nullptr);
+
+    auto &memPolicy = mock->context.receivedCreateGemExt.value().memPolicyExt;
+    EXPECT_EQ(static_cast<uint32_t>(MPOL_PREFERRED), memPolicy.mode);
+    ASSERT_EQ(2u, memPolicy.nodeMask.value().size());
+    EXPECT_EQ(0b10ul, memPolicy.nodeMask.value()[0]);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenMemoryInfoAndNoNumaNodeRequestedWhenAllocateWithAlignmentThenDeviceNumaNodeIsPreferred) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBOMmapCreate.set(-1);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, DrmMockHelper::getEngineOrMemoryInstanceValue(0, 0)};
+
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+    mock->queryEngineInfo();
+    memoryManager->deviceNumaNodes.resize(rootDeviceIndex + 1, -1);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(allocation, nullptr);
+    EXPECT_NE(allocation->getMmapPtr(), nullptr);
+
+    auto &memPolicy = mock->context.receivedCreateGemExt.value().memPolicyExt;
+    EXPECT_EQ(static_cast<uint32_t>(MPOL_PREFERRED), memPolicy.mode);
+    ASSERT_EQ(2u, memPolicy.nodeMask.value().size());
+    EXPECT_EQ(0b10ul, memPolicy.nodeMask.value()[0]);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenGemCreateOnDeviceNumaNodeFailingWhenAllocateWithAlignmentWithoutRequestedNodeThenAllocationIsCreatedWithoutNodePolicy) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBOMmapCreate.set(-1);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, DrmMockHelper::getEngineOrMemoryInstanceValue(0, 0)};
+
+    auto memoryInfo = new MockedMemoryInfo(regionInfo, *mock);
+    memoryInfo->failOnCreateGemExtWithNumaNode = true;
+    mock->memoryInfo.reset(memoryInfo);
+    memoryManager->deviceNumaNodes.resize(rootDeviceIndex + 1, -1);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(allocation, nullptr);
+    EXPECT_EQ(1u, memoryInfo->createGemExtWithNumaNodeCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocationData.numaNode = 1;
+    EXPECT_EQ(nullptr, memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    EXPECT_EQ(2u, memoryInfo->createGemExtWithNumaNodeCalled);
+}
+
 static uint32_t munmapCalledCount = 0u;
 
 TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenAlignmentAndSizeWhenMmapReturnsUnalignedPointerThenCreateAllocWithAlignmentUnmapTwoUnalignedPart) {
@@ -1986,7 +2074,8 @@ TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenPrintBOCreateDestroyResultFla
                                                                                             1,
                                                                                             -1,
                                                                                             false,
-                                                                                            false));
+                                                                                            false,
+                                                                                            -1));
     EXPECT_NE(nullptr, bo);
 
     std::string output = testing::internal::GetCapturedStdout();
@@ -128,7 +128,8 @@ HWTEST2_F(DrmMemoryManagerLocalMemoryTest, givenDrmMemoryManagerWhenCreateBuffer
                                                                                             1,
                                                                                             -1,
                                                                                             false,
-                                                                                            false));
+                                                                                            false,
+                                                                                            -1));
     ASSERT_NE(nullptr, bo);
     EXPECT_EQ(1u, mock->ioctlCallsCount);
     EXPECT_EQ(1u, mock->createExt.handle);
@@ -349,6 +350,26 @@ HWTEST2_F(DrmMemoryManagerLocalMemoryTest, givenMemoryInfoWhenAllocateWithAlignm
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenMemoryInfoWithoutGemCreateMemoryPolicyWhenAllocateWithAlignmentOnRequestedNumaNodeThenAllocationFails) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBOMmapCreate.set(-1);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+    mock->ioctlCallsCount = 0;
+    EXPECT_FALSE(memoryManager->isHostNumaNodeSelectionSupported(rootDeviceIndex));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.numaNode = 1;
+
+    EXPECT_EQ(nullptr, memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    EXPECT_EQ(0u, mock->ioctlCallsCount);
+}
+
 TEST_F(DrmMemoryManagerLocalMemoryTest, givenMemoryInfoAndNotUseObjectMmapPropertyWhenAllocateWithAlignmentThenUserptrIsUsed) {
     DebugManagerStateRestore restorer;
     debugManager.flags.EnableBOMmapCreate.set(0);
@@ -372,6 +393,31 @@ TEST_F(DrmMemoryManagerLocalMemoryTest, givenMemoryInfoAndNotUseObjectMmapProper
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenMemoryInfoAndHugePagesEnabledWhenAllocateWithAlignmentAboveThresholdThenUserptrBackedWithHugePagesIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBOMmapCreate.set(-1);
+    debugManager.flags.EnableHostAllocationHugePages.set(1);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+    mock->mmapOffsetRetVal = -1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize2M;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(allocation, nullptr);
+    EXPECT_EQ(nullptr, allocation->getMmapPtr());
+    EXPECT_EQ(static_cast<int>(mock->returnHandle), allocation->getBO()->peekHandle() + 1);
+    EXPECT_TRUE(isAligned(allocation->getUnderlyingBuffer(), MemoryConstants::pageSize2M));
+    EXPECT_EQ(1u, memoryManager->hugePagesStatistics.transparentAllocations.load());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryManagerLocalMemoryTest, givenMemoryInfoAndFailedMmapOffsetWhenAllocateWithAlignmentThenNullptr) {
     DebugManagerStateRestore restorer;
     debugManager.flags.EnableBOMmapCreate.set(-1);
@@ -450,7 +496,7 @@ class DrmMemoryManagerLocalMemoryMemoryBankMock : public TestedDrmMemoryManager
                                                    uint32_t memoryBanks,
                                                    size_t maxOsContextCount,
                                                    int32_t pairHandle,
-                                                   bool isSystemMemoryPool, bool isUSMHostAllocation) override {
+                                                   bool isSystemMemoryPool, bool isUSMHostAllocation, int32_t numaNode) override {
         memoryBankIsOne = (memoryBanks == 1) ? true : false;
         return nullptr;
     }
@@ -40,7 +40,9 @@
 #include "gtest/gtest.h"
 
 #include <array>
+#include <climits>
 #include <fcntl.h>
+#include <linux/mempolicy.h>
 #include <memory>
 #include <vector>
 
@@ -2861,6 +2863,349 @@ TEST_F(DrmMemoryManagerUSMHostAllocationTests,
     alignedFree(hostPtr);
 }
 
+struct MbindCapture {
+    void *addr = nullptr;
+    unsigned long len = 0;
+    int mode = -1;
+    std::vector<unsigned long> nodeMask;
+    unsigned long maxNode = 0;
+    unsigned int flags = 0;
+};
+
+static MbindCapture mbindCapture;
+
+static long mockMbind(void *addr, unsigned long len, int mode, const unsigned long *nodeMask, unsigned long maxNode, unsigned int flags) {
+    mbindCapture.addr = addr;
+    mbindCapture.len = len;
+    mbindCapture.mode = mode;
+    mbindCapture.nodeMask.assign(nodeMask, nodeMask + maxNode / (sizeof(unsigned long) * CHAR_BIT));
+    mbindCapture.maxNode = maxNode;
+    mbindCapture.flags = flags;
+    return 0;
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenDeviceNumaNodeWhenAllocatingHostMemoryWithAlignmentThenMemoryPrefersDeviceNumaNodeBeforeItIsTouched) {
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    mbindCapture = {};
+    VariableBackup<int> mbindCalledBackup(&SysCalls::mbindCalled, 0);
+    VariableBackup<decltype(SysCalls::sysCallsMbind)> mbindBackup(&SysCalls::sysCallsMbind, mockMbind);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    AllocationData allocationData;
+    allocationData.size = 16384;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(1, SysCalls::mbindCalled);
+    EXPECT_EQ(alloc->getUnderlyingBuffer(), mbindCapture.addr);
+    EXPECT_EQ(alloc->getUnderlyingBufferSize(), mbindCapture.len);
+    EXPECT_EQ(MPOL_PREFERRED, mbindCapture.mode);
+    ASSERT_EQ(1u, mbindCapture.nodeMask.size());
+    EXPECT_EQ(0b10ul, mbindCapture.nodeMask[0]);
+    EXPECT_EQ(sizeof(unsigned long) * CHAR_BIT + 1, mbindCapture.maxNode);
+    EXPECT_EQ(0u, mbindCapture.flags);
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenNumaNodeRequestedByAllocationWhenAllocatingHostMemoryWithAlignmentThenRequestedNodeIsUsed) {
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    mbindCapture = {};
+    VariableBackup<int> mbindCalledBackup(&SysCalls::mbindCalled, 0);
+    VariableBackup<decltype(SysCalls::sysCallsMbind)> mbindBackup(&SysCalls::sysCallsMbind, mockMbind);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 0;
+
+    constexpr int32_t requestedNode = sizeof(unsigned long) * CHAR_BIT + 2;
+    AllocationData allocationData;
+    allocationData.size = 16384;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.numaNode = requestedNode;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(1, SysCalls::mbindCalled);
+    ASSERT_EQ(2u, mbindCapture.nodeMask.size());
+    EXPECT_EQ(0u, mbindCapture.nodeMask[0]);
+    EXPECT_EQ(0b100ul, mbindCapture.nodeMask[1]);
+    EXPECT_EQ(2 * sizeof(unsigned long) * CHAR_BIT + 1, mbindCapture.maxNode);
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenNumaNodeOverrideAndPageMigrationEnabledWhenAllocatingHostMemoryWithAlignmentThenOverriddenNodeIsUsedAndPagesAreMoved) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.OverrideHostAllocationNumaNode.set(3);
+    debugManager.flags.EnableHostAllocationNumaPageMigration.set(1);
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    mbindCapture = {};
+    VariableBackup<int> mbindCalledBackup(&SysCalls::mbindCalled, 0);
+    VariableBackup<decltype(SysCalls::sysCallsMbind)> mbindBackup(&SysCalls::sysCallsMbind, mockMbind);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    AllocationData allocationData;
+    allocationData.size = 16384;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.numaNode = 2;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(1, SysCalls::mbindCalled);
+    ASSERT_EQ(1u, mbindCapture.nodeMask.size());
+    EXPECT_EQ(0b1000ul, mbindCapture.nodeMask[0]);
+    EXPECT_EQ(static_cast<unsigned int>(MPOL_MF_MOVE), mbindCapture.flags);
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenUnknownDeviceNumaNodeOrNumaPlacementDisabledWhenAllocatingHostMemoryWithAlignmentThenNumaPolicyIsNotApplied) {
+    DebugManagerStateRestore restorer;
+    mock->ioctlExpected.gemUserptr = 2;
+    mock->ioctlExpected.gemClose = 2;
+    VariableBackup<int> mbindCalledBackup(&SysCalls::mbindCalled, 0);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = -1;
+
+    AllocationData allocationData;
+    allocationData.size = 16384;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(0, SysCalls::mbindCalled);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+
+    debugManager.flags.EnableHostAllocationNumaPlacement.set(0);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+    allocationData.numaNode = 1;
+    alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(0, SysCalls::mbindCalled);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenExistingHostPointerWhenAllocatingUsmHostMemoryThenNumaPolicyIsAppliedOnlyForRequestedNode) {
+    mock->ioctlExpected.gemUserptr = 2;
+    mock->ioctlExpected.gemClose = 2;
+    mbindCapture = {};
+    VariableBackup<int> mbindCalledBackup(&SysCalls::mbindCalled, 0);
+    VariableBackup<decltype(SysCalls::sysCallsMbind)> mbindBackup(&SysCalls::sysCallsMbind, mockMbind);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    size_t allocSize = 16384;
+    void *hostPtr = alignedMalloc(allocSize + MemoryConstants::pageSize, MemoryConstants::pageSize);
+    void *unalignedHostPtr = ptrOffset(hostPtr, 64);
+
+    AllocationData allocationData;
+    allocationData.size = allocSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    allocationData.hostPtr = unalignedHostPtr;
+    auto alloc = memoryManager->allocateGraphicsMemory(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(0, SysCalls::mbindCalled);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+
+    allocationData.numaNode = 0;
+    alloc = memoryManager->allocateGraphicsMemory(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(1, SysCalls::mbindCalled);
+    EXPECT_EQ(hostPtr, mbindCapture.addr);
+    EXPECT_EQ(allocSize + MemoryConstants::pageSize, mbindCapture.len);
+    ASSERT_EQ(1u, mbindCapture.nodeMask.size());
+    EXPECT_EQ(0b1ul, mbindCapture.nodeMask[0]);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+
+    alignedFree(hostPtr);
+}
+
+struct MadviseCapture {
+    void *addr = nullptr;
+    size_t size = 0;
+    int advice = -1;
+};
+
+static MadviseCapture madviseCapture;
+
+static int mockMadvise(void *addr, size_t size, int advice) {
+    madviseCapture.addr = addr;
+    madviseCapture.size = size;
+    madviseCapture.advice = advice;
+    return 0;
+}
+
+static std::vector<int> mmapFlagsCaptured;
+
+static void *mockMmapFailingHugetlb(void *addr, size_t size, int prot, int flags, int fd, off_t off) noexcept {
+    mmapFlagsCaptured.push_back(flags);
+    if (flags & MAP_HUGETLB) {
+        return MAP_FAILED;
+    }
+    return SysCalls::mmap(addr, size, prot, flags, fd, off);
+}
+
+static void *mockMmapCapturingFlags(void *addr, size_t size, int prot, int flags, int fd, off_t off) noexcept {
+    mmapFlagsCaptured.push_back(flags);
+    return SysCalls::mmap(addr, size, prot, flags, fd, off);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenTransparentHugePagesEnabledWhenAllocatingHostMemoryAboveThresholdThenHugePageAlignedMappingIsAdvisedAndUnmappedOnFree) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePages.set(1);
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    madviseCapture = {};
+    VariableBackup<int> madviseCalledBackup(&SysCalls::madviseCalled, 0);
+    VariableBackup<decltype(SysCalls::sysCallsMadvise)> madviseBackup(&SysCalls::sysCallsMadvise, mockMadvise);
+    VariableBackup<uint32_t> mmapBackup(&SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<uint32_t> munmapBackup(&SysCalls::munmapFuncCalled, 0u);
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize2M;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.zeroMemory = true;
+    auto alloc = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(1u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1, SysCalls::madviseCalled);
+    EXPECT_EQ(alloc->getUnderlyingBuffer(), madviseCapture.addr);
+    EXPECT_TRUE(isAligned(madviseCapture.addr, MemoryConstants::pageSize2M));
+    EXPECT_EQ(MemoryConstants::pageSize2M, madviseCapture.size);
+    EXPECT_EQ(MADV_HUGEPAGE, madviseCapture.advice);
+    EXPECT_EQ(nullptr, alloc->getDriverAllocatedCpuPtr());
+    EXPECT_EQ(1u, memoryManager->hugePagesStatistics.transparentAllocations.load());
+    EXPECT_EQ(MemoryConstants::pageSize2M, memoryManager->hugePagesStatistics.transparentBytes.load());
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenHugePagesEnabledWhenAllocatingHostMemoryBelowThresholdThenRegularPagesAreUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePages.set(2);
+    debugManager.flags.HostAllocationHugePagesThreshold.set(64);
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    VariableBackup<int> madviseCalledBackup(&SysCalls::madviseCalled, 0);
+    VariableBackup<uint32_t> mmapBackup(&SysCalls::mmapFuncCalled, 0u);
+
+    AllocationData allocationData;
+    allocationData.size = 16384;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(0u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(0, SysCalls::madviseCalled);
+    EXPECT_EQ(alloc->getUnderlyingBuffer(), alloc->getDriverAllocatedCpuPtr());
+    EXPECT_EQ(0u, memoryManager->hugePagesStatistics.transparentAllocations.load());
+    EXPECT_EQ(0u, memoryManager->hugePagesStatistics.hugetlbAllocations.load());
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenHugetlbPagesEnabledWhenAllocatingHostMemoryAboveThresholdThenHugetlbMappingIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePages.set(2);
+    debugManager.flags.HostAllocationHugePagesThreshold.set(64);
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    mmapFlagsCaptured.clear();
+    VariableBackup<int> madviseCalledBackup(&SysCalls::madviseCalled, 0);
+    VariableBackup<uint32_t> munmapBackup(&SysCalls::munmapFuncCalled, 0u);
+    memoryManager->mmapFunction = mockMmapCapturingFlags;
+
+    AllocationData allocationData;
+    allocationData.size = 128 * MemoryConstants::kiloByte;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, alloc);
+
+    ASSERT_EQ(1u, mmapFlagsCaptured.size());
+    EXPECT_EQ(MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, mmapFlagsCaptured[0] & ~(MAP_HUGE_MASK << MAP_HUGE_SHIFT));
+    EXPECT_EQ(21, (mmapFlagsCaptured[0] >> MAP_HUGE_SHIFT) & MAP_HUGE_MASK);
+    EXPECT_EQ(0, SysCalls::madviseCalled);
+    EXPECT_EQ(nullptr, alloc->getDriverAllocatedCpuPtr());
+    EXPECT_EQ(1u, memoryManager->hugePagesStatistics.hugetlbAllocations.load());
+    EXPECT_EQ(MemoryConstants::pageSize2M, memoryManager->hugePagesStatistics.hugetlbBytes.load());
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenHugetlbPagesUnavailableWhenAllocatingHostMemoryThenTransparentHugePagesAreUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePages.set(2);
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    mmapFlagsCaptured.clear();
+    madviseCapture = {};
+    VariableBackup<int> madviseCalledBackup(&SysCalls::madviseCalled, 0);
+    VariableBackup<decltype(SysCalls::sysCallsMadvise)> madviseBackup(&SysCalls::sysCallsMadvise, mockMadvise);
+    memoryManager->mmapFunction = mockMmapFailingHugetlb;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize2M;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, alloc);
+
+    ASSERT_EQ(2u, mmapFlagsCaptured.size());
+    EXPECT_EQ(MAP_PRIVATE | MAP_ANONYMOUS, mmapFlagsCaptured[1]);
+    EXPECT_EQ(1, SysCalls::madviseCalled);
+    EXPECT_EQ(alloc->getUnderlyingBuffer(), madviseCapture.addr);
+    EXPECT_EQ(1u, memoryManager->hugePagesStatistics.hugetlbFallbacks.load());
+    EXPECT_EQ(0u, memoryManager->hugePagesStatistics.hugetlbAllocations.load());
+    EXPECT_EQ(1u, memoryManager->hugePagesStatistics.transparentAllocations.load());
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenTransparentHugePagesUnsupportedWhenAllocatingHostMemoryThenMappingIsReleasedAndRegularPagesAreUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePages.set(1);
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemClose = 1;
+    VariableBackup<decltype(SysCalls::sysCallsMadvise)> madviseBackup(&SysCalls::sysCallsMadvise, [](void *addr, size_t size, int advice) -> int {
+        return -1;
+    });
+    VariableBackup<uint32_t> munmapBackup(&SysCalls::munmapFuncCalled, 0u);
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize2M;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, alloc);
+
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+    EXPECT_EQ(alloc->getUnderlyingBuffer(), alloc->getDriverAllocatedCpuPtr());
+    EXPECT_EQ(1u, memoryManager->hugePagesStatistics.regularPagesFallbacks.load());
+    EXPECT_EQ(0u, memoryManager->hugePagesStatistics.transparentAllocations.load());
+
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenPrintHugePagesStatisticsFlagWhenPrintingStatisticsThenAllocationsAndFallbacksArePrinted) {
+    DebugManagerStateRestore restorer;
+    memoryManager->hugePagesStatistics.hugetlbAllocations = 1;
+    memoryManager->hugePagesStatistics.hugetlbBytes = MemoryConstants::pageSize2M;
+    memoryManager->hugePagesStatistics.hugetlbFallbacks = 2;
+    memoryManager->hugePagesStatistics.transparentAllocations = 3;
+    memoryManager->hugePagesStatistics.transparentBytes = 3 * MemoryConstants::pageSize2M;
+    memoryManager->hugePagesStatistics.regularPagesFallbacks = 4;
+
+    testing::internal::CaptureStdout();
+    memoryManager->printHugePagesStatistics();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+
+    debugManager.flags.PrintHostAllocationHugePagesStatistics.set(true);
+    testing::internal::CaptureStdout();
+    memoryManager->printHugePagesStatistics();
+    EXPECT_EQ("Host allocations with huge pages: hugetlbfs 1 (2097152 bytes, 2 fallbacks), transparent 3 (6291456 bytes), regular pages fallbacks 4\n", testing::internal::GetCapturedStdout());
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDefaultDrmMemoryManagerWhenAskedForAlignedMallocRestrictionsThenNullPtrIsReturned) {
     EXPECT_EQ(nullptr, memoryManager->getAlignedMallocRestrictions());
 }
@@ -5834,7 +6179,7 @@ TEST_F(DrmMemoryManagerWithLocalMemoryAndExplicitExpectationsTest, givenDrmMemor
     auto gpuAddress = 0x1234u;
     auto size = MemoryConstants::pageSize;
 
-    auto bo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(rootDeviceIndex, nullptr, AllocationType::buffer, gpuAddress, size, MemoryBanks::mainBank, 1, -1, false, false));
+    auto bo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(rootDeviceIndex, nullptr, AllocationType::buffer, gpuAddress, size, MemoryBanks::mainBank, 1, -1, false, false, -1));
     EXPECT_EQ(nullptr, bo);
 }
 
@@ -5842,7 +6187,7 @@ TEST_F(DrmMemoryManagerWithLocalMemoryAndExplicitExpectationsTest, givenDrmMemor
     auto gpuAddress = 0x1234u;
     auto size = 0u;
 
-    auto bo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(rootDeviceIndex, nullptr, AllocationType::buffer, gpuAddress, size, MemoryBanks::mainBank, 1, -1, false, false));
+    auto bo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(rootDeviceIndex, nullptr, AllocationType::buffer, gpuAddress, size, MemoryBanks::mainBank, 1, -1, false, false, -1));
     EXPECT_EQ(nullptr, bo);
 }
 
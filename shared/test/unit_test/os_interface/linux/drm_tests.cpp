@@ -210,6 +210,60 @@ TEST(DrmTest, GivenSysfsNodeReadFailsWhenGetDeviceMemoryPhysicalSizeInBytesIsCal
     EXPECT_FALSE(drm.getDeviceMemoryPhysicalSizeInBytes(0, size));
 }
 
+TEST(DrmTest, GivenValidSysfsNodeWhenGetDeviceNumaNodeIsCalledThenNumaNodeIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    static std::string openedPath;
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        openedPath = pathname;
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("1\n");
+        memcpy(buf, testData.data(), testData.length() + 1);
+        return 2;
+    });
+    int32_t numaNode = -1;
+    EXPECT_TRUE(drm.getDeviceNumaNode(numaNode));
+    EXPECT_EQ(1, numaNode);
+    EXPECT_NE(std::string::npos, openedPath.find("/device/numa_node"));
+}
+
+TEST(DrmTest, GivenSysfsNodeReportsNoLocalityWhenGetDeviceNumaNodeIsCalledThenReturnError) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("-1\n");
+        memcpy(buf, testData.data(), testData.length() + 1);
+        return 3;
+    });
+    int32_t numaNode = 5;
+    EXPECT_FALSE(drm.getDeviceNumaNode(numaNode));
+    EXPECT_EQ(5, numaNode);
+}
+
+TEST(DrmTest, GivenInValidSysfsNodeWhenGetDeviceNumaNodeIsCalledThenReturnError) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return -1;
+    });
+    int32_t numaNode = -1;
+    EXPECT_FALSE(drm.getDeviceNumaNode(numaNode));
+    EXPECT_EQ(-1, numaNode);
+}
+
 TEST(DrmTest, givenSysfsNodeReadFailsWithErrnoWhenGetDeviceMemoryPhysicalSizeInBytesIsCalledThenReturnError) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
@@ -868,3 +868,169 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenAllocationsWhenVerifyingPageFaultInsideAndBetweenAllocationsThenOnlyContainingAllocationIsHandled) {
+    void *alloc1 = reinterpret_cast<void *>(0x1000);
+    void *alloc2 = reinterpret_cast<void *>(0x3000);
+    void *alloc3 = reinterpret_cast<void *>(0x8000);
+
+    pageFaultManager->insertAllocation(alloc3, 0x1000, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc1, 0x1000, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 0x2000, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x800)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x2000)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x5000)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x9000)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x4fff)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, 0x2000u);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc3));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc3);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetWhenInsertingAllocationsThenOnlyAllocationsLargerThanChunkAreTrackedPerChunk) {
+    DebugManagerStateRestore restorer;
+
+    EXPECT_EQ(0u, pageFaultManager->getMigrationChunkSize(MemoryConstants::gigaByte));
+
+    debugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k + 1));
+    EXPECT_EQ(MemoryConstants::pageSize64k + MemoryConstants::pageSize, pageFaultManager->getMigrationChunkSize(MemoryConstants::gigaByte));
+
+    debugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    EXPECT_EQ(0u, pageFaultManager->getMigrationChunkSize(MemoryConstants::pageSize64k));
+
+    void *smallAlloc = reinterpret_cast<void *>(0x10000);
+    void *largeAlloc = reinterpret_cast<void *>(0x100000);
+    pageFaultManager->insertAllocation(smallAlloc, MemoryConstants::pageSize64k, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(largeAlloc, 4 * MemoryConstants::pageSize64k + 1, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_EQ(0u, pageFaultManager->memoryData.at(smallAlloc).chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(smallAlloc).cpuChunks.empty());
+
+    auto &largeAllocData = pageFaultManager->memoryData.at(largeAlloc);
+    EXPECT_EQ(MemoryConstants::pageSize64k, largeAllocData.chunkSize);
+    EXPECT_EQ(std::vector<bool>(5, true), largeAllocData.cpuChunks);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInGpuDomainWhenCpuTouchesSingleChunkThenOnlyThatChunkIsTransferredAndUnprotected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    const size_t chunkSize = MemoryConstants::pageSize64k;
+    const size_t allocSize = 4 * chunkSize + MemoryConstants::pageSize;
+
+    pageFaultManager->insertAllocation(alloc, allocSize, unifiedMemoryManager.get(), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferChunkToGpuCalled);
+    EXPECT_EQ(alloc, pageFaultManager->transferChunkToGpuAddress);
+    EXPECT_EQ(allocSize, pageFaultManager->transferChunkToGpuSize);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultManager->memoryData.at(alloc).domain);
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * chunkSize + 1)));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, 2 * chunkSize), pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(ptrOffset(alloc, 2 * chunkSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(1, pageFaultManager->allowCPUMemoryEvictionCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(alloc).domain);
+    EXPECT_EQ(std::vector<bool>({false, false, true, false, false}), pageFaultManager->memoryData.at(alloc).cpuChunks);
+    ASSERT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(alloc, unifiedMemoryManager->nonGpuDomainAllocs[0]);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, allocSize - 1)));
+    EXPECT_EQ(2, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, 4 * chunkSize), pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(1, pageFaultManager->allowCPUMemoryEvictionCalled);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationWithCpuChunksWhenMovingToGpuDomainThenOnlyContiguousCpuRangesAreTransferredAndProtected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    const size_t chunkSize = MemoryConstants::pageSize64k;
+
+    pageFaultManager->insertAllocation(alloc, 8 * chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->transferChunkToGpuCalled = 0;
+    pageFaultManager->protectMemoryCalled = 0;
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 1 * chunkSize));
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * chunkSize));
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 6 * chunkSize));
+    EXPECT_EQ(3, pageFaultManager->transferToCpuCalled);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(2, pageFaultManager->transferChunkToGpuCalled);
+    EXPECT_EQ(2, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(ptrOffset(alloc, 6 * chunkSize), pageFaultManager->transferChunkToGpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferChunkToGpuSize);
+    EXPECT_EQ(ptrOffset(alloc, 6 * chunkSize), pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(std::vector<bool>(8, false), pageFaultManager->memoryData.at(alloc).cpuChunks);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::gpu, pageFaultManager->memoryData.at(alloc).domain);
+
+    PageFaultManager::PageFaultStatistics statistics;
+    EXPECT_TRUE(pageFaultManager->getAllocationStatistics(alloc, statistics));
+    EXPECT_EQ(3u, statistics.cpuFaults);
+    EXPECT_EQ(3u, statistics.transfersToCpu);
+    EXPECT_EQ(3 * chunkSize, statistics.bytesTransferredToCpu);
+    EXPECT_EQ(3u, statistics.transfersToGpu);
+    EXPECT_EQ(8 * chunkSize + 3 * chunkSize, statistics.bytesTransferredToGpu);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationNeverMovedToGpuWhenCpuTouchesChunkThenChunkIsUnprotectedWithoutTransfer) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    const size_t chunkSize = MemoryConstants::pageSize64k;
+
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(std::vector<bool>(4, false), pageFaultManager->memoryData.at(alloc).cpuChunks);
+
+    pageFaultManager->gpuDomainHandler = &MockPageFaultManager::unprotectAndTransferMemory;
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * chunkSize)));
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(0, pageFaultManager->allowCPUMemoryEvictionCalled);
+    EXPECT_EQ(ptrOffset(alloc, 3 * chunkSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(alloc).domain);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenWholeAllocationMigrationWhenMigratingThenStatisticsAreUpdated) {
+    void *alloc = reinterpret_cast<void *>(0x1000);
+    pageFaultManager->insertAllocation(alloc, 10, unifiedMemoryManager.get(), nullptr, {});
+
+    PageFaultManager::PageFaultStatistics statistics;
+    EXPECT_FALSE(pageFaultManager->getAllocationStatistics(reinterpret_cast<void *>(0x2000), statistics));
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_TRUE(pageFaultManager->getAllocationStatistics(alloc, statistics));
+    EXPECT_EQ(1u, statistics.cpuFaults);
+    EXPECT_EQ(1u, statistics.transfersToCpu);
+    EXPECT_EQ(10u, statistics.bytesTransferredToCpu);
+    EXPECT_EQ(2u, statistics.transfersToGpu);
+    EXPECT_EQ(20u, statistics.bytesTransferredToGpu);
+}
@@ -1,16 +1,19 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/linux/cpu_page_fault_manager_linux.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_cpu_page_fault_manager.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/mock_memory_operations_handler.h"
 
 #include "gtest/gtest.h"
@@ -243,3 +246,66 @@ TEST_F(PageFaultManagerLinuxTest, givenDefaultSaHandlerWhenOverwritingNewHandler
     mockPageFaultManager.reset();
     sigaction(SIGSEGV, &originalHandler, nullptr);
 }
+
+class MockChunkedPageFaultManagerLinux : public PageFaultManagerLinux {
+  public:
+    using PageFaultManagerLinux::memoryData;
+
+    void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+        transfersToCpu.push_back({ptr, size});
+    }
+    void transferToGpu(void *ptr, void *cmdQ) override {
+        transfersToGpu.push_back({ptr, memoryData.at(ptr).size});
+    }
+    void transferChunkToGpu(void *allocPtr, void *chunkPtr, size_t chunkSize, void *cmdQ) override {
+        transfersToGpu.push_back({chunkPtr, chunkSize});
+    }
+    void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+    void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {}
+    void allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) override {}
+
+    std::vector<std::pair<void *, size_t>> transfersToCpu;
+    std::vector<std::pair<void *, size_t>> transfersToGpu;
+};
+
+TEST_F(PageFaultManagerLinuxTest, givenChunkedSharedAllocationInGpuDomainWhenCpuTouchesSingleByteThenOnlyTouchedChunkIsMigrated) {
+    DebugManagerStateRestore restorer;
+    const size_t chunkSize = MemoryConstants::pageSize64k;
+    const size_t allocSize = 16 * chunkSize;
+    debugManager.flags.UsmSharedMigrationChunkSize.set(static_cast<int32_t>(chunkSize));
+
+    MockExecutionEnvironment executionEnvironment;
+    MockMemoryManager memoryManager(executionEnvironment);
+    SVMAllocsManager unifiedMemoryManager(&memoryManager, false);
+    auto pageFaultManager = std::make_unique<MockChunkedPageFaultManagerLinux>();
+
+    auto ptr = static_cast<uint8_t *>(mmap(nullptr, allocSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0));
+    ASSERT_NE(MAP_FAILED, static_cast<void *>(ptr));
+
+    pageFaultManager->insertAllocation(ptr, allocSize, &unifiedMemoryManager, nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(ptr);
+    ASSERT_EQ(1u, pageFaultManager->transfersToGpu.size());
+    EXPECT_EQ(allocSize, pageFaultManager->transfersToGpu[0].second);
+
+    ptr[5 * chunkSize + 7] = 1;
+    ASSERT_EQ(1u, pageFaultManager->transfersToCpu.size());
+    EXPECT_EQ(ptr + 5 * chunkSize, pageFaultManager->transfersToCpu[0].first);
+    EXPECT_EQ(chunkSize, pageFaultManager->transfersToCpu[0].second);
+
+    ptr[6 * chunkSize - 1] = 2;
+    EXPECT_EQ(1u, pageFaultManager->transfersToCpu.size());
+
+    PageFaultManager::PageFaultStatistics statistics;
+    EXPECT_TRUE(pageFaultManager->getAllocationStatistics(ptr, statistics));
+    EXPECT_EQ(1u, statistics.cpuFaults);
+    EXPECT_EQ(chunkSize, statistics.bytesTransferredToCpu);
+
+    pageFaultManager->moveAllocationToGpuDomain(ptr);
+    ASSERT_EQ(2u, pageFaultManager->transfersToGpu.size());
+    EXPECT_EQ(ptr + 5 * chunkSize, pageFaultManager->transfersToGpu[1].first);
+    EXPECT_EQ(chunkSize, pageFaultManager->transfersToGpu[1].second);
+
+    pageFaultManager->removeAllocation(ptr);
+    EXPECT_EQ(1, ptr[5 * chunkSize + 7]);
+    munmap(ptr, allocSize);
+}
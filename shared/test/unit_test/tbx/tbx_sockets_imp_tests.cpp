@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/test/common/mocks/mock_tbx_sockets_imp.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+TEST(TbxSocketsImpTests, givenWriteBatchingDisabledWhenWritingThenEachMessageIsSentImmediately) {
+    MockTbxSocketsImp tbxSockets;
+    uint32_t data = 0x12345678;
+
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2000, 5u));
+    EXPECT_TRUE(tbxSockets.writeGTT(0x10, 0x1000u));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x4000, &data, sizeof(data), MemType::system));
+
+    EXPECT_EQ(4u, tbxSockets.sendWriteDataCalled);
+    EXPECT_EQ(3u, tbxSockets.server.messagesReceived);
+    EXPECT_EQ(5u, tbxSockets.server.mmio[0x2000]);
+    EXPECT_EQ(0x1000u, tbxSockets.server.gtt[0x10 / sizeof(uint64_t)]);
+    EXPECT_EQ(0x78u, tbxSockets.server.memory[0x4000]);
+    EXPECT_EQ(3u, tbxSockets.getTransportStatistics().messages);
+    EXPECT_EQ(0u, tbxSockets.getTransportStatistics().roundTrips);
+}
+
+TEST(TbxSocketsImpTests, givenWriteBatchingEnabledWhenWritingThenMessagesAreSentTogetherBeforeRead) {
+    MockTbxSocketsImp tbxSockets;
+    tbxSockets.writeBatchingBufferSize = MemoryConstants::pageSize;
+    std::vector<uint8_t> data(64, 0xab);
+
+    for (uint32_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(tbxSockets.writeMMIO(0x2000 + i * sizeof(uint32_t), i));
+        EXPECT_TRUE(tbxSockets.writeMemory(0x4000 + i * data.size(), data.data(), data.size(), MemType::system));
+    }
+    EXPECT_EQ(0u, tbxSockets.sendWriteDataCalled);
+    EXPECT_EQ(0u, tbxSockets.server.messagesReceived);
+
+    uint32_t value = 0;
+    EXPECT_TRUE(tbxSockets.readMMIO(0x2000 + 7 * sizeof(uint32_t), &value));
+    EXPECT_EQ(7u, value);
+    EXPECT_EQ(2u, tbxSockets.sendWriteDataCalled);
+    EXPECT_EQ(17u, tbxSockets.server.messagesReceived);
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+
+    std::vector<uint8_t> readData(data.size() * 8, 0);
+    EXPECT_TRUE(tbxSockets.readMemory(0x4000, readData.data(), readData.size()));
+    EXPECT_EQ(std::vector<uint8_t>(readData.size(), 0xab), readData);
+    EXPECT_EQ(3u, tbxSockets.sendWriteDataCalled);
+
+    EXPECT_EQ(18u, tbxSockets.getTransportStatistics().messages);
+    EXPECT_EQ(2u, tbxSockets.getTransportStatistics().roundTrips);
+}
+
+TEST(TbxSocketsImpTests, givenWriteBatchingEnabledWhenWriteDoesNotFitIntoBufferThenPendingWritesAreSentFirstAndOrderIsPreserved) {
+    MockTbxSocketsImp tbxSockets;
+    tbxSockets.writeBatchingBufferSize = 256u;
+
+    std::vector<uint8_t> smallData(16, 0x11);
+    std::vector<uint8_t> largeData(1024, 0x22);
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, smallData.data(), smallData.size(), MemType::system));
+    EXPECT_EQ(0u, tbxSockets.sendWriteDataCalled);
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1008, largeData.data(), largeData.size(), MemType::system));
+    EXPECT_EQ(2u, tbxSockets.sendWriteDataCalled);
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+
+    EXPECT_EQ(2u, tbxSockets.server.messagesReceived);
+    EXPECT_EQ(0x11u, tbxSockets.server.memory[0x1007]);
+    EXPECT_EQ(0x22u, tbxSockets.server.memory[0x1008]);
+    EXPECT_EQ(0x22u, tbxSockets.server.memory[0x1008 + largeData.size() - 1]);
+}
+
+TEST(TbxSocketsImpTests, givenPendingWritesWhenFlushingThenAllWritesAreSentInSingleCall) {
+    MockTbxSocketsImp tbxSockets;
+    tbxSockets.writeBatchingBufferSize = MemoryConstants::pageSize;
+
+    EXPECT_TRUE(tbxSockets.flush());
+    EXPECT_EQ(0u, tbxSockets.sendWriteDataCalled);
+
+    EXPECT_TRUE(tbxSockets.writeGTT(0, 0x1003u));
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2230, 1u));
+    EXPECT_TRUE(tbxSockets.flush());
+
+    EXPECT_EQ(1u, tbxSockets.sendWriteDataCalled);
+    EXPECT_EQ(2u, tbxSockets.server.messagesReceived);
+    EXPECT_EQ(1u, tbxSockets.server.mmio[0x2230]);
+}
@@ -33,6 +33,14 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
 }
+void PageFaultManager::transferChunkToGpu(void *allocPtr, void *chunkPtr, size_t chunkSize, void *cmdQ) {
+}
+bool PageFaultManager::isChunkedMigrationSupported() const {
+    return true;
+}
+bool PageFaultManager::isCpuMigrationBlocked(void *allocPtr, PageFaultData &pageFaultData) {
+    return false;
+}
 void PageFaultManager::allowCPUMemoryEviction(void *ptr, PageFaultData &pageFaultData) {
 }
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) { return nullptr; }
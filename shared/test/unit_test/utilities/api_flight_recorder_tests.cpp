@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_flight_recorder.h"
+
+#include "gtest/gtest.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+struct MockApiFlightRecorder : public ApiFlightRecorder {
+    using ApiFlightRecorder::ApiFlightRecorder;
+    using ApiFlightRecorder::dumpRequested;
+    using ApiFlightRecorder::freeThreadRecords;
+    using ApiFlightRecorder::threadRecords;
+};
+
+std::vector<char> readFile(const std::string &filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+enum class TestEnum : uint32_t {
+    value = 7
+};
+
+struct TestStruct {
+    uint32_t field = 1;
+};
+} // namespace
+
+TEST(ApiFlightRecorderTests, givenValuesOfDifferentTypesWhenConvertingToRecordValueThenPointersAndIntegralsAreKeptAndOtherTypesAreZeroed) {
+    int variable = 0;
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&variable), ApiFlightRecorder::toRecordValue(&variable));
+    EXPECT_EQ(5u, ApiFlightRecorder::toRecordValue(5));
+    EXPECT_EQ(0xffffffffffffffffull, ApiFlightRecorder::toRecordValue(-1ll));
+    EXPECT_EQ(7u, ApiFlightRecorder::toRecordValue(TestEnum::value));
+    EXPECT_EQ(0u, ApiFlightRecorder::toRecordValue(TestStruct{}));
+    EXPECT_EQ(0u, ApiFlightRecorder::toRecordValue(nullptr));
+}
+
+TEST(ApiFlightRecorderTests, givenRecordedCallWhenGettingRecordsThenEnterAndExitRecordsWithArgumentsAndCorrelationIdAreReturned) {
+    MockApiFlightRecorder recorder(16u, "");
+    int object = 0;
+
+    auto correlationId = recorder.recordEnter("apiCall", &object, 3u, TestEnum::value);
+    EXPECT_NE(0u, correlationId);
+    recorder.recordExit("apiCall", correlationId, 0x10u);
+
+    auto records = recorder.getRecords();
+    ASSERT_EQ(2u, records.size());
+
+    EXPECT_EQ(ApiFlightRecord::Phase::enter, records[0].phase);
+    EXPECT_STREQ("apiCall", records[0].functionName);
+    EXPECT_EQ(correlationId, records[0].correlationId);
+    EXPECT_EQ(3u, records[0].valuesCount);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&object), records[0].values[0]);
+    EXPECT_EQ(3u, records[0].values[1]);
+    EXPECT_EQ(7u, records[0].values[2]);
+
+    EXPECT_EQ(ApiFlightRecord::Phase::exit, records[1].phase);
+    EXPECT_STREQ("apiCall", records[1].functionName);
+    EXPECT_EQ(correlationId, records[1].correlationId);
+    EXPECT_EQ(1u, records[1].valuesCount);
+    EXPECT_EQ(0x10u, records[1].values[0]);
+}
+
+TEST(ApiFlightRecorderTests, givenMoreArgumentsThanRecordCapacityWhenRecordingThenOnlyFirstArgumentsAreKept) {
+    MockApiFlightRecorder recorder(16u, "");
+    recorder.recordEnter("apiCall", 1, 2, 3, 4, 5, 6, 7, 8);
+
+    auto records = recorder.getRecords();
+    ASSERT_EQ(1u, records.size());
+    EXPECT_EQ(ApiFlightRecord::maxArguments, records[0].valuesCount);
+    for (uint32_t i = 0; i < ApiFlightRecord::maxArguments; i++) {
+        EXPECT_EQ(i + 1u, records[0].values[i]);
+    }
+}
+
+TEST(ApiFlightRecorderTests, givenMoreRecordsThanRingCapacityWhenGettingRecordsThenOnlyNewestRecordsAreReturned) {
+    MockApiFlightRecorder recorder(4u, "");
+    for (uint32_t i = 0; i < 10; i++) {
+        recorder.recordEnter("apiCall", i);
+    }
+
+    auto records = recorder.getRecords();
+    ASSERT_EQ(4u, records.size());
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_EQ(6u + i, records[i].values[0]);
+    }
+}
+
+TEST(ApiFlightRecorderTests, givenCallsFromMultipleThreadsWhenRecordingThenEachThreadUsesItsOwnRingAndCorrelationIdsAreUnique) {
+    MockApiFlightRecorder recorder(64u, "");
+    recorder.recordEnter("mainThreadCall");
+
+    std::thread thread([&recorder] {
+        recorder.recordEnter("workerThreadCall");
+    });
+    thread.join();
+
+    EXPECT_EQ(2u, recorder.threadRecords.size());
+    auto records = recorder.getRecords();
+    ASSERT_EQ(2u, records.size());
+    EXPECT_NE(records[0].threadIndex, records[1].threadIndex);
+    EXPECT_NE(records[0].correlationId, records[1].correlationId);
+}
+
+TEST(ApiFlightRecorderTests, givenThreadExitedWhenNewThreadRecordsCallThenRingOfExitedThreadIsReusedAndItsRecordsAreKept) {
+    MockApiFlightRecorder recorder(64u, "");
+
+    std::thread firstThread([&recorder] {
+        recorder.recordEnter("firstThreadCall");
+    });
+    firstThread.join();
+    EXPECT_EQ(1u, recorder.threadRecords.size());
+    EXPECT_EQ(1u, recorder.freeThreadRecords.size());
+
+    std::thread secondThread([&recorder] {
+        recorder.recordEnter("secondThreadCall");
+    });
+    secondThread.join();
+    EXPECT_EQ(1u, recorder.threadRecords.size());
+    EXPECT_EQ(1u, recorder.freeThreadRecords.size());
+
+    auto records = recorder.getRecords();
+    ASSERT_EQ(2u, records.size());
+    EXPECT_STREQ("firstThreadCall", records[0].functionName);
+    EXPECT_STREQ("secondThreadCall", records[1].functionName);
+    EXPECT_NE(records[0].threadIndex, records[1].threadIndex);
+    EXPECT_NE(records[0].correlationId, records[1].correlationId);
+}
+
+TEST(ApiFlightRecorderTests, givenRecorderDestroyedWhenThreadExitsThenRingIsNotReleased) {
+    auto recorder = std::make_unique<MockApiFlightRecorder>(16u, "");
+    bool recorded = false;
+    bool recorderDestroyed = false;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    std::thread thread([&] {
+        recorder->recordEnter("apiCall");
+        std::unique_lock<std::mutex> lock(mutex);
+        recorded = true;
+        condition.notify_all();
+        condition.wait(lock, [&] { return recorderDestroyed; });
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&] { return recorded; });
+        recorder.reset();
+        recorderDestroyed = true;
+    }
+    condition.notify_all();
+    thread.join();
+}
+
+TEST(ApiFlightRecorderTests, givenRecordedCallsWhenDumpingThenFileContainsHeaderNamesAndRecords) {
+    std::string dumpFile = "api_flight_recorder_test.bin";
+    MockApiFlightRecorder recorder(16u, dumpFile);
+    auto correlationId = recorder.recordEnter("firstCall", 1u, 2u);
+    recorder.recordExit("firstCall", correlationId, 0u);
+    recorder.recordEnter("secondCall");
+
+    EXPECT_TRUE(recorder.dump());
+    auto content = readFile(dumpFile);
+    std::remove(dumpFile.c_str());
+
+    ASSERT_LE(sizeof(ApiFlightRecorderDumpHeader), content.size());
+    ApiFlightRecorderDumpHeader header;
+    memcpy(&header, content.data(), sizeof(header));
+    EXPECT_EQ(ApiFlightRecorderDumpHeader::magic, header.magicValue);
+    EXPECT_EQ(ApiFlightRecorderDumpHeader::currentVersion, header.version);
+    EXPECT_EQ(2u, header.namesCount);
+    EXPECT_EQ(3u, header.recordsCount);
+
+    size_t offset = sizeof(header);
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < header.namesCount; i++) {
+        uint32_t length = 0;
+        memcpy(&length, content.data() + offset, sizeof(length));
+        offset += sizeof(length);
+        names.emplace_back(content.data() + offset, length);
+        offset += length;
+    }
+    EXPECT_EQ("firstCall", names[0]);
+    EXPECT_EQ("secondCall", names[1]);
+
+    ASSERT_EQ(offset + header.recordsCount * sizeof(ApiFlightRecorderDumpRecord), content.size());
+    std::vector<ApiFlightRecorderDumpRecord> records(header.recordsCount);
+    memcpy(records.data(), content.data() + offset, records.size() * sizeof(ApiFlightRecorderDumpRecord));
+
+    EXPECT_EQ(0u, records[0].nameIndex);
+    EXPECT_EQ(static_cast<uint8_t>(ApiFlightRecord::Phase::enter), records[0].phase);
+    EXPECT_EQ(2u, records[0].valuesCount);
+    EXPECT_EQ(2u, records[0].values[1]);
+    EXPECT_EQ(0u, records[1].nameIndex);
+    EXPECT_EQ(static_cast<uint8_t>(ApiFlightRecord::Phase::exit), records[1].phase);
+    EXPECT_EQ(records[0].correlationId, records[1].correlationId);
+    EXPECT_EQ(1u, records[2].nameIndex);
+}
+
+TEST(ApiFlightRecorderTests, givenDumpRequestedWhenNextCallIsRecordedThenDumpIsNotWrittenByRecordingThread) {
+    std::string dumpFile = "api_flight_recorder_request_test.bin";
+    std::remove(dumpFile.c_str());
+    MockApiFlightRecorder recorder(16u, dumpFile);
+
+    recorder.requestDump();
+    recorder.recordEnter("apiCall");
+    EXPECT_TRUE(recorder.dumpRequested.load());
+    EXPECT_TRUE(readFile(dumpFile).empty());
+}
+
+TEST(ApiFlightRecorderTests, givenDumpThreadStartedWhenDumpIsRequestedThenDumpThreadWritesDumpAndClearsRequest) {
+    std::string dumpFile = "api_flight_recorder_thread_test.bin";
+    std::remove(dumpFile.c_str());
+    MockApiFlightRecorder recorder(16u, dumpFile);
+    recorder.recordEnter("apiCall");
+
+    recorder.startDumpThread();
+    recorder.requestDump();
+    while (recorder.dumpRequested.load()) {
+        std::this_thread::yield();
+    }
+    recorder.stopDumpThread();
+
+    auto content = readFile(dumpFile);
+    std::remove(dumpFile.c_str());
+    ASSERT_LE(sizeof(ApiFlightRecorderDumpHeader), content.size());
+
+    ApiFlightRecorderDumpHeader header;
+    memcpy(&header, content.data(), sizeof(header));
+    EXPECT_EQ(1u, header.recordsCount);
+}
+
+TEST(ApiFlightRecorderTests, givenSlotBeingWrittenWhenGettingRecordsThenSlotIsSkipped) {
+    MockApiFlightRecorder recorder(4u, "");
+    for (uint32_t i = 0; i < 3; i++) {
+        recorder.recordEnter("apiCall", i);
+    }
+
+    auto &threadRecords = *recorder.threadRecords[0];
+    threadRecords.slots[1].sequence.store(2 * 5 + 1);
+
+    auto records = recorder.getRecords();
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(0u, records[0].values[0]);
+    EXPECT_EQ(2u, records[1].values[0]);
+}
+
+TEST(ApiFlightRecorderTests, givenSlotOverwrittenByNewerRecordWhenGettingRecordsThenSlotIsSkipped) {
+    MockApiFlightRecorder recorder(4u, "");
+    for (uint32_t i = 0; i < 4; i++) {
+        recorder.recordEnter("apiCall", i);
+    }
+
+    // slot 0 already holds record 4, written count was not published yet
+    auto &threadRecords = *recorder.threadRecords[0];
+    threadRecords.slots[0].sequence.store(2 * 4 + 2);
+
+    auto records = recorder.getRecords();
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(1u, records[0].values[0]);
+}
+
+TEST(ApiFlightRecorderTests, givenRecorderDisabledWhenUsingApiFlightRecorderCallThenNothingIsRecorded) {
+    ASSERT_EQ(nullptr, ApiFlightRecorder::getInstance());
+
+    int argument = 0;
+    int returnValue = 0;
+    ApiFlightRecorderCall call("apiCall");
+    call.enter(&argument);
+    call.exit(&returnValue);
+    EXPECT_EQ(3, call.exitWith(3));
+}
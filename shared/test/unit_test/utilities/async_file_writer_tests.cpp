@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/async_file_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+
+using namespace NEO;
+
+TEST(AsyncFileWriterTests, givenWritesSmallerThanBufferWhenFlushingThenDataIsWrittenToStreamInOrder) {
+    std::ostringstream outStream;
+    AsyncFileWriter writer(outStream, 64u);
+
+    writer.write("abc", 3);
+    writer.write("def", 3);
+    EXPECT_EQ(0u, writer.getSubmittedBuffersCount());
+    EXPECT_TRUE(outStream.str().empty());
+
+    writer.flush();
+    EXPECT_EQ(1u, writer.getSubmittedBuffersCount());
+    EXPECT_EQ("abcdef", outStream.str());
+}
+
+TEST(AsyncFileWriterTests, givenWritesExceedingBufferSizeWhenWritingThenFullBuffersAreSubmittedAndAllDataIsWrittenInOrder) {
+    std::ostringstream outStream;
+    std::string expected;
+    {
+        AsyncFileWriter writer(outStream, 16u);
+        for (uint32_t i = 0; i < 100; i++) {
+            auto record = std::to_string(i) + ";";
+            expected += record;
+            writer.write(record.c_str(), record.size());
+        }
+
+        std::string longRecord(40u, 'x');
+        expected += longRecord;
+        writer.write(longRecord.c_str(), longRecord.size());
+        EXPECT_LT(10u, writer.getSubmittedBuffersCount());
+    }
+    EXPECT_EQ(expected, outStream.str());
+}
+
+TEST(AsyncFileWriterTests, givenPendingDataWhenWriterIsDestroyedThenDataIsWrittenToStream) {
+    std::ostringstream outStream;
+    {
+        AsyncFileWriter writer(outStream, AsyncFileWriter::defaultBufferSize);
+        writer.write("pending", 7);
+    }
+    EXPECT_EQ("pending", outStream.str());
+}
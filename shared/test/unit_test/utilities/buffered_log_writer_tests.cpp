@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/buffered_log_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::string readFile(const std::string &filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+struct BufferedLogWriterTests : public ::testing::Test {
+    void SetUp() override {
+        std::remove(filename.c_str());
+        std::remove(BufferedLogWriter::getRotatedFileName(filename).c_str());
+    }
+    void TearDown() override {
+        std::remove(filename.c_str());
+        std::remove(BufferedLogWriter::getRotatedFileName(filename).c_str());
+    }
+
+    const std::string filename = "buffered_log_writer_test.log";
+};
+} // namespace
+
+TEST_F(BufferedLogWriterTests, givenTextFormatWhenWritingAndFlushingThenLinesAreWrittenToFileInOrder) {
+    BufferedLogWriter writer(filename, BufferedLogFormat::text, 0u, BufferedLogWriter::defaultThreadBufferSize);
+    writer.write("line0\n", 6);
+    writer.write("line1\n", 6);
+    writer.flush();
+
+    EXPECT_EQ("line0\nline1\n", readFile(filename));
+    EXPECT_EQ(12u, writer.getCurrentFileSize());
+}
+
+TEST_F(BufferedLogWriterTests, givenPendingRecordsWhenWriterIsDestroyedThenRecordsAreWrittenToFile) {
+    {
+        BufferedLogWriter writer(filename, BufferedLogFormat::text, 0u, BufferedLogWriter::defaultThreadBufferSize);
+        writer.write("pending\n", 8);
+    }
+    EXPECT_EQ("pending\n", readFile(filename));
+}
+
+TEST_F(BufferedLogWriterTests, givenSmallThreadBufferWhenWritingMoreThanBufferCapacityThenAllRecordsAreWrittenInOrder) {
+    constexpr size_t threadBufferSize = 64u;
+    std::string expected;
+    {
+        BufferedLogWriter writer(filename, BufferedLogFormat::text, 0u, threadBufferSize);
+        for (uint32_t i = 0; i < 100; i++) {
+            auto line = "record" + std::to_string(i) + "\n";
+            expected += line;
+            writer.write(line.c_str(), line.size());
+        }
+
+        std::string longRecord(threadBufferSize * 2, 'x');
+        expected += longRecord;
+        writer.write(longRecord.c_str(), longRecord.size());
+    }
+    EXPECT_EQ(expected, readFile(filename));
+}
+
+TEST_F(BufferedLogWriterTests, givenBinaryFormatWhenWritingThenFileContainsHeaderAndCompactRecords) {
+    {
+        BufferedLogWriter writer(filename, BufferedLogFormat::binary, 0u, BufferedLogWriter::defaultThreadBufferSize);
+        writer.write("abc", 3);
+        writer.write("de", 2);
+    }
+
+    auto content = readFile(filename);
+    ASSERT_EQ(sizeof(BufferedLogFileHeader) + 2 * sizeof(BufferedLogRecordHeader) + 5u, content.size());
+
+    BufferedLogFileHeader fileHeader;
+    memcpy(&fileHeader, content.data(), sizeof(fileHeader));
+    EXPECT_EQ(BufferedLogFileHeader::magic, fileHeader.magicValue);
+    EXPECT_EQ(BufferedLogFileHeader::currentVersion, fileHeader.version);
+
+    size_t offset = sizeof(BufferedLogFileHeader);
+    BufferedLogRecordHeader firstRecord;
+    memcpy(&firstRecord, content.data() + offset, sizeof(firstRecord));
+    offset += sizeof(firstRecord);
+    EXPECT_EQ(3u, firstRecord.length);
+    EXPECT_EQ("abc", content.substr(offset, 3));
+    offset += 3;
+
+    BufferedLogRecordHeader secondRecord;
+    memcpy(&secondRecord, content.data() + offset, sizeof(secondRecord));
+    offset += sizeof(secondRecord);
+    EXPECT_EQ(2u, secondRecord.length);
+    EXPECT_EQ("de", content.substr(offset, 2));
+
+    EXPECT_EQ(firstRecord.threadId, secondRecord.threadId);
+    EXPECT_LE(firstRecord.timestampNs, secondRecord.timestampNs);
+}
+
+TEST_F(BufferedLogWriterTests, givenMaxFileSizeWhenLimitIsExceededThenFileIsRotated) {
+    {
+        BufferedLogWriter writer(filename, BufferedLogFormat::text, 10u, BufferedLogWriter::defaultThreadBufferSize);
+        writer.write("12345678\n", 9);
+        writer.flush();
+        EXPECT_EQ(0u, writer.getRotationsCount());
+
+        writer.write("abcdefgh\n", 9);
+        writer.flush();
+        EXPECT_EQ(1u, writer.getRotationsCount());
+        EXPECT_EQ(9u, writer.getCurrentFileSize());
+    }
+    EXPECT_EQ("12345678\n", readFile(BufferedLogWriter::getRotatedFileName(filename)));
+    EXPECT_EQ("abcdefgh\n", readFile(filename));
+}
+
+TEST_F(BufferedLogWriterTests, givenMultipleThreadsWhenWritingThenAllRecordsAreWrittenAndRecordsOfEachThreadKeepTheirOrder) {
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t recordsPerThread = 500;
+    {
+        BufferedLogWriter writer(filename, BufferedLogFormat::text, 0u, 256u);
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < threadsCount; t++) {
+            threads.emplace_back([&writer, t] {
+                for (uint32_t i = 0; i < recordsPerThread; i++) {
+                    auto line = std::to_string(t) + ":" + std::to_string(i) + "\n";
+                    writer.write(line.c_str(), line.size());
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::ifstream file(filename);
+    std::vector<int32_t> lastRecord(threadsCount, -1);
+    uint32_t linesCount = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        auto separator = line.find(':');
+        ASSERT_NE(std::string::npos, separator);
+        auto threadIndex = std::stoul(line.substr(0, separator));
+        auto recordIndex = std::stoi(line.substr(separator + 1));
+        ASSERT_LT(threadIndex, threadsCount);
+        EXPECT_EQ(lastRecord[threadIndex] + 1, recordIndex);
+        lastRecord[threadIndex] = recordIndex;
+        linesCount++;
+    }
+    EXPECT_EQ(threadsCount * recordsPerThread, linesCount);
+}
+
+TEST_F(BufferedLogWriterTests, givenStoppedWriterWhenWritingThenPendingAndNewRecordsAreWrittenSynchronously) {
+    BufferedLogWriter writer(filename, BufferedLogFormat::text, 0u, BufferedLogWriter::defaultThreadBufferSize);
+    writer.write("pending\n", 8);
+    EXPECT_FALSE(writer.isStopped());
+
+    writer.stop();
+    EXPECT_TRUE(writer.isStopped());
+    EXPECT_EQ("pending\n", readFile(filename));
+
+    writer.write("direct\n", 7);
+    EXPECT_EQ("pending\ndirect\n", readFile(filename));
+
+    writer.stop();
+    EXPECT_TRUE(writer.isStopped());
+}
+
+TEST_F(BufferedLogWriterTests, givenActiveWritersWhenStoppingAllThenAllWritersAreStopped) {
+    BufferedLogWriter writer0(filename, BufferedLogFormat::text, 0u, BufferedLogWriter::defaultThreadBufferSize);
+    BufferedLogWriter writer1(BufferedLogWriter::getRotatedFileName(filename), BufferedLogFormat::text, 0u, BufferedLogWriter::defaultThreadBufferSize);
+
+    BufferedLogWriter::stopAll();
+
+    EXPECT_TRUE(writer0.isStopped());
+    EXPECT_TRUE(writer1.isStopped());
+}
+
+TEST_F(BufferedLogWriterTests, givenThreadWritingToWriterWhenThreadExitsThenItsBufferIsReleasedAndRecordsAreWritten) {
+    BufferedLogWriter writer(filename, BufferedLogFormat::text, 0u, BufferedLogWriter::defaultThreadBufferSize);
+
+    std::thread producer([&writer] {
+        writer.write("from thread\n", 12);
+    });
+    producer.join();
+
+    EXPECT_EQ(0u, writer.getThreadBuffersCount());
+    EXPECT_EQ("from thread\n", readFile(filename));
+
+    writer.write("from main\n", 10);
+    EXPECT_EQ(1u, writer.getThreadBuffersCount());
+}
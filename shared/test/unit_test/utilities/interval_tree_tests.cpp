@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/interval_tree.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+TEST(IntervalTreeTest, givenEmptyTreeWhenQueryingThenNothingIsFound) {
+    IntervalTree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(nullptr, tree.findByStart(0x1000));
+    EXPECT_EQ(nullptr, tree.findOverlapping(0x1000, 0x2000));
+    EXPECT_EQ(nullptr, tree.findContaining(0x1000, 0x2000));
+    EXPECT_FALSE(tree.remove(0x1000));
+}
+
+TEST(IntervalTreeTest, givenIntervalsWhenQueryingForOverlapThenHalfOpenRangesAreUsed) {
+    IntervalTree<int> tree;
+    tree.insert(0x1000, 0x2000, 1);
+    tree.insert(0x3000, 0x4000, 2);
+    EXPECT_EQ(2u, tree.size());
+
+    EXPECT_EQ(nullptr, tree.findOverlapping(0x0, 0x1000));
+    EXPECT_EQ(nullptr, tree.findOverlapping(0x2000, 0x3000));
+    EXPECT_EQ(nullptr, tree.findOverlapping(0x4000, 0x5000));
+
+    ASSERT_NE(nullptr, tree.findOverlapping(0x1fff, 0x2001));
+    EXPECT_EQ(1, *tree.findOverlapping(0x1fff, 0x2001));
+    ASSERT_NE(nullptr, tree.findOverlapping(0x2fff, 0x3001));
+    EXPECT_EQ(2, *tree.findOverlapping(0x2fff, 0x3001));
+}
+
+TEST(IntervalTreeTest, givenIntervalsWhenQueryingForContainingIntervalThenWholeRangeMustFit) {
+    IntervalTree<int> tree;
+    tree.insert(0x1000, 0x2000, 1);
+    tree.insert(0x1800, 0x1900, 2);
+    tree.insert(0x0, 0x100, 3);
+
+    ASSERT_NE(nullptr, tree.findContaining(0x1800, 0x1900));
+    ASSERT_NE(nullptr, tree.findContaining(0x1f00, 0x2000));
+    EXPECT_EQ(1, *tree.findContaining(0x1f00, 0x2000));
+    EXPECT_EQ(nullptr, tree.findContaining(0x1f00, 0x2001));
+    EXPECT_EQ(nullptr, tree.findContaining(0x100, 0x200));
+    ASSERT_NE(nullptr, tree.findContaining(0x0, 0x100));
+    EXPECT_EQ(3, *tree.findContaining(0x0, 0x100));
+}
+
+TEST(IntervalTreeTest, givenIntervalsWithSameStartWhenRemovingThenOneIntervalIsRemovedAtATime) {
+    IntervalTree<int> tree;
+    tree.insert(0x1000, 0x2000, 1);
+    tree.insert(0x1000, 0x2000, 2);
+    EXPECT_EQ(2u, tree.size());
+
+    EXPECT_TRUE(tree.remove(0x1000));
+    EXPECT_EQ(1u, tree.size());
+    EXPECT_NE(nullptr, tree.findByStart(0x1000));
+
+    EXPECT_TRUE(tree.remove(0x1000));
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(nullptr, tree.findByStart(0x1000));
+}
+
+TEST(IntervalTreeTest, givenManyIntervalsWhenSomeAreRemovedThenQueriesReflectRemainingIntervals) {
+    IntervalTree<size_t> tree;
+    constexpr size_t count = 10000;
+    for (size_t i = 0; i < count; i++) {
+        size_t index = (i * 7919) % count;
+        tree.insert(index * 0x100, index * 0x100 + 0x80, index);
+    }
+    EXPECT_EQ(count, tree.size());
+
+    for (size_t i = 0; i < count; i += 3) {
+        EXPECT_TRUE(tree.remove(i * 0x100));
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        auto overlapping = tree.findOverlapping(i * 0x100 + 0x40, i * 0x100 + 0x41);
+        auto gap = tree.findOverlapping(i * 0x100 + 0x80, i * 0x100 + 0x100);
+        EXPECT_EQ(nullptr, gap);
+        if (i % 3 == 0) {
+            EXPECT_EQ(nullptr, overlapping);
+            EXPECT_EQ(nullptr, tree.findByStart(i * 0x100));
+        } else {
+            ASSERT_NE(nullptr, overlapping);
+            EXPECT_EQ(i, *overlapping);
+            ASSERT_NE(nullptr, tree.findContaining(i * 0x100, i * 0x100 + 0x80));
+            EXPECT_EQ(i, *tree.findContaining(i * 0x100, i * 0x100 + 0x80));
+        }
+    }
+
+    tree.clear();
+    EXPECT_TRUE(tree.empty());
+}
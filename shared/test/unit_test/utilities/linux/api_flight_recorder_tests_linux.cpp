@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/api_flight_recorder.h"
+
+#include "gtest/gtest.h"
+
+#include <signal.h>
+
+using namespace NEO;
+
+namespace {
+struct MockApiFlightRecorder : public ApiFlightRecorder {
+    using ApiFlightRecorder::ApiFlightRecorder;
+    using ApiFlightRecorder::dumpRequested;
+};
+
+int applicationHandlerCalls = 0;
+void applicationSignalHandler(int) {
+    applicationHandlerCalls++;
+}
+} // namespace
+
+TEST(ApiFlightRecorderLinuxTests, givenApplicationSignalHandlerWhenDumpSignalIsRaisedThenDumpIsRequestedAndApplicationHandlerIsCalled) {
+    struct sigaction applicationAction = {};
+    applicationAction.sa_handler = applicationSignalHandler;
+    sigemptyset(&applicationAction.sa_mask);
+    struct sigaction originalAction = {};
+    ASSERT_EQ(0, sigaction(SIGUSR2, &applicationAction, &originalAction));
+    applicationHandlerCalls = 0;
+
+    MockApiFlightRecorder recorder(16u, "");
+    EXPECT_TRUE(ApiFlightRecorder::installDumpSignalHandler(&recorder, SIGUSR2));
+    EXPECT_FALSE(ApiFlightRecorder::installDumpSignalHandler(&recorder, SIGUSR2));
+
+    raise(SIGUSR2);
+    EXPECT_TRUE(recorder.dumpRequested.load());
+    EXPECT_EQ(1, applicationHandlerCalls);
+
+    ApiFlightRecorder::restoreDumpSignalHandler();
+    struct sigaction restoredAction = {};
+    sigaction(SIGUSR2, nullptr, &restoredAction);
+    EXPECT_EQ(reinterpret_cast<void *>(applicationSignalHandler), reinterpret_cast<void *>(restoredAction.sa_handler));
+
+    recorder.dumpRequested.store(false);
+    raise(SIGUSR2);
+    EXPECT_FALSE(recorder.dumpRequested.load());
+    EXPECT_EQ(2, applicationHandlerCalls);
+
+    sigaction(SIGUSR2, &originalAction, nullptr);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,7 @@
 #include <array>
 #include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -126,6 +127,40 @@ TEST(FileLogger, GivenSameFileNameWhenCreatingNewInstanceThenOldFileIsRemoved) {
     EXPECT_FALSE(fileExists(fileLogger.getLogFileName()));
 }
 
+TEST(FileLogger, GivenBufferedLogWriterEnabledWhenLoggingApiCallsThenLinesAreWrittenThroughBufferedWriter) {
+    std::string testFile = "buffered_testfile";
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.BufferedLogWriter.set(static_cast<int32_t>(BufferedLogFormat::text));
+    {
+        FullyEnabledFileLogger fileLogger(testFile, flags);
+        fileLogger.useRealFiles(true);
+        ASSERT_NE(nullptr, fileLogger.getBufferedLogWriter());
+        EXPECT_EQ(BufferedLogFormat::text, fileLogger.getBufferedLogWriter()->getFormat());
+
+        fileLogger.logApiCall("bufferedFunction", true, 0);
+        fileLogger.logApiCall("bufferedFunction", false, 0);
+        fileLogger.getBufferedLogWriter()->flush();
+
+        std::ifstream file(testFile);
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        EXPECT_NE(std::string::npos, content.find("Function Enter: bufferedFunction"));
+        EXPECT_NE(std::string::npos, content.find("Function Leave (0): bufferedFunction"));
+        EXPECT_LT(content.find("Function Enter: bufferedFunction"), content.find("Function Leave (0): bufferedFunction"));
+    }
+    std::remove(testFile.c_str());
+}
+
+TEST(FileLogger, GivenBufferedLogWriterEnabledWhenLoggerIsFullyDisabledThenBufferedWriterIsNotCreated) {
+    DebugVariables flags;
+    flags.BufferedLogWriter.set(static_cast<int32_t>(BufferedLogFormat::binary));
+    FullyDisabledFileLogger fileLogger(std::string("buffered_testfile"), flags);
+    EXPECT_EQ(nullptr, fileLogger.getBufferedLogWriter());
+
+    FullyEnabledFileLogger defaultFileLogger(std::string("buffered_testfile"), DebugVariables{});
+    EXPECT_EQ(nullptr, defaultFileLogger.getBufferedLogWriter());
+}
+
 TEST(FileLogger, GivenSameFileNameWhenCreatingNewFullyDisabledLoggerThenOldFileIsNotRemoved) {
     std::string testFile = "testfile";
     DebugVariables flags;